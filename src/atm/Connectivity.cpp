@@ -21,10 +21,26 @@
 #include "Model.h"
 #include "EquationSet.h"
 
+#include <cstring>
+
 ///////////////////////////////////////////////////////////////////////////////
 // ExchangeBuffer
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		Number of double-sized buffer rows occupied by nValues values of
+///		type T, so that each packed block starts on a double boundary.
+///	</summary>
+template <typename T>
+static inline int BufferRows(
+	int nValues
+) {
+	return static_cast<int>(
+		(nValues * sizeof(T) + sizeof(double) - 1) / sizeof(double));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void ExchangeBuffer::Reset() {
 	if (m_dSendBuffer.GetByteSize() < sizeof(MessageHeader)) {
 		_EXCEPTION1("Invalid ExchangeBuffer send buffer (%i)",
@@ -42,344 +58,283 @@ void ExchangeBuffer::Reset() {
 	m_ixSendBuffer = sizeof(MessageHeader) / sizeof(double);
 }
 
-///////////////////////////////////////////////////////////////////////////////
-
-void ExchangeBuffer::Pack(
-	const DataArray3D<double> & data
-) {
-	const size_t sRElements = data.GetSize(0);
-	const size_t sAElements = data.GetSize(1);
-	const size_t sBElements = data.GetSize(2);
-
-	// Check matrix bounds
-	if (((m_dir == Direction_Right) || (m_dir == Direction_Left)) &&
-		(m_ixSecond > sBElements)
-	) {
-		_EXCEPTIONT("GridData / ExteriorNeighbor inconsistency.");
-	}
-	if (((m_dir == Direction_Top) || (m_dir == Direction_Bottom)) &&
-		(m_ixSecond > sAElements)
-	) {
-		_EXCEPTIONT("GridData / ExteriorNeighbor inconsistency.");
-	}
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	// Index for halo elements along boundary
-	int ixBoundaryBegin;
-	int ixBoundaryEnd;
+void ExchangeBuffer::GetPackSpan(
+	size_t sAElements,
+	size_t sBElements,
+	HaloSpan & span
+) const {
+	const int nHalo = static_cast<int>(m_sHaloElements);
 
-	int ixABoundaryBegin;
-	int ixABoundaryEnd;
-	int ixBBoundaryBegin;
-	int ixBBoundaryEnd;
+	// Nodes along the boundary, in the order expected by the receiver
+	const int ixAlongBegin = (m_fReverseDirection)?(m_ixSecond-1):(m_ixFirst);
+	const int ixAlongStep = (m_fReverseDirection)?(-1):(1);
 
-	// Maximum index for radial elements
-	int nVarRElements;
+	span.iOuterStep = 0;
+	span.jOuterStep = 0;
+	span.iInnerStep = 0;
+	span.jInnerStep = 0;
 
 	// Pack data to send right
 	if (m_dir == Direction_Right) {
-		ixBoundaryBegin = sAElements - 2 * m_sHaloElements;
-		ixBoundaryEnd   = sAElements - m_sHaloElements;
+		span.nOuter = nHalo;
+		span.nInner = m_ixSecond - m_ixFirst;
+		span.iBegin = static_cast<int>(sAElements) - 2 * nHalo;
+		span.jBegin = ixAlongBegin;
+		span.iOuterStep = 1;
+		span.jInnerStep = ixAlongStep;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
+	// Pack data to send topward
+	} else if (m_dir == Direction_Top) {
+		span.nOuter = nHalo;
+		span.nInner = m_ixSecond - m_ixFirst;
+		span.iBegin = ixAlongBegin;
+		span.jBegin = static_cast<int>(sBElements) - 2 * nHalo;
+		span.jOuterStep = 1;
+		span.iInnerStep = ixAlongStep;
 
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
+	// Pack data to send left
+	} else if (m_dir == Direction_Left) {
+		span.nOuter = nHalo;
+		span.nInner = m_ixSecond - m_ixFirst;
+		span.iBegin = 2 * nHalo - 1;
+		span.jBegin = ixAlongBegin;
+		span.iOuterStep = -1;
+		span.jInnerStep = ixAlongStep;
 
-		// Pack the SendBuffer
+	// Pack data to send bottomward
+	} else if (m_dir == Direction_Bottom) {
+		span.nOuter = nHalo;
+		span.nInner = m_ixSecond - m_ixFirst;
+		span.iBegin = ixAlongBegin;
+		span.jBegin = 2 * nHalo - 1;
+		span.jOuterStep = -1;
+		span.iInnerStep = ixAlongStep;
+
+	// Pack data to send toprightward
+	} else if (m_dir == Direction_TopRight) {
+		span.nOuter = nHalo;
+		span.nInner = nHalo;
+		span.iBegin = m_ixFirst - nHalo + 1;
+		span.jBegin = m_ixSecond - nHalo + 1;
 		if (m_fReverseDirection) {
-			for (int k = 0; k < sRElements; k++) {
-			for (int i = ixBoundaryBegin; i < ixBoundaryEnd; i++) {
-			for (int j = m_ixSecond-1; j >= m_ixFirst; j--) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
-
+			span.iOuterStep = 1;
+			span.jInnerStep = 1;
 		} else {
-			for (int k = 0; k < sRElements; k++) {
-			for (int i = ixBoundaryBegin; i < ixBoundaryEnd; i++) {
-			for (int j = m_ixFirst; j < m_ixSecond; j++) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];	
-			}
-			}
-			}
+			span.jOuterStep = 1;
+			span.iInnerStep = 1;
 		}
-	
-	// Pack data to send topward
-	} else if (m_dir == Direction_Top) {
-		ixBoundaryBegin = sBElements - 2 * m_sHaloElements;
-		ixBoundaryEnd   = sBElements - m_sHaloElements;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
-
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
+	// Pack data to send topleftward
+	} else if (m_dir == Direction_TopLeft) {
+		span.nOuter = nHalo;
+		span.nInner = nHalo;
+		span.iBegin = m_ixFirst + nHalo - 1;
+		span.jBegin = m_ixSecond - nHalo + 1;
+		if (m_fReverseDirection) {
+			span.iOuterStep = -1;
+			span.jInnerStep = 1;
+		} else {
+			span.jOuterStep = 1;
+			span.iInnerStep = -1;
 		}
 
-		// Pack the SendBuffer
+	// Pack data to send bottomleftward
+	} else if (m_dir == Direction_BottomLeft) {
+		span.nOuter = nHalo;
+		span.nInner = nHalo;
+		span.iBegin = m_ixFirst + nHalo - 1;
+		span.jBegin = m_ixSecond + nHalo - 1;
 		if (m_fReverseDirection) {
-			for (int k = 0; k < sRElements; k++) {
-			for (int j = ixBoundaryBegin; j < ixBoundaryEnd; j++) {
-			for (int i = m_ixSecond-1; i >= m_ixFirst; i--) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
+			span.iOuterStep = -1;
+			span.jInnerStep = -1;
+		} else {
+			span.jOuterStep = -1;
+			span.iInnerStep = -1;
+		}
 
+	// Pack data to send bottomrightward
+	} else if (m_dir == Direction_BottomRight) {
+		span.nOuter = nHalo;
+		span.nInner = nHalo;
+		span.iBegin = m_ixFirst - nHalo + 1;
+		span.jBegin = m_ixSecond + nHalo - 1;
+		if (m_fReverseDirection) {
+			span.iOuterStep = 1;
+			span.jInnerStep = -1;
 		} else {
-			for (int k = 0; k < sRElements; k++) {
-			for (int j = ixBoundaryBegin; j < ixBoundaryEnd; j++) {
-			for (int i = m_ixFirst; i < m_ixSecond; i++) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
+			span.jOuterStep = -1;
+			span.iInnerStep = 1;
 		}
 
-	// Pack data to send left
-	} else if (m_dir == Direction_Left) {
-		ixBoundaryBegin = m_sHaloElements;
-		ixBoundaryEnd   = 2 * m_sHaloElements;
+	// Invalid direction
+	} else {
+		_EXCEPTIONT("Invalid direction");
+	}
+}
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
+///////////////////////////////////////////////////////////////////////////////
 
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
+void ExchangeBuffer::GetUnpackSpan(
+	size_t sAElements,
+	size_t sBElements,
+	HaloSpan & span
+) const {
+	const int nHalo = static_cast<int>(m_sHaloElements);
 
-		// Pack the SendBuffer
-		if (m_fReverseDirection) {
-			for (int k = 0; k < sRElements; k++) {
-			for (int i = ixBoundaryEnd-1; i >= ixBoundaryBegin; i--) {
-			for (int j = m_ixSecond-1; j >= m_ixFirst; j--) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
+	span.iOuterStep = 0;
+	span.jOuterStep = 0;
+	span.iInnerStep = 0;
+	span.jInnerStep = 0;
 
-		} else {
-			for (int k = 0; k < sRElements; k++) {
-			for (int i = ixBoundaryEnd-1; i >= ixBoundaryBegin; i--) {
-			for (int j = m_ixFirst; j < m_ixSecond; j++) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
-		}
+	// Unpack data from right
+	if (m_dir == Direction_Right) {
+		span.nOuter = nHalo;
+		span.nInner = m_ixSecond - m_ixFirst;
+		span.iBegin = static_cast<int>(sAElements) - 1;
+		span.jBegin = m_ixFirst;
+		span.iOuterStep = -1;
+		span.jInnerStep = 1;
 
-	// Pack data to send bottomward
-	} else if (m_dir == Direction_Bottom) {
-		ixBoundaryBegin = m_sHaloElements;
-		ixBoundaryEnd   = 2 * m_sHaloElements;
+	// Unpack data from top
+	} else if (m_dir == Direction_Top) {
+		span.nOuter = nHalo;
+		span.nInner = m_ixSecond - m_ixFirst;
+		span.iBegin = m_ixFirst;
+		span.jBegin = static_cast<int>(sBElements) - 1;
+		span.jOuterStep = -1;
+		span.iInnerStep = 1;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
+	// Unpack data from left
+	} else if (m_dir == Direction_Left) {
+		span.nOuter = nHalo;
+		span.nInner = m_ixSecond - m_ixFirst;
+		span.iBegin = 0;
+		span.jBegin = m_ixFirst;
+		span.iOuterStep = 1;
+		span.jInnerStep = 1;
 
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
+	// Unpack data from bottom
+	} else if (m_dir == Direction_Bottom) {
+		span.nOuter = nHalo;
+		span.nInner = m_ixSecond - m_ixFirst;
+		span.iBegin = m_ixFirst;
+		span.jBegin = 0;
+		span.jOuterStep = 1;
+		span.iInnerStep = 1;
 
-		// Pack the SendBuffer
-		if (m_fReverseDirection) {
-			for (int k = 0; k < sRElements; k++) {
-			for (int j = ixBoundaryEnd-1; j >= ixBoundaryBegin; j--) {
-			for (int i = m_ixSecond-1; i >= m_ixFirst; i--) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
+	// Unpack data from top-right
+	} else if (m_dir == Direction_TopRight) {
+		span.nOuter = nHalo;
+		span.nInner = nHalo;
+		span.iBegin = m_ixFirst + nHalo;
+		span.jBegin = m_ixSecond + nHalo;
+		span.jOuterStep = -1;
+		span.iInnerStep = -1;
 
-		} else {
-			for (int k = 0; k < sRElements; k++) {
-			for (int j = ixBoundaryEnd-1; j >= ixBoundaryBegin; j--) {
-			for (int i = m_ixFirst; i < m_ixSecond; i++) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
-		}
+	// Unpack data from top-left
+	} else if (m_dir == Direction_TopLeft) {
+		span.nOuter = nHalo;
+		span.nInner = nHalo;
+		span.iBegin = m_ixFirst - nHalo;
+		span.jBegin = m_ixSecond + nHalo;
+		span.jOuterStep = -1;
+		span.iInnerStep = 1;
 
-	// Pack data to send toprightward 
-	} else if (m_dir == Direction_TopRight) {
-		ixABoundaryBegin = m_ixFirst - m_sHaloElements + 1;
-		ixABoundaryEnd   = m_ixFirst + 1;
-		ixBBoundaryBegin = m_ixSecond - m_sHaloElements + 1;
-		ixBBoundaryEnd   = m_ixSecond + 1;
- 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
-
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
+	// Unpack data from bottom-left
+	} else if (m_dir == Direction_BottomLeft) {
+		span.nOuter = nHalo;
+		span.nInner = nHalo;
+		span.iBegin = m_ixFirst - nHalo;
+		span.jBegin = m_ixSecond - nHalo;
+		span.jOuterStep = 1;
+		span.iInnerStep = 1;
 
-		// Pack the SendBuffer
-		if (m_fReverseDirection) {
-			for (int k = 0; k < sRElements; k++) {
-			for (int i = ixABoundaryBegin; i < ixABoundaryEnd; i++) {
-			for (int j = ixBBoundaryBegin; j < ixBBoundaryEnd; j++) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
+	// Unpack data from bottom-right
+	} else if (m_dir == Direction_BottomRight) {
+		span.nOuter = nHalo;
+		span.nInner = nHalo;
+		span.iBegin = m_ixFirst + nHalo;
+		span.jBegin = m_ixSecond - nHalo;
+		span.jOuterStep = 1;
+		span.iInnerStep = -1;
 
-		} else {
-			for (int k = 0; k < sRElements; k++) {
-			for (int j = ixBBoundaryBegin; j < ixBBoundaryEnd; j++) {
-			for (int i = ixABoundaryBegin; i < ixABoundaryEnd; i++) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
-		}
+	// Invalid direction
+	} else {
+		_EXCEPTIONT("Invalid direction");
+	}
+}
 
-	// Pack data to send topleftward 
-	} else if (m_dir == Direction_TopLeft) {
-		ixABoundaryBegin = m_ixFirst;
-		ixABoundaryEnd   = m_ixFirst + m_sHaloElements;
-		ixBBoundaryBegin = m_ixSecond - m_sHaloElements + 1;
-		ixBBoundaryEnd   = m_ixSecond + 1;
- 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
-
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
+///////////////////////////////////////////////////////////////////////////////
 
-		// Pack the SendBuffer
-		if (m_fReverseDirection) {
-			for (int k = 0; k < sRElements; k++) {
-			for (int i = ixABoundaryEnd-1; i >= ixABoundaryBegin; i--) {
-			for (int j = ixBBoundaryBegin; j < ixBBoundaryEnd; j++) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
+template <typename T>
+void ExchangeBuffer::Pack(
+	const DataArray3D<T> & data
+) {
+	const size_t sRElements = data.GetSize(0);
+	const size_t sAElements = data.GetSize(1);
+	const size_t sBElements = data.GetSize(2);
 
-		} else {
-			for (int k = 0; k < sRElements; k++) {
-			for (int j = ixBBoundaryBegin; j < ixBBoundaryEnd; j++) {
-			for (int i = ixABoundaryEnd-1; i >= ixABoundaryBegin; i--) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
-		}
+	// Check matrix bounds
+	if (((m_dir == Direction_Right) || (m_dir == Direction_Left)) &&
+		(m_ixSecond > sBElements)
+	) {
+		_EXCEPTIONT("GridData / ExteriorNeighbor inconsistency.");
+	}
+	if (((m_dir == Direction_Top) || (m_dir == Direction_Bottom)) &&
+		(m_ixSecond > sAElements)
+	) {
+		_EXCEPTIONT("GridData / ExteriorNeighbor inconsistency.");
+	}
 
-	// Pack data to send bottomleftward 
-	} else if (m_dir == Direction_BottomLeft) {
-		ixABoundaryBegin = m_ixFirst;
-		ixABoundaryEnd   = m_ixFirst + m_sHaloElements;
-		ixBBoundaryBegin = m_ixSecond;
-		ixBBoundaryEnd   = m_ixSecond + m_sHaloElements;
- 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
-
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
+	HaloSpan span;
+	GetPackSpan(sAElements, sBElements, span);
 
-		// Pack the SendBuffer
-		if (m_fReverseDirection) {
-			for (int k = 0; k < sRElements; k++) {
-			for (int i = ixABoundaryEnd-1; i >= ixABoundaryBegin; i--) {
-			for (int j = ixBBoundaryEnd-1; j >= ixBBoundaryBegin; j--) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
+	// Check that sufficient data remains in send buffer
+	int nTotalValues = sRElements * span.nOuter * span.nInner;
 
-		} else {
-			for (int k = 0; k < sRElements; k++) {
-			for (int j = ixBBoundaryEnd-1; j >= ixBBoundaryBegin; j--) {
-			for (int i = ixABoundaryEnd-1; i >= ixABoundaryBegin; i--) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
-		}
+	if (m_ixSendBuffer + BufferRows<T>(nTotalValues)
+	    > m_dSendBuffer.GetRows()
+	) {
+		_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
+	}
 
-	// Pack data to send bottomrightward 
-	} else if (m_dir == Direction_BottomRight) {
-		ixABoundaryBegin = m_ixFirst - m_sHaloElements + 1;
-		ixABoundaryEnd   = m_ixFirst + 1;
-		ixBBoundaryBegin = m_ixSecond;
-		ixBBoundaryEnd   = m_ixSecond + m_sHaloElements;
- 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
-
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
+	// Values of type T are packed from the current send index; the send
+	// index is advanced to the next double boundary once packing is done
+	T * pSendBuffer =
+		reinterpret_cast<T *>(&(m_dSendBuffer[0]) + m_ixSendBuffer);
 
-		// Pack the SendBuffer
-		if (m_fReverseDirection) {
-			for (int k = 0; k < sRElements; k++) {
-			for (int i = ixABoundaryBegin; i < ixABoundaryEnd; i++) {
-			for (int j = ixBBoundaryEnd-1; j >= ixBBoundaryBegin; j--) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
+	int ixPacked = 0;
 
-		} else {
-			for (int k = 0; k < sRElements; k++) {
-			for (int j = ixBBoundaryEnd-1; j >= ixBBoundaryBegin; j--) {
-			for (int i = ixABoundaryBegin; i < ixABoundaryEnd; i++) {
-				m_dSendBuffer[m_ixSendBuffer++] = data[k][i][j];
-			}
-			}
-			}
-		}
+	for (int k = 0; k < sRElements; k++) {
+	for (int o = 0; o < span.nOuter; o++) {
+		int i = span.iBegin + o * span.iOuterStep;
+		int j = span.jBegin + o * span.jOuterStep;
 
-	// Invalid direction
-	} else {
-		_EXCEPTIONT("Invalid direction");
+		for (int n = 0; n < span.nInner; n++) {
+			pSendBuffer[ixPacked++] = data[k][i][j];
+			i += span.iInnerStep;
+			j += span.jInnerStep;
+		}
+	}
 	}
+
+	m_ixSendBuffer += BufferRows<T>(ixPacked);
 }
 
-///////////////////////////////////////////////////////////////////////////////
+///////////////
 
+template <typename T>
 void ExchangeBuffer::Pack(
 	const Grid & grid,
-	const DataArray4D<double> & data
+	const DataArray4D<T> & data
 ) {
 	// Number of components in data
 	size_t sComponents = data.GetSize(0);
 
 	// 3D Grid Data
-	DataArray3D<double> data3D;
+	DataArray3D<T> data3D;
 	data3D.SetSize(
 		data.GetSize(1),
 		data.GetSize(2),
@@ -393,7 +348,8 @@ void ExchangeBuffer::Pack(
 			if (grid.GetVarLocation(c) != data.GetDataLocation()) {
 				continue;
 			}
-			data3D.AttachToData(const_cast<double*>(&(data[c][0][0][0])));
+			data3D.SetColumnLayout(data.IsColumnLayout());
+			data3D.AttachToData(const_cast<T*>(&(data[c][0][0][0])));
 			Pack(data3D);
 			data3D.Detach();
 		}
@@ -401,276 +357,236 @@ void ExchangeBuffer::Pack(
 	// Send everything
 	} else {
 		for (int c = 0; c < sComponents; c++) {
-			data3D.AttachToData(const_cast<double*>(&(data[c][0][0][0])));
+			data3D.SetColumnLayout(data.IsColumnLayout());
+			data3D.AttachToData(const_cast<T*>(&(data[c][0][0][0])));
 			Pack(data3D);
 			data3D.Detach();
 		}
 	}
 }
 
-///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+template <typename T>
 void ExchangeBuffer::Unpack(
-	DataArray3D<double> & data
+	DataArray3D<T> & data
 ) {
 	const size_t sRElements = data.GetSize(0);
 	const size_t sAElements = data.GetSize(1);
 	const size_t sBElements = data.GetSize(2);
 
-	// Index for halo elements along boundary
-	int ixBoundaryBegin;
-	int ixBoundaryEnd;
+	HaloSpan span;
+	GetUnpackSpan(sAElements, sBElements, span);
 
-	int ixABoundaryBegin;
-	int ixABoundaryEnd;
+	// Check that sufficient data remains in receive buffer
+	int nTotalValues = sRElements * span.nOuter * span.nInner;
 
-	int ixBBoundaryBegin;
-	int ixBBoundaryEnd;
+	if (m_ixRecvBuffer + BufferRows<T>(nTotalValues)
+	    > m_dRecvBuffer.GetRows()
+	) {
+		_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
+	}
 
-	// Unpack data from right
-	if (m_dir == Direction_Right) {
-		ixBoundaryBegin = sAElements - m_sHaloElements;
-		ixBoundaryEnd   = sAElements;
+	// Values of type T are unpacked from the current receive index, which
+	// is advanced to the next double boundary once unpacking is done
+	const T * pRecvBuffer =
+		reinterpret_cast<const T *>(&(m_dRecvBuffer[0]) + m_ixRecvBuffer);
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
+	int ixUnpacked = 0;
 
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
+	for (int k = 0; k < sRElements; k++) {
+	for (int o = 0; o < span.nOuter; o++) {
+		int i = span.iBegin + o * span.iOuterStep;
+		int j = span.jBegin + o * span.jOuterStep;
 
-		// Unpack data
-		for (int k = 0; k < sRElements; k++) {
-		for (int i = ixBoundaryEnd-1; i >= ixBoundaryBegin; i--) {
-		for (int j = m_ixFirst; j < m_ixSecond; j++) {
-			data[k][i][j] = m_dRecvBuffer[m_ixRecvBuffer++];
-		}
+		for (int n = 0; n < span.nInner; n++) {
+			data[k][i][j] = pRecvBuffer[ixUnpacked++];
+			i += span.iInnerStep;
+			j += span.jInnerStep;
 		}
-		}
-
-	// Unpack data from top
-	} else if (m_dir == Direction_Top) {
-		ixBoundaryBegin = sBElements - m_sHaloElements;
-		ixBoundaryEnd   = sBElements;
-
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
+	}
+	}
 
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
+	m_ixRecvBuffer += BufferRows<T>(ixUnpacked);
+}
 
-		// Unpack data
-		for (int k = 0; k < sRElements; k++) {
-		for (int j = ixBoundaryEnd-1; j >= ixBoundaryBegin; j--) {
-		for (int i = m_ixFirst; i < m_ixSecond; i++) {
-			data[k][i][j] = m_dRecvBuffer[m_ixRecvBuffer++];
-		}
-		}
-		}
+///////////////
 
-	// Unpack data from left
-	} else if (m_dir == Direction_Left) {
-		ixBoundaryBegin = 0;
-		ixBoundaryEnd   = m_sHaloElements;
+template <typename T>
+void ExchangeBuffer::Unpack(
+	const Grid & grid,
+	DataArray4D<T> & data
+) {
+	// Number of components in data
+	size_t sComponents = data.GetSize(0);
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
+	// 3D Grid Data
+	DataArray3D<T> data3D;
+	data3D.SetSize(
+		data.GetSize(1),
+		data.GetSize(2),
+		data.GetSize(3));
 
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
+	// List of variable indices to receive
+	// - exclude variables which are not-collocated with this data structure
+	if (data.GetDataType() == DataType_State) {
+		for (int c = 0; c < sComponents; c++) {
+			if (grid.GetVarLocation(c) != data.GetDataLocation()) {
+				continue;
+			}
+			data3D.SetColumnLayout(data.IsColumnLayout());
+			data3D.AttachToData(&(data[c][0][0][0]));
+			Unpack(data3D);
+			data3D.Detach();
 		}
 
-		// Unpack data
-		for (int k = 0; k < sRElements; k++) {
-		for (int i = ixBoundaryBegin; i < ixBoundaryEnd; i++) {
-		for (int j = m_ixFirst; j < m_ixSecond; j++) {
-			data[k][i][j] = m_dRecvBuffer[m_ixRecvBuffer++];
-		}
-		}
+	// Unpack all variables
+	} else {
+		for (int c = 0; c < sComponents; c++) {
+			data3D.SetColumnLayout(data.IsColumnLayout());
+			data3D.AttachToData(&(data[c][0][0][0]));
+			Unpack(data3D);
+			data3D.Detach();
 		}
+	}
+}
 
-	// Unpack data from bottom
-	} else if (m_dir == Direction_Bottom) {
-		ixBoundaryBegin = 0;
-		ixBoundaryEnd   = m_sHaloElements;
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
+template <typename T>
+void ExchangeBuffer::CopyFromPartner(
+	const DataArray3D<T> & dataPartner,
+	DataArray3D<T> & data
+) const {
+	if (m_pLocalPartner == NULL) {
+		_EXCEPTIONT("ExchangeBuffer has no local partner");
+	}
 
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
+	const size_t sRElements = data.GetSize(0);
 
-		// Unpack data
-		for (int k = 0; k < sRElements; k++) {
-		for (int j = ixBoundaryBegin; j < ixBoundaryEnd; j++) {
-		for (int i = m_ixFirst; i < m_ixSecond; i++) {
-			data[k][i][j] = m_dRecvBuffer[m_ixRecvBuffer++];
-		}
-		}
-		}
+	if (dataPartner.GetSize(0) != sRElements) {
+		_EXCEPTIONT("Local ExchangeBuffer radial size mismatch");
+	}
 
-	// Unpack data from top-right
-	} else if (m_dir == Direction_TopRight) {
-		ixABoundaryBegin = m_ixFirst + 1;
-		ixABoundaryEnd   = m_ixFirst + m_sHaloElements + 1;
-		ixBBoundaryBegin = m_ixSecond + 1;
-		ixBBoundaryEnd   = m_ixSecond + m_sHaloElements + 1;
-
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
-
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
+	// Nodes are matched in the order in which they would pass through
+	// the buffers
+	HaloSpan spanSource;
+	m_pLocalPartner->GetPackSpan(
+		dataPartner.GetSize(1),
+		dataPartner.GetSize(2),
+		spanSource);
 
-		// Unpack data
-		for (int k = 0; k < sRElements; k++) {
-		for (int j = ixBBoundaryEnd-1; j >= ixBBoundaryBegin; j--) {
-		for (int i = ixABoundaryEnd-1; i >= ixABoundaryBegin; i--) {
-			data[k][i][j] = m_dRecvBuffer[m_ixRecvBuffer++];
-		}
-		}
-		}
+	HaloSpan spanTarget;
+	GetUnpackSpan(
+		data.GetSize(1),
+		data.GetSize(2),
+		spanTarget);
 
-	// Unpack data from top-left
-	} else if (m_dir == Direction_TopLeft) {
-		ixABoundaryBegin = m_ixFirst - m_sHaloElements;
-		ixABoundaryEnd   = m_ixFirst;
-		ixBBoundaryBegin = m_ixSecond + 1;
-		ixBBoundaryEnd   = m_ixSecond + m_sHaloElements + 1;
-
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
-
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
+	if ((spanSource.nOuter != spanTarget.nOuter) ||
+	    (spanSource.nInner != spanTarget.nInner)
+	) {
+		_EXCEPTIONT("Local ExchangeBuffer size mismatch");
+	}
 
-		// Unpack data
-		for (int k = 0; k < sRElements; k++) {
-		for (int j = ixBBoundaryEnd-1; j >= ixBBoundaryBegin; j--) {
-		for (int i = ixABoundaryBegin; i < ixABoundaryEnd; i++) {
-			data[k][i][j] = m_dRecvBuffer[m_ixRecvBuffer++];
-		}
-		}
-		}
+	for (int k = 0; k < sRElements; k++) {
+	for (int o = 0; o < spanTarget.nOuter; o++) {
+		int iSource = spanSource.iBegin + o * spanSource.iOuterStep;
+		int jSource = spanSource.jBegin + o * spanSource.jOuterStep;
 
-	// Unpack data from bottom-left
-	} else if (m_dir == Direction_BottomLeft) {
-		ixABoundaryBegin = m_ixFirst - m_sHaloElements;
-		ixABoundaryEnd   = m_ixFirst;
-		ixBBoundaryBegin = m_ixSecond - m_sHaloElements;
-		ixBBoundaryEnd   = m_ixSecond;
-
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
-
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
+		int i = spanTarget.iBegin + o * spanTarget.iOuterStep;
+		int j = spanTarget.jBegin + o * spanTarget.jOuterStep;
 
-		// Unpack data
-		for (int k = 0; k < sRElements; k++) {
-		for (int j = ixBBoundaryBegin; j < ixBBoundaryEnd; j++) {
-		for (int i = ixABoundaryBegin; i < ixABoundaryEnd; i++) {
-			data[k][i][j] = m_dRecvBuffer[m_ixRecvBuffer++];
-		}
-		}
-		}
+		for (int n = 0; n < spanTarget.nInner; n++) {
+			data[k][i][j] = dataPartner[k][iSource][jSource];
 
-	// Unpack data from bottom-right
-	} else if (m_dir == Direction_BottomRight) {
-		ixABoundaryBegin = m_ixFirst + 1;
-		ixABoundaryEnd   = m_ixFirst + m_sHaloElements + 1;
-		ixBBoundaryBegin = m_ixSecond - m_sHaloElements;
-		ixBBoundaryEnd   = m_ixSecond;
-
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
-
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
-
-		// Unpack data
-		for (int k = 0; k < sRElements; k++) {
-		for (int j = ixBBoundaryBegin; j < ixBBoundaryEnd; j++) {
-		for (int i = ixABoundaryEnd-1; i >= ixABoundaryBegin; i--) {
-			data[k][i][j] = m_dRecvBuffer[m_ixRecvBuffer++];
+			iSource += spanSource.iInnerStep;
+			jSource += spanSource.jInnerStep;
+			i += spanTarget.iInnerStep;
+			j += spanTarget.jInnerStep;
 		}
-		}
-		}
-
-	// Invalid direction
-	} else {
-		_EXCEPTIONT("Invalid direction");
+	}
 	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void ExchangeBuffer::Unpack(
+template <typename T>
+void ExchangeBuffer::CopyFromPartner(
 	const Grid & grid,
-	DataArray4D<double> & data
-) {
+	const DataArray4D<T> & dataPartner,
+	DataArray4D<T> & data
+) const {
 	// Number of components in data
 	size_t sComponents = data.GetSize(0);
 
 	// 3D Grid Data
-	DataArray3D<double> data3D;
+	DataArray3D<T> data3DPartner;
+	data3DPartner.SetSize(
+		dataPartner.GetSize(1),
+		dataPartner.GetSize(2),
+		dataPartner.GetSize(3));
+
+	DataArray3D<T> data3D;
 	data3D.SetSize(
 		data.GetSize(1),
 		data.GetSize(2),
 		data.GetSize(3));
 
-	// List of variable indices to receive
-	// - exclude variables which are not-collocated with this data structure
-	if (data.GetDataType() == DataType_State) {
-		for (int c = 0; c < sComponents; c++) {
-			if (grid.GetVarLocation(c) != data.GetDataLocation()) {
-				continue;
-			}
-			data3D.AttachToData(&(data[c][0][0][0]));
-			Unpack(data3D);
-			data3D.Detach();
-		}
+	for (int c = 0; c < sComponents; c++) {
 
-	// Unpack all variables
-	} else {
-		for (int c = 0; c < sComponents; c++) {
-			data3D.AttachToData(&(data[c][0][0][0]));
-			Unpack(data3D);
-			data3D.Detach();
+		// For state data exclude non-collocated data points
+		if ((data.GetDataType() == DataType_State) &&
+		    (grid.GetVarLocation(c) != data.GetDataLocation())
+		) {
+			continue;
 		}
+
+		data3DPartner.SetColumnLayout(dataPartner.IsColumnLayout());
+		data3DPartner.AttachToData(
+			const_cast<T*>(&(dataPartner[c][0][0][0])));
+
+		data3D.SetColumnLayout(data.IsColumnLayout());
+		data3D.AttachToData(&(data[c][0][0][0]));
+
+		CopyFromPartner(data3DPartner, data3D);
+
+		data3DPartner.Detach();
+		data3D.Detach();
 	}
 }
 
+///////////////
+
+template void ExchangeBuffer::Pack<double>(
+	const DataArray3D<double> & data);
+template void ExchangeBuffer::Pack<double>(
+	const Grid & grid, const DataArray4D<double> & data);
+template void ExchangeBuffer::Unpack<double>(
+	DataArray3D<double> & data);
+template void ExchangeBuffer::Unpack<double>(
+	const Grid & grid, DataArray4D<double> & data);
+template void ExchangeBuffer::CopyFromPartner<double>(
+	const DataArray3D<double> & dataPartner,
+	DataArray3D<double> & data) const;
+template void ExchangeBuffer::CopyFromPartner<double>(
+	const Grid & grid, const DataArray4D<double> & dataPartner,
+	DataArray4D<double> & data) const;
+
+template void ExchangeBuffer::Pack<float>(
+	const DataArray3D<float> & data);
+template void ExchangeBuffer::Pack<float>(
+	const Grid & grid, const DataArray4D<float> & data);
+template void ExchangeBuffer::Unpack<float>(
+	DataArray3D<float> & data);
+template void ExchangeBuffer::Unpack<float>(
+	const Grid & grid, DataArray4D<float> & data);
+template void ExchangeBuffer::CopyFromPartner<float>(
+	const DataArray3D<float> & dataPartner,
+	DataArray3D<float> & data) const;
+template void ExchangeBuffer::CopyFromPartner<float>(
+	const Grid & grid, const DataArray4D<float> & dataPartner,
+	DataArray4D<float> & data) const;
+
 ///////////////////////////////////////////////////////////////////////////////
 // ExchangeBufferRegistry
 ///////////////////////////////////////////////////////////////////////////////
@@ -691,6 +607,7 @@ ExchangeBufferRegistry::~ExchangeBufferRegistry() {
 			delete[] m_vecSendBuffers[i];
 		}
 	}
+	m_memacct.Remove();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -716,10 +633,16 @@ void ExchangeBufferRegistry::Register(
 void ExchangeBufferRegistry::Allocate() {
 
 	// Allocate already called
-	if (m_vecProcessors.size() != 0) {
+	if ((m_vecProcessors.size() != 0) || (m_vecLocalRegistry.size() != 0)) {
 		_EXCEPTIONT("Allocate called on already allocated object");
 	}
 
+	// Rank of this processor
+	int nRank = 0;
+#ifdef TEMPEST_MPIOMP
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+#endif
+
 	// A map between processor index and exchange buffer size
 	std::map<int, int> mapProcessorToBufferSize;
 
@@ -733,6 +656,12 @@ void ExchangeBufferRegistry::Allocate() {
 				_EXCEPTIONT("Invalid processor for ExchangeBuffer");
 			}
 
+			// Exchanges between patches on this processor bypass MPI
+			if (m_vecRegistry[m].m_ixTargetProcessor == nRank) {
+				m_vecLocalRegistry.push_back(&(m_vecRegistry[m]));
+				continue;
+			}
+
 			std::map<int, int>::iterator iterProcs =
 				mapProcessorToBufferSize.find(
 					m_vecRegistry[m].m_ixTargetProcessor);
@@ -768,7 +697,6 @@ void ExchangeBufferRegistry::Allocate() {
 			m_vecBufferSize.push_back(iterProcs->second);
 			m_vecRecvBuffers.push_back(pRecvBuffer);
 			m_vecSendBuffers.push_back(pSendBuffer);
-			m_vecAreRecvBuffersAttached.push_back(false);
 		}
 	}
 
@@ -776,6 +704,10 @@ void ExchangeBufferRegistry::Allocate() {
 	{
 		m_vecRegistryByProcessor.resize(m_vecProcessors.size());
 		for (int m = 0; m < m_vecRegistry.size(); m++) {
+			if (m_vecRegistry[m].m_ixTargetProcessor == nRank) {
+				continue;
+			}
+
 			int p = 0;
 			for (; p < m_vecProcessors.size(); p++) {
 				const int ixTargetProcessor =
@@ -794,7 +726,7 @@ void ExchangeBufferRegistry::Allocate() {
 	}
 
 	// Assign space to send buffers for each ExchangeBuffer (receive
-	// buffers are attached when the first message arrives)
+	// buffers are attached as each message arrives)
 	{
 		std::vector<int> vecSendBufferPosition;
 		vecSendBufferPosition.resize(m_vecProcessors.size());
@@ -808,6 +740,10 @@ void ExchangeBufferRegistry::Allocate() {
 					"double boundaries");
 			}
 
+			if (m_vecRegistry[m].m_ixTargetProcessor == nRank) {
+				continue;
+			}
+
 			int p = 0;
 			for (; p < m_vecProcessors.size(); p++) {
 				int ixTargetProc = m_vecRegistry[m].m_ixTargetProcessor;
@@ -829,9 +765,50 @@ void ExchangeBufferRegistry::Allocate() {
 		}
 	}
 
+	// Pair each local ExchangeBuffer with the ExchangeBuffer in the
+	// opposing direction, whose source patch supplies its halo data
+	for (int m = 0; m < m_vecLocalRegistry.size(); m++) {
+		ExchangeBuffer * pExBuf = m_vecLocalRegistry[m];
+
+		ExchangeBuffer::MessageHeader exbufhead;
+		pExBuf->GetRecvMessageHeader(&exbufhead);
+
+		int n = 0;
+		for (; n < m_vecLocalRegistry.size(); n++) {
+			ExchangeBuffer * pPartner = m_vecLocalRegistry[n];
+
+			ExchangeBuffer::MessageHeader partnerhead;
+			pPartner->GetSendMessageHeader(&partnerhead);
+
+			if (partnerhead != exbufhead) {
+				continue;
+			}
+			if (pPartner->GetMessageSize() != pExBuf->GetMessageSize()) {
+				_EXCEPTIONT("Local ExchangeBuffer size mismatch");
+			}
+
+			pExBuf->m_pLocalPartner = pPartner;
+			break;
+		}
+		if (n == m_vecLocalRegistry.size()) {
+			_EXCEPTIONT("Corresponding local ExchangeBuffer not found");
+		}
+	}
+
+	// Record buffer storage in the MemoryAccounting table
+	{
+		size_t sBufferByteSize = 0;
+		for (int p = 0; p < m_vecBufferSize.size(); p++) {
+			sBufferByteSize += 2 * static_cast<size_t>(m_vecBufferSize[p]);
+		}
+
+		m_memacct.Add(sBufferByteSize,
+			GetMemoryAccounting().GetCategoryIndex("ExchangeBuffers"));
+	}
+
 	// Allocate number of receive and send requests
-	m_vecRecvRequest.resize(m_vecProcessors.size());
-	m_vecSendRequest.resize(m_vecProcessors.size());
+	m_vecRecvRequest.resize(m_vecProcessors.size(), MPI_REQUEST_NULL);
+	m_vecSendRequest.resize(m_vecProcessors.size(), MPI_REQUEST_NULL);
 
 	m_vecMessageReceived.resize(m_vecProcessors.size());
 }
@@ -840,9 +817,11 @@ void ExchangeBufferRegistry::Allocate() {
 
 void ExchangeBufferRegistry::PrepareExchange() {
 
-	// Reset all ExchangeBuffers
+	// Reset all ExchangeBuffers exchanged through MPI
 	for (int r = 0; r < m_vecRegistry.size(); r++) {
-		m_vecRegistry[r].Reset();
+		if (m_vecRegistry[r].m_pLocalPartner == NULL) {
+			m_vecRegistry[r].Reset();
+		}
 	}
 
 #ifdef TEMPEST_MPIOMP
@@ -850,7 +829,6 @@ void ExchangeBufferRegistry::PrepareExchange() {
 	for (int p = 0; p < m_vecProcessors.size(); p++) {
 		m_vecMessageReceived[p] = false;
 
-#pragma message "Check for Exchange between processors of the same rank"
 		MPI_Irecv(
 			m_vecRecvBuffers[p],
 			m_vecBufferSize[p],
@@ -877,9 +855,40 @@ void ExchangeBufferRegistry::Send() {
 
 #ifdef TEMPEST_MPIOMP
 	for (int p = 0; p < m_vecProcessors.size(); p++) {
+
+		// Move the packed part of each ExchangeBuffer to the front of the
+		// message; ExchangeBuffers are stored in the send buffer in the
+		// same order, so data is only ever moved towards the front
+		int iPosition = 0;
+
+		std::vector<ExchangeBuffer *> & vecExchangeBufs =
+			m_vecRegistryByProcessor[p];
+
+		for (int b = 0; b < vecExchangeBufs.size(); b++) {
+			ExchangeBuffer * pExBuf = vecExchangeBufs[b];
+
+			char * pPacked =
+				reinterpret_cast<char *>(&(pExBuf->m_dSendBuffer[0]));
+
+			int nPackedByteSize =
+				pExBuf->m_ixSendBuffer * static_cast<int>(sizeof(double));
+
+			reinterpret_cast<ExchangeBuffer::MessageHeader *>(pPacked)
+				->m_nByteSize = nPackedByteSize;
+
+			if (pPacked != m_vecSendBuffers[p] + iPosition) {
+				memmove(
+					m_vecSendBuffers[p] + iPosition,
+					pPacked,
+					nPackedByteSize);
+			}
+
+			iPosition += nPackedByteSize;
+		}
+
 		MPI_Isend(
 			m_vecSendBuffers[p],
-			m_vecBufferSize[p],
+			iPosition,
 			MPI_BYTE,
 			m_vecProcessors[p],
 			0,
@@ -891,7 +900,7 @@ void ExchangeBufferRegistry::Send() {
 		MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
 		printf("On %i sending %i bytes to %i\n",
 			nRank,
-			m_vecBufferSize[p],
+			iPosition,
 			m_vecProcessors[p]);
 */
 	}
@@ -900,7 +909,10 @@ void ExchangeBufferRegistry::Send() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void ExchangeBufferRegistry::AttachRecvBuffers(int p) {
+void ExchangeBufferRegistry::AttachRecvBuffers(
+	int p,
+	int nByteSize
+) {
 
 	// Find the array of ExchangeBuffers relevant to this processor
 	if ((p < 0) || (p >= m_vecRegistryByProcessor.size())) {
@@ -933,12 +945,22 @@ void ExchangeBufferRegistry::AttachRecvBuffers(int p) {
 				continue;
 			}
 
+			int nPackedByteSize = msghead->m_nByteSize;
+			if ((nPackedByteSize < sizeof(ExchangeBuffer::MessageHeader)) ||
+			    (nPackedByteSize > pExBuf->GetMessageSize()) ||
+			    (nPackedByteSize % sizeof(double) != 0)
+			) {
+				_EXCEPTION1("Invalid ExchangeBuffer size in message (%i)",
+					nPackedByteSize);
+			}
+
+			pExBuf->m_dRecvBuffer.Detach();
 			pExBuf->m_dRecvBuffer.SetSize(
-				pExBuf->GetMessageSize());
+				nPackedByteSize / sizeof(double));
 			pExBuf->m_dRecvBuffer.AttachToData(
 				m_vecRecvBuffers[p] + iPosition);
 
-			iPosition += pExBuf->GetMessageSize();
+			iPosition += nPackedByteSize;
 			msghead = (ExchangeBuffer::MessageHeader *)
 				(m_vecRecvBuffers[p] + iPosition);
 			break;
@@ -949,10 +971,10 @@ void ExchangeBufferRegistry::AttachRecvBuffers(int p) {
 
 		nProcExchangeBuffersAssigned++;
 
-		if (iPosition > m_vecBufferSize[p]) {
+		if (iPosition > nByteSize) {
 			_EXCEPTIONT("Message length does not match buffer size");
 		}
-		if (iPosition == m_vecBufferSize[p]) {
+		if (iPosition == nByteSize) {
 			break;
 		}
 	}
@@ -996,11 +1018,12 @@ const std::vector<ExchangeBuffer *> * ExchangeBufferRegistry::WaitReceive() {
 			MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
 			printf("Message received on proc %i from proc %i\n", nRank, m_vecProcessors[p]);
 */
-			// Attach Recv buffers
-			if (!m_vecAreRecvBuffersAttached[p]) {
-				AttachRecvBuffers(p);
-				m_vecAreRecvBuffersAttached[p] = true;
-			}
+			// Attach Recv buffers; the position of each ExchangeBuffer in
+			// the message depends on the data that was packed
+			int nByteSize;
+			MPI_Get_count(&status, MPI_BYTE, &nByteSize);
+
+			AttachRecvBuffers(p, nByteSize);
 
 			// Return the array of ExchangeBuffers that have been filled
 			return &(m_vecRegistryByProcessor[p]);
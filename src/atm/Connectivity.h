@@ -25,6 +25,8 @@
 #include "DataArray1D.h"
 #include "DataArray3D.h"
 #include "DataArray4D.h"
+#include "TracerArray.h"
+#include "MemoryTools.h"
 
 #ifdef TEMPEST_MPIOMP
 #include <mpi.h>
@@ -47,9 +49,6 @@ typedef int ExchangeBufferId;
 #ifdef TEMPEST_OCR
 typedef int ExchangeBufferId;
 #endif
-#ifdef TEMPEST_HPX
-typedef int ExchangeBufferId;
-#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -78,7 +77,9 @@ public:
 				m_ixReserved(0x01010101),
 				m_ixFirstPatch(-1),
 				m_ixSecondPatch(-1),
-				m_ixDirection(Direction_Middle)
+				m_ixDirection(Direction_Middle),
+				m_nByteSize(0),
+				m_nPadding(0)
 			{ }
 
 			///	<summary>
@@ -92,11 +93,14 @@ public:
 				m_ixReserved(0x01010101),
 				m_ixFirstPatch(ixFirstPatch),
 				m_ixSecondPatch(ixSecondPatch),
-				m_ixDirection(ixDirection)
+				m_ixDirection(ixDirection),
+				m_nByteSize(0),
+				m_nPadding(0)
 			{ }
 
 			///	<summary>
-			///		Equality comparator.
+			///		Equality comparator.  Only the fields identifying the
+			///		ExchangeBuffer are compared.
 			///	</summary>
 			bool operator==(const MessageHeader & msghead) const {
 				if ((m_ixReserved == msghead.m_ixReserved) &&
@@ -121,6 +125,17 @@ public:
 			int m_ixFirstPatch;
 			int m_ixSecondPatch;
 			int m_ixDirection;
+
+			///	<summary>
+			///		Number of bytes packed into the ExchangeBuffer, including
+			///		this header.  Set when the message is sent.
+			///	</summary>
+			int m_nByteSize;
+
+			///	<summary>
+			///		Padding to keep the header aligned at double boundaries.
+			///	</summary>
+			int m_nPadding;
 	};
 
 public:
@@ -137,25 +152,34 @@ public:
 		m_ixLocalActiveSourcePatch(-1),
 		m_sHaloElements(0),
 		m_sComponents(0),
+		m_sTracers(0),
 		m_sMaxRElements(0),
 		m_sBoundarySize(0),
 		m_sByteSize(0),
 		m_ixFirst(0),
 		m_ixSecond(0),
 		m_fReverseDirection(false),
-		m_fFlippedCoordinate(false)
+		m_fFlippedCoordinate(false),
+		m_pLocalPartner(NULL)
 	{ }
 
 public:
 	///	<summary>
-	///		Calculate total data size (in bytes).
+	///		Calculate total data size (in bytes).  Tracers are packed as
+	///		TracerReal, with each tracer padded to a double boundary.
 	///	</summary>
 	void CalculateByteSize() {
-		m_sByteSize =
+		size_t sValues =
 			  m_sBoundarySize
 			* m_sMaxRElements
-			* m_sHaloElements
-			* m_sComponents
+			* m_sHaloElements;
+
+		size_t sTracerRows =
+			(sValues * sizeof(TracerReal) + sizeof(double) - 1)
+			/ sizeof(double);
+
+		m_sByteSize =
+			  (sValues * m_sComponents + sTracerRows * m_sTracers)
 			* sizeof(double);
 	}
 
@@ -199,35 +223,102 @@ public:
 	void Reset();
 
 	///	<summary>
-	///		Pack DataArray3D into the send buffer.
+	///		Pack DataArray3D into the send buffer.  Data is packed in its
+	///		own precision and the block is padded to a double boundary.
 	///	</summary>
+	template <typename T>
 	void Pack(
-		const DataArray3D<double> & data
+		const DataArray3D<T> & data
 	);
 
 	///	<summary>
 	///		Pack DataArray4D into the send buffer.
 	///	</summary>
+	template <typename T>
 	void Pack(
 		const Grid & grid,
-		const DataArray4D<double> & data
+		const DataArray4D<T> & data
 	);
 
 	///	<summary>
 	///		Unpack receive buffer into the given DataArray3D.
 	///	</summary>
+	template <typename T>
 	void Unpack(
-		DataArray3D<double> & data
+		DataArray3D<T> & data
 	);
 
 	///	<summary>
 	///		Unpack receive buffer into the given DataArray4D.
 	///	</summary>
+	template <typename T>
 	void Unpack(
 		const Grid & grid,
-		DataArray4D<double> & data
+		DataArray4D<T> & data
 	);
 
+	///	<summary>
+	///		Copy the boundary data of dataPartner, which belongs to the
+	///		source patch of m_pLocalPartner, directly into the halo of the
+	///		given DataArray3D without passing through the buffers.
+	///	</summary>
+	template <typename T>
+	void CopyFromPartner(
+		const DataArray3D<T> & dataPartner,
+		DataArray3D<T> & data
+	) const;
+
+	///	<summary>
+	///		Copy the boundary data of dataPartner, which belongs to the
+	///		source patch of m_pLocalPartner, directly into the halo of the
+	///		given DataArray4D.
+	///	</summary>
+	template <typename T>
+	void CopyFromPartner(
+		const Grid & grid,
+		const DataArray4D<T> & dataPartner,
+		DataArray4D<T> & data
+	) const;
+
+protected:
+	///	<summary>
+	///		Nodes of a DataArray3D packed or unpacked by this ExchangeBuffer
+	///		in each radial level, in buffer order.  Node (o, n) with
+	///		0 <= o < nOuter and 0 <= n < nInner has indices
+	///		  i = iBegin + o * iOuterStep + n * iInnerStep
+	///		  j = jBegin + o * jOuterStep + n * jInnerStep
+	///	</summary>
+	struct HaloSpan {
+		int nOuter;
+		int nInner;
+		int iBegin;
+		int jBegin;
+		int iOuterStep;
+		int jOuterStep;
+		int iInnerStep;
+		int jInnerStep;
+	};
+
+	///	<summary>
+	///		Get the nodes packed from a DataArray3D with sAElements and
+	///		sBElements nodes in the alpha and beta directions.
+	///	</summary>
+	void GetPackSpan(
+		size_t sAElements,
+		size_t sBElements,
+		HaloSpan & span
+	) const;
+
+	///	<summary>
+	///		Get the nodes unpacked into a DataArray3D with sAElements and
+	///		sBElements nodes in the alpha and beta directions.
+	///	</summary>
+	void GetUnpackSpan(
+		size_t sAElements,
+		size_t sBElements,
+		HaloSpan & span
+	) const;
+
 public:
 	///	<summary>
 	///		Unique global id of this exchange buffer.
@@ -279,6 +370,11 @@ public:
 	///	</summary>
 	size_t m_sComponents;
 
+	///	<summary>
+	///		Number of tracers.
+	///	</summary>
+	size_t m_sTracers;
+
 	///	<summary>
 	///		Number of radial elements.
 	///	</summary>
@@ -317,6 +413,13 @@ public:
 	///	</summary>
 	bool m_fFlippedCoordinate;
 
+	///	<summary>
+	///		If the source and target patches are both on this processor, the
+	///		ExchangeBuffer in the opposing direction, whose source patch
+	///		supplies the halo of this ExchangeBuffer's source patch.
+	///	</summary>
+	ExchangeBuffer * m_pLocalPartner;
+
 protected:
 	///	<summary>
 	///		Current RecvBuffer.
@@ -372,6 +475,16 @@ public:
 		return m_vecRegistry;
 	}
 
+	///	<summary>
+	///		Get the vector of ExchangeBuffers whose source and target
+	///		patches are both on this processor.  These have no buffers and
+	///		are not exchanged through MPI; halo data is copied directly from
+	///		the source patch of m_pLocalPartner.
+	///	</summary>
+	const std::vector<ExchangeBuffer *> & GetLocalExchangeBuffers() const {
+		return m_vecLocalRegistry;
+	}
+
 	///	<summary>
 	///		Allocate ExchangeBuffer storage.
 	///	</summary>
@@ -383,15 +496,17 @@ public:
 	void PrepareExchange();
 
 	///	<summary>
-	///		Set up asynchronous sends.
+	///		Set up asynchronous sends.  The packed part of each
+	///		ExchangeBuffer is compacted so that only packed data is sent.
 	///	</summary>
 	void Send();
 
 protected:
 	///	<summary>
-	///		Attach RecvBuffers based on a received message.
+	///		Attach RecvBuffers based on a received message of nByteSize
+	///		bytes.
 	///	</summary>
-	void AttachRecvBuffers(int ixProc);
+	void AttachRecvBuffers(int ixProc, int nByteSize);
 
 public:
 	///	<summary>
@@ -409,19 +524,14 @@ public:
 	void WaitSend();
 
 protected:
-	///	<summary>
-	///		Flag indicating that ExchangeBuffer RecvBuffers have not yet been
-	///		attached to data.
-	///	</summary>
-	std::vector<bool> m_vecAreRecvBuffersAttached;
-
 	///	<summary>
 	///		Vector of ExchangeBuffers.
 	///	</summary>
 	std::vector<ExchangeBuffer> m_vecRegistry;
 
 	///	<summary>
-	///		Buffer size for each processor.
+	///		Buffer size for each processor, sufficient for every
+	///		ExchangeBuffer to be fully packed.
 	///	</summary>
 	std::vector<int> m_vecBufferSize;
 
@@ -440,6 +550,16 @@ protected:
 	///	</summary>
 	std::vector<char *> m_vecSendBuffers;
 
+	///	<summary>
+	///		Vector of pointers to ExchangeBuffers with a local target.
+	///	</summary>
+	std::vector<ExchangeBuffer *> m_vecLocalRegistry;
+
+	///	<summary>
+	///		Record of the buffer storage in the MemoryAccounting table.
+	///	</summary>
+	MemoryAccountingEntry m_memacct;
+
 	///	<summary>
 	///		Vector of MPI_Requests.
 	///	</summary>
@@ -40,6 +40,12 @@
 //#define USE_JACOBIAN_GENERAL
 #define USE_JACOBIAN_DIAGONAL
 
+///	<summary>
+///		Factor diagonal Jacobians of several columns at once using
+///		BatchedBandedLU (requires USE_DIRECTSOLVE and USE_JACOBIAN_DIAGONAL).
+///	</summary>
+#define USE_JACOBIAN_BATCHED
+
 ///	<summary>
 ///		Thermodynamic closure to use.
 ///	</summary>
@@ -0,0 +1,433 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    FactoredMetric.h
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _FACTOREDMETRIC_H_
+#define _FACTOREDMETRIC_H_
+
+#include "Exception.h"
+#include "DataArray2D.h"
+#include "DataArray3D.h"
+#include "DataArray4D.h"
+
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Indices into the vertical transform profile.  For a terrain-following
+///		coordinate z = Ztop s(xi) + f(xi) zs the profile stores, at each
+///		level or interface, f(xi), Ztop ds/dxi and df/dxi.
+///	</summary>
+enum VerticalTransformProfile {
+	VerticalTransform_F = 0,
+	VerticalTransform_DxiZtop = 1,
+	VerticalTransform_DxiF = 2,
+	VerticalTransform_Count = 3
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Read-only view of the 3D Jacobian of a terrain-following coordinate,
+///		rebuilt from the 2D Jacobian, the topography and the vertical
+///		transform profile whenever an element is accessed.
+///	</summary>
+class FactoredMetric3D {
+
+public:
+	///	<summary>
+	///		Subscript over the alpha index.
+	///	</summary>
+	class LevelRef {
+	public:
+		LevelRef(const FactoredMetric3D & metric, std::ptrdiff_t k) :
+			m_metric(metric), m_k(k)
+		{ }
+
+		class NodeRef {
+		public:
+			NodeRef(
+				const FactoredMetric3D & metric,
+				std::ptrdiff_t k,
+				std::ptrdiff_t i
+			) :
+				m_metric(metric), m_k(k), m_i(i)
+			{ }
+
+			inline double operator[](std::ptrdiff_t j) const {
+				return m_metric.Evaluate(m_k, m_i, j);
+			}
+
+		private:
+			const FactoredMetric3D & m_metric;
+			std::ptrdiff_t m_k;
+			std::ptrdiff_t m_i;
+		};
+
+		inline NodeRef operator[](std::ptrdiff_t i) const {
+			return NodeRef(m_metric, m_k, i);
+		}
+
+	private:
+		const FactoredMetric3D & m_metric;
+		std::ptrdiff_t m_k;
+	};
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	FactoredMetric3D() :
+		m_pdataProfile(NULL),
+		m_pdataTopography(NULL),
+		m_pdataJacobian2D(NULL)
+	{ }
+
+	///	<summary>
+	///		Attach the factors from which the Jacobian is rebuilt.
+	///	</summary>
+	void Initialize(
+		const DataArray2D<double> & dataProfile,
+		const DataArray2D<double> & dataTopography,
+		const DataArray2D<double> & dataJacobian2D
+	) {
+		m_pdataProfile = &dataProfile;
+		m_pdataTopography = &dataTopography;
+		m_pdataJacobian2D = &dataJacobian2D;
+	}
+
+	///	<summary>
+	///		Get the size of the given dimension.
+	///	</summary>
+	size_t GetSize(size_t dim) const {
+		if (dim == 0) {
+			return m_pdataProfile->GetRows();
+		}
+		if (dim == 1) {
+			return m_pdataTopography->GetRows();
+		}
+		if (dim == 2) {
+			return m_pdataTopography->GetColumns();
+		}
+		_EXCEPTIONT("Invalid dimension");
+	}
+
+	///	<summary>
+	///		Jacobian at level k and node (i,j).
+	///	</summary>
+	inline double Evaluate(
+		std::ptrdiff_t k,
+		std::ptrdiff_t i,
+		std::ptrdiff_t j
+	) const {
+		const DataArray2D<double> & dataProfile = *m_pdataProfile;
+
+		double dDxR =
+			dataProfile[k][VerticalTransform_DxiZtop]
+			+ (*m_pdataTopography)[i][j]
+				* dataProfile[k][VerticalTransform_DxiF];
+
+		return dDxR * (*m_pdataJacobian2D)[i][j];
+	}
+
+	///	<summary>
+	///		Subscript operator.
+	///	</summary>
+	inline LevelRef operator[](std::ptrdiff_t k) const {
+		return LevelRef(*this, k);
+	}
+
+private:
+	///	<summary>
+	///		Vertical transform profile.
+	///	</summary>
+	const DataArray2D<double> * m_pdataProfile;
+
+	///	<summary>
+	///		Topography height.
+	///	</summary>
+	const DataArray2D<double> * m_pdataTopography;
+
+	///	<summary>
+	///		2D Jacobian.
+	///	</summary>
+	const DataArray2D<double> * m_pdataJacobian2D;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Read-only view of a 3D metric quantity of a terrain-following
+///		coordinate with three components per node, rebuilt from the 2D
+///		contravariant metric, the topography and its derivatives and the
+///		vertical transform profile whenever an element is accessed.
+///	</summary>
+class FactoredMetric4D {
+
+public:
+	///	<summary>
+	///		Metric quantity represented by this view.
+	///	</summary>
+	enum Field {
+		Field_ContraMetricA,
+		Field_ContraMetricB,
+		Field_ContraMetricXi,
+		Field_DerivR
+	};
+
+	///	<summary>
+	///		Subscript over the alpha index.
+	///	</summary>
+	class LevelRef {
+	public:
+		LevelRef(const FactoredMetric4D & metric, std::ptrdiff_t k) :
+			m_metric(metric), m_k(k)
+		{ }
+
+		class RowRef {
+		public:
+			RowRef(
+				const FactoredMetric4D & metric,
+				std::ptrdiff_t k,
+				std::ptrdiff_t i
+			) :
+				m_metric(metric), m_k(k), m_i(i)
+			{ }
+
+			class NodeRef {
+			public:
+				NodeRef(
+					const FactoredMetric4D & metric,
+					std::ptrdiff_t k,
+					std::ptrdiff_t i,
+					std::ptrdiff_t j
+				) :
+					m_metric(metric), m_k(k), m_i(i), m_j(j)
+				{ }
+
+				inline double operator[](std::ptrdiff_t c) const {
+					return m_metric.Evaluate(m_k, m_i, m_j, c);
+				}
+
+			private:
+				const FactoredMetric4D & m_metric;
+				std::ptrdiff_t m_k;
+				std::ptrdiff_t m_i;
+				std::ptrdiff_t m_j;
+			};
+
+			inline NodeRef operator[](std::ptrdiff_t j) const {
+				return NodeRef(m_metric, m_k, m_i, j);
+			}
+
+		private:
+			const FactoredMetric4D & m_metric;
+			std::ptrdiff_t m_k;
+			std::ptrdiff_t m_i;
+		};
+
+		inline RowRef operator[](std::ptrdiff_t i) const {
+			return RowRef(m_metric, m_k, i);
+		}
+
+	private:
+		const FactoredMetric4D & m_metric;
+		std::ptrdiff_t m_k;
+	};
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	FactoredMetric4D() :
+		m_eField(Field_DerivR),
+		m_pdataProfile(NULL),
+		m_pdataTopography(NULL),
+		m_pdataTopographyDeriv(NULL),
+		m_pdataContraMetric2DA(NULL),
+		m_pdataContraMetric2DB(NULL)
+	{ }
+
+	///	<summary>
+	///		Attach the factors from which the metric quantity is rebuilt.
+	///	</summary>
+	void Initialize(
+		Field eField,
+		const DataArray2D<double> & dataProfile,
+		const DataArray2D<double> & dataTopography,
+		const DataArray3D<double> & dataTopographyDeriv,
+		const DataArray3D<double> & dataContraMetric2DA,
+		const DataArray3D<double> & dataContraMetric2DB
+	) {
+		m_eField = eField;
+		m_pdataProfile = &dataProfile;
+		m_pdataTopography = &dataTopography;
+		m_pdataTopographyDeriv = &dataTopographyDeriv;
+		m_pdataContraMetric2DA = &dataContraMetric2DA;
+		m_pdataContraMetric2DB = &dataContraMetric2DB;
+	}
+
+	///	<summary>
+	///		Get the size of the given dimension.
+	///	</summary>
+	size_t GetSize(size_t dim) const {
+		if (dim == 0) {
+			return m_pdataProfile->GetRows();
+		}
+		if (dim == 1) {
+			return m_pdataTopography->GetRows();
+		}
+		if (dim == 2) {
+			return m_pdataTopography->GetColumns();
+		}
+		if (dim == 3) {
+			return 3;
+		}
+		_EXCEPTIONT("Invalid dimension");
+	}
+
+	///	<summary>
+	///		Component c of the metric quantity at level k and node (i,j).
+	///	</summary>
+	inline double Evaluate(
+		std::ptrdiff_t k,
+		std::ptrdiff_t i,
+		std::ptrdiff_t j,
+		std::ptrdiff_t c
+	) const {
+		const DataArray2D<double> & dataProfile = *m_pdataProfile;
+		const DataArray3D<double> & dataTopographyDeriv =
+			*m_pdataTopographyDeriv;
+
+		// Derivatives of the vertical coordinate transform
+		double dDaR =
+			dataProfile[k][VerticalTransform_F] * dataTopographyDeriv[0][i][j];
+		double dDbR =
+			dataProfile[k][VerticalTransform_F] * dataTopographyDeriv[1][i][j];
+		double dDxR =
+			dataProfile[k][VerticalTransform_DxiZtop]
+			+ (*m_pdataTopography)[i][j]
+				* dataProfile[k][VerticalTransform_DxiF];
+
+		if (m_eField == Field_DerivR) {
+			if (c == 0) {
+				return dDaR;
+			} else if (c == 1) {
+				return dDbR;
+			}
+			return dDxR;
+		}
+
+		const DataArray3D<double> & dataContraMetric2DA =
+			*m_pdataContraMetric2DA;
+		const DataArray3D<double> & dataContraMetric2DB =
+			*m_pdataContraMetric2DB;
+
+		if (m_eField == Field_ContraMetricA) {
+			if (c != 2) {
+				return dataContraMetric2DA[i][j][c];
+			}
+			return - (
+				  dataContraMetric2DA[i][j][0] * dDaR
+				+ dataContraMetric2DA[i][j][1] * dDbR) / dDxR;
+		}
+
+		if (m_eField == Field_ContraMetricB) {
+			if (c != 2) {
+				return dataContraMetric2DB[i][j][c];
+			}
+			return - (
+				  dataContraMetric2DB[i][j][0] * dDaR
+				+ dataContraMetric2DB[i][j][1] * dDbR) / dDxR;
+		}
+
+		// Contravariant metric (xi)
+		double dContraMetricXiA = - (
+			  dataContraMetric2DA[i][j][0] * dDaR
+			+ dataContraMetric2DA[i][j][1] * dDbR) / dDxR;
+
+		if (c == 0) {
+			return dContraMetricXiA;
+		}
+
+		double dContraMetricXiB = - (
+			  dataContraMetric2DB[i][j][0] * dDaR
+			+ dataContraMetric2DB[i][j][1] * dDbR) / dDxR;
+
+		if (c == 1) {
+			return dContraMetricXiB;
+		}
+
+		return (1.0 / dDxR
+			- (dContraMetricXiA * dDaR + dContraMetricXiB * dDbR)) / dDxR;
+	}
+
+	///	<summary>
+	///		Subscript operator.
+	///	</summary>
+	inline LevelRef operator[](std::ptrdiff_t k) const {
+		return LevelRef(*this, k);
+	}
+
+private:
+	///	<summary>
+	///		Metric quantity represented by this view.
+	///	</summary>
+	Field m_eField;
+
+	///	<summary>
+	///		Vertical transform profile.
+	///	</summary>
+	const DataArray2D<double> * m_pdataProfile;
+
+	///	<summary>
+	///		Topography height.
+	///	</summary>
+	const DataArray2D<double> * m_pdataTopography;
+
+	///	<summary>
+	///		Topography derivatives.
+	///	</summary>
+	const DataArray3D<double> * m_pdataTopographyDeriv;
+
+	///	<summary>
+	///		2D contravariant metric (alpha).
+	///	</summary>
+	const DataArray3D<double> * m_pdataContraMetric2DA;
+
+	///	<summary>
+	///		2D contravariant metric (beta).
+	///	</summary>
+	const DataArray3D<double> * m_pdataContraMetric2DB;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Storage type of the 3D metric terms held by each GridPatch.
+///	</summary>
+#if defined(TEMPEST_COMPACT_GEOMETRY)
+typedef FactoredMetric3D MetricArray3D;
+typedef FactoredMetric4D MetricArray4D;
+#else
+typedef DataArray3D<double> MetricArray3D;
+typedef DataArray4D<double> MetricArray4D;
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
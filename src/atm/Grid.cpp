@@ -22,9 +22,16 @@
 #include "VerticalStretch.h"
 #include "ConsolidationStatus.h"
 #include "FunctionTimer.h"
+#include "DataAllocator.h"
 
+#include "Announce.h"
 #include "Exception.h"
 
+#ifdef TEMPEST_TASKS
+#include "TaskRuntime.h"
+#endif
+
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 
@@ -44,6 +51,7 @@ Grid::Grid(
 	m_fInitialized(false),
 	m_model(model),
 	m_fBlockParallelExchange(false),
+	m_fExchangeInProgress(false),
 	m_pVerticalStretchF(NULL)
 { }
 
@@ -170,6 +178,9 @@ Grid::~Grid() {
 	for (int n = 0; n < m_vecActiveGridPatches.size(); n++) {
 		delete m_vecActiveGridPatches[n];
 	}
+
+	// Blocks cached for this grid will not be reused by another grid
+	GetDefaultDataAllocator().ReleaseCache();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -627,6 +638,37 @@ double Grid::ComputeTotalVerticalMomentum(
 void Grid::Exchange(
 	DataType eDataType,
 	int iDataIndex
+) {
+	ExchangeBegin(eDataType, iDataIndex);
+	ExchangeEnd(eDataType, iDataIndex);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::ExchangeBegin(
+	DataType eDataType,
+	int iDataIndex
+) {
+	ExchangeBegin(
+		DataTypeIndexVector(1,
+			std::pair<DataType, int>(eDataType, iDataIndex)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::ExchangeEnd(
+	DataType eDataType,
+	int iDataIndex
+) {
+	ExchangeEnd(
+		DataTypeIndexVector(1,
+			std::pair<DataType, int>(eDataType, iDataIndex)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::ExchangeBegin(
+	const DataTypeIndexVector & vecDataTypeIndices
 ) {
 	// Block parallel exchanges
 	if (m_fBlockParallelExchange) {
@@ -635,18 +677,28 @@ void Grid::Exchange(
 
 	FunctionTimer timer("Communicate");
 
-#ifdef TEMPEST_MPIOMP
-	// Verify all processors are prepared to exchange
-	MPI_Barrier(MPI_COMM_WORLD);
-#endif
+	if (m_fExchangeInProgress) {
+		_EXCEPTIONT("ExchangeBegin called with exchange in progress");
+	}
+	m_fExchangeInProgress = true;
+
+	// Send buffers from the previous exchange must be free before they are
+	// reset and packed
+	m_aExchangeBufferRegistry.WaitSend();
 
 	// Set up asynchronous recvs
 	m_aExchangeBufferRegistry.PrepareExchange();
 
-	// Pack data
+	// Pack data for other processors; halos shared with patches on this
+	// processor are copied directly from the neighboring patch
 	std::vector<ExchangeBuffer> & vecExchangeBuffers =
 		m_aExchangeBufferRegistry.GetExchangeBuffers();
 
+#ifdef TEMPEST_TASKS
+	// Each patch fills its own ExchangeBuffers
+	std::vector< std::vector<int> > vecPatchBuffers(
+		m_vecActiveGridPatches.size());
+
 	for (int b = 0; b < vecExchangeBuffers.size(); b++) {
 		int ixActivePatch = vecExchangeBuffers[b].m_ixLocalActiveSourcePatch;
 		if ((ixActivePatch < 0) ||
@@ -654,14 +706,52 @@ void Grid::Exchange(
 		) {
 			_EXCEPTIONT("ExchangeBuffer active patch index out of range");
 		}
-		m_vecActiveGridPatches[ixActivePatch]->PackExchangeBuffer(
-			eDataType, iDataIndex, vecExchangeBuffers[b]);
+		vecPatchBuffers[ixActivePatch].push_back(b);
+	}
+
+	ForEachActivePatch([&](int n) {
+		for (int i = 0; i < vecPatchBuffers[n].size(); i++) {
+			ExchangeBuffer & exbuf = vecExchangeBuffers[vecPatchBuffers[n][i]];
+			if (exbuf.m_pLocalPartner != NULL) {
+				CopyExchangeBuffer(vecDataTypeIndices, exbuf);
+			} else {
+				PackExchangeBuffer(vecDataTypeIndices, exbuf);
+			}
+		}
+	});
+#else
+	for (int b = 0; b < vecExchangeBuffers.size(); b++) {
+		if (vecExchangeBuffers[b].m_pLocalPartner != NULL) {
+			CopyExchangeBuffer(vecDataTypeIndices, vecExchangeBuffers[b]);
+		} else {
+			PackExchangeBuffer(vecDataTypeIndices, vecExchangeBuffers[b]);
+		}
 	}
+#endif
 
 	// Send data
 	m_aExchangeBufferRegistry.Send();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::ExchangeEnd(
+	const DataTypeIndexVector & vecDataTypeIndices
+) {
+	// Block parallel exchanges
+	if (m_fBlockParallelExchange) {
+		return;
+	}
+
+	FunctionTimer timer("Communicate");
 
-	// Receive data
+	if (!m_fExchangeInProgress) {
+		_EXCEPTIONT("ExchangeEnd called without ExchangeBegin");
+	}
+	m_fExchangeInProgress = false;
+
+	// Receive data; halos shared between patches on this processor were
+	// copied in ExchangeBegin
 	for (;;) {
 		const std::vector<ExchangeBuffer *> * pExchangeBuffers =
 			m_aExchangeBufferRegistry.WaitReceive();
@@ -671,21 +761,235 @@ void Grid::Exchange(
 		}
 
 		for (int b = 0; b < pExchangeBuffers->size(); b++) {
-			int ixActivePatch =
-				(*pExchangeBuffers)[b]->m_ixLocalActiveSourcePatch;
-			if ((ixActivePatch < 0) ||
-			    (ixActivePatch >= m_vecActiveGridPatches.size())
-			) {
-				_EXCEPTIONT("ExchangeBuffer active patch index out of range");
-			}
-			m_vecActiveGridPatches[ixActivePatch]->UnpackExchangeBuffer(
-				eDataType, iDataIndex, *((*pExchangeBuffers)[b]));
+			UnpackExchangeBuffer(
+				vecDataTypeIndices, *((*pExchangeBuffers)[b]));
 		}
 	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void Grid::ExchangeAndApply(
+	const DataTypeIndexVector & vecDataTypeIndices,
+	const PatchOperation & fnInterior,
+	const PatchOperation & fnEdges
+) {
+#ifdef TEMPEST_TASKS
+	// Without an exchange each patch is processed in a single task
+	if (m_fBlockParallelExchange) {
+		ForEachActivePatch([&](int n) {
+			fnInterior(n);
+			fnEdges(n);
+		});
+		return;
+	}
+
+	// Pack and send data
+	ExchangeBegin(vecDataTypeIndices);
+
+	FunctionTimer timer("Communicate");
+
+	m_fExchangeInProgress = false;
+
+	// Build the dependency graph for each patch:  the interior operation
+	// may begin immediately, halo data is unpacked once all messages for
+	// the patch have arrived, and the edge operation follows both.  Halos
+	// shared with patches on this processor were copied in ExchangeBegin.
+	const int nActivePatches = GetActivePatchCount();
+
+	std::vector<ExchangeBuffer> & vecExchangeBuffers =
+		m_aExchangeBufferRegistry.GetExchangeBuffers();
+
+	std::vector< std::vector<ExchangeBuffer *> > vecPatchBuffers(
+		nActivePatches);
+
+	for (int b = 0; b < vecExchangeBuffers.size(); b++) {
+		int ixActivePatch = vecExchangeBuffers[b].m_ixLocalActiveSourcePatch;
+		if ((ixActivePatch < 0) || (ixActivePatch >= nActivePatches)) {
+			_EXCEPTIONT("ExchangeBuffer active patch index out of range");
+		}
+		if (vecExchangeBuffers[b].m_pLocalPartner == NULL) {
+			vecPatchBuffers[ixActivePatch].push_back(
+				&(vecExchangeBuffers[b]));
+		}
+	}
+
+	TaskGraph graph;
+
+	std::vector<TaskGraph::TaskId> vecHaloTask(nActivePatches);
+
+	for (int n = 0; n < nActivePatches; n++) {
+		TaskGraph::TaskId ixInterior =
+			graph.AddTask([this, &fnInterior, n]() {
+				ApplyPatchOperation(fnInterior, n);
+			});
+
+		vecHaloTask[n] =
+			graph.AddTask([this, &vecDataTypeIndices, &vecPatchBuffers, n]() {
+				for (int i = 0; i < vecPatchBuffers[n].size(); i++) {
+					UnpackExchangeBuffer(
+						vecDataTypeIndices, *(vecPatchBuffers[n][i]));
+				}
+			});
+
+		TaskGraph::TaskId ixEdges =
+			graph.AddTask([this, &fnEdges, n]() {
+				ApplyPatchOperation(fnEdges, n);
+			});
+
+		graph.AddDependency(ixInterior, ixEdges);
+		graph.AddDependency(vecHaloTask[n], ixEdges);
+	}
+
+	// Halo data from other processors is released as each message arrives
+	for (int b = 0; b < vecExchangeBuffers.size(); b++) {
+		if (vecExchangeBuffers[b].m_pLocalPartner == NULL) {
+			graph.AddExternalDependency(
+				vecHaloTask[vecExchangeBuffers[b].m_ixLocalActiveSourcePatch]);
+		}
+	}
+
+	graph.Launch();
+
+	// This thread receives messages while the workers execute tasks
+	for (;;) {
+		const std::vector<ExchangeBuffer *> * pExchangeBuffers =
+			m_aExchangeBufferRegistry.WaitReceive();
+
+		if (pExchangeBuffers == NULL) {
+			break;
+		}
+
+		for (int b = 0; b < pExchangeBuffers->size(); b++) {
+			graph.Release(
+				vecHaloTask[(*pExchangeBuffers)[b]->m_ixLocalActiveSourcePatch]);
+		}
+	}
+
+	graph.Wait();
+#else
+	ExchangeBegin(vecDataTypeIndices);
+
+	for (int n = 0; n < GetActivePatchCount(); n++) {
+		ApplyPatchOperation(fnInterior, n);
+	}
+
+	ExchangeEnd(vecDataTypeIndices);
+
+	for (int n = 0; n < GetActivePatchCount(); n++) {
+		ApplyPatchOperation(fnEdges, n);
+	}
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::PackExchangeBuffer(
+	const DataTypeIndexVector & vecDataTypeIndices,
+	ExchangeBuffer & exbuf
+) {
+	int ixActivePatch = exbuf.m_ixLocalActiveSourcePatch;
+	if ((ixActivePatch < 0) ||
+	    (ixActivePatch >= m_vecActiveGridPatches.size())
+	) {
+		_EXCEPTIONT("ExchangeBuffer active patch index out of range");
+	}
+	for (int d = 0; d < vecDataTypeIndices.size(); d++) {
+		m_vecActiveGridPatches[ixActivePatch]->PackExchangeBuffer(
+			vecDataTypeIndices[d].first,
+			vecDataTypeIndices[d].second,
+			exbuf);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::UnpackExchangeBuffer(
+	const DataTypeIndexVector & vecDataTypeIndices,
+	ExchangeBuffer & exbuf
+) {
+	int ixActivePatch = exbuf.m_ixLocalActiveSourcePatch;
+	if ((ixActivePatch < 0) ||
+	    (ixActivePatch >= m_vecActiveGridPatches.size())
+	) {
+		_EXCEPTIONT("ExchangeBuffer active patch index out of range");
+	}
+	for (int d = 0; d < vecDataTypeIndices.size(); d++) {
+		m_vecActiveGridPatches[ixActivePatch]->UnpackExchangeBuffer(
+			vecDataTypeIndices[d].first,
+			vecDataTypeIndices[d].second,
+			exbuf);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::CopyExchangeBuffer(
+	const DataTypeIndexVector & vecDataTypeIndices,
+	const ExchangeBuffer & exbuf
+) {
+	int ixActivePatch = exbuf.m_ixLocalActiveSourcePatch;
+	if ((ixActivePatch < 0) ||
+	    (ixActivePatch >= m_vecActiveGridPatches.size())
+	) {
+		_EXCEPTIONT("ExchangeBuffer active patch index out of range");
+	}
+	if (exbuf.m_pLocalPartner == NULL) {
+		_EXCEPTIONT("ExchangeBuffer has no local partner");
+	}
+
+	int ixActiveSourcePatch = exbuf.m_pLocalPartner->m_ixLocalActiveSourcePatch;
+	if ((ixActiveSourcePatch < 0) ||
+	    (ixActiveSourcePatch >= m_vecActiveGridPatches.size())
+	) {
+		_EXCEPTIONT("ExchangeBuffer active patch index out of range");
+	}
+
+	for (int d = 0; d < vecDataTypeIndices.size(); d++) {
+		m_vecActiveGridPatches[ixActivePatch]->CopyExchangeBuffer(
+			vecDataTypeIndices[d].first,
+			vecDataTypeIndices[d].second,
+			*(m_vecActiveGridPatches[ixActiveSourcePatch]),
+			exbuf);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::ForEachActivePatch(
+	const PatchOperation & fn
+) {
+#ifdef TEMPEST_TASKS
+	TaskParallelFor(GetActivePatchCount(), [&](int n) {
+		ApplyPatchOperation(fn, n);
+	});
+#else
+	for (int n = 0; n < GetActivePatchCount(); n++) {
+		ApplyPatchOperation(fn, n);
+	}
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::ApplyPatchOperation(
+	const PatchOperation & fn,
+	int n
+) {
+	FunctionTimer timer;
+
+	fn(n);
+
+	// Patch times are allocated when patches are distributed
+	if (m_vecPatchTime.size() == GetPatchCount()) {
+		m_vecPatchTime[m_vecActiveGridPatchIndices[n]] +=
+			static_cast<double>(timer.Time())
+			/ static_cast<double>(FunctionTimer::MICROSECONDS_PER_SECOND);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 int Grid::GetMaxNodeCount2D() const {
 
 	// Total number of nodes over all patches of grid
@@ -853,7 +1157,34 @@ void Grid::InterpolateREdgeToNode(
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void Grid::ReduceInterpolate(
+void Grid::BuildRemapOperator(
+	const DataArray1D<double> & dAlpha,
+	const DataArray1D<double> & dBeta,
+	const DataArray1D<int> & iPatch,
+	RemapOperator & opRemap
+) const {
+	if ((dAlpha.GetRows() != dBeta.GetRows()) ||
+		(dAlpha.GetRows() != iPatch.GetRows())
+	) {
+		_EXCEPTIONT("Inconsistency in vector lengths.");
+	}
+
+	opRemap.Initialize(
+		dAlpha.GetRows(),
+		m_vecActiveGridPatches.size());
+
+	for (int n = 0; n < m_vecActiveGridPatches.size(); n++) {
+		m_vecActiveGridPatches[n]->BuildRemapOperator(
+			dAlpha,
+			dBeta,
+			iPatch,
+			opRemap.GetPatchOperator(n));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::Interpolate(
 	DataType eDataType,
 	const DataArray1D<double> & dREta,
 	const DataArray1D<double> & dAlpha,
@@ -864,11 +1195,41 @@ void Grid::ReduceInterpolate(
 	bool fIncludeReferenceState,
 	bool fConvertToPrimitive
 ) const {
-	// Check interpolation data array size
-	if ((dAlpha.GetRows() != dBeta.GetRows()) ||
-		(dAlpha.GetRows() != iPatch.GetRows())
-	) {
-		_EXCEPTIONT("Inconsistency in vector lengths.");
+	RemapOperator opRemap;
+
+	BuildRemapOperator(dAlpha, dBeta, iPatch, opRemap);
+
+	Interpolate(
+		eDataType,
+		dREta,
+		opRemap,
+		dInterpData,
+		eOnlyVariablesAt,
+		fIncludeReferenceState,
+		fConvertToPrimitive);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::Interpolate(
+	DataType eDataType,
+	const DataArray1D<double> & dREta,
+	RemapOperator & opRemap,
+	DataArray3D<double> & dInterpData,
+	DataLocation eOnlyVariablesAt,
+	bool fIncludeReferenceState,
+	bool fConvertToPrimitive
+) const {
+	// Check the operator was built on the active patches
+	if (opRemap.GetPatchCount() != m_vecActiveGridPatches.size()) {
+		_EXCEPTIONT("RemapOperator does not match active patches.");
+	}
+	for (int n = 0; n < m_vecActiveGridPatches.size(); n++) {
+		if (opRemap.GetPatchOperator(n).GetPatchIndex() !=
+			m_vecActiveGridPatches[n]->GetPatchIndex()
+		) {
+			_EXCEPTIONT("RemapOperator does not match active patches.");
+		}
 	}
 
 	if ((eDataType == DataType_Tracers) &&
@@ -927,7 +1288,7 @@ void Grid::ReduceInterpolate(
 		_EXCEPTIONT("InterpData dimension mismatch (1)");
 	}
 
-	if (dInterpData.GetSubColumns() != dAlpha.GetRows()) {
+	if (dInterpData.GetSubColumns() != opRemap.GetPointCount()) {
 		_EXCEPTIONT("InterpData dimension mismatch (2)");
 	}
 
@@ -936,17 +1297,41 @@ void Grid::ReduceInterpolate(
 
 	// Interpolate data
 	for (int n = 0; n < m_vecActiveGridPatches.size(); n++) {
-		m_vecActiveGridPatches[n]->InterpolateData(
+		m_vecActiveGridPatches[n]->RemapData(
 			eDataType,
 			dREta,
-			dAlpha,
-			dBeta,
-			iPatch,
+			opRemap.GetPatchOperator(n),
 			dInterpData,
 			eOnlyVariablesAt,
 			fIncludeReferenceState,
 			fConvertToPrimitive);
 	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::ReduceInterpolate(
+	DataType eDataType,
+	const DataArray1D<double> & dREta,
+	const DataArray1D<double> & dAlpha,
+	const DataArray1D<double> & dBeta,
+	const DataArray1D<int> & iPatch,
+	DataArray3D<double> & dInterpData,
+	DataLocation eOnlyVariablesAt,
+	bool fIncludeReferenceState,
+	bool fConvertToPrimitive
+) const {
+	// Interpolate data on this processor
+	Interpolate(
+		eDataType,
+		dREta,
+		dAlpha,
+		dBeta,
+		iPatch,
+		dInterpData,
+		eOnlyVariablesAt,
+		fIncludeReferenceState,
+		fConvertToPrimitive);
 
 #ifdef TEMPEST_MPIOMP
 	// Perform an Reduce operation to combine all data
@@ -1024,6 +1409,144 @@ void Grid::DeactivatePatch(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void Grid::PartitionPanel(
+	int nElementsA,
+	int nElementsB,
+	int nPatches,
+	DataArray2D<int> & iBoxes
+) {
+	if (nPatches < 1) {
+		_EXCEPTIONT("nPatches must be a positive integer");
+	}
+	if (nPatches > nElementsA * nElementsB) {
+		_EXCEPTION3("Cannot split %i x %i elements into %i patches",
+			nElementsA, nElementsB, nPatches);
+	}
+
+	// Number of strips, chosen so that patches are nearly square
+	int nStrips = static_cast<int>(
+		sqrt(static_cast<double>(nPatches) * static_cast<double>(nElementsA)
+			/ static_cast<double>(nElementsB)) + 0.5);
+
+	if (nStrips < 1) {
+		nStrips = 1;
+	}
+	if (nStrips > nPatches) {
+		nStrips = nPatches;
+	}
+	if (nStrips > nElementsA) {
+		nStrips = nElementsA;
+	}
+	while ((nPatches + nStrips - 1) / nStrips > nElementsB) {
+		nStrips++;
+	}
+
+	iBoxes.Allocate(nPatches, 4);
+
+	// Strip widths are proportional to the number of patches in each strip
+	int ixPatch = 0;
+	int nStripPatchesBegin = 0;
+	int iStripBegin = 0;
+
+	for (int i = 0; i < nStrips; i++) {
+		int nStripPatches = nPatches / nStrips;
+		if (i < nPatches % nStrips) {
+			nStripPatches++;
+		}
+
+		int iStripEnd = static_cast<int>(
+			static_cast<double>(nElementsA)
+			* static_cast<double>(nStripPatchesBegin + nStripPatches)
+			/ static_cast<double>(nPatches) + 0.5);
+
+		if (iStripEnd < iStripBegin + 1) {
+			iStripEnd = iStripBegin + 1;
+		}
+		if (iStripEnd > nElementsA - (nStrips - i - 1)) {
+			iStripEnd = nElementsA - (nStrips - i - 1);
+		}
+
+		// Split the strip along beta
+		for (int j = 0; j < nStripPatches; j++) {
+			iBoxes[ixPatch][0] = iStripBegin;
+			iBoxes[ixPatch][1] = iStripEnd;
+			iBoxes[ixPatch][2] = static_cast<int>(
+				static_cast<double>(nElementsB) * static_cast<double>(j)
+				/ static_cast<double>(nStripPatches) + 0.5);
+			iBoxes[ixPatch][3] = static_cast<int>(
+				static_cast<double>(nElementsB) * static_cast<double>(j+1)
+				/ static_cast<double>(nStripPatches) + 0.5);
+			ixPatch++;
+		}
+
+		nStripPatchesBegin += nStripPatches;
+		iStripBegin = iStripEnd;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Index of the point (iX, iY) along a Hilbert curve filling a square
+///		of side nSide, which must be a power of two.
+///	</summary>
+static long HilbertCurveIndex(
+	int nSide,
+	int iX,
+	int iY
+) {
+	long lIndex = 0;
+	for (int s = nSide / 2; s > 0; s /= 2) {
+		int iRX = ((iX & s) > 0)?(1):(0);
+		int iRY = ((iY & s) > 0)?(1):(0);
+
+		lIndex += static_cast<long>(s) * static_cast<long>(s)
+			* static_cast<long>((3 * iRX) ^ iRY);
+
+		// Rotate the quadrant
+		if (iRY == 0) {
+			if (iRX == 1) {
+				iX = s - 1 - iX;
+				iY = s - 1 - iY;
+			}
+			int iTemp = iX;
+			iX = iY;
+			iY = iTemp;
+		}
+	}
+	return lIndex;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::GatherPatchTimes(
+	std::vector<double> & vecPatchTime
+) const {
+	const int nPatches = GetPatchCount();
+
+	// Each patch is timed only on the processor where it is active
+	std::vector<double> vecLocalPatchTime(nPatches, 0.0);
+	if (m_vecPatchTime.size() == nPatches) {
+		vecLocalPatchTime = m_vecPatchTime;
+	}
+
+	vecPatchTime.resize(nPatches);
+
+#ifdef TEMPEST_MPIOMP
+	MPI_Allreduce(
+		&(vecLocalPatchTime[0]),
+		&(vecPatchTime[0]),
+		nPatches,
+		MPI_DOUBLE,
+		MPI_SUM,
+		MPI_COMM_WORLD);
+#else
+	vecPatchTime = vecLocalPatchTime;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void Grid::DistributePatches() {
 #ifdef TEMPEST_MPIOMP
 	// Number of processors
@@ -1034,19 +1557,146 @@ void Grid::DistributePatches() {
 	int nRank;
 	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
 
-	// Loop over all patches and initialize data
-	m_vecPatchProcessor.resize(m_aPatchBoxes.GetRows());
-	for (int n = 0; n < m_aPatchBoxes.GetRows(); n++) {
-		int iPatchProcessor = n % nSize;
+	const int nPatches = m_aPatchBoxes.GetRows();
+
+	if ((m_vecPatchCost.size() != 0) &&
+	    (m_vecPatchCost.size() != nPatches)
+	) {
+		_EXCEPTION2("Patch cost vector length (%i) does not match "
+			"patch count (%i)", m_vecPatchCost.size(), nPatches);
+	}
+
+	// Measured costs are only used if every patch has been timed
+	bool fMeasuredCost = (m_vecPatchCost.size() != 0);
+	for (int n = 0; n < m_vecPatchCost.size(); n++) {
+		if (!(m_vecPatchCost[n] > 0.0)) {
+			fMeasuredCost = false;
+		}
+	}
+
+	// Weight of each patch, from measured costs if available and
+	// otherwise from the number of nodes
+	std::vector<double> vecWeight(nPatches);
+	double dTotalWeight = 0.0;
+	for (int n = 0; n < nPatches; n++) {
+		if (fMeasuredCost) {
+			vecWeight[n] = m_vecPatchCost[n];
+		} else {
+			vecWeight[n] =
+				static_cast<double>(m_aPatchBoxes[n].GetTotalNodeCount2D());
+		}
+		dTotalWeight += vecWeight[n];
+	}
+
+	// Order patches along a space-filling curve: panel by panel, and
+	// along a Hilbert curve through the patch centers within each panel
+	int nSide = 1;
+	for (int n = 0; n < nPatches; n++) {
+		const PatchBox & box = m_aPatchBoxes[n];
+		while ((nSide < box.GetAGlobalInteriorEnd()) ||
+		       (nSide < box.GetBGlobalInteriorEnd())
+		) {
+			nSide *= 2;
+		}
+	}
+
+	std::vector< std::pair<std::pair<int, long>, int> > vecCurve(nPatches);
+	for (int n = 0; n < nPatches; n++) {
+		const PatchBox & box = m_aPatchBoxes[n];
+		int iCenterA =
+			(box.GetAGlobalInteriorBegin() + box.GetAGlobalInteriorEnd()) / 2;
+		int iCenterB =
+			(box.GetBGlobalInteriorBegin() + box.GetBGlobalInteriorEnd()) / 2;
+
+		vecCurve[n].first.first = box.GetPanel();
+		vecCurve[n].first.second =
+			HilbertCurveIndex(nSide, iCenterA, iCenterB);
+		vecCurve[n].second = n;
+	}
+	std::sort(vecCurve.begin(), vecCurve.end());
+
+	// Assign contiguous segments of the curve with equal weight to each
+	// processor.  Consecutive ranks (which typically share a node) are
+	// assigned neighboring segments.
+	m_vecPatchProcessor.resize(nPatches);
+
+	double dCumulativeWeight = 0.0;
+	for (int c = 0; c < nPatches; c++) {
+		int n = vecCurve[c].second;
+
+		int iPatchProcessor = static_cast<int>(
+			(dCumulativeWeight + 0.5 * vecWeight[n])
+			* static_cast<double>(nSize) / dTotalWeight);
+
+		// Ensure every processor receives a patch when possible
+		if (nPatches >= nSize) {
+			if (iPatchProcessor > c) {
+				iPatchProcessor = c;
+			}
+			if (iPatchProcessor < nSize - (nPatches - c)) {
+				iPatchProcessor = nSize - (nPatches - c);
+			}
+		}
+		if (iPatchProcessor >= nSize) {
+			iPatchProcessor = nSize - 1;
+		}
+
 		m_vecPatchProcessor[n] = iPatchProcessor;
+		dCumulativeWeight += vecWeight[n];
+	}
 
-		if (iPatchProcessor == nRank) {
+	// Loop over all patches and initialize data
+	for (int n = 0; n < nPatches; n++) {
+		if (m_vecPatchProcessor[n] == nRank) {
 			GridPatch * pPatch = NewPatch(n);
 			pPatch->InitializeDataLocal();
 			m_vecActiveGridPatches.push_back(pPatch);
 			m_vecActiveGridPatchIndices.push_back(n);
 		}
 	}
+
+	// Load imbalance (maximum over mean processor weight)
+	std::vector<double> vecProcessorWeight(nSize, 0.0);
+	for (int n = 0; n < nPatches; n++) {
+		vecProcessorWeight[m_vecPatchProcessor[n]] += vecWeight[n];
+	}
+
+	double dMaxProcessorWeight = 0.0;
+	for (int p = 0; p < nSize; p++) {
+		if (vecProcessorWeight[p] > dMaxProcessorWeight) {
+			dMaxProcessorWeight = vecProcessorWeight[p];
+		}
+	}
+
+	// Edge cut (halo nodes exchanged between processors)
+	int nHaloNodes = 0;
+	int nCutHaloNodes = 0;
+	for (int n = 0; n < nPatches; n++) {
+		DataArray1D<int> vecPatch;
+		GetPatchPerimeterNeighbors(n, vecPatch);
+
+		for (int i = 0; i < vecPatch.GetRows(); i++) {
+			if (vecPatch[i] == GridPatch::InvalidIndex) {
+				continue;
+			}
+			nHaloNodes++;
+			if (m_vecPatchProcessor[vecPatch[i]] != m_vecPatchProcessor[n]) {
+				nCutHaloNodes++;
+			}
+		}
+	}
+
+	// Timing restarts with the new distribution
+	m_vecPatchTime.assign(nPatches, 0.0);
+
+	Announce("Patch distribution: %i patches on %i processors",
+		nPatches, nSize);
+	Announce("Patch distribution: weighted by %s",
+		(fMeasuredCost)?("measured cost"):("node count"));
+	Announce("Patch distribution: load imbalance %1.4f",
+		dMaxProcessorWeight * static_cast<double>(nSize) / dTotalWeight);
+	Announce("Patch distribution: edge cut %i of %i halo nodes",
+		nCutHaloNodes, nHaloNodes);
 #endif
 }
 
@@ -1172,15 +1822,11 @@ void Grid::RegisterExchangeBuffer(
 
 	const EquationSet & eqn = model.GetEquationSet();
 
-	size_t sStateTracerMaxVariables;
-	if (eqn.GetComponents() > eqn.GetTracers()) {
-		sStateTracerMaxVariables = eqn.GetComponents();
-	} else {
-		sStateTracerMaxVariables = eqn.GetTracers();
-	}
-
+	// Buffers hold the State and Tracers of one data index so that both
+	// can be exchanged in a single message
 	exbuf.m_sHaloElements = model.GetHaloElements();
-	exbuf.m_sComponents = sStateTracerMaxVariables;
+	exbuf.m_sComponents = eqn.GetComponents();
+	exbuf.m_sTracers = eqn.GetTracers();
 	exbuf.m_sMaxRElements = GetRElements() + 1;
 
 	// Get the opposing direction
@@ -1244,18 +1890,20 @@ void Grid::RegisterExchangeBuffer(
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void Grid::InitializeExchangeBuffersFromPatch(
-	int ixSourcePatch
+void Grid::GetPatchPerimeterNeighbors(
+	int ixPatch,
+	DataArray1D<int> & vecPatch
 ) {
-	const PatchBox & box = GetPatchBox(ixSourcePatch);
+	const PatchBox & box = GetPatchBox(ixPatch);
 
 	// Vector of nodal points around element
 	int nPerimeter = box.GetInteriorPerimeter() + 4;
 
+	vecPatch.Allocate(nPerimeter);
+
 	DataArray1D<int> vecIxA(nPerimeter);
 	DataArray1D<int> vecIxB(nPerimeter);
 	DataArray1D<int> vecPanel(nPerimeter);
-	DataArray1D<int> vecPatch(nPerimeter);
 
 	// Perimeter node index
 	int ix = 0;
@@ -1337,9 +1985,21 @@ void Grid::InitializeExchangeBuffersFromPatch(
 	if (ix != box.GetInteriorPerimeter() + 4) {
 		_EXCEPTIONT("Index mismatch");
 	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::InitializeExchangeBuffersFromPatch(
+	int ixSourcePatch
+) {
+	const PatchBox & box = GetPatchBox(ixSourcePatch);
+
+	// Patch index of each halo node around the perimeter
+	DataArray1D<int> vecPatch;
+	GetPatchPerimeterNeighbors(ixSourcePatch, vecPatch);
 
-	// Reset index
-	ix = 0;
+	// Perimeter node index
+	int ix = 0;
 
 	// Add connectivity to bottom-left corner
 	if (vecPatch[ix] != GridPatch::InvalidIndex) {
@@ -1599,6 +2259,47 @@ void Grid::LinearCombineData(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void Grid::CopyData(
+	int ixSource,
+	int ixDest,
+	const DataTypeVector & vecDataTypes
+) {
+	ForEachActivePatch([&](int n) {
+		for (int d = 0; d < vecDataTypes.size(); d++) {
+			m_vecActiveGridPatches[n]->
+				CopyData(ixSource, ixDest, vecDataTypes[d]);
+		}
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::LinearCombineData(
+	const DataArray1D<double> & dCoeff,
+	int ixDest,
+	const DataTypeVector & vecDataTypes
+) {
+	StageUpdateData(dCoeff, ixDest, (-1), vecDataTypes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::StageUpdateData(
+	const DataArray1D<double> & dCoeff,
+	int ixDest,
+	int ixCopy,
+	const DataTypeVector & vecDataTypes
+) {
+	ForEachActivePatch([&](int n) {
+		for (int d = 0; d < vecDataTypes.size(); d++) {
+			m_vecActiveGridPatches[n]->
+				StageUpdateData(dCoeff, ixDest, ixCopy, vecDataTypes[d]);
+		}
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void Grid::ZeroData(
 	int ixData,
 	DataType eDataType
@@ -27,6 +27,7 @@
 #include <mpi.h>
 #endif
 
+#include <functional>
 #include <string>
 #include <vector>
 #include <map>
@@ -55,6 +56,24 @@ typedef int NcFile;
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		A vector of DataTypes that are processed together.
+///	</summary>
+typedef std::vector<DataType> DataTypeVector;
+
+///	<summary>
+///		A vector of DataTypes and data indices that are exchanged together
+///		in a single message per neighboring processor.
+///	</summary>
+typedef std::vector< std::pair<DataType, int> > DataTypeIndexVector;
+
+///	<summary>
+///		An operation applied to the active patch with the given index.
+///	</summary>
+typedef std::function<void(int)> PatchOperation;
+
+///////////////////////////////////////////////////////////////////////////////
+
 ///	<summary>
 ///		Atmospheric model grid data.  Container for GridPatch objects.
 ///	</summary>
@@ -225,9 +244,20 @@ public:
 	///		Perform post-processing of variables on the grid after each
 	///		TimeStep substage.
 	///	</summary>
-	virtual void PostProcessSubstage(
+	void PostProcessSubstage(
 		int iDataUpdate,
 		DataType eDataType = DataType_State
+	) {
+		PostProcessSubstage(iDataUpdate, DataTypeVector(1, eDataType));
+	}
+
+	///	<summary>
+	///		Perform post-processing of several DataTypes on the grid after
+	///		each TimeStep substage, exchanging all DataTypes together.
+	///	</summary>
+	virtual void PostProcessSubstage(
+		int iDataUpdate,
+		const DataTypeVector & vecDataTypes
 	) {
 		_EXCEPTIONT("Unimplemented");
 	}
@@ -273,6 +303,85 @@ public:
 		int iDataIndex
 	);
 
+	///	<summary>
+	///		Begin a split-phase exchange of data between processors by
+	///		posting receives and sending the edges of each patch.  Until
+	///		the matching call to ExchangeEnd, halo data must not be read
+	///		and the edges of each patch must not be modified.
+	///	</summary>
+	void ExchangeBegin(
+		DataType eDataType,
+		int iDataIndex
+	);
+
+	///	<summary>
+	///		Complete a split-phase exchange of data between processors
+	///		by receiving and unpacking halo data.
+	///	</summary>
+	void ExchangeEnd(
+		DataType eDataType,
+		int iDataIndex
+	);
+
+	///	<summary>
+	///		Begin a split-phase exchange of several DataTypes and data
+	///		indices, packed into a single message per neighboring processor.
+	///		The ExchangeBuffers are sized to hold the State and Tracers of
+	///		one data index.
+	///	</summary>
+	void ExchangeBegin(
+		const DataTypeIndexVector & vecDataTypeIndices
+	);
+
+	///	<summary>
+	///		Complete a split-phase exchange of several DataTypes and data
+	///		indices.  The vector must match the one passed to ExchangeBegin.
+	///	</summary>
+	void ExchangeEnd(
+		const DataTypeIndexVector & vecDataTypeIndices
+	);
+
+	///	<summary>
+	///		Exchange several DataTypes and data indices while applying
+	///		operations to each active patch.  fnInterior is applied while
+	///		halo data is in transit, and so must not read halo data or
+	///		modify patch edges; fnEdges is applied to a patch once its halo
+	///		data has been unpacked.  With the task runtime each patch
+	///		proceeds independently, so fnEdges may be applied to a patch as
+	///		soon as its own halos have arrived.
+	///	</summary>
+	void ExchangeAndApply(
+		const DataTypeIndexVector & vecDataTypeIndices,
+		const PatchOperation & fnInterior,
+		const PatchOperation & fnEdges
+	);
+
+protected:
+	///	<summary>
+	///		Pack all DataTypes and data indices into an ExchangeBuffer.
+	///	</summary>
+	void PackExchangeBuffer(
+		const DataTypeIndexVector & vecDataTypeIndices,
+		ExchangeBuffer & exbuf
+	);
+
+	///	<summary>
+	///		Unpack all DataTypes and data indices from an ExchangeBuffer.
+	///	</summary>
+	void UnpackExchangeBuffer(
+		const DataTypeIndexVector & vecDataTypeIndices,
+		ExchangeBuffer & exbuf
+	);
+
+	///	<summary>
+	///		Copy all DataTypes and data indices for a local ExchangeBuffer
+	///		directly from the GridPatch of its partner.
+	///	</summary>
+	void CopyExchangeBuffer(
+		const DataTypeIndexVector & vecDataTypeIndices,
+		const ExchangeBuffer & exbuf
+	);
+
 public:
 	///	<summary>
 	///		Get the total number of patches on the grid.
@@ -288,6 +397,27 @@ public:
 		return m_vecActiveGridPatches.size();
 	}
 
+	///	<summary>
+	///		Apply an operation to each active patch.  With the task runtime
+	///		each patch is a separate task; otherwise patches are processed
+	///		in order on the calling thread.  Operations applied to different
+	///		patches must be independent.
+	///	</summary>
+	void ForEachActivePatch(
+		const PatchOperation & fn
+	);
+
+protected:
+	///	<summary>
+	///		Apply an operation to an active patch and add the time taken
+	///		to the measured cost of the patch.
+	///	</summary>
+	void ApplyPatchOperation(
+		const PatchOperation & fn,
+		int n
+	);
+
+public:
 	///	<summary>
 	///		Get the maximum number of nodes in 2D over all patches.
 	///	</summary>
@@ -372,6 +502,49 @@ public:
 		_EXCEPTIONT("Not implemented");
 	}
 
+	///	<summary>
+	///		Perform interpolation on a node array at those points which lie
+	///		on the active patches of this processor.  All other points are
+	///		set to zero.
+	///	</summary>
+	void Interpolate(
+		DataType eDataType,
+		const DataArray1D<double> & dREta,
+		const DataArray1D<double> & dAlpha,
+		const DataArray1D<double> & dBeta,
+		const DataArray1D<int> & iPatch,
+		DataArray3D<double> & dInterpData,
+		DataLocation eOnlyVariablesAt = DataLocation_None,
+		bool fIncludeReferenceState = true,
+		bool fConvertToPrimitive = true
+	) const;
+
+	///	<summary>
+	///		Build the operator which interpolates data from the active
+	///		patches of this processor to the specified points.
+	///	</summary>
+	void BuildRemapOperator(
+		const DataArray1D<double> & dAlpha,
+		const DataArray1D<double> & dBeta,
+		const DataArray1D<int> & iPatch,
+		RemapOperator & opRemap
+	) const;
+
+	///	<summary>
+	///		Perform interpolation with an operator built by
+	///		BuildRemapOperator.  Points which do not lie on the active
+	///		patches of this processor are set to zero.
+	///	</summary>
+	void Interpolate(
+		DataType eDataType,
+		const DataArray1D<double> & dREta,
+		RemapOperator & opRemap,
+		DataArray3D<double> & dInterpData,
+		DataLocation eOnlyVariablesAt = DataLocation_None,
+		bool fIncludeReferenceState = true,
+		bool fConvertToPrimitive = true
+	) const;
+
 	///	<summary>
 	///		Perform interpolation on a node array and send data to root
 	///		(generally used for serial output on reference grid)
@@ -443,6 +616,24 @@ public:
 		_EXCEPTIONT("Not implemented");
 	}
 
+protected:
+	///	<summary>
+	///		Split a panel of nElementsA by nElementsB elements into
+	///		nPatches rectangular patches with nearly equal element counts.
+	///		Patches are arranged in strips along the alpha direction, with
+	///		each strip split along the beta direction.  Element index
+	///		bounds of each patch are returned in iBoxes as
+	///		[patch][A begin, A end, B begin, B end].
+	///	</summary>
+	static void PartitionPanel(
+		int nElementsA,
+		int nElementsB,
+		int nPatches,
+		DataArray2D<int> & iBoxes
+	);
+
+public:
+
 	///	<summary>
 	///		Return a pointer to a new GridPatch.
 	///	</summary>
@@ -490,8 +681,30 @@ public:
 	}
 
 public:
+	///	<summary>
+	///		Set the measured cost of each patch, used in place of the node
+	///		count to balance load in DistributePatches.
+	///	</summary>
+	void SetPatchCosts(
+		const std::vector<double> & vecPatchCost
+	) {
+		m_vecPatchCost = vecPatchCost;
+	}
+
+	///	<summary>
+	///		Get the time (in seconds) spent on each patch in
+	///		ForEachActivePatch since patches were last distributed, summed
+	///		over all processors.  Must be called on all processors.
+	///	</summary>
+	void GatherPatchTimes(
+		std::vector<double> & vecPatchTime
+	) const;
+
 	///	<summary>
 	///		Distribute patches among processors and allocate local patches.
+	///		Patches are ordered along a space-filling curve and split into
+	///		contiguous segments of equal weight, so that neighboring patches
+	///		are kept on the same or adjacent processors.
 	///	</summary>
 	void DistributePatches();
 
@@ -516,6 +729,16 @@ protected:
 		int ixSecond
 	);
 
+	///	<summary>
+	///		Get the index of the patch containing each halo node around the
+	///		perimeter of the specified GridPatch, counter-clockwise from the
+	///		bottom-left corner.
+	///	</summary>
+	void GetPatchPerimeterNeighbors(
+		int ixPatch,
+		DataArray1D<int> & vecPatch
+	);
+
 	///	<summary>
 	///		Build exchange buffer information for the specified GridPatch.
 	///	</summary>
@@ -553,6 +776,38 @@ public:
 		DataType eDataType
 	);
 
+	///	<summary>
+	///		Copy data of several DataTypes from one data index to another.
+	///	</summary>
+	void CopyData(
+		int ixSource,
+		int ixDest,
+		const DataTypeVector & vecDataTypes
+	);
+
+	///	<summary>
+	///		Compute a linear combination of data of several DataTypes and
+	///		store at specified index.
+	///	</summary>
+	void LinearCombineData(
+		const DataArray1D<double> & dCoeff,
+		int ixDest,
+		const DataTypeVector & vecDataTypes
+	);
+
+	///	<summary>
+	///		Stage update: compute a linear combination of data and store it
+	///		at both ixDest and ixCopy in a single pass over each DataType.
+	///		Terms with a zero coefficient are not read.  If ixCopy is
+	///		negative no copy is made.
+	///	</summary>
+	void StageUpdateData(
+		const DataArray1D<double> & dCoeff,
+		int ixDest,
+		int ixCopy,
+		const DataTypeVector & vecDataTypes
+	);
+
 	///	<summary>
 	///		Set the state to zero.
 	///	</summary>
@@ -997,6 +1252,11 @@ protected:
 	///	</summary>
 	bool m_fBlockParallelExchange;
 
+	///	<summary>
+	///		Flag indicating a split-phase exchange has begun but not ended.
+	///	</summary>
+	bool m_fExchangeInProgress;
+
 	///	<summary>
 	///		Pointer to the vertical stretching function.
 	///	</summary>
@@ -1020,6 +1280,18 @@ protected:
 	std::vector<int> m_vecPatchProcessor;
 #endif
 
+	///	<summary>
+	///		Measured cost of each patch used to balance load, or empty if
+	///		patches are balanced by node count.
+	///	</summary>
+	std::vector<double> m_vecPatchCost;
+
+	///	<summary>
+	///		Time (in seconds) spent on each locally active patch in
+	///		ForEachActivePatch, indexed by global patch index.
+	///	</summary>
+	std::vector<double> m_vecPatchTime;
+
 	///	<summary>
 	///		Exchange buffer registry.
 	///	</summary>
@@ -98,50 +98,41 @@ void GridCSGLL::ApplyDefaultPatchLayout(
 		_EXCEPTIONT("ApplyDefaultPatchLayout() must be called on an empty Grid");
 	}
 
-	int nProcsPerDirection = Max((int)ISqrt(nPatchCount / 6), 1);
+	// At least one patch is needed on each panel
+	int nDistributedPatches = Max(nPatchCount, 6);
 
-	int nProcsPerPanel = nProcsPerDirection * nProcsPerDirection;
-
-	int nDistributedPatches = 6 * nProcsPerPanel;
-
-	if (nDistributedPatches < nPatchCount) {
-		Announce("WARNING: Patch / thread mismatch: "
-			"%i threads will be unutilized",
-			nPatchCount - nDistributedPatches);
-	}
-
-	// Determine arrangement of elements on processors
-	if (GetABaseResolution() % nProcsPerDirection != 0) {
-		_EXCEPTIONT("\n(UNIMPLEMENTED) Currently elements must be "
-			"equally divided among processors.");
+	if (nDistributedPatches > m_aPatchBoxes.GetRows()) {
+		_EXCEPTION2("Patch count (%i) exceeds maximum patch count (%i)",
+			nDistributedPatches, m_aPatchBoxes.GetRows());
 	}
 
-	int nElementsPerDirection = GetABaseResolution() / nProcsPerDirection;
-	DataArray1D<int> iBoxBegin(nProcsPerDirection + 1);
-
-	iBoxBegin[0] = 0;
-	for (int n = 1; n < nProcsPerDirection; n++) {
-		iBoxBegin[n] = n * nElementsPerDirection;
-	}
-	iBoxBegin[nProcsPerDirection] = GetABaseResolution();
-
-	// Create master patch for each panel
+	// Create patches on each panel, with panels receiving nearly equal
+	// numbers of patches
 	int ixPatch = 0;
 
 	for (int n = 0; n < 6; n++) {
-	for (int i = 0; i < nProcsPerDirection; i++) {
-	for (int j = 0; j < nProcsPerDirection; j++) {
-
-		m_aPatchBoxes[ixPatch] = PatchBox(
-			n, 0, m_model.GetHaloElements(),
-			m_nHorizontalOrder * iBoxBegin[i],
-			m_nHorizontalOrder * iBoxBegin[i+1],
-			m_nHorizontalOrder * iBoxBegin[j],
-			m_nHorizontalOrder * iBoxBegin[j+1]);
+		int nPanelPatches = nDistributedPatches / 6;
+		if (n < nDistributedPatches % 6) {
+			nPanelPatches++;
+		}
 
-		ixPatch++;
-	}
-	}
+		DataArray2D<int> iBoxes;
+		PartitionPanel(
+			GetABaseResolution(),
+			GetBBaseResolution(),
+			nPanelPatches,
+			iBoxes);
+
+		for (int p = 0; p < nPanelPatches; p++) {
+			m_aPatchBoxes[ixPatch] = PatchBox(
+				n, 0, m_model.GetHaloElements(),
+				m_nHorizontalOrder * iBoxes[p][0],
+				m_nHorizontalOrder * iBoxes[p][1],
+				m_nHorizontalOrder * iBoxes[p][2],
+				m_nHorizontalOrder * iBoxes[p][3]);
+
+			ixPatch++;
+		}
 	}
 
 	m_nInitializedPatchBoxes = ixPatch;
@@ -430,235 +421,359 @@ void GridCSGLL::GetOpposingDirection(
 
 void GridCSGLL::ApplyDSS(
 	int iDataUpdate,
-	DataType eDataType
+	const DataTypeVector & vecDataTypes
 ) {
-	// Exchange data between nodes
-	Exchange(eDataType, iDataUpdate);
-
-	// Post-process velocities across panel edges and
-	// perform direct stiffness summation (DSS)
-	for (int n = 0; n < GetActivePatchCount(); n++) {
-		GridPatchCSGLL * pPatch =
-			dynamic_cast<GridPatchCSGLL*>(GetActivePatch(n));
-
-		const PatchBox & box = pPatch->GetPatchBox();
-        
-        // Patch-specific quantities
-		int nElementCountA = pPatch->GetElementCountA();
-		int nElementCountB = pPatch->GetElementCountB();
-        
-		// Apply panel transforms to velocity data
-		if (eDataType == DataType_State) {
-			pPatch->TransformHaloVelocities(iDataUpdate);
-		}
-		if (eDataType == DataType_TopographyDeriv) {
-			pPatch->TransformTopographyDeriv();
+	// Exchange data between nodes, with all DataTypes packed
+	// into a single message per neighbor
+	DataTypeIndexVector vecDataTypeIndices;
+	for (int d = 0; d < vecDataTypes.size(); d++) {
+		vecDataTypeIndices.push_back(
+			std::pair<DataType, int>(vecDataTypes[d], iDataUpdate));
+	}
 
-			const DataArray3D<double> & dataTopographyDeriv =
-				pPatch->GetTopographyDeriv();
-		}
+	ExchangeAndApply(
+		vecDataTypeIndices,
 
-		// Panels in each coordinate direction
-		int ixRightPanel =
-			pPatch->GetNeighborPanel(Direction_Right);
-		int ixTopPanel =
-			pPatch->GetNeighborPanel(Direction_Top);
-		int ixLeftPanel =
-			pPatch->GetNeighborPanel(Direction_Left);
-		int ixBottomPanel =
-			pPatch->GetNeighborPanel(Direction_Bottom);
-
-		int ixTopRightPanel =
-			pPatch->GetNeighborPanel(Direction_TopRight);
-		int ixTopLeftPanel =
-			pPatch->GetNeighborPanel(Direction_TopLeft);
-		int ixBottomLeftPanel =
-			pPatch->GetNeighborPanel(Direction_BottomLeft);
-		int ixBottomRightPanel =
-			pPatch->GetNeighborPanel(Direction_BottomRight);
-
-		// Loop through all components associated with this DataType
-		int nComponents;
-		if (eDataType == DataType_State) {
-			nComponents = m_model.GetEquationSet().GetComponents();
-		} else if (eDataType == DataType_Tracers) {
-			nComponents = m_model.GetEquationSet().GetTracers();
-		} else if (eDataType == DataType_Vorticity) {
-			nComponents = 1;
-		} else if (eDataType == DataType_Divergence) {
-			nComponents = 1;
-		} else if (eDataType == DataType_TopographyDeriv) {
-			nComponents = 1;
-		} else {
-			_EXCEPTIONT("Invalid DataType");
-		}
+		// Perform direct stiffness summation (DSS) away from patch edges
+		// while halo data is in transit
+		[&](int n) {
+			for (int d = 0; d < vecDataTypes.size(); d++) {
+				ApplyPatchDSS(n, iDataUpdate, vecDataTypes[d], false);
+			}
+		},
+
+		// Post-process velocities across panel edges and
+		// perform DSS along patch edges
+		[&](int n) {
+			for (int d = 0; d < vecDataTypes.size(); d++) {
+				ApplyPatchDSS(n, iDataUpdate, vecDataTypes[d], true);
+			}
+		});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Average the given data across element edges, either along the
+///		edges of the patch or in its interior.  T is the storage type of
+///		the data (double, or float for single precision tracers).
+///	</summary>
+template <typename T>
+static void AverageElementEdges(
+	DataArray3D<T> & pDataUpdate,
+	const PatchBox & box,
+	int nHorizontalOrder,
+	int nElementCountA,
+	int nElementCountB,
+	int ixTopRightPanel,
+	int ixTopLeftPanel,
+	int ixBottomLeftPanel,
+	int ixBottomRightPanel,
+	bool fPatchEdges
+) {
+	const int nRElements = pDataUpdate.GetSize(0);
 
-		// Perform Direct Stiffness Summation (DSS)
-		for (int c = 0; c < nComponents; c++) {
+	for (int k = 0; k < nRElements; k++) {
 
-			// Obtain the array of working data
-			int nRElements = GetRElements();
+		// Average in the alpha direction
+		for (int a = 0; a <= nElementCountA; a++) {
+			int iA = a * nHorizontalOrder + box.GetHaloElements();
+
+			bool fEdgeA = ((a == 0) || (a == nElementCountA));
+			if (fEdgeA && !fPatchEdges) {
+				continue;
+			}
 
-			DataArray3D<double> pDataUpdate;
+			// Do not average across cubed-sphere corners
+			int jBegin = box.GetBInteriorBegin()-1;
+			int jEnd = box.GetBInteriorEnd()+1;
 
-			if ((eDataType == DataType_State) &&
-				(GetVarLocation(c) == DataLocation_REdge)
+			if (((a == 0) &&
+					(ixTopLeftPanel == InvalidPanel)) ||
+				((a == nElementCountA) &&
+					(ixTopRightPanel == InvalidPanel))
 			) {
-				nRElements++;
+				jEnd -= 2;
 			}
-			if (eDataType == DataType_TopographyDeriv) {
-				nRElements = 2;
+			if (((a == 0) &&
+					(ixBottomLeftPanel == InvalidPanel)) ||
+				((a == nElementCountA) &&
+					(ixBottomRightPanel == InvalidPanel))
+			) {
+				jBegin += 2;
 			}
 
-			pDataUpdate.SetSize(
-				nRElements,
-				box.GetATotalWidth(),
-				box.GetBTotalWidth());
+			// Perform averaging across edge
+			for (int j = jBegin; j < jEnd; j++) {
 
-			// State data
-			if (eDataType == DataType_State) {
-				DataArray4D<double> & dState =
-					pPatch->GetDataState(iDataUpdate, GetVarLocation(c));
+				// Nodes on the first and last row of the patch
+				// interior, or in the halo, are averaged along
+				// with the patch edges
+				bool fNearEdge =
+					(j <= box.GetBInteriorBegin()) ||
+					(j >= box.GetBInteriorEnd()-1);
 
-				pDataUpdate.AttachToData(&(dState[c][0][0][0]));
+				if (!fEdgeA && (fNearEdge != fPatchEdges)) {
+					continue;
+				}
 
-			// Tracer data
-			} else if (eDataType == DataType_Tracers) {
-				DataArray4D<double> & dTracers =
-					pPatch->GetDataTracers(iDataUpdate);
+				pDataUpdate[k][iA][j] = 0.5 * (
+					+ pDataUpdate[k][iA  ][j]
+					+ pDataUpdate[k][iA-1][j]);
 
-				pDataUpdate.AttachToData(&(dTracers[c][0][0][0]));
+				pDataUpdate[k][iA-1][j] = pDataUpdate[k][iA][j];
+			}
+		}
 
-			// Vorticity data
-			} else if (eDataType == DataType_Vorticity) {
-				DataArray3D<double> & dVorticity =
-					pPatch->GetDataVorticity();
+		// Average in the beta direction
+		for (int b = 0; b <= nElementCountB; b++) {
+			int iB = b * nHorizontalOrder + box.GetHaloElements();
 
-				pDataUpdate.AttachToData(&(dVorticity[0][0][0]));
+			bool fEdgeB = ((b == 0) || (b == nElementCountB));
+			if (fEdgeB && !fPatchEdges) {
+				continue;
+			}
 
-			// Divergence data
-			} else if (eDataType == DataType_Divergence) {
-				DataArray3D<double> & dDivergence =
-					pPatch->GetDataDivergence();
+			// Do not average across cubed-sphere corners
+			int iBegin = box.GetAInteriorBegin()-1;
+			int iEnd = box.GetAInteriorEnd()+1;
 
-				pDataUpdate.AttachToData(&(dDivergence[0][0][0]));
+			if (((b == 0) &&
+					(ixBottomLeftPanel == InvalidPanel)) ||
+				((b == nElementCountB) &&
+					(ixTopLeftPanel == InvalidPanel))
+			) {
+				iBegin += 2;
+			}
+			if (((b == 0) &&
+					(ixBottomRightPanel == InvalidPanel)) ||
+				((b == nElementCountB) &&
+					(ixTopRightPanel == InvalidPanel))
+			) {
+				iEnd -= 2;
+			}
 
-			// Topographic derivative data
-			} else if (eDataType == DataType_TopographyDeriv) {
-				DataArray3D<double> & dTopographyDeriv =
-					pPatch->GetTopographyDeriv();
+			for (int i = iBegin; i < iEnd; i++) {
 
-				pDataUpdate.AttachToData(&(dTopographyDeriv[0][0][0]));
-			}
+				bool fNearEdge =
+					(i <= box.GetAInteriorBegin()) ||
+					(i >= box.GetAInteriorEnd()-1);
 
-			for (int k = 0; k < nRElements; k++) {
-
-				// Average in the alpha direction
-				for (int a = 0; a <= nElementCountA; a++) {
-					int iA = a * m_nHorizontalOrder + box.GetHaloElements();
-
-					// Do not average across cubed-sphere corners
-					int jBegin = box.GetBInteriorBegin()-1;
-					int jEnd = box.GetBInteriorEnd()+1;
-
-					if (((a == 0) &&
-							(ixTopLeftPanel == InvalidPanel)) ||
-						((a == nElementCountA) &&
-							(ixTopRightPanel == InvalidPanel))
-					) {
-						jEnd -= 2;
-					}
-					if (((a == 0) &&
-							(ixBottomLeftPanel == InvalidPanel)) ||
-						((a == nElementCountA) &&
-							(ixBottomRightPanel == InvalidPanel))
-					) {
-						jBegin += 2;
-					}
-
-					// Perform averaging across edge
-					for (int j = jBegin; j < jEnd; j++) {
-						pDataUpdate[k][iA][j] = 0.5 * (
-							+ pDataUpdate[k][iA  ][j]
-							+ pDataUpdate[k][iA-1][j]);
-
-						pDataUpdate[k][iA-1][j] = pDataUpdate[k][iA][j];
-					}
+				if (!fEdgeB && (fNearEdge != fPatchEdges)) {
+					continue;
 				}
 
-				// Average in the beta direction
-				for (int b = 0; b <= nElementCountB; b++) {
-					int iB = b * m_nHorizontalOrder + box.GetHaloElements();
-
-					// Do not average across cubed-sphere corners
-					int iBegin = box.GetAInteriorBegin()-1;
-					int iEnd = box.GetAInteriorEnd()+1;
-
-					if (((b == 0) &&
-							(ixBottomLeftPanel == InvalidPanel)) ||
-						((b == nElementCountA) &&
-							(ixTopLeftPanel == InvalidPanel))
-					) {
-						iBegin += 2;
-					}
-					if (((b == 0) &&
-							(ixBottomRightPanel == InvalidPanel)) ||
-						((b == nElementCountA) &&
-							(ixTopRightPanel == InvalidPanel))
-					) {
-						iEnd -= 2;
-					}
-
-					for (int i = iBegin; i < iEnd; i++) {
-						pDataUpdate[k][i][iB] = 0.5 * (
-							+ pDataUpdate[k][i][iB  ]
-							+ pDataUpdate[k][i][iB-1]);
-
-						pDataUpdate[k][i][iB-1] = pDataUpdate[k][i][iB];
-					}
-				}
+				pDataUpdate[k][i][iB] = 0.5 * (
+					+ pDataUpdate[k][i][iB  ]
+					+ pDataUpdate[k][i][iB-1]);
 
-				// Average at cubed-sphere corners (nodes of connectivity 3)
-				if (ixTopRightPanel == InvalidPanel) {
-					int iA = box.GetAInteriorEnd()-1;
-					int iB = box.GetBInteriorEnd()-1;
+				pDataUpdate[k][i][iB-1] = pDataUpdate[k][i][iB];
+			}
+		}
 
-					pDataUpdate[k][iA][iB] = (1.0/3.0) * (
-						+ pDataUpdate[k][iA  ][iB  ]
-						+ pDataUpdate[k][iA+1][iB  ]
-						+ pDataUpdate[k][iA  ][iB+1]);
-				}
+		// Average at cubed-sphere corners (nodes of connectivity 3)
+		if (!fPatchEdges) {
+			continue;
+		}
 
-				if (ixTopLeftPanel == InvalidPanel) {
-					int iA = box.GetAInteriorBegin();
-					int iB = box.GetBInteriorEnd()-1;
+		if (ixTopRightPanel == InvalidPanel) {
+			int iA = box.GetAInteriorEnd()-1;
+			int iB = box.GetBInteriorEnd()-1;
 
-					pDataUpdate[k][iA][iB] = (1.0/3.0) * (
-						+ pDataUpdate[k][iA  ][iB  ]
-						+ pDataUpdate[k][iA-1][iB  ]
-						+ pDataUpdate[k][iA  ][iB+1]);
-				}
+			pDataUpdate[k][iA][iB] = (1.0/3.0) * (
+				+ pDataUpdate[k][iA  ][iB  ]
+				+ pDataUpdate[k][iA+1][iB  ]
+				+ pDataUpdate[k][iA  ][iB+1]);
+		}
 
-				if (ixBottomLeftPanel == InvalidPanel) {
-					int iA = box.GetAInteriorBegin();
-					int iB = box.GetBInteriorBegin();
+		if (ixTopLeftPanel == InvalidPanel) {
+			int iA = box.GetAInteriorBegin();
+			int iB = box.GetBInteriorEnd()-1;
 
-					pDataUpdate[k][iA][iB] = (1.0/3.0) * (
-						+ pDataUpdate[k][iA  ][iB  ]
-						+ pDataUpdate[k][iA-1][iB  ]
-						+ pDataUpdate[k][iA  ][iB-1]);
-				}
+			pDataUpdate[k][iA][iB] = (1.0/3.0) * (
+				+ pDataUpdate[k][iA  ][iB  ]
+				+ pDataUpdate[k][iA-1][iB  ]
+				+ pDataUpdate[k][iA  ][iB+1]);
+		}
 
-				if (ixBottomRightPanel == InvalidPanel) {
-					int iA = box.GetAInteriorEnd()-1;
-					int iB = box.GetBInteriorBegin();
+		if (ixBottomLeftPanel == InvalidPanel) {
+			int iA = box.GetAInteriorBegin();
+			int iB = box.GetBInteriorBegin();
 
-					pDataUpdate[k][iA][iB] = (1.0/3.0) * (
-						+ pDataUpdate[k][iA  ][iB  ]
-						+ pDataUpdate[k][iA+1][iB  ]
-						+ pDataUpdate[k][iA  ][iB-1]);
-				}
-			}
+			pDataUpdate[k][iA][iB] = (1.0/3.0) * (
+				+ pDataUpdate[k][iA  ][iB  ]
+				+ pDataUpdate[k][iA-1][iB  ]
+				+ pDataUpdate[k][iA  ][iB-1]);
+		}
+
+		if (ixBottomRightPanel == InvalidPanel) {
+			int iA = box.GetAInteriorEnd()-1;
+			int iB = box.GetBInteriorBegin();
+
+			pDataUpdate[k][iA][iB] = (1.0/3.0) * (
+				+ pDataUpdate[k][iA  ][iB  ]
+				+ pDataUpdate[k][iA+1][iB  ]
+				+ pDataUpdate[k][iA  ][iB-1]);
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void GridCSGLL::ApplyPatchDSS(
+	int n,
+	int iDataUpdate,
+	DataType eDataType,
+	bool fPatchEdges
+) {
+	GridPatchCSGLL * pPatch =
+		dynamic_cast<GridPatchCSGLL*>(GetActivePatch(n));
+
+	const PatchBox & box = pPatch->GetPatchBox();
+
+	// Patch-specific quantities
+	int nElementCountA = pPatch->GetElementCountA();
+	int nElementCountB = pPatch->GetElementCountB();
+
+	// Apply panel transforms to velocity data
+	if (fPatchEdges) {
+		if (eDataType == DataType_State) {
+			pPatch->TransformHaloVelocities(iDataUpdate);
+		}
+		if (eDataType == DataType_TopographyDeriv) {
+			pPatch->TransformTopographyDeriv();
+
+			const DataArray3D<double> & dataTopographyDeriv =
+				pPatch->GetTopographyDeriv();
+		}
+	}
+
+	// Panels in each coordinate direction
+	int ixRightPanel =
+		pPatch->GetNeighborPanel(Direction_Right);
+	int ixTopPanel =
+		pPatch->GetNeighborPanel(Direction_Top);
+	int ixLeftPanel =
+		pPatch->GetNeighborPanel(Direction_Left);
+	int ixBottomPanel =
+		pPatch->GetNeighborPanel(Direction_Bottom);
+
+	int ixTopRightPanel =
+		pPatch->GetNeighborPanel(Direction_TopRight);
+	int ixTopLeftPanel =
+		pPatch->GetNeighborPanel(Direction_TopLeft);
+	int ixBottomLeftPanel =
+		pPatch->GetNeighborPanel(Direction_BottomLeft);
+	int ixBottomRightPanel =
+		pPatch->GetNeighborPanel(Direction_BottomRight);
+
+	// Loop through all components associated with this DataType
+	int nComponents;
+	if (eDataType == DataType_State) {
+		nComponents = m_model.GetEquationSet().GetComponents();
+	} else if (eDataType == DataType_Tracers) {
+		nComponents = m_model.GetEquationSet().GetTracers();
+	} else if (eDataType == DataType_Vorticity) {
+		nComponents = 1;
+	} else if (eDataType == DataType_Divergence) {
+		nComponents = 1;
+	} else if (eDataType == DataType_TopographyDeriv) {
+		nComponents = 1;
+	} else {
+		_EXCEPTIONT("Invalid DataType");
+	}
+
+	// Perform Direct Stiffness Summation (DSS)
+	for (int c = 0; c < nComponents; c++) {
+
+		// Obtain the array of working data
+		int nRElements = GetRElements();
+
+		DataArray3D<double> pDataUpdate;
+		TracerArray3D pTracerUpdate;
+
+		if ((eDataType == DataType_State) &&
+			(GetVarLocation(c) == DataLocation_REdge)
+		) {
+			nRElements++;
+		}
+		if (eDataType == DataType_TopographyDeriv) {
+			nRElements = 2;
+		}
+
+		pDataUpdate.SetSize(
+			nRElements,
+			box.GetATotalWidth(),
+			box.GetBTotalWidth());
+
+		// State data
+		if (eDataType == DataType_State) {
+			DataArray4D<double> & dState =
+				pPatch->GetDataState(iDataUpdate, GetVarLocation(c));
+
+			pDataUpdate.SetColumnLayout(dState.IsColumnLayout());
+			pDataUpdate.AttachToData(&(dState[c][0][0][0]));
+
+		// Tracer data
+		} else if (eDataType == DataType_Tracers) {
+			TracerArray4D & dTracers =
+				pPatch->GetDataTracers(iDataUpdate);
+
+			pTracerUpdate.SetSize(
+				nRElements,
+				box.GetATotalWidth(),
+				box.GetBTotalWidth());
+
+			pTracerUpdate.SetColumnLayout(dTracers.IsColumnLayout());
+			pTracerUpdate.AttachToData(&(dTracers[c][0][0][0]));
+
+		// Vorticity data
+		} else if (eDataType == DataType_Vorticity) {
+			DataArray3D<double> & dVorticity =
+				pPatch->GetDataVorticity();
+
+			pDataUpdate.AttachToData(&(dVorticity[0][0][0]));
+
+		// Divergence data
+		} else if (eDataType == DataType_Divergence) {
+			DataArray3D<double> & dDivergence =
+				pPatch->GetDataDivergence();
+
+			pDataUpdate.AttachToData(&(dDivergence[0][0][0]));
+
+		// Topographic derivative data
+		} else if (eDataType == DataType_TopographyDeriv) {
+			DataArray3D<double> & dTopographyDeriv =
+				pPatch->GetTopographyDeriv();
+
+			pDataUpdate.AttachToData(&(dTopographyDeriv[0][0][0]));
+		}
+
+		// Average across element edges
+		if (eDataType == DataType_Tracers) {
+			AverageElementEdges(
+				pTracerUpdate,
+				box,
+				m_nHorizontalOrder,
+				nElementCountA,
+				nElementCountB,
+				ixTopRightPanel,
+				ixTopLeftPanel,
+				ixBottomLeftPanel,
+				ixBottomRightPanel,
+				fPatchEdges);
+		} else {
+			AverageElementEdges(
+				pDataUpdate,
+				box,
+				m_nHorizontalOrder,
+				nElementCountA,
+				nElementCountB,
+				ixTopRightPanel,
+				ixTopLeftPanel,
+				ixBottomLeftPanel,
+				ixBottomRightPanel,
+				fPatchEdges);
 		}
 	}
 }
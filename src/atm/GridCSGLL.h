@@ -117,12 +117,29 @@ public:
 	) const;
 
 public:
+	using GridGLL::ApplyDSS;
+
 	///	<summary>
-	///		Apply the direct stiffness summation (DSS) operation on the grid.
+	///		Apply the direct stiffness summation (DSS) operation on the grid
+	///		to several DataTypes, exchanging all DataTypes together.
 	///	</summary>
 	virtual void ApplyDSS(
 		int iDataUpdate,
-		DataType eDataType = DataType_State
+		const DataTypeVector & vecDataTypes
+	);
+
+protected:
+	///	<summary>
+	///		Apply DSS on the active patch with index n.  If fPatchEdges
+	///		is false only element edges that do not require halo data are
+	///		averaged; otherwise halo data is post-processed and the
+	///		remaining element edges are averaged.
+	///	</summary>
+	void ApplyPatchDSS(
+		int n,
+		int iDataUpdate,
+		DataType eDataType,
+		bool fPatchEdges
 	);
 };
 
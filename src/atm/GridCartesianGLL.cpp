@@ -131,100 +131,31 @@ void GridCartesianGLL::ApplyDefaultPatchLayout(
 		_EXCEPTIONT("ApplyDefaultPatchLayout() must be called on an empty Grid");
 	}
 
-	// Determine number of usable processors
-	int nProcsPerDirection = nPatchCount;
-
-	int nDistributedPatches = nProcsPerDirection;
-
-	// Determine arrangement of elements on processors
-	// SINGLE RECTANGULAR PATCH
-	if (GetABaseResolution() * GetBBaseResolution() % nProcsPerDirection != 0) {
-		_EXCEPTIONT("\n(UNIMPLEMENTED) Currently Alpha-Beta elements must be "
-			"equally divided among processors.");
+	if (nPatchCount > m_aPatchBoxes.GetRows()) {
+		_EXCEPTION2("Patch count (%i) exceeds maximum patch count (%i)",
+			nPatchCount, m_aPatchBoxes.GetRows());
 	}
 
-	bool fCartXZ = GetIsCartesianXZ();
-	int nProcsADirection = 0;
-	int nProcsBDirection = 0;
-
-	// Handle special case of 2 or 3 processors (laptop testing)
-	if (fCartXZ || (nDistributedPatches < 4)) {
-		nProcsADirection = nProcsPerDirection;
-		nProcsBDirection = 1;
-	}
-/*
-	// Allow 3D cases to split the Beta elements once (EVEN NUMBER OF PROCESSORS)
-	else if (!fCartXZ && (nProcsPerDirection % 2 == 0)) {
-		# pragma message "3D Cartesian processor layout..."
-		nProcsADirection = (int) (nProcsPerDirection / 2);
-		nProcsBDirection = 2;
-	}
-	else if (!fCartXZ && 
-			 (nProcsADirection * nProcsBDirection != nDistributedPatches)) {
-		_EXCEPTIONT("Even number of processors required"
-			"for 3D Cartesian cases.");
-	}
-*/
-	// Default to alpha wise strips
-	else {
-		nProcsADirection = nProcsPerDirection;
-		nProcsBDirection = 1;
-	}
+	// Split the single panel into patches
+	DataArray2D<int> iBoxes;
+	PartitionPanel(
+		GetABaseResolution(),
+		GetBBaseResolution(),
+		nPatchCount,
+		iBoxes);
 
-	//nProcsADirection = nProcsPerDirection;
-	//nProcsBDirection = 1;
-
-	int nElementsPerDirectionA = GetABaseResolution() / nProcsADirection;
-	DataArray1D<int> iBoxBeginA(nProcsADirection + 1);
-
-	int nElementsPerDirectionB = GetBBaseResolution() / nProcsBDirection;
-	DataArray1D<int> iBoxBeginB(nProcsBDirection + 1);
-
-	// Set the patch array for Alpha
-	iBoxBeginA[0] = 0;
-	for (int n = 1; n < nProcsADirection; n++) {
-		iBoxBeginA[n] = n * nElementsPerDirectionA;
-	}
-	iBoxBeginA[nProcsADirection] = GetABaseResolution();
-
-	// Set the patch array for Beta
-	iBoxBeginB[0] = 0;
-	for (int n = 1; n < nProcsBDirection; n++) {
-		iBoxBeginB[n] = n * nElementsPerDirectionB;
-	}
-	iBoxBeginB[nProcsBDirection] = GetBBaseResolution();
-
-/*
-	// Single panel 0 implementation (Cartesian Grid)
-	// Rectangular alpha-wise patches that span all of the beta direction
-	// (as many as there are processors available)
-	for (int i = 0; i < nProcsPerDirection; i++) {
-
-		// Patch strips that span beta
-		m_aPatchBoxes[i] = PatchBox(
-			0, 0, m_model.GetHaloElements(),
-			m_nHorizontalOrder * iBoxBegin[i],
-			m_nHorizontalOrder * iBoxBegin[i+1],
-			0,
-			m_nHorizontalOrder * GetBBaseResolution());
-	}
-*/
-	// Create master patch for each panel
 	int ixPatch = 0;
 
-	for (int i = 0; i < nProcsADirection; i++) {
-	for (int j = 0; j < nProcsBDirection; j++) {
-
+	for (int p = 0; p < nPatchCount; p++) {
 		m_aPatchBoxes[ixPatch] = PatchBox(
 			0, 0, m_model.GetHaloElements(),
-			m_nHorizontalOrder * iBoxBeginA[i],
-			m_nHorizontalOrder * iBoxBeginA[i+1],
-			m_nHorizontalOrder * iBoxBeginB[j],
-			m_nHorizontalOrder * iBoxBeginB[j+1]);
+			m_nHorizontalOrder * iBoxes[p][0],
+			m_nHorizontalOrder * iBoxes[p][1],
+			m_nHorizontalOrder * iBoxes[p][2],
+			m_nHorizontalOrder * iBoxes[p][3]);
 
 		ixPatch++;
 	}
-	}
 
 	m_nInitializedPatchBoxes = ixPatch;
 }
@@ -507,148 +438,256 @@ void GridCartesianGLL::GetOpposingDirection(
 
 void GridCartesianGLL::ApplyDSS(
 	int iDataUpdate,
-	DataType eDataType
+	const DataTypeVector & vecDataTypes
 ) {
-	// Exchange data between nodes
-	Exchange(eDataType, iDataUpdate);
+	// Exchange data between nodes, with all DataTypes packed
+	// into a single message per neighbor
+	DataTypeIndexVector vecDataTypeIndices;
+	for (int d = 0; d < vecDataTypes.size(); d++) {
+		vecDataTypeIndices.push_back(
+			std::pair<DataType, int>(vecDataTypes[d], iDataUpdate));
+	}
 
-	// Post-process velocities across panel edges and
-	// perform direct stiffness summation (DSS)
-	for (int n = 0; n < GetActivePatchCount(); n++) {
-		GridPatchCartesianGLL * pPatch =
-			dynamic_cast<GridPatchCartesianGLL*>(GetActivePatch(n));
+	ExchangeAndApply(
+		vecDataTypeIndices,
 
-		const PatchBox & box = pPatch->GetPatchBox();
+		// Perform direct stiffness summation (DSS) away from patch edges
+		// while halo data is in transit
+		[&](int n) {
+			for (int d = 0; d < vecDataTypes.size(); d++) {
+				ApplyPatchDSS(n, iDataUpdate, vecDataTypes[d], false);
+			}
+		},
 
-		// Patch-specific quantities
-		int nElementCountA = pPatch->GetElementCountA();
-		int nElementCountB = pPatch->GetElementCountB();
+		// Post-process velocities, apply boundary conditions and
+		// perform DSS along patch edges
+		[&](int n) {
+			for (int d = 0; d < vecDataTypes.size(); d++) {
+				ApplyPatchDSS(n, iDataUpdate, vecDataTypes[d], true);
+			}
+		});
+}
 
-		// Apply panel transforms to velocity data
-		if (eDataType == DataType_State) {
-			pPatch->TransformHaloVelocities(iDataUpdate);
-		}
-		if (eDataType == DataType_TopographyDeriv) {
-			pPatch->TransformTopographyDeriv();
-		}
+///////////////////////////////////////////////////////////////////////////////
 
-		// Loop through all components associated with this DataType
-		int nComponents;
-		if (eDataType == DataType_State) {
-			nComponents = m_model.GetEquationSet().GetComponents();
-		} else if (eDataType == DataType_Tracers) {
-			nComponents = m_model.GetEquationSet().GetTracers();
-		} else if (eDataType == DataType_Vorticity) {
-			nComponents = 1;
-		} else if (eDataType == DataType_Divergence) {
-			nComponents = 1;
-		} else if (eDataType == DataType_TopographyDeriv) {
-			nComponents = 2;
-		} else {
-			_EXCEPTIONT("Invalid DataType");
-		}
+///	<summary>
+///		Average the given data across element edges, either along the
+///		edges of the patch or in its interior.  T is the storage type of
+///		the data (double, or float for single precision tracers).
+///	</summary>
+template <typename T>
+static void AverageElementEdges(
+	DataArray3D<T> & pDataUpdate,
+	const PatchBox & box,
+	int nHorizontalOrder,
+	int nElementCountA,
+	int nElementCountB,
+	bool fPatchEdges
+) {
+	const int nRElements = pDataUpdate.GetSize(0);
 
-		// Apply BC only to state DSS
-		if (eDataType == DataType_State) {
-			pPatch->ApplyBoundaryConditions(iDataUpdate, DataType_State, n);
-		}
+	// Averaging DSS across patch boundaries
+	for (int k = 0; k < nRElements; k++) {
 
-		// Perform Direct Stiffness Summation (DSS)
-		for (int c = 0; c < nComponents; c++) {
+		// Average in the alpha direction
+		for (int a = 0; a <= nElementCountA; a++) {
+			int iA = a * nHorizontalOrder + box.GetHaloElements();
 
-			// Obtain the array of working data
-			int nRElements = GetRElements();
+			bool fEdgeA = ((a == 0) || (a == nElementCountA));
+			if (fEdgeA && !fPatchEdges) {
+				continue;
+			}
 
-			DataArray3D<double> pDataUpdate;
+			// Averaging done at the corners of the panel
+			int jBegin = box.GetBInteriorBegin()-1;
+			int jEnd = box.GetBInteriorEnd()+1;
 
-			if ((eDataType == DataType_State) &&
-				(GetVarLocation(c) == DataLocation_REdge)
-			) {
-				nRElements++;
+			// Perform averaging across edge of patch
+			for (int j = jBegin; j < jEnd; j++) {
+
+				// Nodes on the first and last row of the patch
+				// interior, or in the halo, are averaged along
+				// with the patch edges
+				bool fNearEdge =
+					(j <= box.GetBInteriorBegin()) ||
+					(j >= box.GetBInteriorEnd()-1);
+
+				if (!fEdgeA && (fNearEdge != fPatchEdges)) {
+					continue;
+				}
+
+				pDataUpdate[k][iA][j] = 0.5 * (
+					+ pDataUpdate[k][iA  ][j]
+					+ pDataUpdate[k][iA-1][j]);
+
+				pDataUpdate[k][iA-1][j] = pDataUpdate[k][iA][j];
+			}
+		}
+
+		// Average in the beta direction
+		for (int b = 0; b <= nElementCountB; b++) {
+			int iB = b * nHorizontalOrder + box.GetHaloElements();
+
+			bool fEdgeB = ((b == 0) || (b == nElementCountB));
+			if (fEdgeB && !fPatchEdges) {
+				continue;
 			}
-			if (eDataType == DataType_TopographyDeriv) {
-				nRElements = 2;
+
+			// Averaging done at the corners of the panel
+			int iBegin = box.GetAInteriorBegin()-1;
+			int iEnd = box.GetAInteriorEnd()+1;
+
+			for (int i = iBegin; i < iEnd; i++) {
+
+				bool fNearEdge =
+					(i <= box.GetAInteriorBegin()) ||
+					(i >= box.GetAInteriorEnd()-1);
+
+				if (!fEdgeB && (fNearEdge != fPatchEdges)) {
+					continue;
+				}
+
+				pDataUpdate[k][i][iB] = 0.5 * (
+					+ pDataUpdate[k][i][iB  ]
+					+ pDataUpdate[k][i][iB-1]);
+
+				pDataUpdate[k][i][iB-1] = pDataUpdate[k][i][iB];
 			}
+		}
+	}
+}
 
-			pDataUpdate.SetSize(
-				nRElements,
-				box.GetATotalWidth(),
-				box.GetBTotalWidth());
+///////////////////////////////////////////////////////////////////////////////
+
+void GridCartesianGLL::ApplyPatchDSS(
+	int n,
+	int iDataUpdate,
+	DataType eDataType,
+	bool fPatchEdges
+) {
+	GridPatchCartesianGLL * pPatch =
+		dynamic_cast<GridPatchCartesianGLL*>(GetActivePatch(n));
+
+	const PatchBox & box = pPatch->GetPatchBox();
+
+	// Patch-specific quantities
+	int nElementCountA = pPatch->GetElementCountA();
+	int nElementCountB = pPatch->GetElementCountB();
+
+	// Apply panel transforms to velocity data
+	if (fPatchEdges) {
+		if (eDataType == DataType_State) {
+			pPatch->TransformHaloVelocities(iDataUpdate);
+		}
+		if (eDataType == DataType_TopographyDeriv) {
+			pPatch->TransformTopographyDeriv();
+		}
+	}
 
-			// State data
-			if (eDataType == DataType_State) {
-				DataArray4D<double> & dState =
-					pPatch->GetDataState(iDataUpdate, GetVarLocation(c));
+	// Loop through all components associated with this DataType
+	int nComponents;
+	if (eDataType == DataType_State) {
+		nComponents = m_model.GetEquationSet().GetComponents();
+	} else if (eDataType == DataType_Tracers) {
+		nComponents = m_model.GetEquationSet().GetTracers();
+	} else if (eDataType == DataType_Vorticity) {
+		nComponents = 1;
+	} else if (eDataType == DataType_Divergence) {
+		nComponents = 1;
+	} else if (eDataType == DataType_TopographyDeriv) {
+		nComponents = 2;
+	} else {
+		_EXCEPTIONT("Invalid DataType");
+	}
 
-				pDataUpdate.AttachToData(&(dState[c][0][0][0]));
+	// Apply BC only to state DSS
+	if (fPatchEdges && (eDataType == DataType_State)) {
+		pPatch->ApplyBoundaryConditions(iDataUpdate, DataType_State, n);
+	}
 
-			// Tracer data
-			} else if (eDataType == DataType_Tracers) {
-				DataArray4D<double> & dTracers =
-					pPatch->GetDataTracers(iDataUpdate);
+	// Perform Direct Stiffness Summation (DSS)
+	for (int c = 0; c < nComponents; c++) {
 
-				pDataUpdate.AttachToData(&(dTracers[c][0][0][0]));
+		// Obtain the array of working data
+		int nRElements = GetRElements();
 
-			// Vorticity data
-			} else if (eDataType == DataType_Vorticity) {
-				DataArray3D<double> & dVorticity =
-					pPatch->GetDataVorticity();
+		DataArray3D<double> pDataUpdate;
+		TracerArray3D pTracerUpdate;
 
-				pDataUpdate.AttachToData(&(dVorticity[0][0][0]));
+		if ((eDataType == DataType_State) &&
+			(GetVarLocation(c) == DataLocation_REdge)
+		) {
+			nRElements++;
+		}
+		if (eDataType == DataType_TopographyDeriv) {
+			nRElements = 2;
+		}
 
-			// Divergence data
-			} else if (eDataType == DataType_Divergence) {
-				DataArray3D<double> & dDivergence =
-					pPatch->GetDataDivergence();
+		pDataUpdate.SetSize(
+			nRElements,
+			box.GetATotalWidth(),
+			box.GetBTotalWidth());
 
-				pDataUpdate.AttachToData(&(dDivergence[0][0][0]));
+		// State data
+		if (eDataType == DataType_State) {
+			DataArray4D<double> & dState =
+				pPatch->GetDataState(iDataUpdate, GetVarLocation(c));
 
-			// Topographic derivative data
-			} else if (eDataType == DataType_TopographyDeriv) {
-				DataArray3D<double> & dTopographyDeriv =
-					pPatch->GetTopographyDeriv();
+			pDataUpdate.SetColumnLayout(dState.IsColumnLayout());
+			pDataUpdate.AttachToData(&(dState[c][0][0][0]));
 
-				pDataUpdate.AttachToData(&(dTopographyDeriv[0][0][0]));
-			}
+		// Tracer data
+		} else if (eDataType == DataType_Tracers) {
+			TracerArray4D & dTracers =
+				pPatch->GetDataTracers(iDataUpdate);
 
-			// Averaging DSS across patch boundaries
-			for (int k = 0; k < nRElements; k++) {
+			pTracerUpdate.SetSize(
+				nRElements,
+				box.GetATotalWidth(),
+				box.GetBTotalWidth());
 
-				// Average in the alpha direction
-				for (int a = 0; a <= nElementCountA; a++) {
-					int iA = a * m_nHorizontalOrder + box.GetHaloElements();
+			pTracerUpdate.SetColumnLayout(dTracers.IsColumnLayout());
+			pTracerUpdate.AttachToData(&(dTracers[c][0][0][0]));
 
-					// Averaging done at the corners of the panel
-					int jBegin = box.GetBInteriorBegin()-1;
-					int jEnd = box.GetBInteriorEnd()+1;
+		// Vorticity data
+		} else if (eDataType == DataType_Vorticity) {
+			DataArray3D<double> & dVorticity =
+				pPatch->GetDataVorticity();
 
-					// Perform averaging across edge of patch
-					for (int j = jBegin; j < jEnd; j++) {
-						pDataUpdate[k][iA][j] = 0.5 * (
-							+ pDataUpdate[k][iA  ][j]
-							+ pDataUpdate[k][iA-1][j]);
+			pDataUpdate.AttachToData(&(dVorticity[0][0][0]));
 
-						pDataUpdate[k][iA-1][j] = pDataUpdate[k][iA][j];
-					}
-				}
+		// Divergence data
+		} else if (eDataType == DataType_Divergence) {
+			DataArray3D<double> & dDivergence =
+				pPatch->GetDataDivergence();
 
-				// Average in the beta direction
-				for (int b = 0; b <= nElementCountB; b++) {
-					int iB = b * m_nHorizontalOrder + box.GetHaloElements();
+			pDataUpdate.AttachToData(&(dDivergence[0][0][0]));
 
-					// Averaging done at the corners of the panel
-					int iBegin = box.GetAInteriorBegin()-1;
-					int iEnd = box.GetAInteriorEnd()+1;
+		// Topographic derivative data
+		} else if (eDataType == DataType_TopographyDeriv) {
+			DataArray3D<double> & dTopographyDeriv =
+				pPatch->GetTopographyDeriv();
 
-					for (int i = iBegin; i < iEnd; i++) {
-						pDataUpdate[k][i][iB] = 0.5 * (
-							+ pDataUpdate[k][i][iB  ]
-							+ pDataUpdate[k][i][iB-1]);
+			pDataUpdate.AttachToData(&(dTopographyDeriv[0][0][0]));
+		}
 
-						pDataUpdate[k][i][iB-1] = pDataUpdate[k][i][iB];
-					}
-				}
-			}
+		// Average across element edges
+		if (eDataType == DataType_Tracers) {
+			AverageElementEdges(
+				pTracerUpdate,
+				box,
+				m_nHorizontalOrder,
+				nElementCountA,
+				nElementCountB,
+				fPatchEdges);
+		} else {
+			AverageElementEdges(
+				pDataUpdate,
+				box,
+				m_nHorizontalOrder,
+				nElementCountA,
+				nElementCountB,
+				fPatchEdges);
 		}
 	}
 }
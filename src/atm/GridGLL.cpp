@@ -570,7 +570,7 @@ void GridGLL::EvaluateTestCase(
 
 void GridGLL::PostProcessSubstage(
 	int iDataUpdate,
-	DataType eDataType
+	const DataTypeVector & vecDataTypes
 ) {
 	// Block parallel exchanges
 	if (m_fBlockParallelExchange) {
@@ -578,7 +578,7 @@ void GridGLL::PostProcessSubstage(
 	}
 
 	// Apply Direct Stiffness Summation
-	ApplyDSS(iDataUpdate, eDataType);
+	ApplyDSS(iDataUpdate, vecDataTypes);
 
 }
 
@@ -596,8 +596,7 @@ void GridGLL::ComputeVorticityDivergence(
 	Grid::ComputeVorticityDivergence(iDataIndex);
 
 	// Apply DSS
-	ApplyDSS(0, DataType_Vorticity);
-	ApplyDSS(0, DataType_Divergence);
+	ApplyDSS(0, {DataType_Vorticity, DataType_Divergence});
 
 }
 
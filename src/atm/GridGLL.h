@@ -80,21 +80,34 @@ public:
 	);
 
 public:
+	using Grid::PostProcessSubstage;
+
 	///	<summary>
-	///		Perform post-processing of variables on the grid after each
-	///		TimeStep substage.
+	///		Perform post-processing of several DataTypes on the grid after
+	///		each TimeStep substage, exchanging all DataTypes together.
 	///	</summary>
 	virtual void PostProcessSubstage(
 		int iDataUpdate,
-		DataType eDataType = DataType_State
+		const DataTypeVector & vecDataTypes
 	);
 
 	///	<summary>
 	///		Apply the direct stiffness summation (DSS) operation on the grid.
 	///	</summary>
-	virtual void ApplyDSS(
+	void ApplyDSS(
 		int iDataUpdate,
 		DataType eDataType = DataType_State
+	) {
+		ApplyDSS(iDataUpdate, DataTypeVector(1, eDataType));
+	}
+
+	///	<summary>
+	///		Apply the direct stiffness summation (DSS) operation on the grid
+	///		to several DataTypes, exchanging all DataTypes together.
+	///	</summary>
+	virtual void ApplyDSS(
+		int iDataUpdate,
+		const DataTypeVector & vecDataTypes
 	) {
 		_EXCEPTIONT("Unimplemented");
 	}
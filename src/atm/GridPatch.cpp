@@ -20,11 +20,126 @@
 #include "EquationSet.h"
 #include "Defines.h"
 #include <cfloat>
+#include <algorithm>
 
 #include <mpi.h>
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		Store the levels of each node contiguously in the state and tracer
+///		data (see mk/config.make, LAYOUT=COLUMN).
+///	</summary>
+#if defined(TEMPEST_COLUMN_LAYOUT)
+static const bool StateColumnLayout = true;
+#else
+static const bool StateColumnLayout = false;
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Number of entries per block in LinearCombineArrays.  The accumulator
+///		for one block stays in L1 cache while each term is added to it.
+///	</summary>
+static const size_t LinearCombineBlockSize = 512;
+
+///	<summary>
+///		Compute dDest = dDestCoeff * dDest + sum_t vecCoeff[t] * vecSource[t]
+///		in a single pass over memory, also storing the result in dCopy if it
+///		is not NULL.  Terms are accumulated in the same order as Scale()
+///		followed by AddProduct(), so results are bitwise identical.  The
+///		accumulator is double precision for any storage type T.
+///	</summary>
+template <typename T>
+static void LinearCombineArrays(
+	size_t sTotalSize,
+	double dDestCoeff,
+	T * dDest,
+	T * dCopy,
+	const std::vector<const T *> & vecSource,
+	const std::vector<double> & vecCoeff
+) {
+	double dAccum[LinearCombineBlockSize];
+
+	for (size_t i0 = 0; i0 < sTotalSize; i0 += LinearCombineBlockSize) {
+		const size_t sBlock =
+			std::min(LinearCombineBlockSize, sTotalSize - i0);
+
+		T * pDest = dDest + i0;
+
+		if (dDestCoeff == 0.0) {
+			for (size_t i = 0; i < sBlock; i++) {
+				dAccum[i] = 0.0;
+			}
+		} else {
+			for (size_t i = 0; i < sBlock; i++) {
+				dAccum[i] = pDest[i] * dDestCoeff;
+			}
+		}
+
+		for (int t = 0; t < vecSource.size(); t++) {
+			const T * pSource = vecSource[t] + i0;
+			const double dCoeff = vecCoeff[t];
+			for (size_t i = 0; i < sBlock; i++) {
+				dAccum[i] += pSource[i] * dCoeff;
+			}
+		}
+
+		for (size_t i = 0; i < sBlock; i++) {
+			pDest[i] = dAccum[i];
+		}
+
+		if (dCopy != NULL) {
+			T * pCopy = dCopy + i0;
+			for (size_t i = 0; i < sBlock; i++) {
+				pCopy[i] = dAccum[i];
+			}
+		}
+	}
+}
+
+///	<summary>
+///		Apply LinearCombineArrays to one set of data instances, skipping
+///		terms with a zero coefficient.
+///	</summary>
+template <typename T>
+static void LinearCombineInstances(
+	const DataArray1D<double> & dCoeff,
+	int ixDest,
+	int ixCopy,
+	std::vector< DataArray4D<T> > & datavec
+) {
+	std::vector<const T *> vecSource;
+	std::vector<double> vecCoeff;
+
+	for (int m = 0; m < dCoeff.GetRows(); m++) {
+		if (m == ixDest) {
+			continue;
+		}
+		if (dCoeff[m] == 0.0) {
+			continue;
+		}
+		vecSource.push_back(&(datavec[m][0][0][0][0]));
+		vecCoeff.push_back(dCoeff[m]);
+	}
+
+	T * dCopy = NULL;
+	if ((ixCopy >= 0) && (ixCopy != ixDest)) {
+		dCopy = &(datavec[ixCopy][0][0][0][0]);
+	}
+
+	LinearCombineArrays(
+		datavec[ixDest].GetTotalSize(),
+		dCoeff[ixDest],
+		&(datavec[ixDest][0][0][0][0]),
+		dCopy,
+		vecSource,
+		vecCoeff);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 GridPatch::GridPatch(
 	Grid & grid,
 	int ixPatch,
@@ -36,6 +151,10 @@ GridPatch::GridPatch(
 	m_box(box),
 	m_fContainsData(false)
 {
+	m_dcGeometric.SetMemoryCategory("Geometric");
+	m_dcActiveState.SetMemoryCategory("ActiveState");
+	m_dcBufferState.SetMemoryCategory("BufferState");
+	m_dcAuxiliary.SetMemoryCategory("Auxiliary");
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -122,6 +241,92 @@ void GridPatch::InitializeDataLocal(
 		m_box.GetBTotalWidth(),
 		2);
 
+	// Vertical coordinate transform profile
+	m_dataVerticalTransformNode.SetSize(
+		m_grid.GetRElements(),
+		VerticalTransform_Count);
+
+	m_dataVerticalTransformREdge.SetSize(
+		m_grid.GetRElements()+1,
+		VerticalTransform_Count);
+
+#if defined(TEMPEST_COMPACT_GEOMETRY)
+	// 3D metric terms are rebuilt from the 2D metric, topography and
+	// vertical transform profile where they are used
+	m_dataJacobian.Initialize(
+		m_dataVerticalTransformNode,
+		m_dataTopography,
+		m_dataJacobian2D);
+
+	m_dataJacobianREdge.Initialize(
+		m_dataVerticalTransformREdge,
+		m_dataTopography,
+		m_dataJacobian2D);
+
+	m_dataContraMetricA.Initialize(
+		FactoredMetric4D::Field_ContraMetricA,
+		m_dataVerticalTransformNode,
+		m_dataTopography,
+		m_dataTopographyDeriv,
+		m_dataContraMetric2DA,
+		m_dataContraMetric2DB);
+
+	m_dataContraMetricB.Initialize(
+		FactoredMetric4D::Field_ContraMetricB,
+		m_dataVerticalTransformNode,
+		m_dataTopography,
+		m_dataTopographyDeriv,
+		m_dataContraMetric2DA,
+		m_dataContraMetric2DB);
+
+	m_dataContraMetricXi.Initialize(
+		FactoredMetric4D::Field_ContraMetricXi,
+		m_dataVerticalTransformNode,
+		m_dataTopography,
+		m_dataTopographyDeriv,
+		m_dataContraMetric2DA,
+		m_dataContraMetric2DB);
+
+	m_dataContraMetricAREdge.Initialize(
+		FactoredMetric4D::Field_ContraMetricA,
+		m_dataVerticalTransformREdge,
+		m_dataTopography,
+		m_dataTopographyDeriv,
+		m_dataContraMetric2DA,
+		m_dataContraMetric2DB);
+
+	m_dataContraMetricBREdge.Initialize(
+		FactoredMetric4D::Field_ContraMetricB,
+		m_dataVerticalTransformREdge,
+		m_dataTopography,
+		m_dataTopographyDeriv,
+		m_dataContraMetric2DA,
+		m_dataContraMetric2DB);
+
+	m_dataContraMetricXiREdge.Initialize(
+		FactoredMetric4D::Field_ContraMetricXi,
+		m_dataVerticalTransformREdge,
+		m_dataTopography,
+		m_dataTopographyDeriv,
+		m_dataContraMetric2DA,
+		m_dataContraMetric2DB);
+
+	m_dataDerivRNode.Initialize(
+		FactoredMetric4D::Field_DerivR,
+		m_dataVerticalTransformNode,
+		m_dataTopography,
+		m_dataTopographyDeriv,
+		m_dataContraMetric2DA,
+		m_dataContraMetric2DB);
+
+	m_dataDerivRREdge.Initialize(
+		FactoredMetric4D::Field_DerivR,
+		m_dataVerticalTransformREdge,
+		m_dataTopography,
+		m_dataTopographyDeriv,
+		m_dataContraMetric2DA,
+		m_dataContraMetric2DB);
+#else
 	// Jacobian at each node
 	m_dataJacobian.SetSize(
 		m_grid.GetRElements(),
@@ -204,6 +409,8 @@ void GridPatch::InitializeDataLocal(
 		m_box.GetBTotalWidth(),
 		3);
 
+#endif
+
 	// Element area at each node
 	m_dataElementArea.SetSize(
 		m_grid.GetRElements(),
@@ -261,6 +468,7 @@ void GridPatch::InitializeDataLocal(
 	// Initialize reference state
 	m_dataRefStateNode.SetDataType(DataType_State);
 	m_dataRefStateNode.SetDataLocation(DataLocation_Node);
+	m_dataRefStateNode.SetColumnLayout(StateColumnLayout);
 	m_dataRefStateNode.SetSize(
 		eqn.GetComponents(),
 		m_grid.GetRElements(),
@@ -269,6 +477,7 @@ void GridPatch::InitializeDataLocal(
 
 	m_dataRefStateREdge.SetDataType(DataType_State);
 	m_dataRefStateREdge.SetDataLocation(DataLocation_REdge);
+	m_dataRefStateREdge.SetColumnLayout(StateColumnLayout);
 	m_dataRefStateREdge.SetSize(
 		eqn.GetComponents(),
 		m_grid.GetRElements()+1,
@@ -277,6 +486,7 @@ void GridPatch::InitializeDataLocal(
 
 	m_dataRefTracers.SetDataType(DataType_Tracers);
 	m_dataRefTracers.SetDataLocation(DataLocation_Node);
+	m_dataRefTracers.SetColumnLayout(StateColumnLayout);
 	m_dataRefTracers.SetSize(
 		eqn.GetTracers(),
 		m_grid.GetRElements(),
@@ -310,6 +520,9 @@ void GridPatch::InitializeDataLocal(
 	m_dcGeometric.PushDataChunk(&m_dataContraMetric2DB);
 	m_dcGeometric.PushDataChunk(&m_dataCovMetric2DA);
 	m_dcGeometric.PushDataChunk(&m_dataCovMetric2DB);
+	m_dcGeometric.PushDataChunk(&m_dataVerticalTransformNode);
+	m_dcGeometric.PushDataChunk(&m_dataVerticalTransformREdge);
+#if !defined(TEMPEST_COMPACT_GEOMETRY)
 	m_dcGeometric.PushDataChunk(&m_dataJacobian);
 	m_dcGeometric.PushDataChunk(&m_dataJacobianREdge);
 	m_dcGeometric.PushDataChunk(&m_dataContraMetricA);
@@ -325,6 +538,7 @@ void GridPatch::InitializeDataLocal(
 	m_dcGeometric.PushDataChunk(&m_dataContraMetricXiREdge);
 	m_dcGeometric.PushDataChunk(&m_dataDerivRNode);
 	m_dcGeometric.PushDataChunk(&m_dataDerivRREdge);
+#endif
 	m_dcGeometric.PushDataChunk(&m_dataElementArea);
 	m_dcGeometric.PushDataChunk(&m_dataElementAreaREdge);
 	m_dcGeometric.PushDataChunk(&m_dataTopography);
@@ -356,6 +570,7 @@ void GridPatch::InitializeDataLocal(
 	for (int m = 0; m < model.GetComponentDataInstances(); m++) {
 		m_datavecStateNode[m].SetDataType(DataType_State);
 		m_datavecStateNode[m].SetDataLocation(DataLocation_Node);
+		m_datavecStateNode[m].SetColumnLayout(StateColumnLayout);
 		m_datavecStateNode[m].SetSize(
 			eqn.GetComponents(),
 			m_grid.GetRElements(),
@@ -364,6 +579,7 @@ void GridPatch::InitializeDataLocal(
 
 		m_datavecStateREdge[m].SetDataType(DataType_State);
 		m_datavecStateREdge[m].SetDataLocation(DataLocation_REdge);
+		m_datavecStateREdge[m].SetColumnLayout(StateColumnLayout);
 		m_datavecStateREdge[m].SetSize(
 			eqn.GetComponents(),
 			m_grid.GetRElements()+1,
@@ -391,6 +607,7 @@ void GridPatch::InitializeDataLocal(
 		for (int m = 0; m < model.GetTracerDataInstances(); m++) {
 			m_datavecTracers[m].SetDataType(DataType_Tracers);
 			m_datavecTracers[m].SetDataLocation(DataLocation_Node);
+			m_datavecTracers[m].SetColumnLayout(StateColumnLayout);
 			m_datavecTracers[m].SetSize(
 				eqn.GetTracers(),
 				m_grid.GetRElements(),
@@ -688,33 +905,77 @@ void GridPatch::ComputeTemperature(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		Accumulate the checksum of the given variables of one data array,
+///		weighted by the given element areas, over the interior of a patch.
+///	</summary>
+template <typename T>
+static void ChecksumArray(
+	const DataArray4D<T> & data,
+	const std::vector<int> & vars,
+	int nLevels,
+	const PatchBox & box,
+	const DataArray3D<double> & dArea,
+	ChecksumType eChecksumType,
+	DataArray1D<double> & dChecksums
+) {
+	for (int c = 0; c < vars.size(); c++) {
+	for (int k = 0; k < nLevels; k++) {
+	for (int i = box.GetAInteriorBegin(); i < box.GetAInteriorEnd(); i++) {
+	for (int j = box.GetBInteriorBegin(); j < box.GetBInteriorEnd(); j++) {
+		double dValue = data[vars[c]][k][i][j];
+
+		// ChecksumType_Sum
+		if (eChecksumType == ChecksumType_Sum) {
+			dChecksums[vars[c]] += dValue * dArea[k][i][j];
+
+		// ChecksumType_L1
+		} else if (eChecksumType == ChecksumType_L1) {
+			dChecksums[vars[c]] += fabs(dValue) * dArea[k][i][j];
+
+		// ChecksumType_L2
+		} else if (eChecksumType == ChecksumType_L2) {
+			dChecksums[vars[c]] += dValue * dValue * dArea[k][i][j];
+
+		// ChecksumType_Linf
+		} else {
+			if (fabs(dValue) > dChecksums[vars[c]]) {
+				dChecksums[vars[c]] = fabs(dValue);
+			}
+		}
+	}
+	}
+	}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void GridPatch::Checksum(
 	DataType eDataType,
 	DataArray1D<double> & dChecksums,
 	int iDataIndex,
 	ChecksumType eChecksumType
 ) const {
-	int c;
-	int i;
-	int j;
-	int k;
 
 	// Verify consistency in number of components
 	if (!m_fContainsData) {
 		_EXCEPTIONT("Checksum called on uninitialized GridPatch");
 	}
 
-	// State variables
-	DataArray4D<double> const * pDataNode;
-	DataArray4D<double> const * pDataREdge;
+	if ((eChecksumType != ChecksumType_Sum) &&
+	    (eChecksumType != ChecksumType_L1) &&
+	    (eChecksumType != ChecksumType_L2) &&
+	    (eChecksumType != ChecksumType_Linf)
+	) {
+		_EXCEPTIONT("Invalid DataType in Checksum: Expected State or Tracers");
+	}
 
 	std::vector<int> nodevars;
 	std::vector<int> redgevars;
 
 	// State data
 	if (eDataType == DataType_State) {
-		pDataNode  = &(m_datavecStateNode[iDataIndex]);
-		pDataREdge = &(m_datavecStateREdge[iDataIndex]);
 
 		// Variables on nodes
 		int nComponents = m_grid.GetModel().GetEquationSet().GetComponents();
@@ -732,10 +993,26 @@ void GridPatch::Checksum(
 			_EXCEPTIONT("Invalid Checksum count");
 		}
 
+		ChecksumArray(
+			m_datavecStateNode[iDataIndex],
+			nodevars,
+			m_grid.GetRElements(),
+			m_box,
+			m_dataElementArea,
+			eChecksumType,
+			dChecksums);
+
+		ChecksumArray(
+			m_datavecStateREdge[iDataIndex],
+			redgevars,
+			m_grid.GetRElements()+1,
+			m_box,
+			m_dataElementAreaREdge,
+			eChecksumType,
+			dChecksums);
+
 	// Tracer data
 	} else if (eDataType == DataType_Tracers) {
-		pDataNode  = &(m_datavecTracers[iDataIndex]);
-		pDataREdge = NULL;
 
 		int nTracers = m_grid.GetModel().GetEquationSet().GetTracers();
 		for (int c = 0; c < nTracers; c++) {
@@ -746,119 +1023,17 @@ void GridPatch::Checksum(
 			_EXCEPTIONT("Invalid Checksum count");
 		}
 
-	} else {
-		_EXCEPTIONT("Invalid DataType.");
-	}
-
-	// ChecksumType_Sum
-	if (eChecksumType == ChecksumType_Sum) {
-		for (c = 0; c < nodevars.size(); c++) {
-		for (k = 0; k < m_grid.GetRElements(); k++) {
-		for (i = m_box.GetAInteriorBegin(); i < m_box.GetAInteriorEnd(); i++) {
-		for (j = m_box.GetBInteriorBegin(); j < m_box.GetBInteriorEnd(); j++) {
-			dChecksums[nodevars[c]] +=
-				  (*pDataNode)[nodevars[c]][k][i][j]
-				* m_dataElementArea[k][i][j];
-		}
-		}
-		}
-		}
-
-		for (c = 0; c < redgevars.size(); c++) {
-		for (k = 0; k <= m_grid.GetRElements(); k++) {
-		for (i = m_box.GetAInteriorBegin(); i < m_box.GetAInteriorEnd(); i++) {
-		for (j = m_box.GetBInteriorBegin(); j < m_box.GetBInteriorEnd(); j++) {
-			dChecksums[redgevars[c]] +=
-				  (*pDataREdge)[redgevars[c]][k][i][j]
-				* m_dataElementAreaREdge[k][i][j];
-		}
-		}
-		}
-		}
-
-	// ChecksumType_L1
-	} else if (eChecksumType == ChecksumType_L1) {
-		for (c = 0; c < nodevars.size(); c++) {
-		for (k = 0; k < m_grid.GetRElements(); k++) {
-		for (i = m_box.GetAInteriorBegin(); i < m_box.GetAInteriorEnd(); i++) {
-		for (j = m_box.GetBInteriorBegin(); j < m_box.GetBInteriorEnd(); j++) {
-			double dValue = fabs((*pDataNode)[nodevars[c]][k][i][j]);
-			dChecksums[nodevars[c]] +=
-				dValue * m_dataElementArea[k][i][j];
-		}
-		}
-		}
-		}
-
-		for (c = 0; c < redgevars.size(); c++) {
-		for (k = 0; k <= m_grid.GetRElements(); k++) {
-		for (i = m_box.GetAInteriorBegin(); i < m_box.GetAInteriorEnd(); i++) {
-		for (j = m_box.GetBInteriorBegin(); j < m_box.GetBInteriorEnd(); j++) {
-			double dValue = fabs((*pDataREdge)[redgevars[c]][k][i][j]);
-			dChecksums[redgevars[c]] +=
-				dValue * m_dataElementAreaREdge[k][i][j];
-		}
-		}
-		}
-		}
-
-	// ChecksumType_L2
-	} else if (eChecksumType == ChecksumType_L2) {
-		for (c = 0; c < nodevars.size(); c++) {
-		for (k = 0; k < m_grid.GetRElements(); k++) {
-		for (i = m_box.GetAInteriorBegin(); i < m_box.GetAInteriorEnd(); i++) {
-		for (j = m_box.GetBInteriorBegin(); j < m_box.GetBInteriorEnd(); j++) {
-			double dValue = (*pDataNode)[nodevars[c]][k][i][j];
-			dChecksums[nodevars[c]] +=
-				dValue * dValue * m_dataElementArea[k][i][j];
-		}
-		}
-		}
-		}
-
-		for (c = 0; c < redgevars.size(); c++) {
-		for (k = 0; k <= m_grid.GetRElements(); k++) {
-		for (i = m_box.GetAInteriorBegin(); i < m_box.GetAInteriorEnd(); i++) {
-		for (j = m_box.GetBInteriorBegin(); j < m_box.GetBInteriorEnd(); j++) {
-			double dValue = (*pDataREdge)[redgevars[c]][k][i][j];
-			dChecksums[redgevars[c]] +=
-				dValue * dValue * m_dataElementAreaREdge[k][i][j];
-		}
-		}
-		}
-		}
-
-	// ChecksumType_Linf
-	} else if (eChecksumType == ChecksumType_Linf) {
-		for (c = 0; c < nodevars.size(); c++) {
-		for (k = 0; k < m_grid.GetRElements(); k++) {
-		for (i = m_box.GetAInteriorBegin(); i < m_box.GetAInteriorEnd(); i++) {
-		for (j = m_box.GetBInteriorBegin(); j < m_box.GetBInteriorEnd(); j++) {
-			double dValue = (*pDataNode)[nodevars[c]][k][i][j];
-			if (fabs(dValue) > dChecksums[nodevars[c]]) {
-				dChecksums[nodevars[c]] = fabs(dValue);
-			}
-		}
-		}
-		}
-		}
-
-		for (c = 0; c < redgevars.size(); c++) {
-		for (k = 0; k <= m_grid.GetRElements(); k++) {
-		for (i = m_box.GetAInteriorBegin(); i < m_box.GetAInteriorEnd(); i++) {
-		for (j = m_box.GetBInteriorBegin(); j < m_box.GetBInteriorEnd(); j++) {
-			double dValue = (*pDataREdge)[redgevars[c]][k][i][j];
-			if (fabs(dValue) > dChecksums[redgevars[c]]) {
-				dChecksums[redgevars[c]] = fabs(dValue);
-			}
-		}
-		}
-		}
-		}
+		ChecksumArray(
+			m_datavecTracers[iDataIndex],
+			nodevars,
+			m_grid.GetRElements(),
+			m_box,
+			m_dataElementArea,
+			eChecksumType,
+			dChecksums);
 
-	// Invalid data type
 	} else {
-		_EXCEPTIONT("Invalid DataType in Checksum: Expected State or Tracers");
+		_EXCEPTIONT("Invalid DataType.");
 	}
 }
 
@@ -1286,6 +1461,78 @@ void GridPatch::UnpackExchangeBuffer(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void GridPatch::CopyExchangeBuffer(
+	DataType eDataType,
+	int iDataIndex,
+	const GridPatch & patchSource,
+	const ExchangeBuffer & exbuf
+) {
+	// Check exchange buffer target and source
+	if (exbuf.m_ixSourcePatch != m_ixPatch) {
+		_EXCEPTIONT("ExchangeBuffer patch index mismatch");
+	}
+	if ((exbuf.m_pLocalPartner == NULL) ||
+	    (exbuf.m_pLocalPartner->m_ixSourcePatch != patchSource.m_ixPatch)
+	) {
+		_EXCEPTIONT("ExchangeBuffer local partner mismatch");
+	}
+
+	// State data
+	if (eDataType == DataType_State) {
+		if ((iDataIndex < 0) || (iDataIndex > m_datavecStateNode.size())) {
+			_EXCEPTIONT("Invalid state data instance.");
+		}
+
+		exbuf.CopyFromPartner(m_grid,
+			patchSource.m_datavecStateNode[iDataIndex],
+			m_datavecStateNode[iDataIndex]);
+		exbuf.CopyFromPartner(m_grid,
+			patchSource.m_datavecStateREdge[iDataIndex],
+			m_datavecStateREdge[iDataIndex]);
+
+	// Tracer data
+	} else if (eDataType == DataType_Tracers) {
+		if ((iDataIndex < 0) || (iDataIndex > m_datavecTracers.size())) {
+			_EXCEPTIONT("Invalid tracers data instance.");
+		}
+
+		exbuf.CopyFromPartner(m_grid,
+			patchSource.m_datavecTracers[iDataIndex],
+			m_datavecTracers[iDataIndex]);
+
+	// Vorticity data
+	} else if (eDataType == DataType_Vorticity) {
+		exbuf.CopyFromPartner(
+			patchSource.m_dataVorticity, m_dataVorticity);
+
+	// Divergence data
+	} else if (eDataType == DataType_Divergence) {
+		exbuf.CopyFromPartner(
+			patchSource.m_dataDivergence, m_dataDivergence);
+
+	// Temperature data
+	} else if (eDataType == DataType_Temperature) {
+		exbuf.CopyFromPartner(
+			patchSource.m_dataTemperature, m_dataTemperature);
+
+	// Richardson data
+	} else if (eDataType == DataType_Richardson) {
+		exbuf.CopyFromPartner(
+			patchSource.m_dataRichardson, m_dataRichardson);
+
+	// Topographic derivatives
+	} else if (eDataType == DataType_TopographyDeriv) {
+		exbuf.CopyFromPartner(
+			patchSource.m_dataTopographyDeriv, m_dataTopographyDeriv);
+
+	// Invalid data
+	} else {
+		_EXCEPTIONT("Invalid DataType");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void GridPatch::CopyData(
 	int ixSource,
 	int ixDest,
@@ -1326,6 +1573,17 @@ void GridPatch::LinearCombineData(
 	const DataArray1D<double> & dCoeff,
 	int ixDest,
 	DataType eDataType
+) {
+	StageUpdateData(dCoeff, ixDest, (-1), eDataType);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void GridPatch::StageUpdateData(
+	const DataArray1D<double> & dCoeff,
+	int ixDest,
+	int ixCopy,
+	DataType eDataType
 ) {
 	// Check bounds on Coeff array
 	if (ixDest >= dCoeff.GetRows()) {
@@ -1338,39 +1596,26 @@ void GridPatch::LinearCombineData(
 		if ((ixDest < 0) || (ixDest >= m_datavecStateNode.size())) {
 			_EXCEPTIONT("Invalid ixDest index in LinearCombineData.");
 		}
+		if (ixCopy >= (int)m_datavecStateNode.size()) {
+			_EXCEPTIONT("Invalid ixCopy index in StageUpdateData.");
+		}
 		if (dCoeff.GetRows() > m_datavecStateNode.size()) {
 			_EXCEPTIONT("Too many elements in coefficient vector.");
 		}
 
-		// Premultiply
-		if (dCoeff[ixDest] == 0.0) {
-			m_datavecStateNode [ixDest].Zero();
-			m_datavecStateREdge[ixDest].Zero();
-		} else {
-			m_datavecStateNode [ixDest].Scale(dCoeff[ixDest]);
-			m_datavecStateREdge[ixDest].Scale(dCoeff[ixDest]);
-		}
-
-		// Consider all other terms
-		for (int m = 0; m < dCoeff.GetRows(); m++) {
-			if (m == ixDest) {
-				continue;
-			}
-			if (dCoeff[m] == 0.0) {
-				continue;
-			}
-
-			m_datavecStateNode[ixDest].AddProduct(
-				m_datavecStateNode[m], dCoeff[m]);
-			m_datavecStateREdge[ixDest].AddProduct(
-				m_datavecStateREdge[m], dCoeff[m]);
-		}
+		LinearCombineInstances(
+			dCoeff, ixDest, ixCopy, m_datavecStateNode);
+		LinearCombineInstances(
+			dCoeff, ixDest, ixCopy, m_datavecStateREdge);
 
 	// Check bounds on ixDest for Tracers data
 	} else if (eDataType == DataType_Tracers) {
 		if ((ixDest < 0) || (ixDest >= m_datavecTracers.size())) {
 			_EXCEPTIONT("Invalid ixDest index in LinearCombineData.");
 		}
+		if (ixCopy >= (int)m_datavecTracers.size()) {
+			_EXCEPTIONT("Invalid ixCopy index in StageUpdateData.");
+		}
 		if (dCoeff.GetRows() > m_datavecTracers.size()) {
 			_EXCEPTIONT("Too many elements in coefficient vector.");
 		}
@@ -1380,25 +1625,8 @@ void GridPatch::LinearCombineData(
 			return;
 		}
 
-		// Premultiply
-		if (dCoeff[ixDest] == 0.0) {
-			m_datavecTracers[ixDest].Zero();
-		} else {
-			m_datavecTracers[ixDest].Scale(dCoeff[ixDest]);
-		}
-
-		// Consider all other terms
-		for (int m = 0; m < dCoeff.GetRows(); m++) {
-			if (m == ixDest) {
-				continue;
-			}
-			if (dCoeff[m] == 0.0) {
-				continue;
-			}
-
-			m_datavecTracers[ixDest].AddProduct(
-				m_datavecTracers[m], dCoeff[m]);
-		}
+		LinearCombineInstances(
+			dCoeff, ixDest, ixCopy, m_datavecTracers);
 
 	// Invalid datatype; only State or Tracers expected
 	} else {
@@ -1869,8 +2097,8 @@ double GridPatch::DotProductData(
 	}
 
 	// set shortcuts to tracer variables
-	DataArray4D<double> const * pDataTracersX = &(m_datavecTracers[ix]);
-	DataArray4D<double> const * pDataTracersY = &(m_datavecTracers[iy]);
+	TracerArray4D const * pDataTracersX = &(m_datavecTracers[ix]);
+	TracerArray4D const * pDataTracersY = &(m_datavecTracers[iy]);
 
 	// perform dot-product over Tracer nodes
 	for (c=0; c<nodeVarsTracers.size(); c++) {
@@ -1952,14 +2180,15 @@ double GridPatch::MinimumData(
 	}
 
 	// set shortcuts to tracer variables
-	DataArray4D<double> const * pDataTracers = &(m_datavecTracers[ix]);
+	TracerArray4D const * pDataTracers = &(m_datavecTracers[ix]);
 
 	// perform operation over Tracer nodes
 	for (c=0; c<nodeVarsTracers.size(); c++) {
 	  for (k=0; k<m_grid.GetRElements(); k++) {
 	    for (i=m_box.GetAInteriorBegin(); i<m_box.GetAInteriorEnd(); i++) {
 	      for (j=m_box.GetBInteriorBegin(); j<m_box.GetBInteriorEnd(); j++) {
-		dMin = std::min(dMin, (*pDataTracers)[nodeVarsTracers[c]][k][i][j]); 
+		dMin = std::min(dMin,
+			static_cast<double>((*pDataTracers)[nodeVarsTracers[c]][k][i][j]));
 	      }
 	    }
 	  }
@@ -2048,8 +2277,8 @@ void GridPatch::WRMSNormData(
 	}
 
 	// set shortcuts to tracer variables
-	DataArray4D<double> const * pDataTracersX = &(m_datavecTracers[ix]);
-	DataArray4D<double> const * pDataTracersW = &(m_datavecTracers[iw]);
+	TracerArray4D const * pDataTracersX = &(m_datavecTracers[ix]);
+	TracerArray4D const * pDataTracersW = &(m_datavecTracers[iw]);
 
 	// perform operation over Tracer nodes
 	for (c=0; c<nodeVarsTracers.size(); c++) {
@@ -2133,14 +2362,15 @@ double GridPatch::MaximumNormData(
 	}
 
 	// set shortcuts to tracer variables
-	DataArray4D<double> const * pDataTracers = &(m_datavecTracers[ix]);
+	TracerArray4D const * pDataTracers = &(m_datavecTracers[ix]);
 
 	// perform operation over Tracer nodes
 	for (c=0; c<nodeVarsTracers.size(); c++) {
 	  for (k=0; k<m_grid.GetRElements(); k++) {
 	    for (i=m_box.GetAInteriorBegin(); i<m_box.GetAInteriorEnd(); i++) {
 	      for (j=m_box.GetBInteriorBegin(); j<m_box.GetBInteriorEnd(); j++) {
-		dMax = std::max(dMax, fabs((*pDataTracers)[nodeVarsTracers[c]][k][i][j])); 
+		dMax = std::max(dMax,
+			fabs(static_cast<double>((*pDataTracers)[nodeVarsTracers[c]][k][i][j])));
 	      }
 	    }
 	  }
@@ -2181,6 +2411,31 @@ void GridPatch::AddReferenceState(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void GridPatch::BuildRemapOperator(
+	const DataArray1D<double> & dAlpha,
+	const DataArray1D<double> & dBeta,
+	const DataArray1D<int> & iPatch,
+	PatchRemapOperator & opRemap
+) const {
+	_EXCEPTIONT("Unimplemented.");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void GridPatch::RemapData(
+	DataType eDataType,
+	const DataArray1D<double> & dREta,
+	PatchRemapOperator & opRemap,
+	DataArray3D<double> & dInterpData,
+	DataLocation eOnlyVariablesAt,
+	bool fIncludeReferenceState,
+	bool fConvertToPrimitive
+) {
+	_EXCEPTIONT("Unimplemented.");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void GridPatch::InterpolateData(
 	DataType eDataType,
 	const DataArray1D<double> & dREta,
@@ -2192,7 +2447,18 @@ void GridPatch::InterpolateData(
 	bool fIncludeReferenceState,
 	bool fConvertToPrimitive
 ) {
-	_EXCEPTIONT("Unimplemented.");
+	PatchRemapOperator opRemap;
+
+	BuildRemapOperator(dAlpha, dBeta, iPatch, opRemap);
+
+	RemapData(
+		eDataType,
+		dREta,
+		opRemap,
+		dInterpData,
+		eOnlyVariablesAt,
+		fIncludeReferenceState,
+		fConvertToPrimitive);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
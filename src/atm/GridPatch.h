@@ -22,6 +22,9 @@
 #include "DataArray2D.h"
 #include "DataArray3D.h"
 #include "DataArray4D.h"
+#include "FactoredMetric.h"
+#include "TracerArray.h"
+#include "RemapOperator.h"
 
 #include "PatchBox.h"
 #include "ChecksumType.h"
@@ -57,6 +60,11 @@ protected:
 	///	</summary>
 	typedef std::vector< DataArray4D<double> > DataArray4DVector;
 
+	///	<summary>
+	///		A vector storing TracerArray4D.
+	///	</summary>
+	typedef std::vector<TracerArray4D> TracerArray4DVector;
+
 public:
 	///	<summary>
 	///		The PatchIndex indicating an invalid patch.
@@ -244,6 +252,17 @@ public:
 		ExchangeBuffer & exbuf
 	);
 
+	///	<summary>
+	///		Copy halo data for a local ExchangeBuffer directly from the
+	///		edge of its partner GridPatch on this processor.
+	///	</summary>
+	void CopyExchangeBuffer(
+		DataType eDataType,
+		int iDataIndex,
+		const GridPatch & patchSource,
+		const ExchangeBuffer & exbuf
+	);
+
 public:
 	///	<summary>
 	///		Copy data from one data index to another.
@@ -263,6 +282,17 @@ public:
 		DataType eDataType
 	);
 
+	///	<summary>
+	///		Compute a linear combination of data and store it at both ixDest
+	///		and ixCopy (if non-negative) in a single pass over the data.
+	///	</summary>
+	void StageUpdateData(
+		const DataArray1D<double> & dCoeff,
+		int ixDest,
+		int ixCopy,
+		DataType eDataType
+	);
+
 	///	<summary>
 	///		Zero the data at the specified index.
 	///	</summary>
@@ -398,10 +428,48 @@ public:
 	);
 
 public:
+	///	<summary>
+	///		Build the operator which interpolates data from this patch to
+	///		those of the specified points which lie on this patch.
+	///	</summary>
+	virtual void BuildRemapOperator(
+		const DataArray1D<double> & dAlpha,
+		const DataArray1D<double> & dBeta,
+		const DataArray1D<int> & iPatch,
+		PatchRemapOperator & opRemap
+	) const;
+
+	///	<summary>
+	///		Interpolate data to the points of a PatchRemapOperator built by
+	///		this patch.  Vertical operators are added to opRemap as needed.
+	///	</summary>
+	virtual void RemapData(
+		DataType eDataType,
+		const DataArray1D<double> & dREta,
+		PatchRemapOperator & opRemap,
+		DataArray3D<double> & dInterpData,
+		DataLocation eOnlyVariablesAt = DataLocation_None,
+		bool fIncludeReferenceState = true,
+		bool fConvertToPrimitive = true
+	);
+
+	///	<summary>
+	///		Convert the horizontal velocity components at node (i,j) from
+	///		the coordinate system of this patch to the primitive (zonal and
+	///		meridional) components.  By default the components are unchanged.
+	///	</summary>
+	virtual void ConvertToPrimitiveVelocity(
+		int i,
+		int j,
+		double & dUa,
+		double & dUb
+	) const {
+	}
+
 	///	<summary>
 	///		Linearly interpolate data horizontally to the specified points.
 	///	</summary>
-	virtual void InterpolateData(
+	void InterpolateData(
 		DataType eDataType,
 		const DataArray1D<double> & dREta,
 		const DataArray1D<double> & dAlpha,
@@ -630,7 +698,7 @@ public:
 	///	<summary>
 	///		Get the nodal Jacobian matrix.
 	///	</summary>
-	const DataArray3D<double> & GetJacobian() const {
+	const MetricArray3D & GetJacobian() const {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -641,7 +709,7 @@ public:
 	///	<summary>
 	///		Get the interface Jacobian matrix.
 	///	</summary>
-	const DataArray3D<double> & GetJacobianREdge() const {
+	const MetricArray3D & GetJacobianREdge() const {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -652,7 +720,7 @@ public:
 	///	<summary>
 	///		Get the components of the contravariant metric (alpha)
 	///	</summary>
-	const DataArray4D<double> & GetContraMetricA() const {
+	const MetricArray4D & GetContraMetricA() const {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -663,7 +731,7 @@ public:
 	///	<summary>
 	///		Get the components of the contravariant metric (beta)
 	///	</summary>
-	const DataArray4D<double> & GetContraMetricB() const {
+	const MetricArray4D & GetContraMetricB() const {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -674,7 +742,7 @@ public:
 	///	<summary>
 	///		Get the components of the contravariant metric (xi)
 	///	</summary>
-	const DataArray4D<double> & GetContraMetricXi() const {
+	const MetricArray4D & GetContraMetricXi() const {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -686,7 +754,7 @@ public:
 	///		Get the components of the contravariant metric (alpha)
 	///		on interfaces.
 	///	</summary>
-	const DataArray4D<double> & GetContraMetricAREdge() const {
+	const MetricArray4D & GetContraMetricAREdge() const {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -698,7 +766,7 @@ public:
 	///		Get the components of the contravariant metric (beta)
 	///		on interfaces.
 	///	</summary>
-	const DataArray4D<double> & GetContraMetricBREdge() const {
+	const MetricArray4D & GetContraMetricBREdge() const {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -710,7 +778,7 @@ public:
 	///		Get the components of the contravariant metric (xi)
 	///		on interfaces.
 	///	</summary>
-	const DataArray4D<double> & GetContraMetricXiREdge() const {
+	const MetricArray4D & GetContraMetricXiREdge() const {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -755,7 +823,7 @@ public:
 	///		Get the vertical coordinate transform (derivatives of the
 	///		radius) at nodes.
 	///	</summary>
-	const DataArray4D<double> & GetDerivRNode() const {
+	const MetricArray4D & GetDerivRNode() const {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -767,7 +835,7 @@ public:
 	///		Get the vertical coordinate transform (derivatives of the
 	///		radius) at edges.
 	///	</summary>
-	const DataArray4D<double> & GetDerivRREdge() const {
+	const MetricArray4D & GetDerivRREdge() const {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -1011,7 +1079,7 @@ public:
 	///	<summary>
 	///		Get the tracer data matrix with the specified index.
 	///	</summary>
-	DataArray4D<double> & GetDataTracers(int ix) {
+	TracerArray4D & GetDataTracers(int ix) {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -1024,7 +1092,7 @@ public:
 	///	<summary>
 	///		Get the tracer data matrix with the specified index.
 	///	</summary>
-	const DataArray4D<double> & GetDataTracers(int ix) const {
+	const TracerArray4D & GetDataTracers(int ix) const {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -1037,7 +1105,7 @@ public:
 	///	<summary>
 	///		Get the tracer data reference state.
 	///	</summary>
-	DataArray4D<double> & GetReferenceTracers() {
+	TracerArray4D & GetReferenceTracers() {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -1047,7 +1115,7 @@ public:
 	///	<summary>
 	///		Get the tracer data reference state.
 	///	</summary>
-	const DataArray4D<double> & GetReferenceTracers() const {
+	const TracerArray4D & GetReferenceTracers() const {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -1057,7 +1125,7 @@ public:
 	///	<summary>
 	///		Get the tracer data matrix with the specified index.
 	///	</summary>
-	DataArray4D<double> & GetDataTracersReference(int ix) {
+	TracerArray4D & GetDataTracersReference(int ix) {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -1070,7 +1138,7 @@ public:
 	///	<summary>
 	///		Get the tracer data matrix with the specified index.
 	///	</summary>
-	const DataArray4D<double> & GetDataTracersReference(int ix) const {
+	const TracerArray4D & GetDataTracersReference(int ix) const {
 		if (!m_fContainsData) {
 			_EXCEPTIONT("Stub patch does not store data.");
 		}
@@ -1311,30 +1379,41 @@ protected:
 	///	</summary>
 	DataArray3D<double> m_dataCovMetric2DB;
 
+	///	<summary>
+	///		Vertical coordinate transform profile at each level (Geometric).
+	///	</summary>
+	DataArray2D<double> m_dataVerticalTransformNode;
+
+	///	<summary>
+	///		Vertical coordinate transform profile at each interface
+	///		(Geometric).
+	///	</summary>
+	DataArray2D<double> m_dataVerticalTransformREdge;
+
 	///	<summary>
 	///		Jacobian at each node (Geometric).
 	///	</summary>
-	DataArray3D<double> m_dataJacobian;
+	MetricArray3D m_dataJacobian;
 
 	///	<summary>
 	///		Jacobian at each edge (Geometric).
 	///	</summary>
-	DataArray3D<double> m_dataJacobianREdge;
+	MetricArray3D m_dataJacobianREdge;
 
 	///	<summary>
 	///		Contravariant metric (alpha) components (Geometric).
 	///	</summary>
-	DataArray4D<double> m_dataContraMetricA;
+	MetricArray4D m_dataContraMetricA;
 
 	///	<summary>
 	///		Contravariant metric (beta) components (Geometric).
 	///	</summary>
-	DataArray4D<double> m_dataContraMetricB;
+	MetricArray4D m_dataContraMetricB;
 
 	///	<summary>
 	///		Contravariant metric (xi) components (Geometric).
 	///	</summary>
-	DataArray4D<double> m_dataContraMetricXi;
+	MetricArray4D m_dataContraMetricXi;
 /*
 	///	<summary>
 	///		Covariant metric (alpha) components (Geometric).
@@ -1354,29 +1433,29 @@ protected:
 	///	<summary>
 	///		Contravariant metric (alpha) components on interfaces (Geometric).
 	///	</summary>
-	DataArray4D<double> m_dataContraMetricAREdge;
+	MetricArray4D m_dataContraMetricAREdge;
 
 	///	<summary>
 	///		Contravariant metric (beta) components on interfaces (Geometric).
 	///	</summary>
-	DataArray4D<double> m_dataContraMetricBREdge;
+	MetricArray4D m_dataContraMetricBREdge;
 
 	///	<summary>
 	///		Contravariant metric (xi) components on interfaces (Geometric).
 	///	</summary>
-	DataArray4D<double> m_dataContraMetricXiREdge;
+	MetricArray4D m_dataContraMetricXiREdge;
 
  	///	<summary>
 	///		Vertical coordinate transform (derivatives of the radius)
 	///		at each node (Geometric).
 	///	</summary>
-	DataArray4D<double> m_dataDerivRNode;
+	MetricArray4D m_dataDerivRNode;
 
  	///	<summary>
 	///		Vertical coordinate transform (derivatives of the radius)
 	///		at each interface (Geometric).
 	///	</summary>
-	DataArray4D<double> m_dataDerivRREdge;
+	MetricArray4D m_dataDerivRREdge;
 
 	///	<summary>
 	///		Element area at each node (Geometric).
@@ -1462,12 +1541,12 @@ public:
 	///	<summary>
 	///		Grid data for tracer variables (State).
 	///	</summary>
-	DataArray4DVector m_datavecTracers;
+	TracerArray4DVector m_datavecTracers;
 
 	///	<summary>
 	///		Grid data for the reference state on model levels (State).
 	///	</summary>
-	DataArray4D<double> m_dataRefTracers;
+	TracerArray4D m_dataRefTracers;
 
 public:
 	///	<summary>
@@ -338,6 +338,37 @@ void GridPatchCSGLL::EvaluateGeometricTerms() {
 	}
 	}
 
+	// Vertical coordinate transform profile for the Gal-Chen and
+	// Somerville (1975) linear terrain-following coord
+	for (int k = 0; k < m_grid.GetRElements(); k++) {
+		double dREta = m_grid.GetREtaLevel(k);
+
+		m_dataVerticalTransformNode[k][VerticalTransform_F] = 1.0 - dREta;
+		m_dataVerticalTransformNode[k][VerticalTransform_DxiZtop] =
+			m_grid.GetZtop();
+		m_dataVerticalTransformNode[k][VerticalTransform_DxiF] = -1.0;
+	}
+	for (int k = 0; k <= m_grid.GetRElements(); k++) {
+		double dREta = m_grid.GetREtaInterface(k);
+
+		m_dataVerticalTransformREdge[k][VerticalTransform_F] = 1.0 - dREta;
+		m_dataVerticalTransformREdge[k][VerticalTransform_DxiZtop] =
+			m_grid.GetZtop();
+		m_dataVerticalTransformREdge[k][VerticalTransform_DxiF] = -1.0;
+	}
+
+	// Topography does not enter the metric of 2D equation sets
+	if (fIs2DEquationSet) {
+		for (int k = 0; k < m_grid.GetRElements(); k++) {
+			m_dataVerticalTransformNode[k][VerticalTransform_F] = 0.0;
+			m_dataVerticalTransformNode[k][VerticalTransform_DxiF] = 0.0;
+		}
+		for (int k = 0; k <= m_grid.GetRElements(); k++) {
+			m_dataVerticalTransformREdge[k][VerticalTransform_F] = 0.0;
+			m_dataVerticalTransformREdge[k][VerticalTransform_DxiF] = 0.0;
+		}
+	}
+
 	// Initialize metric in terrain-following coords
 	for (int a = 0; a < GetElementCountA(); a++) {
 	for (int b = 0; b < GetElementCountB(); b++) {
@@ -360,14 +391,18 @@ void GridPatchCSGLL::EvaluateGeometricTerms() {
 
 		// Topography height and its derivatives
 		double dZs = m_dataTopography[iA][iB];
+#if !defined(TEMPEST_COMPACT_GEOMETRY)
 		double dDaZs = m_dataTopographyDeriv[0][iA][iB];
 		double dDbZs = m_dataTopographyDeriv[1][iA][iB];
+#endif
 
 		// 2D equations
 		if (fIs2DEquationSet) {
 			dZs = 0.0;
+#if !defined(TEMPEST_COMPACT_GEOMETRY)
 			dDaZs = 0.0;
 			dDbZs = 0.0;
+#endif
 		}
 
 		// Initialize 2D Jacobian
@@ -413,7 +448,6 @@ void GridPatchCSGLL::EvaluateGeometricTerms() {
 		for (int k = 0; k < m_grid.GetRElements(); k++) {
 
 			// Gal-Chen and Somerville (1975) linear terrain-following coord
-			double dREta = m_grid.GetREtaLevel(k);
 /*
 			double dREtaStretch;
 			double dDxREtaStretch;
@@ -426,21 +460,29 @@ void GridPatchCSGLL::EvaluateGeometricTerms() {
 			double dDxR = (m_grid.GetZtop() - dZs) * dDxREtaStretch;
 */
 
-			double dZ = dZs + (m_grid.GetZtop() - dZs) * dREta;
-			double dDaR = (1.0 - dREta) * dDaZs;
-			double dDbR = (1.0 - dREta) * dDbZs;
-			double dDxR = (m_grid.GetZtop() - dZs);
+			const DataArray2D<double> & dProfile =
+				m_dataVerticalTransformNode;
+
+			double dDxR =
+				dProfile[k][VerticalTransform_DxiZtop]
+				+ dZs * dProfile[k][VerticalTransform_DxiF];
 
 			// Calculate pointwise Jacobian
-			m_dataJacobian[k][iA][iB] = dDxR * m_dataJacobian2D[iA][iB];
+			double dJacobian = dDxR * m_dataJacobian2D[iA][iB];
 
 			// Element area associated with each model level GLL node
 			m_dataElementArea[k][iA][iB] =
-				m_dataJacobian[k][iA][iB]
+				dJacobian
 				* dWL[i] * GetElementDeltaA()
 				* dWL[j] * GetElementDeltaB()
 				* dWNode[k];
 
+#if !defined(TEMPEST_COMPACT_GEOMETRY)
+			double dDaR = dProfile[k][VerticalTransform_F] * dDaZs;
+			double dDbR = dProfile[k][VerticalTransform_F] * dDbZs;
+
+			m_dataJacobian[k][iA][iB] = dJacobian;
+
 			// Contravariant metric components
 			m_dataContraMetricA[k][iA][iB][0] =
 				m_dataContraMetric2DA[iA][iB][0];
@@ -556,13 +598,13 @@ void GridPatchCSGLL::EvaluateGeometricTerms() {
 			m_dataDerivRNode[k][iA][iB][0] = dDaR;
 			m_dataDerivRNode[k][iA][iB][1] = dDbR;
 			m_dataDerivRNode[k][iA][iB][2] = dDxR;
+#endif
 		}
 
 		// Metric terms at vertical interfaces
 		for (int k = 0; k <= m_grid.GetRElements(); k++) {
 
 			// Gal-Chen and Somerville (1975) linear terrain-following coord
-			double dREta = m_grid.GetREtaInterface(k);
 /*
 			double dREtaStretch;
 			double dDxREtaStretch;
@@ -575,27 +617,35 @@ void GridPatchCSGLL::EvaluateGeometricTerms() {
 			double dDbR = (1.0 - dREtaStretch) * dDbZs;
 			double dDxR = (m_grid.GetZtop() - dZs) * dDxREtaStretch;
 */
-			double dZ = dZs + (m_grid.GetZtop() - dZs) * dREta;
-			double dDaR = (1.0 - dREta) * dDaZs;
-			double dDbR = (1.0 - dREta) * dDbZs;
-			double dDxR = (m_grid.GetZtop() - dZs);
+			const DataArray2D<double> & dProfile =
+				m_dataVerticalTransformREdge;
+
+			double dDxR =
+				dProfile[k][VerticalTransform_DxiZtop]
+				+ dZs * dProfile[k][VerticalTransform_DxiF];
 
 			// Calculate pointwise Jacobian
-			m_dataJacobianREdge[k][iA][iB] =
+			double dJacobian =
 				(1.0 + dX * dX) * (1.0 + dY * dY) / (dDelta * dDelta * dDelta);
 
-			m_dataJacobianREdge[k][iA][iB] *=
+			dJacobian *=
 				dDxR
 				* phys.GetEarthRadius()
 				* phys.GetEarthRadius();
 
 			// Element area associated with each model interface GLL node
 			m_dataElementAreaREdge[k][iA][iB] =
-				m_dataJacobianREdge[k][iA][iB]
+				dJacobian
 				* dWL[i] * GetElementDeltaA()
 				* dWL[j] * GetElementDeltaB()
 				* dWREdge[k];
 
+#if !defined(TEMPEST_COMPACT_GEOMETRY)
+			double dDaR = dProfile[k][VerticalTransform_F] * dDaZs;
+			double dDbR = dProfile[k][VerticalTransform_F] * dDbZs;
+
+			m_dataJacobianREdge[k][iA][iB] = dJacobian;
+
 			// Contravariant metric (alpha)
 			m_dataContraMetricAREdge[k][iA][iB][0] =
 				m_dataContraMetric2DA[iA][iB][0];
@@ -633,6 +683,7 @@ void GridPatchCSGLL::EvaluateGeometricTerms() {
 			m_dataDerivRREdge[k][iA][iB][0] = dDaR;
 			m_dataDerivRREdge[k][iA][iB][1] = dDbR;
 			m_dataDerivRREdge[k][iA][iB][2] = dDxR;
+#endif
 		}
 	}
 	}
@@ -1221,7 +1272,9 @@ void GridPatchCSGLL::ComputeVorticityDivergence(
 		dataState.GetSize(2),
 		dataState.GetSize(3));
 
+	dataUa.SetColumnLayout(dataState.IsColumnLayout());
 	dataUa.AttachToData(&(dataState[0][0][0][0]));
+	dataUb.SetColumnLayout(dataState.IsColumnLayout());
 	dataUb.AttachToData(&(dataState[1][0][0][0]));
 
 	// Compute the radial component of the curl of the velocity field
@@ -1230,29 +1283,24 @@ void GridPatchCSGLL::ComputeVorticityDivergence(
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void GridPatchCSGLL::InterpolateData(
+void GridPatchCSGLL::RemapData(
 	DataType eDataType,
 	const DataArray1D<double> & dREta,
-	const DataArray1D<double> & dAlpha,
-	const DataArray1D<double> & dBeta,
-	const DataArray1D<int> & iPatch,
+	PatchRemapOperator & opRemap,
 	DataArray3D<double> & dInterpData,
 	DataLocation eOnlyVariablesAt,
 	bool fIncludeReferenceState,
 	bool fConvertToPrimitive
 ) {
-	if ((dAlpha.GetRows() != dBeta.GetRows()) ||
-		(dAlpha.GetRows() != iPatch.GetRows())
+	if ((opRemap.GetPatchIndex() != GetPatchIndex()) ||
+		(opRemap.GetOrder() != m_nHorizontalOrder)
 	) {
-		_EXCEPTIONT("Point vectors must have equivalent length.");
+		_EXCEPTIONT("PatchRemapOperator not built on this patch");
 	}
 
-	// Vector for storage interpolated points
-	DataArray1D<double> dAInterpCoeffs(m_nHorizontalOrder);
-	DataArray1D<double> dBInterpCoeffs(m_nHorizontalOrder);
-	DataArray1D<double> dADiffCoeffs(m_nHorizontalOrder);
-	DataArray1D<double> dBDiffCoeffs(m_nHorizontalOrder);
-	DataArray1D<double> dAInterpPt(m_nHorizontalOrder);
+	// Number of points and weights per point
+	const int nPoints = opRemap.GetPointCount();
+	const int nOrder = m_nHorizontalOrder;
 
 	// Physical constants
 	const PhysicalConstants & phys = m_grid.GetModel().GetPhysicalConstants();
@@ -1333,69 +1381,80 @@ void GridPatchCSGLL::InterpolateData(
 			}
 		}
 
-		// Vertical interpolation operator
-		LinearColumnInterpFEM opInterp;
+		// Vertical interpolation operator, built on first use
+		int ixColumnOp =
+			opRemap.FindColumnOperator(eDataLocation, nRElements, dREta);
 
-		if (nRElements != 1) {
+		if (ixColumnOp == (-1)) {
+			LinearColumnInterpFEM & opInterp =
+				opRemap.AddColumnOperator(eDataLocation, nRElements, dREta);
 
-			// Finite element interpolation
-			if (eVerticalDiscType ==
-				Grid::VerticalDiscretization_FiniteElement
-			) {
-				if (eDataLocation == DataLocation_Node) {
-					opInterp.Initialize(
-						LinearColumnInterpFEM::InterpSource_Levels,
-						m_nVerticalOrder,
-						m_grid.GetREtaLevels(),
-						m_grid.GetREtaInterfaces(),
-						dREta);
-
-				} else if (eDataLocation == DataLocation_REdge) {
-					opInterp.Initialize(
-						LinearColumnInterpFEM::InterpSource_Interfaces,
-						m_nVerticalOrder,
-						m_grid.GetREtaLevels(),
-						m_grid.GetREtaInterfaces(),
-						dREta);
+			if (nRElements != 1) {
 
-				} else {
-					_EXCEPTIONT("Invalid DataLocation");
-				}
+				// Finite element interpolation
+				if (eVerticalDiscType ==
+					Grid::VerticalDiscretization_FiniteElement
+				) {
+					if (eDataLocation == DataLocation_Node) {
+						opInterp.Initialize(
+							LinearColumnInterpFEM::InterpSource_Levels,
+							m_nVerticalOrder,
+							m_grid.GetREtaLevels(),
+							m_grid.GetREtaInterfaces(),
+							dREta);
+
+					} else if (eDataLocation == DataLocation_REdge) {
+						opInterp.Initialize(
+							LinearColumnInterpFEM::InterpSource_Interfaces,
+							m_nVerticalOrder,
+							m_grid.GetREtaLevels(),
+							m_grid.GetREtaInterfaces(),
+							dREta);
+
+					} else {
+						_EXCEPTIONT("Invalid DataLocation");
+					}
 
-			// Finite volume interpolation
-			} else if (
-				eVerticalDiscType ==
-				Grid::VerticalDiscretization_FiniteVolume
-			) {
-				if (eDataLocation == DataLocation_Node) {
-					opInterp.Initialize(
-						LinearColumnInterpFEM::InterpSource_Levels,
-						1,
-						m_grid.GetREtaLevels(),
-						m_grid.GetREtaInterfaces(),
-						dREta);
-
-				} else if (eDataLocation == DataLocation_REdge) {
-					opInterp.Initialize(
-						LinearColumnInterpFEM::InterpSource_Interfaces,
-						1,
-						m_grid.GetREtaLevels(),
-						m_grid.GetREtaInterfaces(),
-						dREta);
+				// Finite volume interpolation
+				} else if (
+					eVerticalDiscType ==
+					Grid::VerticalDiscretization_FiniteVolume
+				) {
+					if (eDataLocation == DataLocation_Node) {
+						opInterp.Initialize(
+							LinearColumnInterpFEM::InterpSource_Levels,
+							1,
+							m_grid.GetREtaLevels(),
+							m_grid.GetREtaInterfaces(),
+							dREta);
+
+					} else if (eDataLocation == DataLocation_REdge) {
+						opInterp.Initialize(
+							LinearColumnInterpFEM::InterpSource_Interfaces,
+							1,
+							m_grid.GetREtaLevels(),
+							m_grid.GetREtaInterfaces(),
+							dREta);
+
+					} else {
+						_EXCEPTIONT("Invalid DataLocation");
+					}
 
+				// Invalid vertical discretization type
 				} else {
-					_EXCEPTIONT("Invalid DataLocation");
+					_EXCEPTIONT("Invalid VerticalDiscretization");
 				}
 
-			// Invalid vertical discretization type
 			} else {
-				_EXCEPTIONT("Invalid VerticalDiscretization");
+				opInterp.InitializeIdentity(1);
 			}
 
-		} else {
-			opInterp.InitializeIdentity(1);
+			ixColumnOp = opRemap.GetColumnOperatorCount() - 1;
 		}
 
+		const LinearColumnInterpFEM & opInterp =
+			opRemap.GetColumnOperator(ixColumnOp);
+
 		// Buffer storage in column
 		DataArray1D<double> dColumnData(nRElements);
 
@@ -1403,6 +1462,11 @@ void GridPatchCSGLL::InterpolateData(
 		DataArray3D<double> pData;
 		DataArray3D<double> pDataRef;
 
+#if defined(TEMPEST_SINGLE_PRECISION_TRACERS)
+		// Double precision copy of a single precision tracer
+		DataArray3D<double> dataTracerBuffer;
+#endif
+
 		pData.SetSize(
 			nRElements,
 			m_box.GetATotalWidth(),
@@ -1415,17 +1479,42 @@ void GridPatchCSGLL::InterpolateData(
 
 		if (eDataType == DataType_State) {
 			if (eDataLocation == DataLocation_Node) {
+				pData.SetColumnLayout(m_datavecStateNode[0].IsColumnLayout());
 				pData.AttachToData(&(m_datavecStateNode[0][c][0][0][0]));
+				pDataRef.SetColumnLayout(m_dataRefStateNode.IsColumnLayout());
 				pDataRef.AttachToData(&(m_dataRefStateNode[c][0][0][0]));
 			} else if (eDataLocation == DataLocation_REdge) {
+				pData.SetColumnLayout(m_datavecStateREdge[0].IsColumnLayout());
 				pData.AttachToData(&(m_datavecStateREdge[0][c][0][0][0]));
+				pDataRef.SetColumnLayout(m_dataRefStateREdge.IsColumnLayout());
 				pDataRef.AttachToData(&(m_dataRefStateREdge[c][0][0][0]));
 			} else {
 				_EXCEPTIONT("Invalid DataLocation");
 			}
 
 		} else if (eDataType == DataType_Tracers) {
+			pData.SetColumnLayout(m_datavecTracers[0].IsColumnLayout());
+#if defined(TEMPEST_SINGLE_PRECISION_TRACERS)
+			// Widen the tracer to double precision for interpolation
+			dataTracerBuffer.SetColumnLayout(
+				m_datavecTracers[0].IsColumnLayout());
+			dataTracerBuffer.Allocate(
+				nRElements,
+				m_box.GetATotalWidth(),
+				m_box.GetBTotalWidth());
+
+			for (int k = 0; k < nRElements; k++) {
+			for (int i = 0; i < m_box.GetATotalWidth(); i++) {
+			for (int j = 0; j < m_box.GetBTotalWidth(); j++) {
+				dataTracerBuffer[k][i][j] = m_datavecTracers[0][c][k][i][j];
+			}
+			}
+			}
+
+			pData.AttachToData(&(dataTracerBuffer[0][0][0]));
+#else
 			pData.AttachToData(&(m_datavecTracers[0][c][0][0][0]));
+#endif
 
 		} else if (eDataType == DataType_Topography) {
 			pData.AttachToData(&(m_dataTopography[0][0]));
@@ -1446,73 +1535,24 @@ void GridPatchCSGLL::InterpolateData(
 			pData.AttachToData(&(m_dataUserData2D[c][0][0]));
 		}
 
-		// Loop throught all points
-		for (int i = 0; i < dAlpha.GetRows(); i++) {
-
-			// Element index
-			if (iPatch[i] != GetPatchIndex()) {
-				continue;
-			}
-
-			// Verify point lies within domain of patch
-			const double Eps = 1.0e-10;
-			if ((dAlpha[i] < m_dAEdge[m_box.GetAInteriorBegin()] - Eps) ||
-				(dAlpha[i] > m_dAEdge[m_box.GetAInteriorEnd()] + Eps) ||
-				(dBeta[i] < m_dBEdge[m_box.GetBInteriorBegin()] - Eps) ||
-				(dBeta[i] > m_dBEdge[m_box.GetBInteriorEnd()] + Eps)
-			) {
-				_EXCEPTIONT("Point out of range");
-			}
-
-			// Determine finite element index
-			int iA =
-				(dAlpha[i] - m_dAEdge[m_box.GetAInteriorBegin()])
-					/ GetElementDeltaA();
-
-			int iB =
-				(dBeta[i] - m_dBEdge[m_box.GetBInteriorBegin()])
-					/ GetElementDeltaB();
-
-			// Bound the index within the element
-			if (iA < 0) {
-				iA = 0;
-			}
-			if (iA >= (m_box.GetAInteriorWidth() / m_nHorizontalOrder)) {
-				iA = m_box.GetAInteriorWidth() / m_nHorizontalOrder - 1;
-			}
-			if (iB < 0) {
-				iB = 0;
-			}
-			if (iB >= (m_box.GetBInteriorWidth() / m_nHorizontalOrder)) {
-				iB = m_box.GetBInteriorWidth() / m_nHorizontalOrder - 1;
-			}
+		// Loop through all points
+		for (int p = 0; p < nPoints; p++) {
 
-			iA = m_box.GetHaloElements() + iA * m_nHorizontalOrder;
-			iB = m_box.GetHaloElements() + iB * m_nHorizontalOrder;
+			const int i = opRemap.GetPoint(p);
+			const int iA = opRemap.GetNodeA(p);
+			const int iB = opRemap.GetNodeB(p);
 
-			// Compute interpolation coefficients
-			PolynomialInterp::LagrangianPolynomialCoeffs(
-				m_nHorizontalOrder,
-				&(m_dAEdge[iA]),
-				dAInterpCoeffs,
-				dAlpha[i]);
-
-			PolynomialInterp::LagrangianPolynomialCoeffs(
-				m_nHorizontalOrder,
-				&(m_dBEdge[iB]),
-				dBInterpCoeffs,
-				dBeta[i]);
+			const double * dWeight = opRemap.GetWeights(p);
 
 			// Perform interpolation on all levels
 			for (int k = 0; k < nRElements; k++) {
 
 				dColumnData[k] = 0.0;
 
-				for (int m = 0; m < m_nHorizontalOrder; m++) {
-				for (int n = 0; n < m_nHorizontalOrder; n++) {
+				for (int m = 0; m < nOrder; m++) {
+				for (int n = 0; n < nOrder; n++) {
 					dColumnData[k] +=
-						  dAInterpCoeffs[m]
-						* dBInterpCoeffs[n]
+						  dWeight[m * nOrder + n]
 						* pData[k][iA+m][iB+n];
 				}
 				}
@@ -1521,11 +1561,10 @@ void GridPatchCSGLL::InterpolateData(
 				if ((eDataType == DataType_State) &&
 					(!fIncludeReferenceState)
 				) {
-					for (int m = 0; m < m_nHorizontalOrder; m++) {
-					for (int n = 0; n < m_nHorizontalOrder; n++) {
+					for (int m = 0; m < nOrder; m++) {
+					for (int n = 0; n < nOrder; n++) {
 						dColumnData[k] -=
-							  dAInterpCoeffs[m]
-							* dBInterpCoeffs[n]
+							  dWeight[m * nOrder + n]
 							* pDataRef[k][iA+m][iB+n];
 					}
 					}
@@ -1546,10 +1585,11 @@ void GridPatchCSGLL::InterpolateData(
 
 	// Convert to primitive variables
 	if ((eDataType == DataType_State) && (fConvertToPrimitive)) {
-		for (int i = 0; i < dAlpha.GetRows(); i++) { 
-			if (iPatch[i] != GetPatchIndex()) {
-				continue;
-			}
+		for (int p = 0; p < nPoints; p++) {
+			const int i = opRemap.GetPoint(p);
+
+			const double dAlpha = opRemap.GetAlpha(p);
+			const double dBeta = opRemap.GetBeta(p);
 
 			for (int k = 0; k < dREta.GetRows(); k++) {
 				double dUalpha =
@@ -1558,8 +1598,8 @@ void GridPatchCSGLL::InterpolateData(
 					dInterpData[1][k][i] / phys.GetEarthRadius();
 
 				CubedSphereTrans::CoVecTransRLLFromABP(
-					tan(dAlpha[i]),
-					tan(dBeta[i]),
+					tan(dAlpha),
+					tan(dBeta),
 					GetPatchBox().GetPanel(),
 					dUalpha,
 					dUbeta,
@@ -1689,6 +1729,30 @@ void GridPatchCSGLL::TransformHaloVelocities(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void GridPatchCSGLL::ConvertToPrimitiveVelocity(
+	int i,
+	int j,
+	double & dUa,
+	double & dUb
+) const {
+	// Physical constants
+	const PhysicalConstants & phys = m_grid.GetModel().GetPhysicalConstants();
+
+	double dUalpha = dUa / phys.GetEarthRadius();
+	double dUbeta = dUb / phys.GetEarthRadius();
+
+	CubedSphereTrans::CoVecTransRLLFromABP(
+		tan(m_dANode[i]),
+		tan(m_dBNode[j]),
+		GetPatchBox().GetPanel(),
+		dUalpha,
+		dUbeta,
+		dUa,
+		dUb);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void GridPatchCSGLL::TransformTopographyDeriv() {
 
 	// Panels in each coordinate direction
@@ -194,6 +194,36 @@ void GridPatchCartesianGLL::EvaluateTopography(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		Decay function f of the terrain following coordinate
+///		z = Ztop xi + f(xi) zs and its derivative.  The 6th order fancy
+///		decay function by Jorge is used (less noisy than f = 1 - xi).
+///	</summary>
+static void EvaluateDecayFunction(
+	double dREta,
+	double & dF,
+	double & dDxF
+) {
+	double power = 6.0;
+	double botRate = 1.0;
+
+	dF = (1.0 - botRate * dREta) *
+		(std::pow(std::cos(0.5 * M_PI * dREta), power) +
+		0.25 * dREta * std::sin(0.5 * M_PI * dREta));
+
+	dDxF =
+		(-std::pow(std::cos(0.5 * M_PI * dREta), power) - 
+			0.25 * dREta * std::sin(0.5 * M_PI * dREta) + 
+		(1.0 - botRate * dREta) * 
+		(-3.0 * M_PI * 
+			std::pow(std::cos(0.5 * M_PI * dREta), power - 1.0) * 
+			std::sin(0.5 * M_PI * dREta) +
+		0.25 * std::sin(0.5 * M_PI * dREta) +
+		M_PI / 8.0 * dREta * std::cos(0.5 * M_PI * dREta)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void GridPatchCartesianGLL::EvaluateGeometricTerms() {
 
 	// Physical constants
@@ -259,6 +289,27 @@ void GridPatchCartesianGLL::EvaluateGeometricTerms() {
 	}
 	}
 
+	// Vertical coordinate transform profile for the Gal-Chen and
+	// Somerville (1975) terrain following coord
+	for (int k = 0; k < m_grid.GetRElements(); k++) {
+		m_dataVerticalTransformNode[k][VerticalTransform_DxiZtop] =
+			m_grid.GetZtop();
+
+		EvaluateDecayFunction(
+			m_grid.GetREtaLevel(k),
+			m_dataVerticalTransformNode[k][VerticalTransform_F],
+			m_dataVerticalTransformNode[k][VerticalTransform_DxiF]);
+	}
+	for (int k = 0; k <= m_grid.GetRElements(); k++) {
+		m_dataVerticalTransformREdge[k][VerticalTransform_DxiZtop] =
+			m_grid.GetZtop();
+
+		EvaluateDecayFunction(
+			m_grid.GetREtaInterface(k),
+			m_dataVerticalTransformREdge[k][VerticalTransform_F],
+			m_dataVerticalTransformREdge[k][VerticalTransform_DxiF]);
+	}
+
 	// Initialize metric and Christoffel symbols in terrain-following coords
 	for (int a = 0; a < GetElementCountA(); a++) {
 	for (int b = 0; b < GetElementCountB(); b++) {
@@ -275,8 +326,10 @@ void GridPatchCartesianGLL::EvaluateGeometricTerms() {
 
 			// Topography height and its derivatives
 			double dZs = m_dataTopography[iA][iB];
+#if !defined(TEMPEST_COMPACT_GEOMETRY)
 			double dDaZs = m_dataTopographyDeriv[0][iA][iB];
 			double dDbZs = m_dataTopographyDeriv[1][iA][iB];
+#endif
 
 			// Initialize 2D Jacobian
 			m_dataJacobian2D[iA][iB] = 1.0;
@@ -298,55 +351,30 @@ void GridPatchCartesianGLL::EvaluateGeometricTerms() {
 			// Metric terms at vertical levels
 			for (int k = 0; k < m_grid.GetRElements(); k++) {
 
-				// Gal-Chen and Somerville (1975) terrain following coord
-				// 6th order fancy decay function by Jorge (less noisy)
-				double dREta = m_grid.GetREtaLevel(k);
-/*
-				double dZ = dZs + (m_grid.GetZtop() - dZs) * dREta;
-				double dDaZ = (1.0 - dREta) * dDaZs;
-				double dDbZ = (1.0 - dREta) * dDbZs;
-				double dDxZ = (m_grid.GetZtop() - dZs);
-*/
-//
-				double power = 6.0;
-				double botRate = 1.0;
-				double dZ = m_grid.GetZtop() * dREta +
-					(1.0 - botRate * dREta) *
-					(std::pow(std::cos(0.5 * M_PI * dREta), power) +
-					0.25 * dREta * std::sin(0.5 * M_PI * dREta)) * dZs;
-
-				double dDaZ = (1.0 - botRate * dREta) *
-					(std::pow(std::cos(0.5 * M_PI * dREta), power) +
-					0.25 * dREta * std::sin(0.5 * M_PI * dREta)) * dDaZs;
-
-				double dDbZ = (1.0 - botRate * dREta) *
-					(std::pow(std::cos(0.5 * M_PI * dREta), power) +
-					0.25 * dREta * std::sin(0.5 * M_PI * dREta)) * dDbZs;
-
-				double dDxZ = m_grid.GetZtop() + dZs *
-
-					(-std::pow(std::cos(0.5 * M_PI * dREta), power) - 
-						0.25 * dREta * std::sin(0.5 * M_PI * dREta) + 
-					(1.0 - botRate * dREta) * 
-					(-3.0 * M_PI * 
-						std::pow(std::cos(0.5 * M_PI * dREta), power - 1.0) * 
-						std::sin(0.5 * M_PI * dREta) +
-					0.25 * std::sin(0.5 * M_PI * dREta) +
-					M_PI / 8.0 * dREta * std::cos(0.5 * M_PI * dREta)));
-
-//printf("%.16E %.16E %.16E %.16E %.16E %.16E \n",m_dataLon[iA][iB],m_dataLat[iA][iB],dZ,dDaZ,dDbZ,dDxZ);
+				// Derivatives of the vertical coordinate transform
+				const DataArray2D<double> & dProfile =
+					m_dataVerticalTransformNode;
+
+				double dDxZ =
+					dProfile[k][VerticalTransform_DxiZtop]
+					+ dZs * dProfile[k][VerticalTransform_DxiF];
 
 				// Calculate pointwise Jacobian
-				m_dataJacobian[k][iA][iB] =
-					dDxZ * m_dataJacobian2D[iA][iB];
+				double dJacobian = dDxZ * m_dataJacobian2D[iA][iB];
 
 				// Element area associated with each model level GLL node
 				m_dataElementArea[k][iA][iB] =
-					m_dataJacobian[k][iA][iB]
+					dJacobian
 					* dWL[i] * GetElementDeltaA()
 					* dWL[j] * GetElementDeltaB()
 					* dWNode[k];
 
+#if !defined(TEMPEST_COMPACT_GEOMETRY)
+				double dDaZ = dProfile[k][VerticalTransform_F] * dDaZs;
+				double dDbZ = dProfile[k][VerticalTransform_F] * dDbZs;
+
+				m_dataJacobian[k][iA][iB] = dJacobian;
+
 				// Contravariant metric components
 				m_dataContraMetricA[k][iA][iB][0] =
 					m_dataContraMetric2DA[iA][iB][0];
@@ -395,59 +423,36 @@ void GridPatchCartesianGLL::EvaluateGeometricTerms() {
 				m_dataDerivRNode[k][iA][iB][0] = dDaZ;
 				m_dataDerivRNode[k][iA][iB][1] = dDbZ;
 				m_dataDerivRNode[k][iA][iB][2] = dDxZ;
+#endif
 			}
 
 			// Metric terms at vertical interfaces
 			for (int k = 0; k <= m_grid.GetRElements(); k++) {
 
-				// Gal-Chen and Somerville (1975) terrain following coord
-				// 6th order fancy decay function by Jorge (less noisy)
-				double dREta = m_grid.GetREtaInterface(k);
-/*
-				double dZ = dZs + (m_grid.GetZtop() - dZs) * dREta;
-				double dDaZ = (1.0 - dREta) * dDaZs;
-				double dDbZ = (1.0 - dREta) * dDbZs;
-				double dDxZ = (m_grid.GetZtop() - dZs);
-*/
-//
-				double power = 6.0;
-				double botRate = 1.0;
-				double dZ = m_grid.GetZtop() * dREta +
-					(1.0 - botRate * dREta) *
-					(std::pow(std::cos(0.5 * M_PI * dREta), power) +
-					0.25 * dREta * std::sin(0.5 * M_PI * dREta)) * dZs;
-
-				double dDaZ = (1.0 - botRate * dREta) *
-					(std::pow(std::cos(0.5 * M_PI * dREta), power) +
-					0.25 * dREta * std::sin(0.5 * M_PI * dREta)) * dDaZs;
-
-				double dDbZ = (1.0 - botRate * dREta) *
-					(std::pow(std::cos(0.5 * M_PI * dREta), power) +
-					0.25 * dREta * std::sin(0.5 * M_PI * dREta)) * dDbZs;
-
-				double dDxZ = m_grid.GetZtop() + dZs *
-					(-std::pow(std::cos(0.5 * M_PI * dREta), power) - 
-						0.25 * dREta * std::sin(0.5 * M_PI * dREta) + 
-					(1.0 - botRate * dREta) * 
-					(-3.0 * M_PI * 
-						std::pow(std::cos(0.5 * M_PI * dREta), power - 1.0) * 
-						std::sin(0.5 * M_PI * dREta) +
-					0.25 * std::sin(0.5 * M_PI * dREta) +
-					M_PI / 8.0 * dREta * std::cos(0.5 * M_PI * dREta)));
-
-//printf("%.16E %.16E %.16E %.16E %.16E %.16E \n",m_dataLon[iA][iB],m_dataLat[iA][iB],dZ,dDaZ,dDbZ,dDxZ);
+				// Derivatives of the vertical coordinate transform
+				const DataArray2D<double> & dProfile =
+					m_dataVerticalTransformREdge;
+
+				double dDxZ =
+					dProfile[k][VerticalTransform_DxiZtop]
+					+ dZs * dProfile[k][VerticalTransform_DxiF];
 
 				// Calculate pointwise Jacobian
-				m_dataJacobianREdge[k][iA][iB] =
-					dDxZ * m_dataJacobian2D[iA][iB];
+				double dJacobian = dDxZ * m_dataJacobian2D[iA][iB];
 
 				// Element area associated with each model interface GLL node
 				m_dataElementAreaREdge[k][iA][iB] =
-					m_dataJacobianREdge[k][iA][iB]
+					dJacobian
 					* dWL[i] * GetElementDeltaA()
 					* dWL[j] * GetElementDeltaB()
 					* dWREdge[k];
 
+#if !defined(TEMPEST_COMPACT_GEOMETRY)
+				double dDaZ = dProfile[k][VerticalTransform_F] * dDaZs;
+				double dDbZ = dProfile[k][VerticalTransform_F] * dDbZs;
+
+				m_dataJacobianREdge[k][iA][iB] = dJacobian;
+
 				// Components of the contravariant metric
 				m_dataContraMetricAREdge[k][iA][iB][0] =
 					m_dataContraMetric2DA[iA][iB][0];
@@ -474,6 +479,7 @@ void GridPatchCartesianGLL::EvaluateGeometricTerms() {
 				m_dataDerivRREdge[k][iA][iB][0] = dDaZ;
 				m_dataDerivRREdge[k][iA][iB][1] = dDbZ;
 				m_dataDerivRREdge[k][iA][iB][2] = dDxZ;
+#endif
 			}
 		}
 		}
@@ -1386,7 +1392,9 @@ void GridPatchCartesianGLL::ComputeVorticityDivergence(
 		dataState.GetSize(2),
 		dataState.GetSize(3));
 
+	dataUa.SetColumnLayout(dataState.IsColumnLayout());
 	dataUa.AttachToData(&(dataState[0][0][0][0]));
+	dataUb.SetColumnLayout(dataState.IsColumnLayout());
 	dataUb.AttachToData(&(dataState[1][0][0][0]));
 
 	// Compute the radial component of the curl of the velocity field
@@ -1395,31 +1403,24 @@ void GridPatchCartesianGLL::ComputeVorticityDivergence(
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void GridPatchCartesianGLL::InterpolateData(
+void GridPatchCartesianGLL::RemapData(
 	DataType eDataType,
 	const DataArray1D<double> & dREta,
-	const DataArray1D<double> & dAlpha,
-	const DataArray1D<double> & dBeta,
-	const DataArray1D<int> & iPatch,
+	PatchRemapOperator & opRemap,
 	DataArray3D<double> & dInterpData,
 	DataLocation eOnlyVariablesAt,
 	bool fIncludeReferenceState,
 	bool fConvertToPrimitive
 ) {
-	if (dAlpha.GetRows() != dBeta.GetRows()) {
-		_EXCEPTIONT("Point vectors must have equivalent length.");
+	if ((opRemap.GetPatchIndex() != GetPatchIndex()) ||
+		(opRemap.GetOrder() != m_nHorizontalOrder)
+	) {
+		_EXCEPTIONT("PatchRemapOperator not built on this patch");
 	}
 
-	// Vector for storage interpolated points
-	DataArray1D<double> dAInterpCoeffs(m_nHorizontalOrder);
-	DataArray1D<double> dBInterpCoeffs(m_nHorizontalOrder);
-	DataArray1D<double> dADiffCoeffs(m_nHorizontalOrder);
-	DataArray1D<double> dBDiffCoeffs(m_nHorizontalOrder);
-	DataArray1D<double> dAInterpPt(m_nHorizontalOrder);
-
-	// Element-wise grid spacing
-	double dDeltaA = GetElementDeltaA();
-	double dDeltaB = GetElementDeltaB();
+	// Number of points and weights per point
+	const int nPoints = opRemap.GetPointCount();
+	const int nOrder = m_nHorizontalOrder;
 
 	// Physical constants
 	const PhysicalConstants & phys = m_grid.GetModel().GetPhysicalConstants();
@@ -1482,9 +1483,6 @@ void GridPatchCartesianGLL::InterpolateData(
 	if (dInterpData.GetColumns() != dREta.GetRows()) {
 		_EXCEPTIONT("Invalid size in InterpData (1)");
 	}
-	if (dInterpData.GetSubColumns() != dAlpha.GetRows()) {
-		_EXCEPTIONT("Invalid size in InterpData (2)");
-	}
 
 	// Buffer storage in column
 	DataArray1D<double> dColumnDataOut(dREta.GetRows());
@@ -1514,52 +1512,63 @@ void GridPatchCartesianGLL::InterpolateData(
 			}
 		}
 
-		// Vertical interpolation operator
-		LinearColumnInterpFEM opInterp;
+		// Vertical interpolation operator, built on first use
+		int ixColumnOp =
+			opRemap.FindColumnOperator(eDataLocation, nRElements, dREta);
 
-		if (nRElements != 1) {
+		if (ixColumnOp == (-1)) {
+			LinearColumnInterpFEM & opInterp =
+				opRemap.AddColumnOperator(eDataLocation, nRElements, dREta);
 
-			// Finite element interpolation
-			if (eVerticalDiscType ==
-				Grid::VerticalDiscretization_FiniteElement
-			) {
-				if (eDataLocation == DataLocation_Node) {
-					opInterp.Initialize(
-						LinearColumnInterpFEM::InterpSource_Levels,
-						m_nVerticalOrder,
-						m_grid.GetREtaLevels(),
-						m_grid.GetREtaInterfaces(),
-						dREta);
-
-				} else if (eDataLocation == DataLocation_REdge) {
-					opInterp.Initialize(
-						LinearColumnInterpFEM::InterpSource_Interfaces,
-						m_nVerticalOrder,
-						m_grid.GetREtaLevels(),
-						m_grid.GetREtaInterfaces(),
-						dREta);
+			if (nRElements != 1) {
 
-				} else {
-					_EXCEPTIONT("Invalid DataLocation");
-				}
+				// Finite element interpolation
+				if (eVerticalDiscType ==
+					Grid::VerticalDiscretization_FiniteElement
+				) {
+					if (eDataLocation == DataLocation_Node) {
+						opInterp.Initialize(
+							LinearColumnInterpFEM::InterpSource_Levels,
+							m_nVerticalOrder,
+							m_grid.GetREtaLevels(),
+							m_grid.GetREtaInterfaces(),
+							dREta);
+
+					} else if (eDataLocation == DataLocation_REdge) {
+						opInterp.Initialize(
+							LinearColumnInterpFEM::InterpSource_Interfaces,
+							m_nVerticalOrder,
+							m_grid.GetREtaLevels(),
+							m_grid.GetREtaInterfaces(),
+							dREta);
+
+					} else {
+						_EXCEPTIONT("Invalid DataLocation");
+					}
 
-			// Finite volume interpolation
-			} else if (
-				eVerticalDiscType ==
-				Grid::VerticalDiscretization_FiniteVolume
-			) {
+				// Finite volume interpolation
+				} else if (
+					eVerticalDiscType ==
+					Grid::VerticalDiscretization_FiniteVolume
+				) {
 #pragma message "Finite volume interpolation not implemented correctly"
-				opInterp.InitializeIdentity(nRElements);
+					opInterp.InitializeIdentity(nRElements);
+
+				// Invalid vertical discretization type
+				} else {
+					_EXCEPTIONT("Invalid VerticalDiscretization");
+				}
 
-			// Invalid vertical discretization type
 			} else {
-				_EXCEPTIONT("Invalid VerticalDiscretization");
+				opInterp.InitializeIdentity(1);
 			}
 
-		} else {
-			opInterp.InitializeIdentity(1);
+			ixColumnOp = opRemap.GetColumnOperatorCount() - 1;
 		}
 
+		const LinearColumnInterpFEM & opInterp =
+			opRemap.GetColumnOperator(ixColumnOp);
+
 		// Buffer storage in column
 		DataArray1D<double> dColumnData(nRElements);
 
@@ -1567,6 +1576,11 @@ void GridPatchCartesianGLL::InterpolateData(
 		DataArray3D<double> pData;
 		DataArray3D<double> pDataRef;
 
+#if defined(TEMPEST_SINGLE_PRECISION_TRACERS)
+		// Double precision copy of a single precision tracer
+		DataArray3D<double> dataTracerBuffer;
+#endif
+
 		pData.SetSize(
 			nRElements,
 			m_box.GetATotalWidth(),
@@ -1579,17 +1593,42 @@ void GridPatchCartesianGLL::InterpolateData(
 
 		if (eDataType == DataType_State) {
 			if (eDataLocation == DataLocation_Node) {
+				pData.SetColumnLayout(m_datavecStateNode[0].IsColumnLayout());
 				pData.AttachToData(&(m_datavecStateNode[0][c][0][0][0]));
+				pDataRef.SetColumnLayout(m_dataRefStateNode.IsColumnLayout());
 				pDataRef.AttachToData(&(m_dataRefStateNode[c][0][0][0]));
 			} else if (eDataLocation == DataLocation_REdge) {
+				pData.SetColumnLayout(m_datavecStateREdge[0].IsColumnLayout());
 				pData.AttachToData(&(m_datavecStateREdge[0][c][0][0][0]));
+				pDataRef.SetColumnLayout(m_dataRefStateREdge.IsColumnLayout());
 				pDataRef.AttachToData(&(m_dataRefStateREdge[c][0][0][0]));
 			} else {
 				_EXCEPTIONT("Invalid DataLocation");
 			}
 
 		} else if (eDataType == DataType_Tracers) {
+			pData.SetColumnLayout(m_datavecTracers[0].IsColumnLayout());
+#if defined(TEMPEST_SINGLE_PRECISION_TRACERS)
+			// Widen the tracer to double precision for interpolation
+			dataTracerBuffer.SetColumnLayout(
+				m_datavecTracers[0].IsColumnLayout());
+			dataTracerBuffer.Allocate(
+				nRElements,
+				m_box.GetATotalWidth(),
+				m_box.GetBTotalWidth());
+
+			for (int k = 0; k < nRElements; k++) {
+			for (int i = 0; i < m_box.GetATotalWidth(); i++) {
+			for (int j = 0; j < m_box.GetBTotalWidth(); j++) {
+				dataTracerBuffer[k][i][j] = m_datavecTracers[0][c][k][i][j];
+			}
+			}
+			}
+
+			pData.AttachToData(&(dataTracerBuffer[0][0][0]));
+#else
 			pData.AttachToData(&(m_datavecTracers[0][c][0][0][0]));
+#endif
 
 		} else if (eDataType == DataType_Topography) {
 			pData.AttachToData(&(m_dataTopography[0][0]));
@@ -1616,71 +1655,24 @@ void GridPatchCartesianGLL::InterpolateData(
 			_EXCEPTIONT("Invalid DataType");
 		}
 
-		// Loop throught all points
-		for (int i = 0; i < dAlpha.GetRows(); i++) {
-
-			// Element index
-			if (iPatch[i] != GetPatchIndex()) {
-				continue;
-			}
-
-			// Verify point lies within domain of patch
-			const double Eps = 1.0e-10;
-			if ((dAlpha[i] < m_dAEdge[m_box.GetAInteriorBegin()] - Eps) ||
-				(dAlpha[i] > m_dAEdge[m_box.GetAInteriorEnd()] + Eps) ||
-				(dBeta[i] < m_dBEdge[m_box.GetBInteriorBegin()] - Eps) ||
-				(dBeta[i] > m_dBEdge[m_box.GetBInteriorEnd()] + Eps)
-			) {
-				_EXCEPTIONT("Point out of range");
-			}
-
-			// Determine finite element index
-			int iA =
-				(dAlpha[i] - m_dAEdge[m_box.GetAInteriorBegin()]) / dDeltaA;
-
-			int iB =
-				(dBeta[i] - m_dBEdge[m_box.GetBInteriorBegin()]) / dDeltaB;
-
-			// Bound the index within the element
-			if (iA < 0) {
-				iA = 0;
-			}
-			if (iA >= (m_box.GetAInteriorWidth() / m_nHorizontalOrder)) {
-				iA = m_box.GetAInteriorWidth() / m_nHorizontalOrder - 1;
-			}
-			if (iB < 0) {
-				iB = 0;
-			}
-			if (iB >= (m_box.GetBInteriorWidth() / m_nHorizontalOrder)) {
-				iB = m_box.GetBInteriorWidth() / m_nHorizontalOrder - 1;
-			}
-
-			iA = m_box.GetHaloElements() + iA * m_nHorizontalOrder;
-			iB = m_box.GetHaloElements() + iB * m_nHorizontalOrder;
+		// Loop through all points
+		for (int p = 0; p < nPoints; p++) {
 
-			// Compute interpolation coefficients
-			PolynomialInterp::LagrangianPolynomialCoeffs(
-				m_nHorizontalOrder,
-				&(m_dAEdge[iA]),
-				dAInterpCoeffs,
-				dAlpha[i]);
+			const int i = opRemap.GetPoint(p);
+			const int iA = opRemap.GetNodeA(p);
+			const int iB = opRemap.GetNodeB(p);
 
-			PolynomialInterp::LagrangianPolynomialCoeffs(
-				m_nHorizontalOrder,
-				&(m_dBEdge[iB]),
-				dBInterpCoeffs,
-				dBeta[i]);
+			const double * dWeight = opRemap.GetWeights(p);
 
 			// Perform interpolation on all levels
 			for (int k = 0; k < nRElements; k++) {
 
 				dColumnData[k] = 0.0;
 
-				for (int m = 0; m < m_nHorizontalOrder; m++) {
-				for (int n = 0; n < m_nHorizontalOrder; n++) {
+				for (int m = 0; m < nOrder; m++) {
+				for (int n = 0; n < nOrder; n++) {
 					dColumnData[k] +=
-						  dAInterpCoeffs[m]
-						* dBInterpCoeffs[n]
+						  dWeight[m * nOrder + n]
 						* pData[k][iA+m][iB+n];
 				}
 				}
@@ -1689,11 +1681,10 @@ void GridPatchCartesianGLL::InterpolateData(
 				if ((eDataType == DataType_State) &&
 					(!fIncludeReferenceState)
 				) {
-					for (int m = 0; m < m_nHorizontalOrder; m++) {
-					for (int n = 0; n < m_nHorizontalOrder; n++) {
+					for (int m = 0; m < nOrder; m++) {
+					for (int n = 0; n < nOrder; n++) {
 						dColumnData[k] -=
-							  dAInterpCoeffs[m]
-							* dBInterpCoeffs[n]
+							  dWeight[m * nOrder + n]
 							* pDataRef[k][iA+m][iB+n];
 					}
 					}
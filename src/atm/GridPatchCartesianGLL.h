@@ -132,14 +132,12 @@ public:
 
 public:
 	///	<summary>
-	///		Linearly interpolate data to the specified point.
+	///		Interpolate data to the points of a PatchRemapOperator.
 	///	</summary>
-	virtual void InterpolateData(
+	virtual void RemapData(
 		DataType eDataType,
 		const DataArray1D<double> & dREta,
-		const DataArray1D<double> & dAlpha,
-		const DataArray1D<double> & dBeta,
-		const DataArray1D<int> & iPatch,
+		PatchRemapOperator & opRemap,
 		DataArray3D<double> & dInterpData,
 		DataLocation eOnlyVariablesAt = DataLocation_None,
 		bool fIncludeReferenceState = true,
@@ -20,6 +20,7 @@
 #include "EquationSet.h"
 #include "Defines.h"
 #include "DataArray1D.h"
+#include "PolynomialInterp.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -94,20 +95,18 @@ void GridPatchGLL::InterpolateNodeToREdge(
 		_EXCEPTIONT("Logic error");
 	}
 
-	// Loop over all elements in the box
-	int nStride = dataNode.GetSize(2) * dataNode.GetSize(3);
-
 	const LinearColumnInterpFEM & opInterpNodeToREdge =
 		pGLLGrid->GetOpInterpNodeToREdge();
 
+	// Loop over all elements in the box
 	for (int i = m_box.GetAInteriorBegin(); i < m_box.GetAInteriorEnd(); i++) {
 	for (int j = m_box.GetBInteriorBegin(); j < m_box.GetBInteriorEnd(); j++) {
 
 		opInterpNodeToREdge.Apply(
 			&(dataNode[iVar][0][i][j]),
 			&(dataREdge[iVar][0][i][j]),
-			nStride,
-			nStride);
+			dataNode.GetStride(1),
+			dataREdge.GetStride(1));
 	}
 	}
 }
@@ -131,9 +130,6 @@ void GridPatchGLL::InterpolateREdgeToNode(
 		_EXCEPTIONT("Logic error");
 	}
 
-	// Loop over all elements in the box
-	int nStride = dataNode.GetSize(2) * dataNode.GetSize(3);
-
 	const LinearColumnInterpFEM & opInterpREdgeToNode =
 		pGLLGrid->GetOpInterpREdgeToNode();
 
@@ -144,9 +140,97 @@ void GridPatchGLL::InterpolateREdgeToNode(
 		opInterpREdgeToNode.Apply(
 			&(dataREdge[iVar][0][i][j]),
 			&(dataNode[iVar][0][i][j]),
-			nStride,
-			nStride);
+			dataREdge.GetStride(1),
+			dataNode.GetStride(1));
+	}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void GridPatchGLL::BuildRemapOperator(
+	const DataArray1D<double> & dAlpha,
+	const DataArray1D<double> & dBeta,
+	const DataArray1D<int> & iPatch,
+	PatchRemapOperator & opRemap
+) const {
+	if ((dAlpha.GetRows() != dBeta.GetRows()) ||
+		(dAlpha.GetRows() != iPatch.GetRows())
+	) {
+		_EXCEPTIONT("Point vectors must have equivalent length.");
 	}
+
+	opRemap.Initialize(GetPatchIndex(), m_nHorizontalOrder);
+
+	// Vector for storage interpolation coefficients
+	DataArray1D<double> dAInterpCoeffs(m_nHorizontalOrder);
+	DataArray1D<double> dBInterpCoeffs(m_nHorizontalOrder);
+
+	// Loop throught all points
+	for (int i = 0; i < dAlpha.GetRows(); i++) {
+
+		// Element index
+		if (iPatch[i] != GetPatchIndex()) {
+			continue;
+		}
+
+		// Verify point lies within domain of patch
+		const double Eps = 1.0e-10;
+		if ((dAlpha[i] < m_dAEdge[m_box.GetAInteriorBegin()] - Eps) ||
+			(dAlpha[i] > m_dAEdge[m_box.GetAInteriorEnd()] + Eps) ||
+			(dBeta[i] < m_dBEdge[m_box.GetBInteriorBegin()] - Eps) ||
+			(dBeta[i] > m_dBEdge[m_box.GetBInteriorEnd()] + Eps)
+		) {
+			_EXCEPTIONT("Point out of range");
+		}
+
+		// Determine finite element index
+		int iA =
+			(dAlpha[i] - m_dAEdge[m_box.GetAInteriorBegin()])
+				/ GetElementDeltaA();
+
+		int iB =
+			(dBeta[i] - m_dBEdge[m_box.GetBInteriorBegin()])
+				/ GetElementDeltaB();
+
+		// Bound the index within the element
+		if (iA < 0) {
+			iA = 0;
+		}
+		if (iA >= (m_box.GetAInteriorWidth() / m_nHorizontalOrder)) {
+			iA = m_box.GetAInteriorWidth() / m_nHorizontalOrder - 1;
+		}
+		if (iB < 0) {
+			iB = 0;
+		}
+		if (iB >= (m_box.GetBInteriorWidth() / m_nHorizontalOrder)) {
+			iB = m_box.GetBInteriorWidth() / m_nHorizontalOrder - 1;
+		}
+
+		iA = m_box.GetHaloElements() + iA * m_nHorizontalOrder;
+		iB = m_box.GetHaloElements() + iB * m_nHorizontalOrder;
+
+		// Compute interpolation coefficients
+		PolynomialInterp::LagrangianPolynomialCoeffs(
+			m_nHorizontalOrder,
+			&(m_dAEdge[iA]),
+			dAInterpCoeffs,
+			dAlpha[i]);
+
+		PolynomialInterp::LagrangianPolynomialCoeffs(
+			m_nHorizontalOrder,
+			&(m_dBEdge[iB]),
+			dBInterpCoeffs,
+			dBeta[i]);
+
+		opRemap.AddPoint(
+			i,
+			dAlpha[i],
+			dBeta[i],
+			iA,
+			iB,
+			dAInterpCoeffs,
+			dBInterpCoeffs);
 	}
 }
 
@@ -162,9 +246,9 @@ void GridPatchGLL::ComputeRichardson(
 	int nRElements = m_grid.GetRElements();
 
 	// Get metric quantities
-	const DataArray4D<double> & dDerivRNode =
+	const MetricArray4D & dDerivRNode =
 		GetDerivRNode();
-	const DataArray4D<double> & dDerivRREdge =
+	const MetricArray4D & dDerivRREdge =
 		GetDerivRREdge();
 
 	// Indices of EquationSet variables
@@ -63,6 +63,18 @@ public:
 		int iDataIndex
 	);
 
+public:
+	///	<summary>
+	///		Build the operator which interpolates data from this patch to
+	///		those of the specified points which lie on this patch.
+	///	</summary>
+	virtual void BuildRemapOperator(
+		const DataArray1D<double> & dAlpha,
+		const DataArray1D<double> & dBeta,
+		const DataArray1D<int> & iPatch,
+		PatchRemapOperator & opRemap
+	) const;
+
 public:
 	///	<summary>
 	///		Transform vectors received from other panels to this panel's
@@ -20,6 +20,7 @@
 #include "Model.h"
 #include "Grid.h"
 #include "FunctionTimer.h"
+#include "ThreadTools.h"
 
 #include "Announce.h"
 #include "GridGLL.h"
@@ -58,103 +59,133 @@ HorizontalDynamicsFEM::HorizontalDynamicsFEM(
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void HorizontalDynamicsFEM::Initialize() {
-
-	// Get a copy of the GLL grid
-	GridGLL * pGrid = dynamic_cast<GridGLL*>(m_model.GetGrid());
-	if (pGrid == NULL) {
-		_EXCEPTIONT("Grid must be of type GridGLL");
-	}
-
-	// Number of vertical levels
-	int nRElements = pGrid->GetRElements();
-
-	// Number of tracers
-	int nTracerCount = m_model.GetEquationSet().GetTracers();
-
+void HorizontalDynamicsFEM::ElementWorkspace::Allocate(
+	int nHorizontalOrder,
+	int nRElements,
+	int nTracerCount
+) {
 	// Initialize the alpha and beta mass fluxes
 	m_dAlphaMassFlux.Allocate(
-		m_nHorizontalOrder,
-		m_nHorizontalOrder);
+		nHorizontalOrder,
+		nHorizontalOrder);
 
 	m_dBetaMassFlux.Allocate(
-		m_nHorizontalOrder,
-		m_nHorizontalOrder);
+		nHorizontalOrder,
+		nHorizontalOrder);
 
+#ifdef FIX_ELEMENT_MASS_NONHYDRO
 	// Initialize the alpha and beta mass fluxes for mass fix
 	m_dAlphaElMassFlux.Allocate(
-		m_nHorizontalOrder,
-		m_nHorizontalOrder);
+		nHorizontalOrder,
+		nHorizontalOrder);
 
 	m_dBetaElMassFlux.Allocate(
-		m_nHorizontalOrder,
-		m_nHorizontalOrder);
+		nHorizontalOrder,
+		nHorizontalOrder);
+#endif
 
 	// Initialize the alpha and beta pressure fluxes
 	m_dAlphaPressureFlux.Allocate(
-		m_nHorizontalOrder,
-		m_nHorizontalOrder);
+		nHorizontalOrder,
+		nHorizontalOrder);
 
 	m_dBetaPressureFlux.Allocate(
-		m_nHorizontalOrder,
-		m_nHorizontalOrder);
+		nHorizontalOrder,
+		nHorizontalOrder);
 
 	// Initialize tracer fluxes
 	if (nTracerCount > 0) {
 		m_dAlphaTracerFlux.Allocate(
 			nTracerCount,
-			m_nHorizontalOrder,
-			m_nHorizontalOrder);
+			nHorizontalOrder,
+			nHorizontalOrder);
 
 		m_dBetaTracerFlux.Allocate(
 			nTracerCount,
-			m_nHorizontalOrder,
-			m_nHorizontalOrder);
+			nHorizontalOrder,
+			nHorizontalOrder);
 	}
 
 	// Auxiliary data
 	m_dAuxDataNode.Allocate(
 		9,
 		nRElements,
-		m_nHorizontalOrder,
-		m_nHorizontalOrder);
+		nHorizontalOrder,
+		nHorizontalOrder);
 
 	m_dAuxDataREdge.Allocate(
 		9,
 		nRElements+1,
-		m_nHorizontalOrder,
-		m_nHorizontalOrder);
+		nHorizontalOrder,
+		nHorizontalOrder);
 
 	m_dDivergence.Allocate(
 		nRElements,
-		m_nHorizontalOrder,
-		m_nHorizontalOrder);
+		nHorizontalOrder,
+		nHorizontalOrder);
 
 	// Contravariant metric terms
 	m_dLocalCoriolisF.Allocate(
-		m_nHorizontalOrder,
-		m_nHorizontalOrder);
+		nHorizontalOrder,
+		nHorizontalOrder);
 
 	m_dLocalJacobian2D.Allocate(
-		m_nHorizontalOrder,
-		m_nHorizontalOrder);
+		nHorizontalOrder,
+		nHorizontalOrder);
 
 	m_dLocalJacobian.Allocate(
 		nRElements,
-		m_nHorizontalOrder,
-		m_nHorizontalOrder);
+		nHorizontalOrder,
+		nHorizontalOrder);
 
 	m_dLocalDerivR.Allocate(
 		nRElements,
-		m_nHorizontalOrder,
-		m_nHorizontalOrder,
+		nHorizontalOrder,
+		nHorizontalOrder,
 		3);
 
 	m_dLocalContraMetric.Allocate(
 		nRElements,
+		nHorizontalOrder,
+		nHorizontalOrder,
+		6);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void HorizontalDynamicsFEM::Initialize() {
+
+	// Get a copy of the GLL grid
+	GridGLL * pGrid = dynamic_cast<GridGLL*>(m_model.GetGrid());
+	if (pGrid == NULL) {
+		_EXCEPTIONT("Grid must be of type GridGLL");
+	}
+
+	// Number of vertical levels
+	int nRElements = pGrid->GetRElements();
+
+	// Number of tracers
+	int nTracerCount = m_model.GetEquationSet().GetTracers();
+
+	// Initialize one element workspace per thread
+	m_vecElementWorkspace.resize(GetMaxThreadCount());
+	for (int t = 0; t < m_vecElementWorkspace.size(); t++) {
+		m_vecElementWorkspace[t].Allocate(
+			m_nHorizontalOrder,
+			nRElements,
+			nTracerCount);
+	}
+
+#ifdef FIX_ELEMENT_MASS_NONHYDRO
+	// Initialize the alpha and beta mass fluxes for mass fix
+	m_dAlphaElMassFlux.Allocate(
 		m_nHorizontalOrder,
+		m_nHorizontalOrder);
+
+	m_dBetaElMassFlux.Allocate(
 		m_nHorizontalOrder,
-		6);
+		m_nHorizontalOrder);
+#endif
 
 	// Initialize buffers for derivatives of Jacobian
 	m_dJGradientA.Allocate(
@@ -193,7 +224,7 @@ void HorizontalDynamicsFEM::FilterNegativeTracers(
 		const DataArray3D<double> & dElementArea =
 			pPatch->GetElementArea();
 
-		DataArray4D<double> & dataUpdateTracer =
+		TracerArray4D & dataUpdateTracer =
 			pPatch->GetDataTracers(iDataUpdate);
 
 		// Number of tracers
@@ -293,7 +324,7 @@ void HorizontalDynamicsFEM::StepShallowWater(
 	const int KIx = 4;
 
 	// Perform local update
-	for (int n = 0; n < pGrid->GetActivePatchCount(); n++) {
+	pGrid->ForEachActivePatch([&](int n) {
 		GridPatchGLL * pPatch =
 			dynamic_cast<GridPatchGLL*>(pGrid->GetActivePatch(n));
 
@@ -333,9 +364,18 @@ void HorizontalDynamicsFEM::StepShallowWater(
 		int nElementCountA = pPatch->GetElementCountA();
 		int nElementCountB = pPatch->GetElementCountB();
 
+		ParallelExceptionGuard excParallel;
+
 		// Loop over all elements
+#ifdef _OPENMP
+#pragma omp parallel for collapse(2) schedule(static)
+#endif
 		for (int a = 0; a < nElementCountA; a++) {
 		for (int b = 0; b < nElementCountB; b++) {
+		try {
+
+			// Element workspace for this thread
+			ElementWorkspace & ws = m_vecElementWorkspace[GetThreadIndex()];
 
 			// Compute auxiliary data in element
 			for (int k = 0; k < nRElements; k++) {
@@ -353,20 +393,20 @@ void HorizontalDynamicsFEM::StepShallowWater(
 				double dCovUb = dataInitialNode[VIx][k][iA][iB];
 
 				// Contravariant velocities
-				m_dAuxDataNode[ConUaIx][k][i][j] =
+				ws.m_dAuxDataNode[ConUaIx][k][i][j] =
 					  dContraMetric2DA[iA][iB][0] * dCovUa
 					+ dContraMetric2DA[iA][iB][1] * dCovUb;
 
-				m_dAuxDataNode[ConUbIx][k][i][j] =
+				ws.m_dAuxDataNode[ConUbIx][k][i][j] =
 					  dContraMetric2DB[iA][iB][0] * dCovUa
 					+ dContraMetric2DB[iA][iB][1] * dCovUb;
 
 				// Specific kinetic energy plus pointwise pressure
-				m_dAuxDataNode[KIx][k][i][j] = 0.5 * (
-					  m_dAuxDataNode[ConUaIx][k][i][j] * dCovUa
-					+ m_dAuxDataNode[ConUbIx][k][i][j] * dCovUb);
+				ws.m_dAuxDataNode[KIx][k][i][j] = 0.5 * (
+					  ws.m_dAuxDataNode[ConUaIx][k][i][j] * dCovUa
+					+ ws.m_dAuxDataNode[ConUbIx][k][i][j] * dCovUb);
 
-				m_dAuxDataNode[KIx][k][i][j] +=
+				ws.m_dAuxDataNode[KIx][k][i][j] +=
 					phys.GetG() * dataInitialNode[HIx][k][iA][iB];
 			}
 			}
@@ -383,15 +423,15 @@ void HorizontalDynamicsFEM::StepShallowWater(
 					int iB = b * m_nHorizontalOrder + j + box.GetHaloElements();
 
 					// Height flux
-					m_dAlphaMassFlux[i][j] =
+					ws.m_dAlphaMassFlux[i][j] =
 						dJacobian2D[iA][iB]
 						* (dataInitialNode[HIx][k][iA][iB] - dTopography[iA][iB])
-						* m_dAuxDataNode[ConUaIx][k][i][j];
+						* ws.m_dAuxDataNode[ConUaIx][k][i][j];
 
-					m_dBetaMassFlux[i][j] =
+					ws.m_dBetaMassFlux[i][j] =
 						dJacobian2D[iA][iB]
 						* (dataInitialNode[HIx][k][iA][iB] - dTopography[iA][iB])
-						* m_dAuxDataNode[ConUbIx][k][i][j];
+						* ws.m_dAuxDataNode[ConUbIx][k][i][j];
 
 				}
 				}
@@ -418,8 +458,8 @@ void HorizontalDynamicsFEM::StepShallowWater(
 					double dDbKE = 0.0;
 
 					// Aliases for alpha and beta velocities
-					const double dConUa = m_dAuxDataNode[ConUaIx][k][i][j];
-					const double dConUb = m_dAuxDataNode[ConUbIx][k][i][j];
+					const double dConUa = ws.m_dAuxDataNode[ConUaIx][k][i][j];
+					const double dConUb = ws.m_dAuxDataNode[ConUbIx][k][i][j];
 
 					// Calculate derivatives in the alpha direction
 					double dDaMassFluxA = 0.0;
@@ -428,12 +468,12 @@ void HorizontalDynamicsFEM::StepShallowWater(
 #ifdef DIFFERENTIAL_FORM
 						// Update density: Differential formulation
 						dDaMassFluxA +=
-							m_dAlphaMassFlux[s][j]
+							ws.m_dAlphaMassFlux[s][j]
 							* dDxBasis1D[s][i];
 #else
 						// Update density: Variational formulation
 						dDaMassFluxA -=
-							m_dAlphaMassFlux[s][j]
+							ws.m_dAlphaMassFlux[s][j]
 							* dStiffness1D[i][s];
 #endif
 						// Derivative of covariant beta velocity wrt alpha
@@ -443,7 +483,7 @@ void HorizontalDynamicsFEM::StepShallowWater(
 
 						// Derivative of specific kinetic energy wrt alpha
 						dDaKE +=
-							m_dAuxDataNode[KIx][k][s][j]
+							ws.m_dAuxDataNode[KIx][k][s][j]
 							* dDxBasis1D[s][i];
 					}
 
@@ -454,13 +494,13 @@ void HorizontalDynamicsFEM::StepShallowWater(
 #ifdef DIFFERENTIAL_FORM
 						// Update density: Differential formulation
 						dDbMassFluxB +=
-							m_dBetaMassFlux[i][s]
+							ws.m_dBetaMassFlux[i][s]
 							* dDxBasis1D[s][j];
 
 #else
 						// Update density: Variational formulation
 						dDbMassFluxB -=
-							m_dBetaMassFlux[i][s]
+							ws.m_dBetaMassFlux[i][s]
 							* dStiffness1D[j][s];
 #endif
 						// Derivative of covariant alpha velocity wrt beta
@@ -470,7 +510,7 @@ void HorizontalDynamicsFEM::StepShallowWater(
 
 						// Derivative of specific kinetic energy wrt beta
 						dDbKE +=
-							m_dAuxDataNode[KIx][k][i][s]
+							ws.m_dAuxDataNode[KIx][k][i][s]
 							* dDxBasis1D[s][j];
 					}
 
@@ -527,9 +567,13 @@ void HorizontalDynamicsFEM::StepShallowWater(
 				}
 				}
 			}
+		} catch(...) {
+			excParallel.Capture();
 		}
 		}
-	}
+		}
+		excParallel.Rethrow();
+	});
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -578,7 +622,7 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 		m_nHorizontalOrder * m_nHorizontalOrder;
 
 	// Perform local update
-	for (int n = 0; n < pGrid->GetActivePatchCount(); n++) {
+	pGrid->ForEachActivePatch([&](int n) {
 		GridPatchGLL * pPatch =
 			dynamic_cast<GridPatchGLL*>(pGrid->GetActivePatch(n));
 
@@ -588,26 +632,26 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 			pPatch->GetElementArea();
 		const DataArray2D<double> & dJacobian2D =
 			pPatch->GetJacobian2D();
-		const DataArray3D<double> & dJacobian =
+		const MetricArray3D & dJacobian =
 			pPatch->GetJacobian();
-		const DataArray3D<double> & dJacobianREdge =
+		const MetricArray3D & dJacobianREdge =
 			pPatch->GetJacobianREdge();
-		const DataArray4D<double> & dContraMetricA =
+		const MetricArray4D & dContraMetricA =
 			pPatch->GetContraMetricA();
-		const DataArray4D<double> & dContraMetricB =
+		const MetricArray4D & dContraMetricB =
 			pPatch->GetContraMetricB();
-		const DataArray4D<double> & dContraMetricXi =
+		const MetricArray4D & dContraMetricXi =
 			pPatch->GetContraMetricXi();
-		const DataArray4D<double> & dContraMetricAREdge =
+		const MetricArray4D & dContraMetricAREdge =
 			pPatch->GetContraMetricAREdge();
-		const DataArray4D<double> & dContraMetricBREdge =
+		const MetricArray4D & dContraMetricBREdge =
 			pPatch->GetContraMetricBREdge();
-		const DataArray4D<double> & dContraMetricXiREdge =
+		const MetricArray4D & dContraMetricXiREdge =
 			pPatch->GetContraMetricXiREdge();
 
-		const DataArray4D<double> & dDerivRNode =
+		const MetricArray4D & dDerivRNode =
 			pPatch->GetDerivRNode();
-		const DataArray4D<double> & dDerivRREdge =
+		const MetricArray4D & dDerivRREdge =
 			pPatch->GetDerivRREdge();
 
 		const DataArray2D<double> & dCoriolisF =
@@ -635,10 +679,10 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 		DataArray4D<double> & dataUpdateREdge =
 			pPatch->GetDataState(iDataUpdate, DataLocation_REdge);
 
-		DataArray4D<double> & dataInitialTracer =
+		TracerArray4D & dataInitialTracer =
 			pPatch->GetDataTracers(iDataInitial);
 
-		DataArray4D<double> & dataUpdateTracer =
+		TracerArray4D & dataUpdateTracer =
 			pPatch->GetDataTracers(iDataUpdate);
 
 		// Number of tracers
@@ -646,8 +690,7 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 		// Spacing between vertical levels in dataInitialNode
 		const int nVerticalStateStride =
-			  dataInitialNode.GetSize(2)
-			* dataInitialNode.GetSize(3);
+			dataInitialNode.GetStride(1);
 
 		// Perform interpolations as required due to vertical staggering
 		if (pGrid->GetVarsAtLocation(DataLocation_REdge) != 0) {
@@ -680,9 +723,18 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 		int nElementCountA = pPatch->GetElementCountA();
 		int nElementCountB = pPatch->GetElementCountB();
 
+		ParallelExceptionGuard excParallel;
+
 		// Loop over all elements
+#ifdef _OPENMP
+#pragma omp parallel for collapse(2) schedule(static)
+#endif
 		for (int a = 0; a < nElementCountA; a++) {
 		for (int b = 0; b < nElementCountB; b++) {
+		try {
+
+			// Element workspace for this thread
+			ElementWorkspace & ws = m_vecElementWorkspace[GetThreadIndex()];
 
 			// Store 2D Jacobian
 			for (int i = 0; i < m_nHorizontalOrder; i++) {
@@ -690,8 +742,8 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 				int iA = a * m_nHorizontalOrder + i + box.GetHaloElements();
 				int iB = b * m_nHorizontalOrder + j + box.GetHaloElements();
 
-				m_dLocalCoriolisF[i][j] = dCoriolisF[iA][iB];
-				m_dLocalJacobian2D[i][j] = dJacobian2D[iA][iB];
+				ws.m_dLocalCoriolisF[i][j] = dCoriolisF[iA][iB];
+				ws.m_dLocalJacobian2D[i][j] = dJacobian2D[iA][iB];
 			}
 			}
 
@@ -708,69 +760,69 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 				double dCovUb = dataInitialNode[VIx][k][iA][iB];
 
 				// Store metric quantities
-				m_dLocalJacobian[k][i][j] = dJacobian[k][iA][iB];
+				ws.m_dLocalJacobian[k][i][j] = dJacobian[k][iA][iB];
 
-				m_dLocalDerivR[k][i][j][0] = dDerivRNode[k][iA][iB][0];
-				m_dLocalDerivR[k][i][j][1] = dDerivRNode[k][iA][iB][1];
-				m_dLocalDerivR[k][i][j][2] = dDerivRNode[k][iA][iB][2];
+				ws.m_dLocalDerivR[k][i][j][0] = dDerivRNode[k][iA][iB][0];
+				ws.m_dLocalDerivR[k][i][j][1] = dDerivRNode[k][iA][iB][1];
+				ws.m_dLocalDerivR[k][i][j][2] = dDerivRNode[k][iA][iB][2];
 
-				m_dLocalContraMetric[k][i][j][0] =
+				ws.m_dLocalContraMetric[k][i][j][0] =
 					dContraMetricA[k][iA][iB][0];
-				m_dLocalContraMetric[k][i][j][1] =
+				ws.m_dLocalContraMetric[k][i][j][1] =
 					dContraMetricA[k][iA][iB][1];
-				m_dLocalContraMetric[k][i][j][2] =
+				ws.m_dLocalContraMetric[k][i][j][2] =
 					dContraMetricA[k][iA][iB][2];
-				m_dLocalContraMetric[k][i][j][3] =
+				ws.m_dLocalContraMetric[k][i][j][3] =
 					dContraMetricB[k][iA][iB][1];
-				m_dLocalContraMetric[k][i][j][4] =
+				ws.m_dLocalContraMetric[k][i][j][4] =
 					dContraMetricB[k][iA][iB][2];
-				m_dLocalContraMetric[k][i][j][5] =
+				ws.m_dLocalContraMetric[k][i][j][5] =
 					dContraMetricXi[k][iA][iB][2];
 
 				// Calculate covariant xi velocity and store
 				double dCovUx =
 					  dataInitialNode[WIx][k][iA][iB]
-					* m_dLocalDerivR[k][i][j][2];
+					* ws.m_dLocalDerivR[k][i][j][2];
 
-				m_dAuxDataNode[CovUxIx][k][i][j] = dCovUx;
+				ws.m_dAuxDataNode[CovUxIx][k][i][j] = dCovUx;
 
 				// Contravariant velocities
-				m_dAuxDataNode[ConUaIx][k][i][j] =
-					  m_dLocalContraMetric[k][i][j][0] * dCovUa
-					+ m_dLocalContraMetric[k][i][j][1] * dCovUb
-					+ m_dLocalContraMetric[k][i][j][2] * dCovUx;
+				ws.m_dAuxDataNode[ConUaIx][k][i][j] =
+					  ws.m_dLocalContraMetric[k][i][j][0] * dCovUa
+					+ ws.m_dLocalContraMetric[k][i][j][1] * dCovUb
+					+ ws.m_dLocalContraMetric[k][i][j][2] * dCovUx;
 
-				m_dAuxDataNode[ConUbIx][k][i][j] =
-					  m_dLocalContraMetric[k][i][j][1] * dCovUa
-					+ m_dLocalContraMetric[k][i][j][3] * dCovUb
-					+ m_dLocalContraMetric[k][i][j][4] * dCovUx;
+				ws.m_dAuxDataNode[ConUbIx][k][i][j] =
+					  ws.m_dLocalContraMetric[k][i][j][1] * dCovUa
+					+ ws.m_dLocalContraMetric[k][i][j][3] * dCovUb
+					+ ws.m_dLocalContraMetric[k][i][j][4] * dCovUx;
 
-				m_dAuxDataNode[ConUxIx][k][i][j] =
-					  m_dLocalContraMetric[k][i][j][2] * dCovUa
-					+ m_dLocalContraMetric[k][i][j][4] * dCovUb
-					+ m_dLocalContraMetric[k][i][j][5] * dCovUx;
+				ws.m_dAuxDataNode[ConUxIx][k][i][j] =
+					  ws.m_dLocalContraMetric[k][i][j][2] * dCovUa
+					+ ws.m_dLocalContraMetric[k][i][j][4] * dCovUb
+					+ ws.m_dLocalContraMetric[k][i][j][5] * dCovUx;
 
 				// Specific kinetic energy
-				m_dAuxDataNode[KIx][k][i][j] = 0.5 * (
-					  m_dAuxDataNode[ConUaIx][k][i][j] * dCovUa
-					+ m_dAuxDataNode[ConUbIx][k][i][j] * dCovUb
-					+ m_dAuxDataNode[ConUxIx][k][i][j] * dCovUx);
+				ws.m_dAuxDataNode[KIx][k][i][j] = 0.5 * (
+					  ws.m_dAuxDataNode[ConUaIx][k][i][j] * dCovUa
+					+ ws.m_dAuxDataNode[ConUbIx][k][i][j] * dCovUb
+					+ ws.m_dAuxDataNode[ConUxIx][k][i][j] * dCovUx);
 
 #ifdef FORMULATION_RHOTHETA_P
 				// Pressure
-				m_dAuxDataNode[ExnerIx][k][i][j] =
+				ws.m_dAuxDataNode[ExnerIx][k][i][j] =
 					phys.PressureFromRhoTheta(
 						dataInitialNode[PIx][k][iA][iB]);
 #endif
 #ifdef FORMULATION_RHOTHETA_PI
 				// Exner pressure
-				m_dAuxDataNode[ExnerIx][k][i][j] =
+				ws.m_dAuxDataNode[ExnerIx][k][i][j] =
 					phys.ExnerPressureFromRhoTheta(
 						dataInitialNode[PIx][k][iA][iB]);
 #endif
 #if defined(FORMULATION_THETA) || defined(FORMULATION_THETA_FLUX)
 				// Exner pressure
-				m_dAuxDataNode[ExnerIx][k][i][j] =
+				ws.m_dAuxDataNode[ExnerIx][k][i][j] =
 					phys.ExnerPressureFromRhoTheta(
 						  dataInitialNode[RIx][k][iA][iB]
 						* dataInitialNode[PIx][k][iA][iB]);
@@ -807,7 +859,7 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 					// Derivative of covariant xi velocity wrt alpha
 					dCovDaUx +=
-						m_dAuxDataNode[CovUxIx][k][s][j]
+						ws.m_dAuxDataNode[CovUxIx][k][s][j]
 						* dDxBasis1D[s][i];
 
 					// Derivative of covariant alpha velocity wrt beta
@@ -817,7 +869,7 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 					// Derivative of covariant xi velocity wrt beta
 					dCovDbUx +=
-						m_dAuxDataNode[CovUxIx][k][i][s]
+						ws.m_dAuxDataNode[CovUxIx][k][i][s]
 						* dDxBasis1D[s][j];
 				}
 
@@ -827,9 +879,9 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 				dCovDbUx *= dInvElementDeltaB;
 
 				// Contravariant velocities
-				double dConUa = m_dAuxDataNode[ConUaIx][k][i][j];
-				double dConUb = m_dAuxDataNode[ConUbIx][k][i][j];
-				double dConUx = m_dAuxDataNode[ConUxIx][k][i][j];
+				double dConUa = ws.m_dAuxDataNode[ConUaIx][k][i][j];
+				double dConUb = ws.m_dAuxDataNode[ConUbIx][k][i][j];
+				double dConUx = ws.m_dAuxDataNode[ConUxIx][k][i][j];
 
 				// Relative vorticity (contravariant)
 				double dJZetaA = (dCovDbUx           );
@@ -837,13 +889,13 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 				double dJZetaX = (dCovDaUb - dCovDbUa);
 
 				// U cross Relative Vorticity (contravariant)
-				m_dAuxDataNode[UCrossZetaAIx][k][i][j] =
+				ws.m_dAuxDataNode[UCrossZetaAIx][k][i][j] =
 					dConUb * dJZetaX - dConUx * dJZetaB;
 
-				m_dAuxDataNode[UCrossZetaBIx][k][i][j] =
+				ws.m_dAuxDataNode[UCrossZetaBIx][k][i][j] =
 					dConUx * dJZetaA - dConUa * dJZetaX;
 
-				m_dAuxDataNode[UCrossZetaXIx][k][i][j] =
+				ws.m_dAuxDataNode[UCrossZetaXIx][k][i][j] =
 					- dConUa * dCovDaUx - dConUb * dCovDbUx;
 			}
 			}
@@ -854,9 +906,9 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 				for (int k = 0; k <= nRElements; k++) {
 				for (int i = 0; i < m_nHorizontalOrder; i++) {
 				for (int j = 0; j < m_nHorizontalOrder; j++) {
-					m_dAuxDataREdge[UCrossZetaXIx][k][i][j] =
+					ws.m_dAuxDataREdge[UCrossZetaXIx][k][i][j] =
 						pGrid->InterpolateNodeToREdge(
-							&(m_dAuxDataNode[UCrossZetaXIx][0][i][j]),
+							&(ws.m_dAuxDataNode[UCrossZetaXIx][0][i][j]),
 							NULL,
 							k,
 							0.0,
@@ -883,30 +935,30 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 					// Base fluxes (area times velocity)
 					double dAlphaBaseFlux =
-						m_dLocalJacobian[k][i][j]
-						* m_dAuxDataNode[ConUaIx][k][i][j];
+						ws.m_dLocalJacobian[k][i][j]
+						* ws.m_dAuxDataNode[ConUaIx][k][i][j];
 
 					double dBetaBaseFlux =
-						m_dLocalJacobian[k][i][j]
-						* m_dAuxDataNode[ConUbIx][k][i][j];
+						ws.m_dLocalJacobian[k][i][j]
+						* ws.m_dAuxDataNode[ConUbIx][k][i][j];
 
 					// Density flux
-					m_dAlphaMassFlux[i][j] =
+					ws.m_dAlphaMassFlux[i][j] =
 						  dAlphaBaseFlux
 						* dataInitialNode[RIx][k][iA][iB];
 
-					m_dBetaMassFlux[i][j] =
+					ws.m_dBetaMassFlux[i][j] =
 						  dBetaBaseFlux
 						* dataInitialNode[RIx][k][iA][iB];
 
 #ifdef FORMULATION_PRESSURE
 					// Pressure flux
-					m_dAlphaPressureFlux[i][j] =
+					ws.m_dAlphaPressureFlux[i][j] =
 						  dAlphaBaseFlux
 						* phys.GetGamma()
 						* dataInitialNode[PIx][k][iA][iB];
 
-					m_dBetaPressureFlux[i][j] =
+					ws.m_dBetaPressureFlux[i][j] =
 						  dBetaBaseFlux
 						* phys.GetGamma()
 						* dataInitialNode[PIx][k][iA][iB];
@@ -914,20 +966,20 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 #if defined(FORMULATION_RHOTHETA_PI) \
  || defined(FORMULATION_RHOTHETA_P)
 					// RhoTheta flux
-					m_dAlphaPressureFlux[i][j] =
+					ws.m_dAlphaPressureFlux[i][j] =
 						  dAlphaBaseFlux
 						* dataInitialNode[PIx][k][iA][iB];
 
-					m_dBetaPressureFlux[i][j] =
+					ws.m_dBetaPressureFlux[i][j] =
 						  dBetaBaseFlux
 						* dataInitialNode[PIx][k][iA][iB];
 #endif
 					for (int c = 0; c < nTracerCount; c++) {
-						m_dAlphaTracerFlux[c][i][j] =
+						ws.m_dAlphaTracerFlux[c][i][j] =
 							dAlphaBaseFlux
 							* dataInitialTracer[c][k][iA][iB];
 
-						m_dBetaTracerFlux[c][i][j] =
+						ws.m_dBetaTracerFlux[c][i][j] =
 							dBetaBaseFlux
 							* dataInitialTracer[c][k][iA][iB];
 					}
@@ -959,22 +1011,22 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 							// Gradient of tracer mixing ratio
 							double dConDaQ =
-								  m_dLocalContraMetric[k][i][j][0] * dCovDaQ
-								+ m_dLocalContraMetric[k][i][j][1] * dCovDbQ;
+								  ws.m_dLocalContraMetric[k][i][j][0] * dCovDaQ
+								+ ws.m_dLocalContraMetric[k][i][j][1] * dCovDbQ;
 
 							double dConDbQ =
-								  m_dLocalContraMetric[k][i][j][1] * dCovDaQ
-								+ m_dLocalContraMetric[k][i][j][3] * dCovDbQ;
+								  ws.m_dLocalContraMetric[k][i][j][1] * dCovDaQ
+								+ ws.m_dLocalContraMetric[k][i][j][3] * dCovDbQ;
 
-							m_dAlphaTracerFlux[c][i][j] -=
+							ws.m_dAlphaTracerFlux[c][i][j] -=
 								pGrid->GetScalarUniformDiffusionCoeff()
-								* m_dLocalJacobian[k][i][j]
+								* ws.m_dLocalJacobian[k][i][j]
 								* dataInitialNode[RIx][k][iA][iB]
 								* dConDaQ;
 
-							m_dBetaTracerFlux[c][i][j] -=
+							ws.m_dBetaTracerFlux[c][i][j] -=
 								pGrid->GetScalarUniformDiffusionCoeff()
-								* m_dLocalJacobian[k][i][j]
+								* ws.m_dLocalJacobian[k][i][j]
 								* dataInitialNode[RIx][k][iA][iB]
 								* dConDbQ;
 						}
@@ -988,22 +1040,22 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 					for (int s = 0; s < m_nHorizontalOrder; s++) {
 						// Alpha derivative of J U^a
 						dDaJUa +=
-							m_dLocalJacobian[k][s][j]
-							* m_dAuxDataNode[ConUaIx][k][s][j]
+							ws.m_dLocalJacobian[k][s][j]
+							* ws.m_dAuxDataNode[ConUaIx][k][s][j]
 							* dDxBasis1D[s][i];
 
 						// Beta derivative of J U^b
 						dDbJUb +=
-							m_dLocalJacobian[k][i][s]
-							* m_dAuxDataNode[ConUbIx][k][i][s]
+							ws.m_dLocalJacobian[k][i][s]
+							* ws.m_dAuxDataNode[ConUbIx][k][i][s]
 							* dDxBasis1D[s][j];
 					}
 
 					dDaJUa *= dInvElementDeltaA;
 					dDbJUb *= dInvElementDeltaB;
 
-					m_dDivergence[k][i][j] =
-						(dDaJUa + dDbJUb) / m_dLocalJacobian[k][i][j];
+					ws.m_dDivergence[k][i][j] =
+						(dDaJUa + dDbJUb) / ws.m_dLocalJacobian[k][i][j];
 #endif
 				}
 				}
@@ -1023,14 +1075,14 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 					// Inverse Jacobian
 					const double dInvJacobian =
-						1.0 / m_dLocalJacobian[k][i][j];
+						1.0 / ws.m_dLocalJacobian[k][i][j];
 
 					// Aliases for alpha and beta velocities
-					const double dConUa = m_dAuxDataNode[ConUaIx][k][i][j];
-					const double dConUb = m_dAuxDataNode[ConUbIx][k][i][j];
-					const double dConUx = m_dAuxDataNode[ConUxIx][k][i][j];
+					const double dConUa = ws.m_dAuxDataNode[ConUaIx][k][i][j];
+					const double dConUb = ws.m_dAuxDataNode[ConUbIx][k][i][j];
+					const double dConUx = ws.m_dAuxDataNode[ConUxIx][k][i][j];
 
-					const double dCovUx = m_dAuxDataNode[CovUxIx][k][i][j];
+					const double dCovUx = ws.m_dAuxDataNode[CovUxIx][k][i][j];
 
 					// Derivative of the kinetic energy
 					double dDaKE = 0.0;
@@ -1052,24 +1104,24 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 #ifdef DIFFERENTIAL_FORM
 						// Update density: Differential formulation
 						dDaRhoFluxA +=
-							m_dAlphaMassFlux[s][j]
+							ws.m_dAlphaMassFlux[s][j]
 							* dDxBasis1D[s][i];
 
 #pragma message "Only evaluate pressure flux for relevant formulations"
 						// Update pressure: Differential formulation
 						dDaPressureFluxA +=
-							m_dAlphaPressureFlux[s][j]
+							ws.m_dAlphaPressureFlux[s][j]
 							* dDxBasis1D[s][i];
 
 #else
 						// Update density: Variational formulation
 						dDaRhoFluxA -=
-							m_dAlphaMassFlux[s][j]
+							ws.m_dAlphaMassFlux[s][j]
 							* dStiffness1D[i][s];
 
 						// Update pressure: Variational formulation
 						dDaPressureFluxA -=
-							m_dAlphaPressureFlux[s][j]
+							ws.m_dAlphaPressureFlux[s][j]
 							* dStiffness1D[i][s];
 #endif
 
@@ -1085,18 +1137,18 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
  || defined(FORMULATION_THETA_FLUX)
 						// Derivative of (Exner) pressure with respect to alpha
 						dDaP +=
-							m_dAuxDataNode[ExnerIx][k][s][j]
+							ws.m_dAuxDataNode[ExnerIx][k][s][j]
 							* dDxBasis1D[s][i];
 #endif
 
 						// Derivative of specific kinetic energy wrt alpha
 						dDaKE +=
-							m_dAuxDataNode[KIx][k][s][j]
+							ws.m_dAuxDataNode[KIx][k][s][j]
 							* dDxBasis1D[s][i];
 
 #ifdef INSTEP_DIVERGENCE_DAMPING
 						dDaDiv -=
-							m_dDivergence[k][s][j]
+							ws.m_dDivergence[k][s][j]
 							* dStiffness1D[i][s];
 #endif
 					}
@@ -1109,23 +1161,23 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 #ifdef DIFFERENTIAL_FORM
 						// Update density: Differential formulation
 						dDbRhoFluxB +=
-							m_dBetaMassFlux[i][s]
+							ws.m_dBetaMassFlux[i][s]
 							* dDxBasis1D[s][j];
 
 						// Update pressure: Differential formulation
 						dDbPressureFluxB +=
-							m_dBetaPressureFlux[i][s]
+							ws.m_dBetaPressureFlux[i][s]
 							* dDxBasis1D[s][j];
 
 #else
 						// Update density: Variational formulation
 						dDbRhoFluxB -=
-							m_dBetaMassFlux[i][s]
+							ws.m_dBetaMassFlux[i][s]
 							* dStiffness1D[j][s];
 
 						// Update pressure: Variational formulation
 						dDbPressureFluxB -=
-							m_dBetaPressureFlux[i][s]
+							ws.m_dBetaPressureFlux[i][s]
 							* dStiffness1D[j][s];
 #endif
 
@@ -1141,18 +1193,18 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
  || defined(FORMULATION_THETA_FLUX)
 						// Derivative of (Exner) pressure with respect to beta
 						dDbP +=
-							m_dAuxDataNode[ExnerIx][k][i][s]
+							ws.m_dAuxDataNode[ExnerIx][k][i][s]
 							* dDxBasis1D[s][j];
 #endif
 
 						// Derivative of specific kinetic energy wrt beta
 						dDbKE +=
-							m_dAuxDataNode[KIx][k][i][s]
+							ws.m_dAuxDataNode[KIx][k][i][s]
 							* dDxBasis1D[s][j];
 
 #ifdef INSTEP_DIVERGENCE_DAMPING
 						dDbDiv -=
-							m_dDivergence[k][i][s]
+							ws.m_dDivergence[k][i][s]
 							* dStiffness1D[j][s];
 #endif
 					}
@@ -1180,18 +1232,18 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 					double dLocalUpdateUb = 0.0;
 
 					// Updates due to rotational terms
-					dLocalUpdateUa += m_dAuxDataNode[UCrossZetaAIx][k][i][j];
-					dLocalUpdateUb += m_dAuxDataNode[UCrossZetaBIx][k][i][j];
+					dLocalUpdateUa += ws.m_dAuxDataNode[UCrossZetaAIx][k][i][j];
+					dLocalUpdateUb += ws.m_dAuxDataNode[UCrossZetaBIx][k][i][j];
 
 					// Coriolis terms
 					dLocalUpdateUa +=
-						m_dLocalCoriolisF[i][j]
-						* m_dLocalJacobian2D[i][j]
+						ws.m_dLocalCoriolisF[i][j]
+						* ws.m_dLocalJacobian2D[i][j]
 						* dConUb;
 
 					dLocalUpdateUb -=
-						m_dLocalCoriolisF[i][j]
-						* m_dLocalJacobian2D[i][j]
+						ws.m_dLocalCoriolisF[i][j]
+						* ws.m_dLocalJacobian2D[i][j]
 						* dConUa;
 
 					// Pressure gradient force
@@ -1217,8 +1269,8 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 #endif
 
 					// Gravity
-					double dDaPhi = phys.GetG() * m_dLocalDerivR[k][i][j][0];
-					double dDbPhi = phys.GetG() * m_dLocalDerivR[k][i][j][1];
+					double dDaPhi = phys.GetG() * ws.m_dLocalDerivR[k][i][j][0];
+					double dDbPhi = phys.GetG() * ws.m_dLocalDerivR[k][i][j][1];
 
 					// Horizontal updates due to gradient terms
 					double dDaUpdate =
@@ -1260,8 +1312,8 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 					dElTotalArea += dElementArea[k][iA][iB];
 
 					// Store the local element fluxes
-					m_dAlphaElMassFlux[i][j] = dDaRhoFluxA;
-					m_dBetaElMassFlux[i][j] = dDbRhoFluxB;
+					ws.m_dAlphaElMassFlux[i][j] = dDaRhoFluxA;
+					ws.m_dBetaElMassFlux[i][j] = dDbRhoFluxB;
 #else
 
 					// Update density on model levels
@@ -1295,17 +1347,17 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 						// Calculate vertical velocity update
 						double dLocalUpdateUr =
-							m_dAuxDataNode[UCrossZetaXIx][k][i][j]
-							/ m_dLocalDerivR[k][i][j][2];
+							ws.m_dAuxDataNode[UCrossZetaXIx][k][i][j]
+							/ ws.m_dLocalDerivR[k][i][j][2];
 
 						if (k == 0) {
 							dLocalUpdateUr =
-								- ( m_dLocalContraMetric[0][iA][iB][2]
+								- ( ws.m_dLocalContraMetric[0][iA][iB][2]
 										* dLocalUpdateUa
-								  + m_dLocalContraMetric[0][iA][iB][4]
+								  + ws.m_dLocalContraMetric[0][iA][iB][4]
 								  		* dLocalUpdateUb)
-								/ m_dLocalContraMetric[0][iA][iB][5]
-								/ m_dLocalDerivR[0][i][j][2];
+								/ ws.m_dLocalContraMetric[0][iA][iB][5]
+								/ ws.m_dLocalDerivR[0][i][j][2];
 
 						} else if (k == nRElements-1) {
 							dLocalUpdateUr = 0.0;
@@ -1355,25 +1407,25 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 						for (int s = 0; s < m_nHorizontalOrder; s++) {
 							dDaJUa +=
-								m_dLocalJacobian[k][s][j]
-								* m_dAuxDataNode[ConUaIx][k][s][j]
+								ws.m_dLocalJacobian[k][s][j]
+								* ws.m_dAuxDataNode[ConUaIx][k][s][j]
 								* dDxBasis1D[s][i];
 
 							dDbJUb +=
-								m_dLocalJacobian[k][i][s]
-								* m_dAuxDataNode[ConUbIx][k][i][s]
+								ws.m_dLocalJacobian[k][i][s]
+								* ws.m_dAuxDataNode[ConUbIx][k][i][s]
 								* dDxBasis1D[s][j];
 
 							dDaJThetaUa +=
-								m_dLocalJacobian[k][s][j]
+								ws.m_dLocalJacobian[k][s][j]
 								* dataInitialNode[PIx][k][iElementA+s][iB]
-								* m_dAuxDataNode[ConUaIx][k][s][j]
+								* ws.m_dAuxDataNode[ConUaIx][k][s][j]
 								* dDxBasis1D[s][i];
 
 							dDbJThetaUb +=
-								m_dLocalJacobian[k][i][s]
+								ws.m_dLocalJacobian[k][i][s]
 								* dataInitialNode[PIx][k][iA][iElementB+s]
-								* m_dAuxDataNode[ConUbIx][k][i][s]
+								* ws.m_dAuxDataNode[ConUbIx][k][i][s]
 								* dDxBasis1D[s][j];
 						}
 
@@ -1403,11 +1455,11 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 						for (int s = 0; s < m_nHorizontalOrder; s++) {
 							dDaTracerFluxA -=
-								m_dAlphaTracerFlux[c][s][j]
+								ws.m_dAlphaTracerFlux[c][s][j]
 								* dStiffness1D[i][s];
 
 							dDbTracerFluxB -=
-								m_dBetaTracerFlux[c][i][s]
+								ws.m_dBetaTracerFlux[c][i][s]
 								* dStiffness1D[j][s];
 						}
 
@@ -1431,20 +1483,20 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 									// Inverse Jacobian
 									const double dInvJacobian =
-										1.0 / m_dLocalJacobian[k][i][j];
-									const double dJacobian = m_dLocalJacobian[k][i][j];
+										1.0 / ws.m_dLocalJacobian[k][i][j];
+									const double dJacobian = ws.m_dLocalJacobian[k][i][j];
 
 									int iA = a * m_nHorizontalOrder + i + box.GetHaloElements();
 									int iB = b * m_nHorizontalOrder + j + box.GetHaloElements();
 
-									m_dAlphaElMassFlux[i][j] -= dJacobian * dMassFluxPerNodeA;
-									m_dBetaElMassFlux[i][j] -= dJacobian * dMassFluxPerNodeB;
+									ws.m_dAlphaElMassFlux[i][j] -= dJacobian * dMassFluxPerNodeA;
+									ws.m_dBetaElMassFlux[i][j] -= dJacobian * dMassFluxPerNodeB;
 
 									// Update density on model levels
 									dataUpdateNode[RIx][k][iA][iB] -=
 										dDeltaT * dInvJacobian * (
-											  m_dAlphaElMassFlux[i][j]
-											+ m_dBetaElMassFlux[i][j]);
+											  ws.m_dAlphaElMassFlux[i][j]
+											+ ws.m_dBetaElMassFlux[i][j]);
 								}
 								}
 				/*
@@ -1500,7 +1552,7 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 					// Calculate vertical velocity update
 					double dLocalUpdateUr =
-						m_dAuxDataREdge[UCrossZetaXIx][k][i][j]
+						ws.m_dAuxDataREdge[UCrossZetaXIx][k][i][j]
 						/ dDerivRREdge[k][iA][iB][2];
 
 					dataUpdateREdge[WIx][k][iA][iB] +=
@@ -1531,12 +1583,12 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 						* dDerivRREdge[k][iA][iB][2];
 
 					// Contravariant velocities on interfaces
-					m_dAuxDataREdge[ConUaIx][k][i][j] =
+					ws.m_dAuxDataREdge[ConUaIx][k][i][j] =
 						  dContraMetricAREdge[k][iA][iB][0] * dCovUa
 						+ dContraMetricAREdge[k][iA][iB][1] * dCovUb
 						+ dContraMetricAREdge[k][iA][iB][2] * dCovUx;
 
-					m_dAuxDataREdge[ConUbIx][k][i][j] =
+					ws.m_dAuxDataREdge[ConUbIx][k][i][j] =
 						  dContraMetricBREdge[k][iA][iB][0] * dCovUa
 						+ dContraMetricBREdge[k][iA][iB][1] * dCovUb
 						+ dContraMetricBREdge[k][iA][iB][2] * dCovUx;
@@ -1573,8 +1625,8 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 					dDbTheta *= dInvElementDeltaB;
 
 					// Update Theta on interfaces
-					double dConUa = m_dAuxDataREdge[ConUaIx][k][i][j];
-					double dConUb = m_dAuxDataREdge[ConUbIx][k][i][j];
+					double dConUa = ws.m_dAuxDataREdge[ConUaIx][k][i][j];
+					double dConUb = ws.m_dAuxDataREdge[ConUbIx][k][i][j];
 
 					dataUpdateREdge[PIx][k][iA][iB] -=
 						dDeltaT * (dConUa * dDaTheta + dConUb * dDbTheta);
@@ -1590,24 +1642,24 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 					for (int s = 0; s < m_nHorizontalOrder; s++) {
 						dDaJUa +=
 							dJacobianREdge[k][iElementA+s][iB]
-							* m_dAuxDataREdge[ConUaIx][k][s][j]
+							* ws.m_dAuxDataREdge[ConUaIx][k][s][j]
 							* dDxBasis1D[s][i];
 
 						dDbJUb +=
 							dJacobianREdge[k][iA][iElementB+s]
-							* m_dAuxDataREdge[ConUbIx][k][i][s]
+							* ws.m_dAuxDataREdge[ConUbIx][k][i][s]
 							* dDxBasis1D[s][j];
 
 						dDaJThetaUa +=
 							dJacobianREdge[k][iElementA+s][iB]
 							* dataInitialREdge[PIx][k][iElementA+s][iB]
-							* m_dAuxDataREdge[ConUaIx][k][s][j]
+							* ws.m_dAuxDataREdge[ConUaIx][k][s][j]
 							* dDxBasis1D[s][i];
 
 						dDbJThetaUb +=
 							dJacobianREdge[k][iA][iElementB+s]
 							* dataInitialREdge[PIx][k][iA][iElementB+s]
-							* m_dAuxDataREdge[ConUbIx][k][i][s]
+							* ws.m_dAuxDataREdge[ConUbIx][k][i][s]
 							* dDxBasis1D[s][j];
 					}
 
@@ -1633,9 +1685,13 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 				}
 			}
 #endif
+		} catch(...) {
+			excParallel.Capture();
 		}
 		}
-	}
+		}
+		excParallel.Rethrow();
+	});
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1754,16 +1810,16 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 
 		const DataArray3D<double> & dElementArea =
 			pPatch->GetElementArea();
-		const DataArray3D<double> & dJacobianNode =
+		const MetricArray3D & dJacobianNode =
 			pPatch->GetJacobian();
-		const DataArray3D<double> & dJacobianREdge =
+		const MetricArray3D & dJacobianREdge =
 			pPatch->GetJacobianREdge();
 		const DataArray3D<double> & dContraMetricA =
 			pPatch->GetContraMetric2DA();
 		const DataArray3D<double> & dContraMetricB =
 			pPatch->GetContraMetric2DB();
 
-		const DataArray4D<double> & dDerivRNode =
+		const MetricArray4D & dDerivRNode =
 			pPatch->GetDerivRNode();
 
 		// Grid data
@@ -1786,10 +1842,10 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 			pPatch->GetReferenceState(DataLocation_REdge);
 
 		// Tracer data
-		DataArray4D<double> & dataInitialTracer =
+		TracerArray4D & dataInitialTracer =
 			pPatch->GetDataTracers(iDataInitial);
 
-		DataArray4D<double> & dataUpdateTracer =
+		TracerArray4D & dataUpdateTracer =
 			pPatch->GetDataTracers(iDataUpdate);
 
 		// Element grid spacing and derivative coefficients
@@ -1849,10 +1905,14 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 
 				int nElementCountR;
 
-				const DataArray4D<double> * pDataInitial;
-				DataArray4D<double> * pDataUpdate;
-				const DataArray4D<double> * pDataRef;
-				const DataArray3D<double> * pJacobian;
+				const DataArray4D<double> * pDataInitial = NULL;
+				DataArray4D<double> * pDataUpdate = NULL;
+				const DataArray4D<double> * pDataRef = NULL;
+				const MetricArray3D * pJacobian;
+
+				// Tracers may be stored in a different precision
+				const TracerArray4D * pTracerInitial = NULL;
+				TracerArray4D * pTracerUpdate = NULL;
 
 				if (iType == 0) {
 					if (pGrid->GetVarLocation(c) == DataLocation_Node) {
@@ -1874,8 +1934,8 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 					}
 
 				} else {
-					pDataInitial = &dataInitialTracer;
-					pDataUpdate = &dataUpdateTracer;
+					pTracerInitial = &dataInitialTracer;
+					pTracerUpdate = &dataUpdateTracer;
 					nElementCountR = nRElements;
 					pJacobian = &dJacobianNode;
 				}
@@ -1896,7 +1956,13 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 						int iA = iElementA + i;
 						int iB = iElementB + j;
 
-						m_dBufferState[i][j] = (*pDataInitial)[c][k][iA][iB];
+						if (pDataInitial != NULL) {
+							m_dBufferState[i][j] =
+								(*pDataInitial)[c][k][iA][iB];
+						} else {
+							m_dBufferState[i][j] =
+								(*pTracerInitial)[c][k][iA][iB];
+						}
 					}
 					}
 
@@ -1990,15 +2056,27 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 								m_dBetaElMassFlux[i][j] = dUpdateB;
 							} else {
 								// Apply update
-								(*pDataUpdate)[c][k][iA][iB] -=
+								const double dUpdate =
 									dDeltaT * dInvJacobian * dLocalNu
 										* (dUpdateA + dUpdateB);
+
+								if (pDataUpdate != NULL) {
+									(*pDataUpdate)[c][k][iA][iB] -= dUpdate;
+								} else {
+									(*pTracerUpdate)[c][k][iA][iB] -= dUpdate;
+								}
 							}
 #else
 						// Apply update
-						(*pDataUpdate)[c][k][iA][iB] -=
+						const double dUpdate =
 							dDeltaT * dInvJacobian * dLocalNu
 								* (dUpdateA + dUpdateB);
+
+						if (pDataUpdate != NULL) {
+							(*pDataUpdate)[c][k][iA][iB] -= dUpdate;
+						} else {
+							(*pTracerUpdate)[c][k][iA][iB] -= dUpdate;
+						}
 #endif
 					}
 					}
@@ -2109,10 +2187,14 @@ void HorizontalDynamicsFEM::ApplyVectorHyperdiffusion(
 			dataInitial.GetSize(3));
 
 		if (fApplyToRefState) {
+			dataUa.SetColumnLayout(dataRef.IsColumnLayout());
 			dataUa.AttachToData(&(dataRef[UIx][0][0][0]));
+			dataUb.SetColumnLayout(dataRef.IsColumnLayout());
 			dataUb.AttachToData(&(dataRef[VIx][0][0][0]));
 		} else {
+			dataUa.SetColumnLayout(dataInitial.IsColumnLayout());
 			dataUa.AttachToData(&(dataInitial[UIx][0][0][0]));
+			dataUb.SetColumnLayout(dataInitial.IsColumnLayout());
 			dataUb.AttachToData(&(dataInitial[VIx][0][0][0]));
 		}
 
@@ -2473,8 +2555,7 @@ void HorizontalDynamicsFEM::StepAfterSubCycle(
 		FilterNegativeTracers(iDataUpdate);
 
 		// Apply Direct Stiffness Summation
-		pGrid->ApplyDSS(iDataUpdate, DataType_State);
-		pGrid->ApplyDSS(iDataUpdate, DataType_Tracers);
+		pGrid->ApplyDSS(iDataUpdate, {DataType_State, DataType_Tracers});
 
 	// Apply hyperviscosity
 	} else if (m_nHyperviscosityOrder == 4) {
@@ -2489,8 +2570,7 @@ void HorizontalDynamicsFEM::StepAfterSubCycle(
 			iDataInitial, iDataWorking, 1.0, 1.0, 1.0, false);
 
 		// Apply Direct Stiffness Summation
-		pGrid->ApplyDSS(iDataWorking, DataType_State);
-		pGrid->ApplyDSS(iDataWorking, DataType_Tracers);
+		pGrid->ApplyDSS(iDataWorking, {DataType_State, DataType_Tracers});
 
 		// Apply scalar and vector hyperviscosity (second application)
 		ApplyScalarHyperdiffusion(
@@ -2502,8 +2582,7 @@ void HorizontalDynamicsFEM::StepAfterSubCycle(
 		FilterNegativeTracers(iDataUpdate);
 
 		// Apply Direct Stiffness Summation
-		pGrid->ApplyDSS(iDataUpdate, DataType_State);
-		pGrid->ApplyDSS(iDataUpdate, DataType_Tracers);
+		pGrid->ApplyDSS(iDataUpdate, {DataType_State, DataType_Tracers});
 
 	// Invalid viscosity order
 	} else {
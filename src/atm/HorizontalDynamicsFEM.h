@@ -23,6 +23,8 @@
 #include "DataArray3D.h"
 #include "DataArray4D.h"
 
+#include <vector>
+
 ///////////////////////////////////////////////////////////////////////////////
 
 class Time;
@@ -168,65 +170,123 @@ public:
 
 protected:
 	///	<summary>
-	///		Spatial order of accuracy.
-	///	</summary>
-	int m_nHorizontalOrder;
+	///		Scratch space used when updating a single element.  One instance
+	///		is allocated per thread so that elements can be updated
+	///		concurrently.
+	///	</summary>
+	struct ElementWorkspace {
+
+		///	<summary>
+		///		Allocate all buffers.
+		///	</summary>
+		void Allocate(
+			int nHorizontalOrder,
+			int nRElements,
+			int nTracerCount
+		);
+
+		///	<summary>
+		///		Nodal alpha mass fluxes.
+		///	</summary>
+		DataArray2D<double> m_dAlphaMassFlux;
+
+		///	<summary>
+		///		Nodal beta mass fluxes.
+		///	</summary>
+		DataArray2D<double> m_dBetaMassFlux;
+
+		///	<summary>
+		///		Nodal alpha mass fluxes to sum over element.
+		///	</summary>
+		DataArray2D<double> m_dAlphaElMassFlux;
+
+		///	<summary>
+		///		Nodal beta mass fluxes to sum over element.
+		///	</summary>
+		DataArray2D<double> m_dBetaElMassFlux;
+
+		///	<summary>
+		///		Nodal alpha pressure fluxes.
+		///	</summary>
+		DataArray2D<double> m_dAlphaPressureFlux;
+
+		///	<summary>
+		///		Nodal beta pressure fluxes.
+		///	</summary>
+		DataArray2D<double> m_dBetaPressureFlux;
+
+		///	<summary>
+		///		Nodal alpha tracer fluxes.
+		///	</summary>
+		DataArray3D<double> m_dAlphaTracerFlux;
+
+		///	<summary>
+		///		Nodal beta tracer fluxes.
+		///	</summary>
+		DataArray3D<double> m_dBetaTracerFlux;
+
+		///	<summary>
+		///		Auxiliary data within an element (on nodes).
+		///	</summary>
+		DataArray4D<double> m_dAuxDataNode;
+
+		///	<summary>
+		///		Auxiliary data within an element (on edges).
+		///	</summary>
+		DataArray4D<double> m_dAuxDataREdge;
+
+		///	<summary>
+		///		Divergence within an element (on nodes).
+		///	</summary>
+		DataArray3D<double> m_dDivergence;
+
+		///	<summary>
+		///		2D Jacobian within an element.
+		///	</summary>
+		DataArray2D<double> m_dLocalJacobian2D;
+
+		///	<summary>
+		///		Coriolis parameter within an element.
+		///	</summary>
+		DataArray2D<double> m_dLocalCoriolisF;
+
+		///	<summary>
+		///		Jacobian within an element.
+		///	</summary>
+		DataArray3D<double> m_dLocalJacobian;
+
+		///	<summary>
+		///		Derivative of R with respect to xi within an element.
+		///	</summary>
+		DataArray4D<double> m_dLocalDerivR;
+
+		///	<summary>
+		///		Contravariant metric terms within an element.
+		///	</summary>
+		DataArray4D<double> m_dLocalContraMetric;
+	};
 
+protected:
 	///	<summary>
-	///		Nodal alpha mass fluxes.
+	///		Spatial order of accuracy.
 	///	</summary>
-	DataArray2D<double> m_dAlphaMassFlux;
+	int m_nHorizontalOrder;
 
 	///	<summary>
-	///		Nodal beta mass fluxes.
+	///		Element workspaces (one per thread).
 	///	</summary>
-	DataArray2D<double> m_dBetaMassFlux;
+	std::vector<ElementWorkspace> m_vecElementWorkspace;
 
 	///	<summary>
-	///		Nodal alpha mass fluxes to sum over element.
+	///		Nodal alpha mass fluxes to sum over element (buffer).
 	///	</summary>
 	DataArray2D<double> m_dAlphaElMassFlux;
 
 	///	<summary>
-	///		Nodal beta mass fluxes to sum over element.
+	///		Nodal beta mass fluxes to sum over element (buffer).
 	///	</summary>
 	DataArray2D<double> m_dBetaElMassFlux;
 
-	///	<summary>
-	///		Nodal alpha pressure fluxes.
-	///	</summary>
-	DataArray2D<double> m_dAlphaPressureFlux;
-
-	///	<summary>
-	///		Nodal beta pressure fluxes.
-	///	</summary>
-	DataArray2D<double> m_dBetaPressureFlux;
-
-	///	<summary>
-	///		Nodal alpha tracer fluxes.
-	///	</summary>
-	DataArray3D<double> m_dAlphaTracerFlux;
-
-	///	<summary>
-	///		Nodal beta tracer fluxes.
-	///	</summary>
-	DataArray3D<double> m_dBetaTracerFlux;
-
-	///	<summary>
-	///		Auxiliary data within an element (on nodes).
-	///	</summary>
-	DataArray4D<double> m_dAuxDataNode;
-
-	///	<summary>
-	///		Auxiliary data within an element (on edges).
-	///	</summary>
-	DataArray4D<double> m_dAuxDataREdge;
-
-	///	<summary>
-	///		Divergence within an element (on nodes).
-	///	</summary>
-	DataArray3D<double> m_dDivergence;
-
 protected:
 	///	<summary>
 	///		Nodal pointwise gradient of Jacobian in alpha direction (buffer).
@@ -243,32 +303,6 @@ protected:
 	///	</summary>
 	DataArray2D<double> m_dBufferState;
 
-protected:
-	///	<summary>
-	///		2D Jacobian within an element (buffer).
-	///	</summary>
-	DataArray2D<double> m_dLocalJacobian2D;
-
-	///	<summary>
-	///		2D Jacobian within an element (buffer).
-	///	</summary>
-	DataArray2D<double> m_dLocalCoriolisF;
-
-	///	<summary>
-	///		Jacobian within an element (buffer).
-	///	</summary>
-	DataArray3D<double> m_dLocalJacobian;
-
-	///	<summary>
-	///		Derivative of R with respect to xi within an element (buffer).
-	///	</summary>
-	DataArray4D<double> m_dLocalDerivR;
-
-	///	<summary>
-	///		Contravariant metric terms within an element (buffer).
-	///	</summary>
-	DataArray4D<double> m_dLocalContraMetric;
-
 protected:
 	///	<summary>
 	///		Viscosity / hyperviscosity order.
@@ -24,6 +24,8 @@
 #include "FunctionTimer.h"
 #include "Announce.h"
 #include "MemoryTools.h"
+#include "ThreadTools.h"
+#include "DataAllocator.h"
 
 #include <cfloat>
 
@@ -81,6 +83,10 @@ Model::Model(
 ///////////////////////////////////////////////////////////////////////////////
 
 Model::~Model() {
+	for (int n = 0; n < m_vecWorkflowProcess.size(); n++) {
+		delete m_vecWorkflowProcess[n];
+	}
+
 	if (m_pGrid != NULL) {
 		delete m_pGrid;
 	}
@@ -124,6 +130,9 @@ void Model::SetGrid(
 #ifdef TEMPEST_MPIOMP
 	if (nPatchCount == (-1)) {
 		MPI_Comm_size(MPI_COMM_WORLD, &nPatchCount);
+#ifdef TEMPEST_TASKS
+		nPatchCount *= GetMaxThreadCount();
+#endif
 	}
 #else
 	if (nPatchCount == (-1)) {
@@ -133,6 +142,9 @@ void Model::SetGrid(
 
 	m_pGrid->ApplyDefaultPatchLayout(nPatchCount);
 
+	// Memory not held by GridPatch DataContainers is charged to the Grid
+	MemoryCategoryScope memscope("Grid");
+
 	// Initialize the grid
 	m_pGrid->Initialize();
 
@@ -159,6 +171,9 @@ void Model::SetGridFromRestartFile(
 	// Attach the grid
 	m_pGrid = pGrid;
 
+	// Memory not held by GridPatch DataContainers is charged to the Grid
+	MemoryCategoryScope memscope("Grid");
+
 	// Load the Grid data from the file
 	OutputManagerComposite ompComposite(*m_pGrid, Time(), "", "", "");
 
@@ -259,6 +274,14 @@ void Model::AttachOutputManager(OutputManager * pOutMan) {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void Model::FlushOutput() {
+	for (int om = 0; om < m_vecOutMan.size(); om++) {
+		m_vecOutMan[om]->FlushOutput();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void Model::AttachWorkflowProcess(WorkflowProcess * pWorkflowProcess) {
 	if (m_pGrid == NULL) {
 		_EXCEPTIONT(
@@ -338,9 +361,18 @@ void Model::Go() {
 	m_pGrid->ApplyBoundaryConditions();
 
 	// Initialize all components
-	m_pTimestepScheme->Initialize();
-	m_pHorizontalDynamics->Initialize();
-	m_pVerticalDynamics->Initialize();
+	{
+		MemoryCategoryScope memscope("TimestepScheme");
+		m_pTimestepScheme->Initialize();
+	}
+	{
+		MemoryCategoryScope memscope("HorizontalDynamics");
+		m_pHorizontalDynamics->Initialize();
+	}
+	{
+		MemoryCategoryScope memscope("VerticalDynamics");
+		m_pVerticalDynamics->Initialize();
+	}
 
 	// Set the current time
 	m_time = m_timeStart;
@@ -365,22 +397,25 @@ void Model::Go() {
 			m_pGrid->ComputeTotalVerticalMomentum(0));
 		}
 		//*/
+		MemoryCategoryScope memscope("OutputBuffers");
 		m_vecOutMan[om]->InitialOutput(m_time);
 	}
 
 	// Initialize WorkflowProcesses
 	for (int wfp = 0; wfp < m_vecWorkflowProcess.size(); wfp++) {
+		MemoryCategoryScope memscope("WorkflowProcess");
 		m_vecWorkflowProcess[wfp]->Initialize(m_time);
 	}
 
+	// Report memory usage
+	ReportMemoryUsage(m_strMemoryReportFile);
+
 	// First time step
 	bool fFirstStep = true;
 
 	// Loop
 	for(int iStep = 0;; iStep++) {
 
-		//PrintMemoryLine();
-
 		FunctionTimer timerLoop("Loop");
 
 		// Last time step
@@ -482,6 +517,8 @@ void Model::Go() {
 
 		// Check for output
 		for (int om = 0; om < m_vecOutMan.size(); om++) {
+			MemoryCategoryScope memscope("OutputBuffers");
+
 			if (fLastStep) {
 			  ///* COMMENT IN FOR MASS, ENERGY, AND MOMENTUM OUTPUTS
 				if (om == 0) {
@@ -520,6 +557,16 @@ void Model::Go() {
 		fFirstStep = false;
 	}
 
+	// Finalize WorkflowProcesses
+	for (int wfp = 0; wfp < m_vecWorkflowProcess.size(); wfp++) {
+		m_vecWorkflowProcess[wfp]->Finalize(m_time);
+	}
+
+	// Complete any outputs still being written
+	for (int om = 0; om < m_vecOutMan.size(); om++) {
+		m_vecOutMan[om]->CompleteOutput();
+	}
+
 #if defined(TEMPEST_MPIOMP)
 	{
 		long lTimeLoop =
@@ -618,6 +665,14 @@ void Model::Go() {
 			lGlobalTimeComm[0], lGlobalTimeComm[1], lGlobalTimeComm[2]);
 	}
 #endif
+
+	// Report solver statistics
+	if (m_pVerticalDynamics != NULL) {
+		m_pVerticalDynamics->ReportStatistics();
+	}
+
+	// Report data allocator statistics
+	GetDataAllocator().ReportStatistics();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -115,6 +115,14 @@ public:
 	///	</summary>
 	void AttachWorkflowProcess(WorkflowProcess * pWorkflowProcess);
 
+	///	<summary>
+	///		Wait for all OutputManagers to complete the file operations
+	///		queued on their background threads.  Must be called before
+	///		NetCDF is used outside of an OutputManager, since the NetCDF
+	///		library is not thread-safe.
+	///	</summary>
+	void FlushOutput();
+
 public:
 	///	<summary>
 	///		Get the number of halo elements needed by the model.
@@ -313,6 +321,14 @@ public:
 		m_fDynamicTimestepping = fDynamicTimestepping;
 	}
 
+	///	<summary>
+	///		Set the file to which the memory report is written as JSON when
+	///		the simulation starts.  No file is written if empty.
+	///	</summary>
+	void SetMemoryReportFile(const std::string & strMemoryReportFile) {
+		m_strMemoryReportFile = strMemoryReportFile;
+	}
+
 protected:
 	///	<summary>
 	///		Flag indicating the Grid has been initialized from a restart file.
@@ -395,6 +411,11 @@ private:
 	///		End time of the simulation.
 	///	</summary>
 	Time m_timeEnd;
+
+	///	<summary>
+	///		File to which the memory report is written as JSON.
+	///	</summary>
+	std::string m_strMemoryReportFile;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
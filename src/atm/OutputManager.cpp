@@ -22,6 +22,7 @@
 #include "ConsolidationStatus.h"
 
 #include "Announce.h"
+#include "AsyncTaskQueue.h"
 
 #include <mpi.h>
 
@@ -50,7 +51,8 @@ OutputManager::OutputManager(
 	m_timeOutputFrequency(timeOutputFrequency),
 	m_strOutputDir(strOutputDir),
 	m_strOutputPrefix(strOutputPrefix),
-	m_nOutputsPerFile(nOutputsPerFile)
+	m_nOutputsPerFile(nOutputsPerFile),
+	m_pAsyncQueue(NULL)
 {
 #ifdef TEMPEST_MPIOMP
 	// Create the output directory
@@ -65,6 +67,69 @@ OutputManager::OutputManager(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+OutputManager::~OutputManager() {
+	if (m_pAsyncQueue != NULL) {
+		delete m_pAsyncQueue;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManager::SetAsynchronous(
+	int nMaxPending
+) {
+	if (m_pAsyncQueue != NULL) {
+		FlushOutput();
+		delete m_pAsyncQueue;
+		m_pAsyncQueue = NULL;
+	}
+
+	if (nMaxPending == 0) {
+		return;
+	}
+
+	if (!SupportsAsynchronousOutput()) {
+		Announce("WARNING: %s output does not support asynchronous mode",
+			GetName());
+		return;
+	}
+
+	// The background thread coexists with the thread making MPI calls.
+	// TempestInitialize tolerates a lower level, so output falls back to
+	// synchronous here instead.
+	int iThreadSupport;
+	MPI_Query_thread(&iThreadSupport);
+	if (iThreadSupport < MPI_THREAD_FUNNELED) {
+		Announce("WARNING: Asynchronous %s output requires "
+			"MPI_THREAD_FUNNELED", GetName());
+		return;
+	}
+
+	m_pAsyncQueue = new AsyncTaskQueue(nMaxPending);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManager::FlushOutput() {
+	if (m_pAsyncQueue != NULL) {
+		m_pAsyncQueue->Flush();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManager::DeferFileOperation(
+	const std::function<void()> & fnOperation
+) {
+	if (m_pAsyncQueue != NULL) {
+		m_pAsyncQueue->Push(fnOperation);
+	} else {
+		fnOperation();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void OutputManager::GetFileName(
 	const Time & time,
 	std::string & strFileName
@@ -25,9 +25,11 @@
 #include <netcdfcpp.h>
 #endif
 
+#include <functional>
 #include <vector>
 
 class Grid;
+class AsyncTaskQueue;
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -52,8 +54,7 @@ public:
 	///	<summary>
 	///		Destructor.
 	///	</summary>
-	virtual ~OutputManager()
-	{ }
+	virtual ~OutputManager();
 
 public:
 	///	<summary>
@@ -98,6 +99,52 @@ public:
 	///	</summary>
 	void FinalOutput(const Time & time);
 
+public:
+	///	<summary>
+	///		Write files on a background thread, with at most nMaxPending
+	///		outputs queued.  Data is still gathered on the calling thread;
+	///		only file operations are deferred.  Has no effect, apart from a
+	///		warning, if this OutputManager does not support asynchronous
+	///		output or if MPI does not provide MPI_THREAD_FUNNELED.
+	///	</summary>
+	void SetAsynchronous(int nMaxPending);
+
+	///	<summary>
+	///		Returns true if file operations are performed on a background
+	///		thread.
+	///	</summary>
+	bool IsAsynchronous() const {
+		return (m_pAsyncQueue != NULL);
+	}
+
+	///	<summary>
+	///		Wait for all file operations queued on the background thread to
+	///		complete.
+	///	</summary>
+	void FlushOutput();
+
+	///	<summary>
+	///		Complete all outputs, including any whose collective file
+	///		operations are deferred.  Must be called on all processors.
+	///	</summary>
+	virtual void CompleteOutput() {
+		FlushOutput();
+	}
+
+protected:
+	///	<summary>
+	///		Returns true if this OutputManager supports asynchronous output.
+	///	</summary>
+	virtual bool SupportsAsynchronousOutput() const {
+		return false;
+	}
+
+	///	<summary>
+	///		Perform a file operation, on the background thread if output is
+	///		asynchronous.  The operation must not make MPI calls.
+	///	</summary>
+	void DeferFileOperation(const std::function<void()> & fnOperation);
+
 public:
 	///	<summary>
 	///		Returns true if this OutputManager supports the input operation.
@@ -201,6 +248,12 @@ protected:
 	///		Number of time steps output per file.
 	///	</summary>
 	int m_nOutputsPerFile;
+
+	///	<summary>
+	///		Queue of file operations performed on a background thread, or
+	///		NULL if output is synchronous.
+	///	</summary>
+	AsyncTaskQueue * m_pAsyncQueue;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -23,8 +23,10 @@
 #include "TimeObj.h"
 #include "Announce.h"
 
-#ifdef TEMPEST_MPIOMP
 #include <mpi.h>
+
+#ifdef TEMPEST_ZLIB
+#include <zlib.h>
 #endif
 
 #include <iostream>
@@ -47,9 +49,17 @@ OutputManagerComposite::OutputManagerComposite(
 		timeOutputFrequency,
 		strOutputDir,
 		strOutputFormat,
-		1)
+		1),
+	m_fileActiveOutput(MPI_FILE_NULL),
+	m_fCompress(false),
+	m_fPendingOutput(false)
 {
-	m_iCheck = 171456;
+	// Check bits identify the restart file layout:
+	//   171456  unpadded DataContainer chunks
+	//   171457  chunks padded to the allocator alignment, patch index table
+	//   171458  optional per-patch compression
+	//   171459  measured per-patch cost table
+	m_iCheck = 171459;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -60,74 +70,161 @@ OutputManagerComposite::~OutputManagerComposite() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
-bool OutputManagerComposite::OpenFile(
-	const std::string & strFileName
+void OutputManagerComposite::SetCompression(
+	bool fCompress
 ) {
-#ifdef TEMPEST_MPIOMP
-	// Determine processor rank
-	int nRank;
-	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
-
-	// Open file at root
-	if (nRank == 0) {
+#ifndef TEMPEST_ZLIB
+	if (fCompress) {
+		_EXCEPTIONT("Restart file compression requires ZLIB=TRUE");
+	}
+#endif
+	m_fCompress = fCompress;
+}
 
-		// Check for existing file
-		if (m_ofsActiveOutput.is_open()) {
-			_EXCEPTIONT("Restart file already open");
-		}
+#ifdef TEMPEST_ZLIB
+///////////////////////////////////////////////////////////////////////////////
 
-		// Open new binary output stream
-		std::string strRestartFileName = strFileName + ".restart.dat";
-		m_ofsActiveOutput.open(
-			strRestartFileName.c_str(), std::ios::binary | std::ios::out);
+///	<summary>
+///		Compress a block of data.  The bytes of each 8-byte word are first
+///		grouped by significance, which exposes the repeated sign and
+///		exponent bytes of double precision data to the deflate stage.
+///	</summary>
+static void CompressBlock(
+	const unsigned char * pData,
+	int nByteSize,
+	std::vector<unsigned char> & vecCompressed
+) {
+	const int nWords = nByteSize / 8;
 
-		if (!m_ofsActiveOutput) {
-			_EXCEPTION1("Error opening output file \"%s\"",
-				strRestartFileName.c_str());
-		}
+	std::vector<unsigned char> vecShuffle(nByteSize);
+	for (int w = 0; w < nWords; w++) {
+	for (int b = 0; b < 8; b++) {
+		vecShuffle[b * nWords + w] = pData[w * 8 + b];
+	}
+	}
+	for (int i = 8 * nWords; i < nByteSize; i++) {
+		vecShuffle[i] = pData[i];
 	}
 
-	// Wait for all processes to complete
-	MPI_Barrier(MPI_COMM_WORLD);
+	uLongf sCompressedSize = compressBound(nByteSize);
+	vecCompressed.resize(sCompressedSize);
 
-	return true;
-#else
-	_EXCEPTIONT("Not implemented without TEMPEST_MPIOMP");
-#endif
+	int iResult =
+		compress2(
+			&(vecCompressed[0]), &sCompressedSize,
+			&(vecShuffle[0]), nByteSize,
+			Z_BEST_SPEED);
 
-}	
+	if (iResult != Z_OK) {
+		_EXCEPTION1("zlib compress2 failed (%i)", iResult);
+	}
+
+	vecCompressed.resize(sCompressedSize);
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void OutputManagerComposite::CloseFile() {
-	m_ofsActiveOutput.close();
+///	<summary>
+///		Decompress a block of data written by CompressBlock.
+///	</summary>
+static void DecompressBlock(
+	const std::vector<unsigned char> & vecCompressed,
+	unsigned char * pData,
+	int nByteSize
+) {
+	const int nWords = nByteSize / 8;
+
+	std::vector<unsigned char> vecShuffle(nByteSize);
+
+	uLongf sByteSize = nByteSize;
+
+	int iResult =
+		uncompress(
+			&(vecShuffle[0]), &sByteSize,
+			&(vecCompressed[0]), vecCompressed.size());
+
+	if ((iResult != Z_OK) || (sByteSize != nByteSize)) {
+		_EXCEPTION1("zlib uncompress failed (%i)", iResult);
+	}
+
+	for (int w = 0; w < nWords; w++) {
+	for (int b = 0; b < 8; b++) {
+		pData[w * 8 + b] = vecShuffle[b * nWords + w];
+	}
+	}
+	for (int i = 8 * nWords; i < nByteSize; i++) {
+		pData[i] = vecShuffle[i];
+	}
 }
 
+#endif
 ///////////////////////////////////////////////////////////////////////////////
 
-void OutputManagerComposite::Output(
-	const Time & time
-) {
-#ifdef TEMPEST_MPIOMP
-	// Check for open file
-	if (!IsFileOpen()) {
-		_EXCEPTIONT("No file available for output");
+void OutputManagerComposite::CompressGridPatchData() {
+#ifdef TEMPEST_ZLIB
+	const int nBlocks = 2 * m_grid.GetActivePatchCount();
+
+	m_vecCompressedBlock.resize(nBlocks);
+
+	// Blocks are compressed independently
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+	for (int b = 0; b < nBlocks; b++) {
+		GridPatch * pPatch = m_grid.GetActivePatch(b / 2);
+
+		const DataContainer & dc =
+			(b % 2 == 0)?
+				(pPatch->GetDataContainerGeometric()):
+				(pPatch->GetDataContainerActiveState());
+
+		CompressBlock(
+			dc.GetPointer(),
+			dc.GetTotalByteSize(),
+			m_vecCompressedBlock[b]);
 	}
+#else
+	_EXCEPTIONT("Restart file compression requires ZLIB=TRUE");
+#endif
+}
 
-	// Verify that only one output has been performed
-	if (m_ixOutputTime != 0) {
-		_EXCEPTIONT("Only one Composite output allowed per file");
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerComposite::DecompressGridPatchData() {
+#ifdef TEMPEST_ZLIB
+	const int nBlocks = 2 * m_grid.GetActivePatchCount();
+
+	if (m_vecCompressedBlock.size() != nBlocks) {
+		_EXCEPTIONT("Compressed block count mismatch");
 	}
 
-	// Determine processor rank
-	int nRank;
-	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+	// Blocks are decompressed independently
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+	for (int b = 0; b < nBlocks; b++) {
+		GridPatch * pPatch = m_grid.GetActivePatch(b / 2);
+
+		DataContainer & dc =
+			(b % 2 == 0)?
+				(pPatch->GetDataContainerGeometric()):
+				(pPatch->GetDataContainerActiveState());
+
+		DecompressBlock(
+			m_vecCompressedBlock[b],
+			dc.GetPointer(),
+			dc.GetTotalByteSize());
+	}
+#else
+	_EXCEPTIONT("Restart file compression requires ZLIB=TRUE");
+#endif
+}
 
-	// Data types
-	const int ExchangeDataType_Geometric = 0;
-	const int ExchangeDataType_ActiveState = 1;
-	const int ExchangeDataType_Count = 2;
+///////////////////////////////////////////////////////////////////////////////
 
+void OutputManagerComposite::CalculateGridPatchByteLoc(
+	MPI_Offset offsetBegin
+) {
 	// Determine space allocation for each GridPatch
 	m_vecGridPatchByteSize.Allocate(m_grid.GetPatchCount(), 2);
 
@@ -135,11 +232,20 @@ void OutputManagerComposite::Output(
 		const GridPatch * pPatch = m_grid.GetActivePatch(i);
 
 		int iPatchIx = pPatch->GetPatchIndex();
-		if (iPatchIx > m_grid.GetPatchCount()) {
+		if ((iPatchIx < 0) || (iPatchIx >= m_grid.GetPatchCount())) {
 			_EXCEPTION2("PatchIndex (%i) out of range [0,%i)",
 				iPatchIx, m_grid.GetPatchCount());
 		}
 
+		// Compressed GridPatch data
+		if (m_vecCompressedBlock.size() != 0) {
+			m_vecGridPatchByteSize[iPatchIx][0] =
+				m_vecCompressedBlock[2*i].size();
+			m_vecGridPatchByteSize[iPatchIx][1] =
+				m_vecCompressedBlock[2*i+1].size();
+			continue;
+		}
+
 		const DataContainer & dcGeometric =
 			pPatch->GetDataContainerGeometric();
 		m_vecGridPatchByteSize[iPatchIx][0] =
@@ -151,268 +257,394 @@ void OutputManagerComposite::Output(
 			dcActiveState.GetTotalByteSize();
 	}
 
-	// Reduce GridPatch byte size
-	if (nRank != 0) {
-		MPI_Reduce(
-			&(m_vecGridPatchByteSize[0][0]),
-			&(m_vecGridPatchByteSize[0][0]),
-			m_vecGridPatchByteSize.GetTotalSize(),
-			MPI_INT,
-			MPI_MAX,
-			0,
-			MPI_COMM_WORLD);
-
-	// Reduce GridPatch byte size and write Grid information
-	} else if (nRank == 0) {
-
-		// Reduce
-		MPI_Reduce(
-			MPI_IN_PLACE,
-			&(m_vecGridPatchByteSize[0][0]),
-			m_vecGridPatchByteSize.GetTotalSize(),
-			MPI_INT,
-			MPI_MAX,
-			0,
-			MPI_COMM_WORLD);
-
-		// The active Model
-		const Model & model = m_grid.GetModel();
-
-		// Get maximum byte size for exchange
-		int sMaxRecvBufferByteSize = 0;
-		for (int i = 0; i < m_vecGridPatchByteSize.GetRows(); i++) {
-			if (m_vecGridPatchByteSize[i][0] > sMaxRecvBufferByteSize) {
-				sMaxRecvBufferByteSize = m_vecGridPatchByteSize[i][0];
-			}
-			if (m_vecGridPatchByteSize[i][1] > sMaxRecvBufferByteSize) {
-				sMaxRecvBufferByteSize = m_vecGridPatchByteSize[i][1];
+	MPI_Allreduce(
+		MPI_IN_PLACE,
+		&(m_vecGridPatchByteSize[0][0]),
+		m_vecGridPatchByteSize.GetTotalSize(),
+		MPI_INT,
+		MPI_MAX,
+		MPI_COMM_WORLD);
+
+	// Initialize byte location for each GridPatch
+	m_vecGridPatchByteLoc.Allocate(m_grid.GetPatchCount(), 2);
+	m_vecGridPatchByteLoc[0][0] = offsetBegin;
+	m_vecGridPatchByteLoc[0][1] = offsetBegin + m_vecGridPatchByteSize[0][0];
+	for (int i = 1; i < m_vecGridPatchByteSize.GetRows(); i++) {
+		m_vecGridPatchByteLoc[i][0] =
+			m_vecGridPatchByteLoc[i-1][1]
+			+ m_vecGridPatchByteSize[i-1][1];
+
+		m_vecGridPatchByteLoc[i][1] =
+			m_vecGridPatchByteLoc[i][0]
+			+ m_vecGridPatchByteSize[i][0];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerComposite::TransferGridPatchData(
+	MPI_File fh,
+	bool fWrite,
+	bool fCompressed
+) {
+	// Each GridPatch is transferred as two blocks (Geometric and
+	// ActiveState); every processor takes part in the same number of
+	// collective calls, transferring nothing once its blocks run out
+	int nBlocks = 2 * m_grid.GetActivePatchCount();
+
+	int nMaxBlocks;
+	MPI_Allreduce(
+		&nBlocks,
+		&nMaxBlocks,
+		1,
+		MPI_INT,
+		MPI_MAX,
+		MPI_COMM_WORLD);
+
+	if (fCompressed && !fWrite) {
+		m_vecCompressedBlock.clear();
+		m_vecCompressedBlock.resize(nBlocks);
+	}
+
+	for (int b = 0; b < nMaxBlocks; b++) {
+
+		MPI_Offset offset = 0;
+		unsigned char * pData = NULL;
+		int nByteSize = 0;
+
+		if (b < nBlocks) {
+			GridPatch * pPatch = m_grid.GetActivePatch(b / 2);
+
+			int iPatchIx = pPatch->GetPatchIndex();
+			int iDataType = b % 2;
+
+			DataContainer & dc =
+				(iDataType == 0)?
+					(pPatch->GetDataContainerGeometric()):
+					(pPatch->GetDataContainerActiveState());
+
+			offset = m_vecGridPatchByteLoc[iPatchIx][iDataType];
+			nByteSize = m_vecGridPatchByteSize[iPatchIx][iDataType];
+
+			if (fCompressed) {
+				std::vector<unsigned char> & vecBlock =
+					m_vecCompressedBlock[b];
+
+				if (!fWrite) {
+					vecBlock.resize(nByteSize);
+				}
+				if (vecBlock.size() != nByteSize) {
+					_EXCEPTION1("GridPatch (%i) size mismatch", iPatchIx);
+				}
+				pData = (nByteSize == 0)?(NULL):(&(vecBlock[0]));
+
+			} else {
+				if (dc.GetTotalByteSize() != nByteSize) {
+					_EXCEPTION1("GridPatch (%i) size mismatch", iPatchIx);
+				}
+				pData = dc.GetPointer();
 			}
 		}
 
-		// Allocate Recv buffer at root
-		if (m_vecRecvBuffer.GetRows() < sMaxRecvBufferByteSize) {
-			m_vecRecvBuffer.Allocate(sMaxRecvBufferByteSize);
+		int iResult;
+		if (fWrite) {
+			iResult =
+				MPI_File_write_at_all(
+					fh, offset, pData, nByteSize,
+					MPI_BYTE, MPI_STATUS_IGNORE);
+		} else {
+			iResult =
+				MPI_File_read_at_all(
+					fh, offset, pData, nByteSize,
+					MPI_BYTE, MPI_STATUS_IGNORE);
 		}
 
-		// Initialize byte location for each GridPatch
-		m_vecGridPatchByteLoc.Allocate(m_grid.GetPatchCount(), 2);
-		m_vecGridPatchByteLoc[0][0] = 0;
-		m_vecGridPatchByteLoc[0][1] = m_vecGridPatchByteSize[0][0];
-		for (int i = 1; i < m_vecGridPatchByteSize.GetRows(); i++) { 
-			m_vecGridPatchByteLoc[i][0] =
-				m_vecGridPatchByteLoc[i-1][1]
-				+ m_vecGridPatchByteSize[i-1][1];
-
-			m_vecGridPatchByteLoc[i][1] =
-				m_vecGridPatchByteLoc[i][0]
-				+ m_vecGridPatchByteSize[i][0];
+		if (iResult != MPI_SUCCESS) {
+			_EXCEPTION1("%s failed",
+				(fWrite)?("MPI_File_write_at_all"):("MPI_File_read_at_all"));
 		}
+	}
+}
 
-		// Write check bits
-		m_ofsActiveOutput.write((const char *)(&m_iCheck), sizeof(int));
+///////////////////////////////////////////////////////////////////////////////
 
-		// Write current time
-		const Time & timeCurrent = model.GetCurrentTime();
-		m_ofsActiveOutput.write((const char *)(&(timeCurrent)), sizeof(Time));
+bool OutputManagerComposite::OpenFile(
+	const std::string & strFileName
+) {
+#ifdef TEMPEST_MPIOMP
+	// Check for existing file
+	if (m_fileActiveOutput != MPI_FILE_NULL) {
+		_EXCEPTIONT("Restart file already open");
+	}
 
-		// Write Grid information to file
-		const DataContainer & dcGridParameters =
-			m_grid.GetDataContainerParameters();
-		int nGridParametersByteSize =
-			dcGridParameters.GetTotalByteSize();
-		const char * pGridParameters =
-			(const char *)(dcGridParameters.GetPointer());
+	// Write the previous restart file if it is still pending
+	CompleteOutput();
 
-		m_ofsActiveOutput.write(
-			pGridParameters, nGridParametersByteSize);
+	// Open new binary output file on all processors
+	std::string strRestartFileName = strFileName + ".restart.dat";
 
-		const DataContainer & dcGridPatchData =
-			m_grid.GetDataContainerPatchData();
-		int nGridPatchDataByteSize =
-			dcGridPatchData.GetTotalByteSize();
-		const char * pGridPatchData =
-			(const char *)(dcGridPatchData.GetPointer());
+	// With asynchronous compression the file is opened once the data
+	// has been compressed
+	if (IsAsynchronous()) {
+		m_strPendingFileName = strRestartFileName;
+		return true;
+	}
 
-		m_ofsActiveOutput.write(
-			pGridPatchData, nGridPatchDataByteSize);
+	int iResult =
+		MPI_File_open(
+			MPI_COMM_WORLD,
+			const_cast<char *>(strRestartFileName.c_str()),
+			MPI_MODE_CREATE | MPI_MODE_WRONLY,
+			MPI_INFO_NULL,
+			&m_fileActiveOutput);
+
+	if (iResult != MPI_SUCCESS) {
+		_EXCEPTION1("Error opening output file \"%s\"",
+			strRestartFileName.c_str());
 	}
 
-	// Send data from GridPatches to root
-	if (nRank != 0) {
+	// Truncate any existing file
+	MPI_File_set_size(m_fileActiveOutput, 0);
 
-		int nActivePatches = m_grid.GetActivePatchCount();
-		if (nActivePatches == 0) {
-			_EXCEPTIONT("No GridPatches on processor");
-		}
+	return true;
+#else
+	_EXCEPTIONT("Not implemented without TEMPEST_MPIOMP");
+#endif
 
-		DataArray1D<MPI_Request> vecSendReqGeo(nActivePatches);
-		DataArray1D<MPI_Request> vecSendReqAcS(nActivePatches);
-
-		for (int i = 0; i < nActivePatches; i++) {
-			const GridPatch * pPatch = m_grid.GetActivePatch(i);
-
-			const DataContainer & dcGeometric =
-				pPatch->GetDataContainerGeometric();
-			int nGeometricDataByteSize =
-				dcGeometric.GetTotalByteSize();
-			const unsigned char * pGeometricData =
-				dcGeometric.GetPointer();
-
-			MPI_Isend(
-				const_cast<unsigned char *>(pGeometricData),
-				nGeometricDataByteSize,
-				MPI_BYTE,
-				0,
-				ExchangeDataType_Geometric,
-				MPI_COMM_WORLD,
-				&(vecSendReqGeo[i]));
-
-			const DataContainer & dcActiveState =
-				pPatch->GetDataContainerActiveState();
-			int nActiveStateDataByteSize =
-				dcActiveState.GetTotalByteSize();
-			const unsigned char * pActiveStateData =
-				dcActiveState.GetPointer();
-
-			MPI_Isend(
-				const_cast<unsigned char *>(pActiveStateData),
-				nActiveStateDataByteSize,
-				MPI_BYTE,
-				0,
-				ExchangeDataType_ActiveState,
-				MPI_COMM_WORLD,
-				&(vecSendReqAcS[i]));
-/*
-			printf("Send Geo %i %i\n", pPatch->GetPatchIndex(), nGeometricDataByteSize);
-			printf("Send AcS %i %i\n", pPatch->GetPatchIndex(), nActiveStateDataByteSize);
-*/
-		}
+}	
+
+///////////////////////////////////////////////////////////////////////////////
 
-		int iWaitAllMsgGeo =
-			MPI_Waitall(
-				nActivePatches,
-				&(vecSendReqGeo[0]),
-				MPI_STATUSES_IGNORE);
+void OutputManagerComposite::CloseFile() {
+	if (m_fileActiveOutput != MPI_FILE_NULL) {
+		MPI_File_close(&m_fileActiveOutput);
+	}
+}
 
-		if (iWaitAllMsgGeo == MPI_ERR_IN_STATUS) {
-			_EXCEPTIONT("MPI_Waitall returned MPI_ERR_IN_STATUS");
-		}
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerComposite::StageCompressedOutput(
+	const Time & time
+) {
+#ifdef TEMPEST_ZLIB
+	const int nBlocks = 2 * m_grid.GetActivePatchCount();
+
+	// Copy Grid information
+	const DataContainer & dcGridParameters =
+		m_grid.GetDataContainerParameters();
+	m_vecPendingGridParameters.assign(
+		dcGridParameters.GetPointer(),
+		dcGridParameters.GetPointer()
+			+ dcGridParameters.GetTotalByteSize());
+
+	const DataContainer & dcGridPatchData =
+		m_grid.GetDataContainerPatchData();
+	m_vecPendingGridPatchData.assign(
+		dcGridPatchData.GetPointer(),
+		dcGridPatchData.GetPointer()
+			+ dcGridPatchData.GetTotalByteSize());
+
+	// Copy GridPatch data, so that the model may continue stepping while
+	// the copies are compressed
+	m_vecSnapshotBlock.resize(nBlocks);
+	m_vecCompressedBlock.resize(nBlocks);
+
+	for (int b = 0; b < nBlocks; b++) {
+		const GridPatch * pPatch = m_grid.GetActivePatch(b / 2);
+
+		const DataContainer & dc =
+			(b % 2 == 0)?
+				(pPatch->GetDataContainerGeometric()):
+				(pPatch->GetDataContainerActiveState());
+
+		m_vecSnapshotBlock[b].assign(
+			dc.GetPointer(),
+			dc.GetPointer() + dc.GetTotalByteSize());
+	}
 
-		int iWaitAllMsgAcS =
-			MPI_Waitall(
-				nActivePatches,
-				&(vecSendReqAcS[0]),
-				MPI_STATUSES_IGNORE);
+	m_timePending = time;
+	m_fPendingOutput = true;
 
-		if (iWaitAllMsgAcS == MPI_ERR_IN_STATUS) {
-			_EXCEPTIONT("MPI_Waitall returned MPI_ERR_IN_STATUS");
+	// Compress on the background thread
+	DeferFileOperation([this, nBlocks]() {
+		for (int b = 0; b < nBlocks; b++) {
+			CompressBlock(
+				&(m_vecSnapshotBlock[b][0]),
+				m_vecSnapshotBlock[b].size(),
+				m_vecCompressedBlock[b]);
+
+			std::vector<unsigned char>().swap(m_vecSnapshotBlock[b]);
 		}
+	});
+#else
+	_EXCEPTIONT("Restart file compression requires ZLIB=TRUE");
+#endif
+}
 
-		//std::cout << "WAIT DONE" << std::endl;
+///////////////////////////////////////////////////////////////////////////////
 
-	// Receive data and output to file 
-	} else {
+void OutputManagerComposite::WriteRestart(
+	MPI_File fh,
+	const Time & time,
+	const unsigned char * pGridParameters,
+	int nGridParametersByteSize,
+	const unsigned char * pGridPatchData,
+	int nGridPatchDataByteSize
+) {
+	// Determine processor rank
+	int nRank;
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
 
-		// Reference position
-		std::streampos posRefFile = m_ofsActiveOutput.tellp();
-		if (posRefFile == (-1)) {
-			_EXCEPTIONT("ActiveOutput::tellp() fail");
-		}
+	// Number of processors
+	int nSize;
+	MPI_Comm_size(MPI_COMM_WORLD, &nSize);
 
-		// Write my GridPatch data to file
-		for (int i = 0; i < m_grid.GetActivePatchCount(); i++) {
-			const GridPatch * pPatch = m_grid.GetActivePatch(i);
+	// Position and size of the GridPatch index table
+	int nPatches = m_grid.GetPatchCount();
 
-			int iPatchIx = pPatch->GetPatchIndex();
-			if (iPatchIx > m_grid.GetPatchCount()) {
-				_EXCEPTION2("PatchIndex (%i) out of range [0,%i)",
-					iPatchIx, m_grid.GetPatchCount());
-			}
-/*
-			printf("Write %i %i %i %i %i\n",
-				iPatchIx,
-				m_vecGridPatchByteLoc[iPatchIx][0],
-				m_vecGridPatchByteSize[iPatchIx][0],
-				m_vecGridPatchByteLoc[iPatchIx][1],
-				m_vecGridPatchByteSize[iPatchIx][1]);
-*/
-			const DataContainer & dcGeometric =
-				pPatch->GetDataContainerGeometric();
-			int nGeometricDataByteSize =
-				dcGeometric.GetTotalByteSize();
-			const char * pGeometricData =
-				(const char *)(dcGeometric.GetPointer());
-
-			m_ofsActiveOutput.seekp(
-				posRefFile + m_vecGridPatchByteLoc[iPatchIx][0]);
-			m_ofsActiveOutput.write(
-				pGeometricData, m_vecGridPatchByteSize[iPatchIx][0]);
-
-			const DataContainer & dcActiveState =
-				pPatch->GetDataContainerActiveState();
-			int nActiveStateDataByteSize =
-				dcActiveState.GetTotalByteSize();
-			const char * pActiveStateData =
-				(const char *)(dcActiveState.GetPointer());
-
-			m_ofsActiveOutput.seekp(
-				posRefFile + m_vecGridPatchByteLoc[iPatchIx][1]);
-			m_ofsActiveOutput.write(
-				pActiveStateData, m_vecGridPatchByteSize[iPatchIx][1]);
-		}
+	MPI_Offset offsetIndex =
+		sizeof(int)
+		+ sizeof(Time)
+		+ nGridParametersByteSize
+		+ nGridPatchDataByteSize;
 
-		// Recieve all data objects from neighbors
-		int nRemainingMessages =
-			2 * (m_grid.GetPatchCount() - m_grid.GetActivePatchCount());
+	MPI_Offset nIndexByteSize =
+		3 * sizeof(int)
+		+ 2 * nPatches * sizeof(int)
+		+ 2 * nPatches * sizeof(MPI_Offset)
+		+ nPatches * sizeof(double);
 
-		for (; nRemainingMessages > 0; nRemainingMessages--) {
+	int iCompression = (m_fCompress)?(1):(0);
 
-			// Receive a consolidation message
-			MPI_Status status;
+	// Determine byte size and location of each GridPatch
+	CalculateGridPatchByteLoc(offsetIndex + nIndexByteSize);
 
-			MPI_Recv(
-				&(m_vecRecvBuffer[0]),
-				m_vecRecvBuffer.GetRows(),
-				MPI_CHAR,
-				MPI_ANY_SOURCE,
-				MPI_ANY_TAG,
-				MPI_COMM_WORLD,
-				&status);
+	// Measured cost of each GridPatch, used to balance load when the
+	// file is read on a different number of processors
+	std::vector<double> vecPatchCost;
+	m_grid.GatherPatchTimes(vecPatchCost);
 
-			// Data type from TAG
-			int iDataType = status.MPI_TAG;
-			if ((iDataType < 0) || (iDataType >= ExchangeDataType_Count)) {
-				_EXCEPTION1("MPI_TAG (%i) out of range", iDataType);
-			}
+	// Write check bits, current time, Grid information and the GridPatch
+	// index table at root
+	if (nRank == 0) {
+		MPI_Offset offset = 0;
+
+		MPI_File_write_at(
+			fh, offset,
+			&m_iCheck, sizeof(int),
+			MPI_BYTE, MPI_STATUS_IGNORE);
+		offset += sizeof(int);
+
+		MPI_File_write_at(
+			fh, offset,
+			const_cast<Time *>(&time), sizeof(Time),
+			MPI_BYTE, MPI_STATUS_IGNORE);
+		offset += sizeof(Time);
+
+		MPI_File_write_at(
+			fh, offset,
+			const_cast<unsigned char *>(pGridParameters),
+			nGridParametersByteSize,
+			MPI_BYTE, MPI_STATUS_IGNORE);
+		offset += nGridParametersByteSize;
+
+		MPI_File_write_at(
+			fh, offset,
+			const_cast<unsigned char *>(pGridPatchData),
+			nGridPatchDataByteSize,
+			MPI_BYTE, MPI_STATUS_IGNORE);
+		offset += nGridPatchDataByteSize;
+
+		MPI_File_write_at(
+			fh, offset,
+			&nPatches, sizeof(int),
+			MPI_BYTE, MPI_STATUS_IGNORE);
+		offset += sizeof(int);
+
+		MPI_File_write_at(
+			fh, offset,
+			&nSize, sizeof(int),
+			MPI_BYTE, MPI_STATUS_IGNORE);
+		offset += sizeof(int);
+
+		MPI_File_write_at(
+			fh, offset,
+			&iCompression, sizeof(int),
+			MPI_BYTE, MPI_STATUS_IGNORE);
+		offset += sizeof(int);
+
+		MPI_File_write_at(
+			fh, offset,
+			&(m_vecGridPatchByteSize[0][0]),
+			2 * nPatches * sizeof(int),
+			MPI_BYTE, MPI_STATUS_IGNORE);
+		offset += 2 * nPatches * sizeof(int);
+
+		MPI_File_write_at(
+			fh, offset,
+			&(m_vecGridPatchByteLoc[0][0]),
+			2 * nPatches * sizeof(MPI_Offset),
+			MPI_BYTE, MPI_STATUS_IGNORE);
+		offset += 2 * nPatches * sizeof(MPI_Offset);
+
+		MPI_File_write_at(
+			fh, offset,
+			&(vecPatchCost[0]),
+			nPatches * sizeof(double),
+			MPI_BYTE, MPI_STATUS_IGNORE);
+	}
 
-			// Check patch index
-			int iPatchIx = *((int*)(&(m_vecRecvBuffer[0])));
+	// Write GridPatch data from all processors
+	TransferGridPatchData(fh, true, m_fCompress);
 
-			if (iPatchIx > m_vecGridPatchByteLoc.GetRows()) {
-				_EXCEPTION2("PatchIndex (%i) out of range [0,%i)",
-					iPatchIx, m_vecGridPatchByteLoc.GetRows());
-			}
-/*
-			if (iDataType == 0) {
-				printf("Recv Geo %i %i\n",
-					pPatchIx[0],
-					m_vecGridPatchByteSize[pPatchIx[0]][iDataType]);
-			} else {
-				printf("Recv AcS %i %i\n",
-					pPatchIx[0],
-					m_vecGridPatchByteSize[pPatchIx[0]][iDataType]);
-			}
-*/
-			m_ofsActiveOutput.seekp(
-				posRefFile + m_vecGridPatchByteLoc[iPatchIx][iDataType]);
-			m_ofsActiveOutput.write(
-				(const char *)(&(m_vecRecvBuffer[0])),
-				m_vecGridPatchByteSize[iPatchIx][iDataType]);
-		}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerComposite::Output(
+	const Time & time
+) {
+#ifdef TEMPEST_MPIOMP
+	// Verify that only one output has been performed
+	if (m_ixOutputTime != 0) {
+		_EXCEPTIONT("Only one Composite output allowed per file");
 	}
 
-	// Barrier
-	MPI_Barrier(MPI_COMM_WORLD);
+	// The active Model
+	const Model & model = m_grid.GetModel();
+
+	// Compress in the background; the file is written by CompleteOutput()
+	if (IsAsynchronous()) {
+		StageCompressedOutput(model.GetCurrentTime());
+		return;
+	}
+
+	// Check for open file
+	if (!IsFileOpen()) {
+		_EXCEPTIONT("No file available for output");
+	}
+
+	// Compress GridPatch data
+	if (m_fCompress) {
+		CompressGridPatchData();
+	}
+
+	// Grid information
+	const DataContainer & dcGridParameters =
+		m_grid.GetDataContainerParameters();
+
+	const DataContainer & dcGridPatchData =
+		m_grid.GetDataContainerPatchData();
+
+	WriteRestart(
+		m_fileActiveOutput,
+		model.GetCurrentTime(),
+		dcGridParameters.GetPointer(),
+		dcGridParameters.GetTotalByteSize(),
+		dcGridPatchData.GetPointer(),
+		dcGridPatchData.GetTotalByteSize());
+
+	m_vecCompressedBlock.clear();
 
 #else
 	_EXCEPTIONT("Not implemented without TEMPEST_MPIOMP");
@@ -421,6 +653,51 @@ void OutputManagerComposite::Output(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void OutputManagerComposite::CompleteOutput() {
+
+	// Wait for compression to complete
+	FlushOutput();
+
+	if (!m_fPendingOutput) {
+		return;
+	}
+	m_fPendingOutput = false;
+
+#ifdef TEMPEST_MPIOMP
+	int iResult =
+		MPI_File_open(
+			MPI_COMM_WORLD,
+			const_cast<char *>(m_strPendingFileName.c_str()),
+			MPI_MODE_CREATE | MPI_MODE_WRONLY,
+			MPI_INFO_NULL,
+			&m_fileActiveOutput);
+
+	if (iResult != MPI_SUCCESS) {
+		_EXCEPTION1("Error opening output file \"%s\"",
+			m_strPendingFileName.c_str());
+	}
+
+	// Truncate any existing file
+	MPI_File_set_size(m_fileActiveOutput, 0);
+
+	WriteRestart(
+		m_fileActiveOutput,
+		m_timePending,
+		&(m_vecPendingGridParameters[0]),
+		m_vecPendingGridParameters.size(),
+		&(m_vecPendingGridPatchData[0]),
+		m_vecPendingGridPatchData.size());
+
+	CloseFile();
+
+	m_vecCompressedBlock.clear();
+	m_vecPendingGridParameters.clear();
+	m_vecPendingGridPatchData.clear();
+#endif
+}
+
+///////////////
+
 Time OutputManagerComposite::Input(
 	const std::string & strFileName
 ) {
@@ -428,26 +705,37 @@ Time OutputManagerComposite::Input(
 	// Set the flag indicating that output came from a restart file
 	m_fFromRestartFile = true;
 
-	// Determine processor rank
-	int nRank;
-	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
-
-	// The active model
-	const Model & model = m_grid.GetModel();
+	// Open binary input file on all processors
+	MPI_File fileActiveInput;
 
-	// Open binary input stream
-	std::ifstream ifsActiveInput;
-	ifsActiveInput.open(
-		strFileName.c_str(), std::ios::binary | std::ios::in);
+	int iResult =
+		MPI_File_open(
+			MPI_COMM_WORLD,
+			const_cast<char *>(strFileName.c_str()),
+			MPI_MODE_RDONLY,
+			MPI_INFO_NULL,
+			&fileActiveInput);
 
-	if (!ifsActiveInput) {
+	if (iResult != MPI_SUCCESS) {
 		_EXCEPTION1("Unable to open input file \"%s\"",
 			strFileName.c_str());
 	}
 
+	MPI_Offset offset = 0;
+
 	// Read check bits
 	int iCheckInput;
-	ifsActiveInput.read((char *)(&iCheckInput), sizeof(int));
+	MPI_File_read_at_all(
+		fileActiveInput, offset,
+		&iCheckInput, sizeof(int),
+		MPI_BYTE, MPI_STATUS_IGNORE);
+	offset += sizeof(int);
+
+	if ((iCheckInput >= 171456) && (iCheckInput < m_iCheck)) {
+		_EXCEPTION3("Restart file \"%s\" uses an older layout "
+			"(check bits %i, expected %i) and cannot be read",
+			strFileName.c_str(), iCheckInput, m_iCheck);
+	}
 	if (iCheckInput != m_iCheck) {
 		_EXCEPTION1("Invalid or incompatible input file \"%s\"",
 			strFileName.c_str());
@@ -455,16 +743,22 @@ Time OutputManagerComposite::Input(
 
 	// Read current time
 	Time timeCurrent;
-	ifsActiveInput.read((char *)(&(timeCurrent)), sizeof(Time));
+	MPI_File_read_at_all(
+		fileActiveInput, offset,
+		&timeCurrent, sizeof(Time),
+		MPI_BYTE, MPI_STATUS_IGNORE);
+	offset += sizeof(Time);
 
 	// Read Grid parameters from file
 	DataContainer & dcGridParameters = m_grid.GetDataContainerParameters();
 	int nGridParametersByteSize =
 		dcGridParameters.GetTotalByteSize();
-	char * pGridParameters =
-		(char *)(dcGridParameters.GetPointer());
 
-	ifsActiveInput.read(pGridParameters, nGridParametersByteSize);
+	MPI_File_read_at_all(
+		fileActiveInput, offset,
+		dcGridParameters.GetPointer(), nGridParametersByteSize,
+		MPI_BYTE, MPI_STATUS_IGNORE);
+	offset += nGridParametersByteSize;
 
 	// Initialize the Grid from specified parameters
 	m_grid.InitializeDataLocal();
@@ -473,105 +767,94 @@ Time OutputManagerComposite::Input(
 	DataContainer & dcGridPatchData = m_grid.GetDataContainerPatchData();
 	int nGridPatchDataByteSize =
 		dcGridPatchData.GetTotalByteSize();
-	char * pGridPatchData =
-		(char *)(dcGridPatchData.GetPointer());
-
-	ifsActiveInput.read(pGridPatchData, nGridPatchDataByteSize);
-
-	// Distribute GridPatches to processors
-	m_grid.DistributePatches();
-
-	// Determine space allocation for each GridPatch
-	m_vecGridPatchByteSize.Allocate(m_grid.GetPatchCount(), 2);
 
-	for (int i = 0; i < m_grid.GetActivePatchCount(); i++) {
-		const GridPatch * pPatch = m_grid.GetActivePatch(i);
-
-		int iPatchIx = pPatch->GetPatchIndex();
-		if (iPatchIx > m_grid.GetPatchCount()) {
-			_EXCEPTION2("PatchIndex (%i) out of range [0,%i)",
-				iPatchIx, m_grid.GetPatchCount());
-		}
-
-		const DataContainer & dcGeometric =
-			pPatch->GetDataContainerGeometric();
-		m_vecGridPatchByteSize[iPatchIx][0] =
-			dcGeometric.GetTotalByteSize();
-
-		const DataContainer & dcActiveState =
-			pPatch->GetDataContainerActiveState();
-		m_vecGridPatchByteSize[iPatchIx][1] =
-			dcActiveState.GetTotalByteSize();
+	MPI_File_read_at_all(
+		fileActiveInput, offset,
+		dcGridPatchData.GetPointer(), nGridPatchDataByteSize,
+		MPI_BYTE, MPI_STATUS_IGNORE);
+	offset += nGridPatchDataByteSize;
+
+	// Read the GridPatch index table
+	int nPatches;
+	MPI_File_read_at_all(
+		fileActiveInput, offset,
+		&nPatches, sizeof(int),
+		MPI_BYTE, MPI_STATUS_IGNORE);
+	offset += sizeof(int);
+
+	if (nPatches != m_grid.GetPatchCount()) {
+		_EXCEPTION2("GridPatch index table size (%i) does not match "
+			"patch count (%i)", nPatches, m_grid.GetPatchCount());
 	}
 
-	MPI_Allreduce(
-		MPI_IN_PLACE,
-		&(m_vecGridPatchByteSize[0][0]),
-		m_vecGridPatchByteSize.GetTotalSize(),
-		MPI_INT,
-		MPI_MAX,
-		MPI_COMM_WORLD);
-
-	// Initialize byte location for each GridPatch
-	m_vecGridPatchByteLoc.Allocate(m_grid.GetPatchCount(), 2);
-	m_vecGridPatchByteLoc[0][0] = 0;
-	m_vecGridPatchByteLoc[0][1] = m_vecGridPatchByteSize[0][0];
-	for (int i = 1; i < m_vecGridPatchByteSize.GetRows(); i++) { 
-		m_vecGridPatchByteLoc[i][0] =
-			m_vecGridPatchByteLoc[i-1][1]
-			+ m_vecGridPatchByteSize[i-1][1];
-
-		m_vecGridPatchByteLoc[i][1] =
-			m_vecGridPatchByteLoc[i][0]
-			+ m_vecGridPatchByteSize[i][0];
+	int nWriterSize;
+	MPI_File_read_at_all(
+		fileActiveInput, offset,
+		&nWriterSize, sizeof(int),
+		MPI_BYTE, MPI_STATUS_IGNORE);
+	offset += sizeof(int);
+
+	int iCompression;
+	MPI_File_read_at_all(
+		fileActiveInput, offset,
+		&iCompression, sizeof(int),
+		MPI_BYTE, MPI_STATUS_IGNORE);
+	offset += sizeof(int);
+
+	if ((iCompression != 0) && (iCompression != 1)) {
+		_EXCEPTION1("Unknown restart file compression (%i)", iCompression);
 	}
 
-	// Reference position
-	std::streampos posRefFile = ifsActiveInput.tellg();
-	if (posRefFile == (-1)) {
-		_EXCEPTIONT("ActiveInput::tellg() fail");
+	m_vecGridPatchByteSize.Allocate(nPatches, 2);
+	MPI_File_read_at_all(
+		fileActiveInput, offset,
+		&(m_vecGridPatchByteSize[0][0]),
+		2 * nPatches * sizeof(int),
+		MPI_BYTE, MPI_STATUS_IGNORE);
+	offset += 2 * nPatches * sizeof(int);
+
+	m_vecGridPatchByteLoc.Allocate(nPatches, 2);
+	MPI_File_read_at_all(
+		fileActiveInput, offset,
+		&(m_vecGridPatchByteLoc[0][0]),
+		2 * nPatches * sizeof(MPI_Offset),
+		MPI_BYTE, MPI_STATUS_IGNORE);
+	offset += 2 * nPatches * sizeof(MPI_Offset);
+
+	std::vector<double> vecPatchCost(nPatches);
+	MPI_File_read_at_all(
+		fileActiveInput, offset,
+		&(vecPatchCost[0]),
+		nPatches * sizeof(double),
+		MPI_BYTE, MPI_STATUS_IGNORE);
+	offset += nPatches * sizeof(double);
+
+	// Distribute GridPatches to processors; the distribution need not
+	// match that of the processors which wrote the file.  When patches
+	// are redistributed they are balanced by the cost measured by the
+	// writer.
+	int nSize;
+	MPI_Comm_size(MPI_COMM_WORLD, &nSize);
+
+	if (nWriterSize != nSize) {
+		Announce("Redistributing %i patches written on %i processors "
+			"to %i processors", nPatches, nWriterSize, nSize);
+
+		m_grid.SetPatchCosts(vecPatchCost);
 	}
 
-	// Load in GridPatch data from file
-	for (int i = 0; i < m_grid.GetActivePatchCount(); i++) {
-		GridPatch * pPatch = m_grid.GetActivePatch(i);
-
-		int iPatchIx = pPatch->GetPatchIndex();
-		if (iPatchIx > m_grid.GetPatchCount()) {
-			_EXCEPTION2("PatchIndex (%i) out of range [0,%i)",
-				iPatchIx, m_grid.GetPatchCount());
-		}
-
-		DataContainer & dcGeometric =
-			pPatch->GetDataContainerGeometric();
-		int nGeometricDataByteSize =
-			dcGeometric.GetTotalByteSize();
-		char * pGeometricData =
-			(char *)(dcGeometric.GetPointer());
-
-		ifsActiveInput.seekg(
-			posRefFile + m_vecGridPatchByteLoc[iPatchIx][0]);
-		ifsActiveInput.read(
-			pGeometricData, m_vecGridPatchByteSize[iPatchIx][0]);
+	m_grid.DistributePatches();
 
-		DataContainer & dcActiveState =
-			pPatch->GetDataContainerActiveState();
-		int nActiveStateDataByteSize =
-			dcActiveState.GetTotalByteSize();
-		char * pActiveStateData =
-			(char *)(dcActiveState.GetPointer());
+	// Load in GridPatch data of the active patches from file
+	TransferGridPatchData(fileActiveInput, false, (iCompression != 0));
 
-		ifsActiveInput.seekg(
-			posRefFile + m_vecGridPatchByteLoc[iPatchIx][1]);
-		ifsActiveInput.read(
-			pActiveStateData, m_vecGridPatchByteSize[iPatchIx][1]);
+	if (iCompression != 0) {
+		DecompressGridPatchData();
+		m_vecCompressedBlock.clear();
 	}
 
 	// Close the file
-	ifsActiveInput.close();
-
-	// Barrier
-	MPI_Barrier(MPI_COMM_WORLD);
+	MPI_File_close(&fileActiveInput);
 
 #else
 	_EXCEPTIONT("Not implemented without TEMPEST_MPIOMP");
@@ -20,7 +20,10 @@
 #include "OutputManager.h"
 #include "DataArray1D.h"
 #include "DataArray2D.h"
-#include <fstream>
+
+#include <mpi.h>
+
+#include <vector>
 
 class Time;
 
@@ -35,7 +38,12 @@ typedef int NcVar;
 
 ///	<summary>
 ///		An OutputManager which implements direct dumping of data structures
-///		to a NetCDF file for later recovery.
+///		to a file for later recovery.  The file begins with a header (check
+///		bits, time, Grid parameters and Grid patch data) followed by an
+///		index table with the byte location and size of the data of each
+///		GridPatch by global patch index, so that any subset of patches can
+///		be read back and a run can be restarted on a different number of
+///		processors.
 ///	</summary>
 class OutputManagerComposite :
 	public OutputManager
@@ -65,6 +73,20 @@ public:
 		return "Composite";
 	}
 
+	///	<summary>
+	///		Compress the data of each GridPatch written to the restart file
+	///		with a lossless codec (requires ZLIB).
+	///	</summary>
+	void SetCompression(
+		bool fCompress = true
+	);
+
+	///	<summary>
+	///		Write the restart file whose compression is pending.  Must be
+	///		called on all processors.
+	///	</summary>
+	virtual void CompleteOutput();
+
 public:
 	///	<summary>
 	///		Open a new NetCDF file.
@@ -79,6 +101,16 @@ public:
 	virtual void CloseFile();
 
 protected:
+	///	<summary>
+	///		Compressed output can be performed asynchronously: compression
+	///		runs on the background thread, while the file is written
+	///		collectively on the calling thread once the next output begins
+	///		or CompleteOutput() is called.
+	///	</summary>
+	virtual bool SupportsAsynchronousOutput() const {
+		return m_fCompress;
+	}
+
 	///	<summary>
 	///		Write output to a file.
 	///	</summary>
@@ -102,6 +134,63 @@ public:
 		const std::string & strFileName
 	);
 
+private:
+	///	<summary>
+	///		Calculate the byte size of each GridPatch from the active
+	///		patches on all processors, and the byte location of each
+	///		GridPatch in the file when GridPatch data begins at offsetBegin.
+	///	</summary>
+	void CalculateGridPatchByteLoc(
+		MPI_Offset offsetBegin
+	);
+
+	///	<summary>
+	///		Collectively write (or read) the Geometric and ActiveState data
+	///		of all active GridPatches on this processor at their byte
+	///		locations in the patch index table.  If fCompressed is true the
+	///		data is transferred through the compressed blocks.
+	///	</summary>
+	void TransferGridPatchData(
+		MPI_File fh,
+		bool fWrite,
+		bool fCompressed
+	);
+
+	///	<summary>
+	///		Compress the Geometric and ActiveState data of all active
+	///		GridPatches on this processor into the compressed blocks.
+	///	</summary>
+	void CompressGridPatchData();
+
+	///	<summary>
+	///		Decompress the compressed blocks into the Geometric and
+	///		ActiveState data of all active GridPatches on this processor.
+	///	</summary>
+	void DecompressGridPatchData();
+
+	///	<summary>
+	///		Copy the Grid information and the Geometric and ActiveState data
+	///		of all active GridPatches on this processor, and compress the
+	///		copies on the background thread.
+	///	</summary>
+	void StageCompressedOutput(
+		const Time & time
+	);
+
+	///	<summary>
+	///		Collectively write the check bits, time, Grid information, the
+	///		GridPatch index table and all GridPatch data to the given file.
+	///		If compression is enabled the compressed blocks must be ready.
+	///	</summary>
+	void WriteRestart(
+		MPI_File fh,
+		const Time & time,
+		const unsigned char * pGridParameters,
+		int nGridParametersByteSize,
+		const unsigned char * pGridPatchData,
+		int nGridPatchDataByteSize
+	);
+
 protected:
 	///	<summary>
 	///		Check bits.
@@ -110,25 +199,63 @@ protected:
 
 protected:
 	///	<summary>
-	///		Active output file.
+	///		Active output file, opened collectively on all processors.
 	///	</summary>
-	std::ofstream m_ofsActiveOutput;
+	MPI_File m_fileActiveOutput;
 
 private:
 	///	<summary>
-	///		Byte size for each GridPatch.
+	///		Flag indicating that GridPatch data is compressed on output.
 	///	</summary>
-	DataArray2D<int> m_vecGridPatchByteSize;
+	bool m_fCompress;
+
+	///	<summary>
+	///		Compressed Geometric and ActiveState data of each active
+	///		GridPatch on this processor.
+	///	</summary>
+	std::vector< std::vector<unsigned char> > m_vecCompressedBlock;
+
+	///	<summary>
+	///		Copies of the Geometric and ActiveState data of each active
+	///		GridPatch on this processor, released once compressed.
+	///	</summary>
+	std::vector< std::vector<unsigned char> > m_vecSnapshotBlock;
+
+	///	<summary>
+	///		Flag indicating that a restart file is waiting to be written.
+	///	</summary>
+	bool m_fPendingOutput;
+
+	///	<summary>
+	///		Name of the restart file waiting to be written.
+	///	</summary>
+	std::string m_strPendingFileName;
+
+	///	<summary>
+	///		Model time of the restart file waiting to be written.
+	///	</summary>
+	Time m_timePending;
 
 	///	<summary>
-	///		Byte location for each GridPatch.
+	///		Copy of the Grid parameters for the pending restart file.
 	///	</summary>
-	DataArray2D<std::streamoff> m_vecGridPatchByteLoc;
+	std::vector<unsigned char> m_vecPendingGridParameters;
+
+	///	<summary>
+	///		Copy of the Grid patch data for the pending restart file.
+	///	</summary>
+	std::vector<unsigned char> m_vecPendingGridPatchData;
+
+	///	<summary>
+	///		Byte size for each GridPatch, indexed by global patch index.
+	///	</summary>
+	DataArray2D<int> m_vecGridPatchByteSize;
 
 	///	<summary>
-	///		Vector used at root node for storage of received data.
+	///		Byte location in the file for each GridPatch, indexed by global
+	///		patch index.
 	///	</summary>
-	DataArray1D<double> m_vecRecvBuffer;
+	DataArray2D<MPI_Offset> m_vecGridPatchByteLoc;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
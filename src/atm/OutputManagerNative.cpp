@@ -0,0 +1,588 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    OutputManagerNative.cpp
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "OutputManagerNative.h"
+
+#include "Model.h"
+#include "Grid.h"
+#include "GridGLL.h"
+#include "GridCSGLL.h"
+#include "GridPatchGLL.h"
+#include "TimeObj.h"
+#include "Announce.h"
+
+#include <mpi.h>
+
+#include <cstdio>
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////////
+
+OutputManagerNative::OutputManagerNative(
+	Grid & grid,
+	const Time & timeOutputFrequency,
+	std::string strOutputDir,
+	std::string strOutputPrefix,
+	int nOutputsPerFile
+) :
+	OutputManager(
+		grid,
+		timeOutputFrequency,
+		strOutputDir,
+		strOutputPrefix,
+		nOutputsPerFile),
+	m_iGridStamp(-1),
+	m_nHorizontalOrder(0),
+	m_nNodes(0),
+	m_nElements(0),
+	m_pActiveNcOutput(NULL),
+	m_varTime(NULL),
+	m_varVorticity(NULL),
+	m_varDivergence(NULL),
+	m_varTemperature(NULL),
+	m_varSurfacePressure(NULL),
+	m_fOutputVorticity(false),
+	m_fOutputDivergence(false),
+	m_fOutputTemperature(false),
+	m_fOutputSurfacePressure(false)
+{
+#ifndef TEMPEST_NETCDF
+	Announce("WARNING: Native output requires NetCDF (NETCDF=TRUE)");
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+OutputManagerNative::~OutputManagerNative() {
+	CloseFile();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool OutputManagerNative::CalculateNodeMap() {
+
+	if (m_grid.GetGridStamp() == m_iGridStamp) {
+		return false;
+	}
+
+	const GridGLL * pGLLGrid = dynamic_cast<const GridGLL *>(&m_grid);
+	if (pGLLGrid == NULL) {
+		_EXCEPTIONT("Native output requires a GLL grid");
+	}
+
+	m_nHorizontalOrder = pGLLGrid->GetHorizontalOrder();
+
+	const int nPatches = m_grid.GetActivePatchCount();
+
+	m_vecPatchNodeBegin.resize(nPatches);
+	m_vecPatchNodeA.resize(nPatches);
+	m_vecPatchNodeB.resize(nPatches);
+
+	m_nNodes = 0;
+	m_nElements = 0;
+
+	for (int n = 0; n < nPatches; n++) {
+		const GridPatchGLL * pPatch =
+			dynamic_cast<const GridPatchGLL *>(m_grid.GetActivePatch(n));
+
+		if (pPatch == NULL) {
+			_EXCEPTIONT("Native output requires GLL grid patches");
+		}
+
+		const PatchBox & box = pPatch->GetPatchBox();
+
+		const int nOrder = m_nHorizontalOrder;
+
+		// Adjacent elements share their edge nodes
+		const int nStride = (nOrder > 1)?(nOrder - 1):(1);
+		const int nShared = (nOrder > 1)?(1):(0);
+
+		const int nElementsA = pPatch->GetElementCountA();
+		const int nElementsB = pPatch->GetElementCountB();
+
+		const int nNodesA = nElementsA * nStride + nShared;
+		const int nNodesB = nElementsB * nStride + nShared;
+
+		// Index of each unique node along each coordinate direction
+		std::vector<int> & vecNodeA = m_vecPatchNodeA[n];
+		std::vector<int> & vecNodeB = m_vecPatchNodeB[n];
+
+		vecNodeA.resize(nNodesA);
+		for (int u = 0; u < nNodesA; u++) {
+			int a = u / nStride;
+			if (a > nElementsA - 1) {
+				a = nElementsA - 1;
+			}
+			vecNodeA[u] = box.GetAInteriorBegin() + a * nOrder + (u - a * nStride);
+		}
+
+		vecNodeB.resize(nNodesB);
+		for (int u = 0; u < nNodesB; u++) {
+			int b = u / nStride;
+			if (b > nElementsB - 1) {
+				b = nElementsB - 1;
+			}
+			vecNodeB[u] = box.GetBInteriorBegin() + b * nOrder + (u - b * nStride);
+		}
+
+		m_vecPatchNodeBegin[n] = m_nNodes;
+
+		m_nNodes += nNodesA * nNodesB;
+		m_nElements += nElementsA * nElementsB;
+	}
+
+	m_vecNodeBuffer.resize((m_grid.GetRElements() + 1) * m_nNodes);
+
+	m_iGridStamp = m_grid.GetGridStamp();
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename FieldFunctor>
+void OutputManagerNative::GatherNodes(
+	int nLevels,
+	FieldFunctor fnField
+) {
+	if (nLevels == 0) {
+		nLevels = 1;
+	}
+
+	for (int n = 0; n < m_grid.GetActivePatchCount(); n++) {
+		const std::vector<int> & vecNodeA = m_vecPatchNodeA[n];
+		const std::vector<int> & vecNodeB = m_vecPatchNodeB[n];
+
+		const int nNodesB = static_cast<int>(vecNodeB.size());
+
+		for (int k = 0; k < nLevels; k++) {
+			double * pBuffer =
+				&(m_vecNodeBuffer[k * m_nNodes + m_vecPatchNodeBegin[n]]);
+
+			for (int uA = 0; uA < vecNodeA.size(); uA++) {
+			for (int uB = 0; uB < nNodesB; uB++) {
+				pBuffer[uA * nNodesB + uB] =
+					fnField(n, k, vecNodeA[uA], vecNodeB[uB]);
+			}
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerNative::PutNodes(
+	NcVar * var,
+	int nLevels
+) {
+#ifdef TEMPEST_NETCDF
+	if (nLevels == 0) {
+		var->set_cur(m_ixOutputTime, 0);
+		var->put(&(m_vecNodeBuffer[0]), 1, m_nNodes);
+
+	} else {
+		var->set_cur(m_ixOutputTime, 0, 0);
+		var->put(&(m_vecNodeBuffer[0]), 1, nLevels, m_nNodes);
+	}
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool OutputManagerNative::OpenFile(
+	const std::string & strFileName
+) {
+#ifdef TEMPEST_NETCDF
+	// Check for existing NetCDF file
+	if (m_pActiveNcOutput != NULL) {
+		_EXCEPTIONT("NetCDF file already open");
+	}
+
+	// Update the node map
+	CalculateNodeMap();
+
+	// Processors with no active patches do not write a file
+	if (m_nNodes == 0) {
+		return true;
+	}
+
+	// Each processor writes its own file
+	int nRank;
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+
+	int nSize;
+	MPI_Comm_size(MPI_COMM_WORLD, &nSize);
+
+	char szRank[16];
+	snprintf(szRank, 16, ".native.%06i.nc", nRank);
+
+	std::string strNcFileName = strFileName + szRank;
+
+	// The active model
+	const Model & model = m_grid.GetModel();
+
+	// Equation set
+	const EquationSet & eqn = model.GetEquationSet();
+
+	// Open new NetCDF file
+	m_pActiveNcOutput = new NcFile(strNcFileName.c_str(), NcFile::Replace);
+	if (m_pActiveNcOutput == NULL) {
+		_EXCEPTION1("Error opening NetCDF file \"%s\"",
+			strNcFileName.c_str());
+	}
+	if (!m_pActiveNcOutput->is_valid()) {
+		_EXCEPTION1("Error opening NetCDF file \"%s\"",
+			strNcFileName.c_str());
+	}
+
+	// Create nodal time dimension
+	NcDim * dimTime = m_pActiveNcOutput->add_dim("time");
+	if (dimTime == NULL) {
+		_EXCEPTIONT("Error creating \"time\" dimension");
+	}
+
+	m_varTime = m_pActiveNcOutput->add_var("time", ncDouble, dimTime);
+	if (m_varTime == NULL) {
+		_EXCEPTIONT("Error creating \"time\" variable");
+	}
+
+	std::string strUnits =
+		"days since " + model.GetStartTime().ToDateString();
+
+	std::string strCalendarName = model.GetStartTime().GetCalendarName();
+
+	m_varTime->add_att("long_name", "time");
+	m_varTime->add_att("units", strUnits.c_str());
+	m_varTime->add_att("calendar", strCalendarName.c_str());
+
+	// Create levels, node and element dimensions
+	NcDim * dimLev =
+		m_pActiveNcOutput->add_dim("lev", m_grid.GetRElements());
+
+	NcDim * dimILev =
+		m_pActiveNcOutput->add_dim("ilev", m_grid.GetRElements()+1);
+
+	NcDim * dimNode =
+		m_pActiveNcOutput->add_dim("node", m_nNodes);
+
+	NcDim * dimElement =
+		m_pActiveNcOutput->add_dim("element", m_nElements);
+
+	NcDim * dimNp =
+		m_pActiveNcOutput->add_dim("np", m_nHorizontalOrder);
+
+	// Output processor and grid parameters
+	const PhysicalConstants & phys = model.GetPhysicalConstants();
+
+	m_pActiveNcOutput->add_att("rank", nRank);
+	m_pActiveNcOutput->add_att("ranks", nSize);
+	m_pActiveNcOutput->add_att("earth_radius", phys.GetEarthRadius());
+	m_pActiveNcOutput->add_att("Ztop", m_grid.GetZtop());
+	m_pActiveNcOutput->add_att("equation_set", eqn.GetName().c_str());
+
+	// Create variables
+	for (int c = 0; c < eqn.GetComponents(); c++) {
+		m_vecComponentVar.push_back(
+			m_pActiveNcOutput->add_var(
+				eqn.GetComponentShortName(c).c_str(),
+				ncDouble,
+				dimTime,
+				(m_grid.GetVarLocation(c) == DataLocation_REdge)?
+					(dimILev):(dimLev),
+				dimNode));
+	}
+
+	for (int c = 0; c < eqn.GetTracers(); c++) {
+		m_vecTracersVar.push_back(
+			m_pActiveNcOutput->add_var(
+				eqn.GetTracerShortName(c).c_str(),
+				ncDouble, dimTime, dimLev, dimNode));
+	}
+
+	if (m_fOutputVorticity) {
+		m_varVorticity =
+			m_pActiveNcOutput->add_var(
+				"ZETA", ncDouble, dimTime, dimLev, dimNode);
+	}
+
+	if (m_fOutputDivergence) {
+		m_varDivergence =
+			m_pActiveNcOutput->add_var(
+				"DELTA", ncDouble, dimTime, dimLev, dimNode);
+	}
+
+	if (m_fOutputTemperature) {
+		m_varTemperature =
+			m_pActiveNcOutput->add_var(
+				"T", ncDouble, dimTime, dimLev, dimNode);
+	}
+
+	if (m_fOutputSurfacePressure) {
+		m_varSurfacePressure =
+			m_pActiveNcOutput->add_var(
+				"PS", ncDouble, dimTime, dimNode);
+	}
+
+	// Output levels
+	NcVar * varLev =
+		m_pActiveNcOutput->add_var("lev", ncDouble, dimLev);
+
+	varLev->put(
+		m_grid.GetREtaStretchLevels(),
+		m_grid.GetREtaStretchLevels().GetRows());
+
+	varLev->add_att("long_name", "level");
+	varLev->add_att("units", "level");
+
+	NcVar * varILev =
+		m_pActiveNcOutput->add_var("ilev", ncDouble, dimILev);
+
+	varILev->put(
+		m_grid.GetREtaStretchInterfaces(),
+		m_grid.GetREtaStretchInterfaces().GetRows());
+
+	varILev->add_att("long_name", "interface level");
+	varILev->add_att("units", "level");
+
+	// Output node coordinates; on the sphere coordinates are converted
+	// from radians to degrees
+	bool fSphere = (dynamic_cast<const GridCSGLL *>(&m_grid) != NULL);
+
+	double dCoordScale = (fSphere)?(180.0 / M_PI):(1.0);
+
+	NcVar * varLon = m_pActiveNcOutput->add_var("lon", ncDouble, dimNode);
+	NcVar * varLat = m_pActiveNcOutput->add_var("lat", ncDouble, dimNode);
+
+	GatherNodes(0, [&](int n, int k, int i, int j) {
+		return dCoordScale * m_grid.GetActivePatch(n)->GetLongitude()[i][j];
+	});
+	varLon->put(&(m_vecNodeBuffer[0]), m_nNodes);
+
+	GatherNodes(0, [&](int n, int k, int i, int j) {
+		return dCoordScale * m_grid.GetActivePatch(n)->GetLatitude()[i][j];
+	});
+	varLat->put(&(m_vecNodeBuffer[0]), m_nNodes);
+
+	if (fSphere) {
+		varLon->add_att("long_name", "longitude");
+		varLon->add_att("units", "degrees_east");
+
+		varLat->add_att("long_name", "latitude");
+		varLat->add_att("units", "degrees_north");
+
+	} else {
+		varLon->add_att("long_name", "x");
+		varLon->add_att("units", "m");
+
+		varLat->add_att("long_name", "y");
+		varLat->add_att("units", "m");
+	}
+
+	// Output topography
+	NcVar * varTopography =
+		m_pActiveNcOutput->add_var("Zs", ncDouble, dimNode);
+
+	GatherNodes(0, [&](int n, int k, int i, int j) {
+		return m_grid.GetActivePatch(n)->GetTopography()[i][j];
+	});
+	varTopography->put(&(m_vecNodeBuffer[0]), m_nNodes);
+
+	// Output the patch and the nodes of each finite element
+	const int nOrder = m_nHorizontalOrder;
+	const int nStride = (nOrder > 1)?(nOrder - 1):(1);
+
+	std::vector<int> vecElementPatch(m_nElements);
+	std::vector<int> vecElementNodes(m_nElements * nOrder * nOrder);
+
+	int ixElement = 0;
+	for (int n = 0; n < m_grid.GetActivePatchCount(); n++) {
+		const GridPatchGLL * pPatch =
+			dynamic_cast<const GridPatchGLL *>(m_grid.GetActivePatch(n));
+
+		const int nNodesB = static_cast<int>(m_vecPatchNodeB[n].size());
+
+		for (int a = 0; a < pPatch->GetElementCountA(); a++) {
+		for (int b = 0; b < pPatch->GetElementCountB(); b++) {
+			vecElementPatch[ixElement] = pPatch->GetPatchIndex();
+
+			int * pNodes = &(vecElementNodes[ixElement * nOrder * nOrder]);
+			for (int i = 0; i < nOrder; i++) {
+			for (int j = 0; j < nOrder; j++) {
+				pNodes[i * nOrder + j] =
+					  m_vecPatchNodeBegin[n]
+					+ (a * nStride + i) * nNodesB
+					+ (b * nStride + j);
+			}
+			}
+			ixElement++;
+		}
+		}
+	}
+
+	NcVar * varElementPatch =
+		m_pActiveNcOutput->add_var("element_patch", ncInt, dimElement);
+
+	varElementPatch->put(&(vecElementPatch[0]), m_nElements);
+	varElementPatch->add_att("long_name", "patch index of element");
+
+	NcVar * varElementNodes =
+		m_pActiveNcOutput->add_var(
+			"element_nodes", ncInt, dimElement, dimNp, dimNp);
+
+	varElementNodes->put(
+		&(vecElementNodes[0]), m_nElements, nOrder, nOrder);
+	varElementNodes->add_att("long_name", "node index of element GLL nodes");
+#endif
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerNative::CloseFile() {
+#ifdef TEMPEST_NETCDF
+	if (m_pActiveNcOutput != NULL) {
+		delete m_pActiveNcOutput;
+		m_pActiveNcOutput = NULL;
+
+		m_vecComponentVar.clear();
+		m_vecTracersVar.clear();
+	}
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerNative::Output(
+	const Time & time
+) {
+	// Derived quantities are computed on all processors since their
+	// computation may require communication
+	if (m_fOutputVorticity || m_fOutputDivergence) {
+		m_grid.ComputeVorticityDivergence(0);
+	}
+	if (m_fOutputTemperature) {
+		m_grid.ComputeTemperature(0);
+	}
+	if (m_fOutputSurfacePressure) {
+		m_grid.ComputeSurfacePressure(0);
+	}
+
+#ifdef TEMPEST_NETCDF
+	if (m_pActiveNcOutput == NULL) {
+		return;
+	}
+
+	if (CalculateNodeMap()) {
+		_EXCEPTIONT("Grid modified while native output file is open");
+	}
+
+	// Equation set
+	const EquationSet & eqn = m_grid.GetModel().GetEquationSet();
+
+	// Time of this output
+	double dTimeDays = (time - m_grid.GetModel().GetStartTime()) / 86400.0;
+
+	m_varTime->set_cur(m_ixOutputTime);
+	m_varTime->put(&dTimeDays, 1);
+
+	// Horizontal velocities are converted to primitive components
+	bool fConvertVelocity =
+		(eqn.GetComponents() >= 2)
+		&& (m_grid.GetVarLocation(0) == m_grid.GetVarLocation(1));
+
+	// Store state variable data
+	for (int c = 0; c < eqn.GetComponents(); c++) {
+		const DataLocation loc = m_grid.GetVarLocation(c);
+
+		const int nLevels =
+			(loc == DataLocation_REdge)?
+				(m_grid.GetRElements()+1):(m_grid.GetRElements());
+
+		if (fConvertVelocity && (c < 2)) {
+			GatherNodes(nLevels, [&](int n, int k, int i, int j) {
+				const GridPatch * pPatch = m_grid.GetActivePatch(n);
+				const DataArray4D<double> & dataState =
+					pPatch->GetDataState(0, loc);
+
+				double dUa = dataState[0][k][i][j];
+				double dUb = dataState[1][k][i][j];
+
+				pPatch->ConvertToPrimitiveVelocity(i, j, dUa, dUb);
+
+				return (c == 0)?(dUa):(dUb);
+			});
+
+		} else {
+			GatherNodes(nLevels, [&](int n, int k, int i, int j) {
+				return m_grid.GetActivePatch(n)->
+					GetDataState(0, loc)[c][k][i][j];
+			});
+		}
+
+		PutNodes(m_vecComponentVar[c], nLevels);
+	}
+
+	// Store tracer variable data
+	for (int c = 0; c < eqn.GetTracers(); c++) {
+		GatherNodes(m_grid.GetRElements(), [&](int n, int k, int i, int j) {
+			return static_cast<double>(
+				m_grid.GetActivePatch(n)->GetDataTracers(0)[c][k][i][j]);
+		});
+
+		PutNodes(m_vecTracersVar[c], m_grid.GetRElements());
+	}
+
+	// Store vorticity data
+	if (m_fOutputVorticity) {
+		GatherNodes(m_grid.GetRElements(), [&](int n, int k, int i, int j) {
+			return m_grid.GetActivePatch(n)->GetDataVorticity()[k][i][j];
+		});
+
+		PutNodes(m_varVorticity, m_grid.GetRElements());
+	}
+
+	// Store divergence data
+	if (m_fOutputDivergence) {
+		GatherNodes(m_grid.GetRElements(), [&](int n, int k, int i, int j) {
+			return m_grid.GetActivePatch(n)->GetDataDivergence()[k][i][j];
+		});
+
+		PutNodes(m_varDivergence, m_grid.GetRElements());
+	}
+
+	// Store temperature data
+	if (m_fOutputTemperature) {
+		GatherNodes(m_grid.GetRElements(), [&](int n, int k, int i, int j) {
+			return m_grid.GetActivePatch(n)->GetDataTemperature()[k][i][j];
+		});
+
+		PutNodes(m_varTemperature, m_grid.GetRElements());
+	}
+
+	// Store surface pressure data
+	if (m_fOutputSurfacePressure) {
+		GatherNodes(0, [&](int n, int k, int i, int j) {
+			return m_grid.GetActivePatch(n)->GetDataSurfacePressure()[i][j];
+		});
+
+		PutNodes(m_varSurfacePressure, 0);
+	}
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
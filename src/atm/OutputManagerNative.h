@@ -0,0 +1,264 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    OutputManagerNative.h
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _OUTPUTMANAGERNATIVE_H_
+#define _OUTPUTMANAGERNATIVE_H_
+
+#include "OutputManager.h"
+
+#include <string>
+#include <vector>
+
+class Time;
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TEMPEST_NETCDF
+typedef int NcFile;
+typedef int NcVar;
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		OutputManager that writes data on the GLL nodes of the active
+///		patches without interpolation.  Each processor writes its own file
+///		containing the unique nodes of each of its patches, their longitude
+///		and latitude, and the node indices of each finite element.  Nodes
+///		on the edge of a patch are repeated in each patch which contains
+///		them.
+///	</summary>
+class OutputManagerNative : public OutputManager {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	OutputManagerNative(
+		Grid & grid,
+		const Time & timeOutputFrequency,
+		std::string strOutputDir,
+		std::string strOutputPrefix,
+		int nOutputsPerFile
+	);
+
+	///	<summary>
+	///		Destructor.
+	///	</summary>
+	virtual ~OutputManagerNative();
+
+	///	<summary>
+	///		Get the name of the OutputManager.
+	///	</summary>
+	virtual const char * GetName() const {
+		return "Native";
+	}
+
+	///	<summary>
+	///		Modify the flag which indicates whether vorticity should be
+	///		computed and output.
+	///	</summary>
+	void OutputVorticity(
+		bool fOutputVorticity = true
+	) {
+		m_fOutputVorticity = fOutputVorticity;
+	}
+
+	///	<summary>
+	///		Modify the flag which indicates whether divergence should be
+	///		computed and output.
+	///	</summary>
+	void OutputDivergence(
+		bool fOutputDivergence = true
+	) {
+		m_fOutputDivergence = fOutputDivergence;
+	}
+
+	///	<summary>
+	///		Modify the flag which indicates whether temperature should be
+	///		computed and output.
+	///	</summary>
+	void OutputTemperature(
+		bool fOutputTemperature = true
+	) {
+		m_fOutputTemperature = fOutputTemperature;
+	}
+
+	///	<summary>
+	///		Modify the flag which indicates whether surface pressure should be
+	///		computed and output.
+	///	</summary>
+	void OutputSurfacePressure(
+		bool fOutputSurfacePressure = true
+	) {
+		m_fOutputSurfacePressure = fOutputSurfacePressure;
+	}
+
+private:
+	///	<summary>
+	///		Calculate the unique nodes and element connectivity of the
+	///		active patches.
+	///	</summary>
+	bool CalculateNodeMap();
+
+	///	<summary>
+	///		Gather a nodal field of the active patches into the node buffer.
+	///		The field of patch n is obtained from fnField(n, k, i, j).
+	///	</summary>
+	template <typename FieldFunctor>
+	void GatherNodes(
+		int nLevels,
+		FieldFunctor fnField
+	);
+
+	///	<summary>
+	///		Write the node buffer to a variable at the current time.
+	///	</summary>
+	void PutNodes(
+		NcVar * var,
+		int nLevels
+	);
+
+protected:
+	///	<summary>
+	///		Open a new NetCDF file.
+	///	</summary>
+	virtual bool OpenFile(
+		const std::string & strFileName
+	);
+
+	///	<summary>
+	///		Close an existing NetCDF file.
+	///	</summary>
+	virtual void CloseFile();
+
+	///	<summary>
+	///		Perform an output.
+	///	</summary>
+	virtual void Output(
+		const Time & time
+	);
+
+private:
+	///	<summary>
+	///		Grid stamp of the node map.
+	///	</summary>
+	int m_iGridStamp;
+
+	///	<summary>
+	///		Horizontal order of the grid.
+	///	</summary>
+	int m_nHorizontalOrder;
+
+	///	<summary>
+	///		Number of unique nodes on this processor.
+	///	</summary>
+	int m_nNodes;
+
+	///	<summary>
+	///		Number of finite elements on this processor.
+	///	</summary>
+	int m_nElements;
+
+	///	<summary>
+	///		Index of the first node of each active patch.
+	///	</summary>
+	std::vector<int> m_vecPatchNodeBegin;
+
+	///	<summary>
+	///		Alpha index of each unique node along the alpha direction of
+	///		each active patch.
+	///	</summary>
+	std::vector< std::vector<int> > m_vecPatchNodeA;
+
+	///	<summary>
+	///		Beta index of each unique node along the beta direction of
+	///		each active patch.
+	///	</summary>
+	std::vector< std::vector<int> > m_vecPatchNodeB;
+
+	///	<summary>
+	///		Buffer holding one field on all unique nodes (level, node).
+	///	</summary>
+	std::vector<double> m_vecNodeBuffer;
+
+private:
+	///	<summary>
+	///		Active NetCDF output file.
+	///	</summary>
+	NcFile * m_pActiveNcOutput;
+
+	///	<summary>
+	///		Time variable.
+	///	</summary>
+	NcVar * m_varTime;
+
+	///	<summary>
+	///		Vector of component variables.
+	///	</summary>
+	std::vector<NcVar *> m_vecComponentVar;
+
+	///	<summary>
+	///		Vector of tracer variables.
+	///	</summary>
+	std::vector<NcVar *> m_vecTracersVar;
+
+	///	<summary>
+	///		Vorticity variable.
+	///	</summary>
+	NcVar * m_varVorticity;
+
+	///	<summary>
+	///		Divergence variable.
+	///	</summary>
+	NcVar * m_varDivergence;
+
+	///	<summary>
+	///		Temperature variable.
+	///	</summary>
+	NcVar * m_varTemperature;
+
+	///	<summary>
+	///		Surface pressure variable.
+	///	</summary>
+	NcVar * m_varSurfacePressure;
+
+private:
+	///	<summary>
+	///		Output vorticity.
+	///	</summary>
+	bool m_fOutputVorticity;
+
+	///	<summary>
+	///		Output divergence.
+	///	</summary>
+	bool m_fOutputDivergence;
+
+	///	<summary>
+	///		Output temperature.
+	///	</summary>
+	bool m_fOutputTemperature;
+
+	///	<summary>
+	///		Output surface pressure.
+	///	</summary>
+	bool m_fOutputSurfacePressure;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
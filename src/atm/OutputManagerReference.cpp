@@ -25,10 +25,21 @@
 
 #include <mpi.h>
 
+#ifdef TEMPEST_NETCDF
+#include <netcdf.h>
+#endif
+
+#ifdef TEMPEST_NETCDF_PARALLEL
+#include <netcdf_par.h>
+#endif
+
+#include <functional>
 #include <iostream>
 #include <cstdio>
 #include <cmath>
 #include <cfloat>
+#include <cstring>
+#include <stdint.h>
 #include <sys/stat.h>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -56,14 +67,19 @@ OutputManagerReference::OutputManagerReference(
 	m_nXReference(nXReference),
 	m_nYReference(nYReference),
 	m_nZReference(nZReference),
+	m_iRowBegin(0),
+	m_iRowEnd(0),
 	m_pActiveNcOutput(NULL),
+	m_ncidParallel(-1),
 	m_fOutputVorticity(false),
 	m_fOutputDivergence(false),
 	m_fOutputTemperature(false),
 	m_fOutputSurfacePressure(false),
 	m_fOutputRichardson(false),
 	m_fOutputAllVarsOnNodes(fOutputAllVarsOnNodes),
-	m_fRemoveReferenceProfile(fRemoveReferenceProfile)
+	m_fRemoveReferenceProfile(fRemoveReferenceProfile),
+	m_nDeflateLevel(0),
+	m_nQuantizeBits(0)
 {
 	// Get the reference box
 	double dX0;
@@ -110,6 +126,13 @@ OutputManagerReference::OutputManagerReference(
 
 OutputManagerReference::~OutputManagerReference() {
 	CloseFile();
+
+	// Complete file operations which refer to this OutputManager; errors
+	// have already been reported by Model::Go via FlushOutput()
+	try {
+		FlushOutput();
+	} catch(...) {
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -175,6 +198,170 @@ void OutputManagerReference::OutputRichardson(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void OutputManagerReference::SetCompression(
+	int nDeflateLevel,
+	int nQuantizeBits
+) {
+	if ((nDeflateLevel < 0) || (nDeflateLevel > 9)) {
+		_EXCEPTION1("Deflate level (%i) out of range [0,9]", nDeflateLevel);
+	}
+	if ((nQuantizeBits < 0) || (nQuantizeBits > 52)) {
+		_EXCEPTION1("Quantization bits (%i) out of range [0,52]",
+			nQuantizeBits);
+	}
+
+	m_nDeflateLevel = nDeflateLevel;
+	m_nQuantizeBits = nQuantizeBits;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Round each finite value of an array to nBits significant bits of
+///		mantissa, rounding to nearest.  The discarded low-order bits are
+///		zero, so quantized fields compress well under deflate.
+///	</summary>
+static void QuantizeArray(
+	DataArray3D<double> & data,
+	int nBits
+) {
+	if (!data.IsAttached()) {
+		return;
+	}
+	if ((nBits <= 0) || (nBits >= 52)) {
+		return;
+	}
+
+	const uint64_t uHalf = (uint64_t)(1) << (51 - nBits);
+	const uint64_t uMask = ~(((uint64_t)(1) << (52 - nBits)) - 1);
+
+	double * pData = &(data[0][0][0]);
+
+	const size_t sSize =
+		  (size_t)(data.GetRows())
+		* (size_t)(data.GetColumns())
+		* (size_t)(data.GetSubColumns());
+
+	for (size_t s = 0; s < sSize; s++) {
+		if (!std::isfinite(pData[s])) {
+			continue;
+		}
+
+		uint64_t uBits;
+		memcpy(&uBits, &(pData[s]), sizeof(double));
+
+		uint64_t uRound = (uBits + uHalf) & uMask;
+
+		double dRound;
+		memcpy(&dRound, &uRound, sizeof(double));
+
+		// Rounding up the largest finite values would overflow
+		if (!std::isfinite(dRound)) {
+			uRound = uBits & uMask;
+			memcpy(&dRound, &uRound, sizeof(double));
+		}
+
+		pData[s] = dRound;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Copy an array into a snapshot, or if fCopy is false attach the
+///		snapshot array to the data of the original.  Arrays which are not
+///		allocated are skipped.
+///	</summary>
+static void SnapshotArray(
+	DataArray3D<double> & data,
+	DataArray3D<double> & dataSnapshot,
+	bool fCopy
+) {
+	if (!data.IsAttached()) {
+		return;
+	}
+	if (fCopy) {
+		dataSnapshot = data;
+
+	} else {
+		dataSnapshot.SetSize(
+			data.GetRows(),
+			data.GetColumns(),
+			data.GetSubColumns());
+		dataSnapshot.AttachToData(&(data[0][0][0]));
+	}
+}
+
+#ifdef TEMPEST_NETCDF_PARALLEL
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Check the status returned by a parallel NetCDF call.
+///	</summary>
+static void NcParallelCheck(
+	int iStatus,
+	const char * szAction
+) {
+	if (iStatus != NC_NOERR) {
+		_EXCEPTION2("%s: %s", szAction, nc_strerror(iStatus));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Collectively write rows iRowBegin to iRowEnd of a variable on the
+///		reference grid.  Variables without a time dimension have iTime
+///		equal to -1 and variables without a level dimension have nLevels
+///		equal to 0.
+///	</summary>
+static void PutParallelRows(
+	int ncid,
+	const std::string & strVarName,
+	int iTime,
+	int nLevels,
+	int iRowBegin,
+	int iRowEnd,
+	int nXReference,
+	const double * pData
+) {
+	int varid;
+	NcParallelCheck(
+		nc_inq_varid(ncid, strVarName.c_str(), &varid),
+		strVarName.c_str());
+
+	size_t sStart[4];
+	size_t sCount[4];
+	int nDims = 0;
+
+	if (iTime != -1) {
+		sStart[nDims] = iTime;
+		sCount[nDims] = 1;
+		nDims++;
+	}
+	if (nLevels != 0) {
+		sStart[nDims] = 0;
+		sCount[nDims] = nLevels;
+		nDims++;
+	}
+
+	// Processors without rows take part in the collective write
+	sStart[nDims] = (iRowEnd > iRowBegin)?(iRowBegin):(0);
+	sCount[nDims] = iRowEnd - iRowBegin;
+	nDims++;
+
+	sStart[nDims] = 0;
+	sCount[nDims] = nXReference;
+	nDims++;
+
+	NcParallelCheck(
+		nc_put_vara_double(ncid, varid, sStart, sCount, pData),
+		strVarName.c_str());
+}
+
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
 bool OutputManagerReference::CalculatePatchCoordinates() {
 
 	if (m_grid.GetGridStamp() == m_iGridStamp) {
@@ -216,78 +403,111 @@ bool OutputManagerReference::CalculatePatchCoordinates() {
 		m_dBeta,
 		m_iPatch);
 
-	// Allocate data arrays
+	// Build the plan which sends reference points to their writer
+	BuildOutputPlan();
+
+	// Build the operator which interpolates to the reference points on
+	// the active patches of this processor, in the order they are sent
+	const int nSendPoints = static_cast<int>(m_vecSendPoint.size());
+
+	if (nSendPoints == 0) {
+		m_opRemap.Initialize(0, 0);
+
+	} else {
+		DataArray1D<double> dAlphaLocal(nSendPoints);
+		DataArray1D<double> dBetaLocal(nSendPoints);
+		DataArray1D<int> iPatchLocal(nSendPoints);
+
+		for (int s = 0; s < nSendPoints; s++) {
+			const int ix = m_vecSendPoint[s];
+			dAlphaLocal[s] = m_dAlpha[ix];
+			dBetaLocal[s] = m_dBeta[ix];
+			iPatchLocal[s] = m_iPatch[ix];
+		}
+
+		m_grid.BuildRemapOperator(
+			dAlphaLocal,
+			dBetaLocal,
+			iPatchLocal,
+			m_opRemap);
+	}
+
+	// Allocate data arrays on the rows written by this processor; arrays
+	// hold at least one point so that they can be allocated on processors
+	// that write no rows
+	int nBandPoints = (m_iRowEnd - m_iRowBegin) * m_nXReference;
+	if (nBandPoints == 0) {
+		nBandPoints = 1;
+	}
+
 	m_dataTopography.Allocate(
-		1, 1, m_nXReference * m_nYReference);
+		1, 1, nBandPoints);
 
 	m_dataStateNode.Allocate(
 		m_grid.GetModel().GetEquationSet().GetComponents(),
 		m_dREtaCoord.GetRows(),
-		m_nXReference * m_nYReference);
+		nBandPoints);
 
 	if (!m_fOutputAllVarsOnNodes) {
 		m_dataStateREdge.Allocate(
 			m_grid.GetModel().GetEquationSet().GetComponents(),
 			m_grid.GetRElements() + 1,
-			m_nXReference * m_nYReference);
+			nBandPoints);
 	}
 
 	if (eqn.GetTracers() != 0) {
 		m_dataTracers.Allocate(
 			m_grid.GetModel().GetEquationSet().GetTracers(),
 			m_dREtaCoord.GetRows(),
-			m_nXReference * m_nYReference);
+			nBandPoints);
 	}
 
 	if (metaUserData.GetUserData2DItemCount() != 0) {
 		m_dataUserData2D.Allocate(
 			metaUserData.GetUserData2DItemCount(),
 			1,
-			m_nXReference * m_nYReference);
+			nBandPoints);
 	}
 
 	if (m_fOutputVorticity) {
 		m_dataVorticity.Allocate(
 			1,
 			m_dREtaCoord.GetRows(),
-			m_nXReference * m_nYReference);
+			nBandPoints);
 	}
 
 	if (m_fOutputDivergence) {
 		m_dataDivergence.Allocate(
 			1,
 			m_dREtaCoord.GetRows(),
-			m_nXReference * m_nYReference);
+			nBandPoints);
 	}
 
 	if (m_fOutputTemperature) {
 		m_dataTemperature.Allocate(
 			1,
 			m_dREtaCoord.GetRows(),
-			m_nXReference * m_nYReference);
+			nBandPoints);
 	}
 
 	if (m_fOutputSurfacePressure) {
 		m_dataSurfacePressure.Allocate(
 			1,
 			1,
-			m_nXReference * m_nYReference);
+			nBandPoints);
 	}
 
 	if (m_fOutputRichardson) {
 		m_dataRichardson.Allocate(
 			1,
 			m_dREtaCoord.GetRows(),
-			m_nXReference * m_nYReference);
+			nBandPoints);
 	}
 
-	// Reduce/Interpolate topography array
-	m_grid.ReduceInterpolate(
+	// Interpolate topography array
+	DistributeInterpolate(
 		DataType_Topography,
 		m_dREtaSurface,
-		m_dAlpha,
-		m_dBeta,
-		m_iPatch,
 		m_dataTopography);
 
 	// Update grid stamp
@@ -299,208 +519,496 @@ bool OutputManagerReference::CalculatePatchCoordinates() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
-bool OutputManagerReference::OpenFile(
-	const std::string & strFileName
-) {
-#ifdef TEMPEST_NETCDF
-	// Determine processor rank; only proceed if root node
+void OutputManagerReference::BuildOutputPlan() {
+
+	// Number of processors and processor rank
+	int nSize;
+	MPI_Comm_size(MPI_COMM_WORLD, &nSize);
+
 	int nRank;
 	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
 
-	// The active model
-	const Model & model = m_grid.GetModel();
+	// Assign contiguous bands of rows to processors; without parallel
+	// NetCDF all rows are written by the root processor
+	std::vector<int> vecRowWriter(m_nYReference, 0);
+
+	for (int p = 0; p < nSize; p++) {
+#ifdef TEMPEST_NETCDF_PARALLEL
+		int iRowBegin = (m_nYReference * p) / nSize;
+		int iRowEnd = (m_nYReference * (p+1)) / nSize;
+#else
+		int iRowBegin = 0;
+		int iRowEnd = (p == 0)?(m_nYReference):(0);
+#endif
 
-	// Open NetCDF file on root process
-	if (nRank == 0) {
+		for (int j = iRowBegin; j < iRowEnd; j++) {
+			vecRowWriter[j] = p;
+		}
 
-		// Check for existing NetCDF file
-		if (m_pActiveNcOutput != NULL) {
-			_EXCEPTIONT("NetCDF file already open");
+		if (p == nRank) {
+			m_iRowBegin = iRowBegin;
+			m_iRowEnd = iRowEnd;
 		}
+	}
 
-		// Append .nc extension to file
-		std::string strNcFileName = strFileName + ".nc";
+	// Flag the patches which are active on this processor
+	std::vector<bool> vecActivePatch(m_grid.GetPatchCount(), false);
+	for (int n = 0; n < m_grid.GetActivePatchCount(); n++) {
+		vecActivePatch[m_grid.GetActivePatch(n)->GetPatchIndex()] = true;
+	}
 
-		// Open new NetCDF file
-		m_pActiveNcOutput = new NcFile(strNcFileName.c_str(), NcFile::Replace);
-		if (m_pActiveNcOutput == NULL) {
-			_EXCEPTION1("Error opening NetCDF file \"%s\"",
-				strNcFileName.c_str());
-		}
-		if (!m_pActiveNcOutput->is_valid()) {
-			_EXCEPTION1("Error opening NetCDF file \"%s\"",
-				strNcFileName.c_str());
-		}
+	// Sort reference points on active patches by their writer
+	std::vector< std::vector<int> > vecPointsByWriter(nSize);
 
-		// Create nodal time dimension
-		NcDim * dimTime = m_pActiveNcOutput->add_dim("time");
-		if (dimTime == NULL) {
-			_EXCEPTIONT("Error creating \"time\" dimension");
+	const int nPoints = m_iPatch.GetRows();
+	for (int ix = 0; ix < nPoints; ix++) {
+		int iPatch = m_iPatch[ix];
+		if ((iPatch < 0) || (!vecActivePatch[iPatch])) {
+			continue;
 		}
+		vecPointsByWriter[vecRowWriter[ix / m_nXReference]].push_back(ix);
+	}
 
-		m_varTime = m_pActiveNcOutput->add_var("time", ncDouble, dimTime);
-		if (m_varTime == NULL) {
-			_EXCEPTIONT("Error creating \"time\" variable");
-		}
+	m_vecSendPoint.clear();
+	m_vecSendCount.resize(nSize);
+	m_vecSendDispl.resize(nSize);
+
+	for (int p = 0; p < nSize; p++) {
+		m_vecSendCount[p] = static_cast<int>(vecPointsByWriter[p].size());
+		m_vecSendDispl[p] = static_cast<int>(m_vecSendPoint.size());
+		m_vecSendPoint.insert(
+			m_vecSendPoint.end(),
+			vecPointsByWriter[p].begin(),
+			vecPointsByWriter[p].end());
+	}
 
-		std::string strUnits =
-			"days since " + model.GetStartTime().ToDateString();
+	// Exchange the number of points sent to each processor
+	m_vecRecvCount.resize(nSize);
+	m_vecRecvDispl.resize(nSize);
 
-		std::string strCalendarName = model.GetStartTime().GetCalendarName();
+	MPI_Alltoall(
+		&(m_vecSendCount[0]), 1, MPI_INT,
+		&(m_vecRecvCount[0]), 1, MPI_INT,
+		MPI_COMM_WORLD);
 
-		m_varTime->add_att("long_name", "time");
-		m_varTime->add_att("units", strUnits.c_str());
-		m_varTime->add_att("calendar", strCalendarName.c_str());
-		m_varTime->add_att("bounds", "time_bnds");
+	int nRecvPoints = 0;
+	for (int p = 0; p < nSize; p++) {
+		m_vecRecvDispl[p] = nRecvPoints;
+		nRecvPoints += m_vecRecvCount[p];
+	}
 
-		// Create levels dimension
-		NcDim * dimLev =
-			m_pActiveNcOutput->add_dim("lev", m_dREtaCoord.GetRows());
+	// Every point in the rows of this processor must be received once
+	if (nRecvPoints != (m_iRowEnd - m_iRowBegin) * m_nXReference) {
+		_EXCEPTION2("Reference grid rows not covered by active patches "
+			"(%i points received, %i expected)",
+			nRecvPoints, (m_iRowEnd - m_iRowBegin) * m_nXReference);
+	}
 
-		// Create interfaces dimension
-		NcDim * dimILev =
-			m_pActiveNcOutput->add_dim("ilev", m_grid.GetRElements()+1);
+	// Exchange the index of each point
+	m_vecRecvPoint.resize(nRecvPoints);
+
+	MPI_Alltoallv(
+		(m_vecSendPoint.size() == 0)?(NULL):(&(m_vecSendPoint[0])),
+		&(m_vecSendCount[0]),
+		&(m_vecSendDispl[0]),
+		MPI_INT,
+		(nRecvPoints == 0)?(NULL):(&(m_vecRecvPoint[0])),
+		&(m_vecRecvCount[0]),
+		&(m_vecRecvDispl[0]),
+		MPI_INT,
+		MPI_COMM_WORLD);
+
+	for (int i = 0; i < nRecvPoints; i++) {
+		m_vecRecvPoint[i] -= m_iRowBegin * m_nXReference;
+	}
+}
 
-		// Create latitude dimension
-		NcDim * dimLat =
-			m_pActiveNcOutput->add_dim("lat", m_nYReference);
+///////////////////////////////////////////////////////////////////////////////
 
-		// Create longitude dimension
-		NcDim * dimLon =
-			m_pActiveNcOutput->add_dim("lon", m_nXReference);
+void OutputManagerReference::DistributeInterpolate(
+	DataType eDataType,
+	const DataArray1D<double> & dREta,
+	DataArray3D<double> & dInterpData,
+	DataLocation eOnlyVariablesAt,
+	bool fIncludeReferenceState
+) {
+	const int nVariables = dInterpData.GetRows();
+	const int nLevels = dInterpData.GetColumns();
+	const int nValues = nVariables * nLevels;
+
+	const int nSendPoints = static_cast<int>(m_vecSendPoint.size());
+	const int nRecvPoints = static_cast<int>(m_vecRecvPoint.size());
+
+	// Interpolate to the reference points on active patches
+	if (nSendPoints != 0) {
+		if ((m_dataInterpLocal.GetRows() != nVariables) ||
+			(m_dataInterpLocal.GetColumns() != nLevels) ||
+			(m_dataInterpLocal.GetSubColumns() != nSendPoints)
+		) {
+			m_dataInterpLocal.Allocate(nVariables, nLevels, nSendPoints);
+		}
 
-		// Output physical constants
-		const PhysicalConstants & phys = model.GetPhysicalConstants();
+		m_grid.Interpolate(
+			eDataType,
+			dREta,
+			m_opRemap,
+			m_dataInterpLocal,
+			eOnlyVariablesAt,
+			fIncludeReferenceState);
+	}
 
-		m_pActiveNcOutput->add_att("earth_radius", phys.GetEarthRadius());
-		m_pActiveNcOutput->add_att("g", phys.GetG());
-		m_pActiveNcOutput->add_att("omega", phys.GetOmega());
-		m_pActiveNcOutput->add_att("alpha", phys.GetAlpha());
-		m_pActiveNcOutput->add_att("Rd", phys.GetR());
-		m_pActiveNcOutput->add_att("Cp", phys.GetCp());
-		m_pActiveNcOutput->add_att("T0", phys.GetT0());
-		m_pActiveNcOutput->add_att("P0", phys.GetP0());
-		m_pActiveNcOutput->add_att("rho_water", phys.GetRhoWater());
-		m_pActiveNcOutput->add_att("Rvap", phys.GetRvap());
-		m_pActiveNcOutput->add_att("Mvap", phys.GetMvap());
-		m_pActiveNcOutput->add_att("Lvap", phys.GetLvap());
+	// Pack values point by point in the order of the send plan
+	const int nSize = static_cast<int>(m_vecSendCount.size());
 
-		// Output grid parameters
-		m_pActiveNcOutput->add_att("Ztop", m_grid.GetZtop());
+	std::vector<int> vecSendCount(nSize);
+	std::vector<int> vecSendDispl(nSize);
+	std::vector<int> vecRecvCount(nSize);
+	std::vector<int> vecRecvDispl(nSize);
 
-		// Output equation set
-		const EquationSet & eqn = model.GetEquationSet();
+	for (int p = 0; p < nSize; p++) {
+		vecSendCount[p] = m_vecSendCount[p] * nValues;
+		vecSendDispl[p] = m_vecSendDispl[p] * nValues;
+		vecRecvCount[p] = m_vecRecvCount[p] * nValues;
+		vecRecvDispl[p] = m_vecRecvDispl[p] * nValues;
+	}
 
-		m_pActiveNcOutput->add_att("equation_set", eqn.GetName().c_str());
+	m_vecSendBuffer.resize(nSendPoints * nValues);
+	m_vecRecvBuffer.resize(nRecvPoints * nValues);
 
-		// Create variables
-		for (int c = 0; c < eqn.GetComponents(); c++) {
-			if ((m_fOutputAllVarsOnNodes) ||
-				(m_grid.GetVarLocation(c) == DataLocation_Node)
-			) {
-				m_vecComponentVar.push_back(
-					m_pActiveNcOutput->add_var(
-						eqn.GetComponentShortName(c).c_str(),
-						ncDouble, dimTime, dimLev, dimLat, dimLon));
-			} else {
-				m_vecComponentVar.push_back(
-					m_pActiveNcOutput->add_var(
-						eqn.GetComponentShortName(c).c_str(),
-						ncDouble, dimTime, dimILev, dimLat, dimLon));
-			}
+	for (int s = 0; s < nSendPoints; s++) {
+		double * pSend = &(m_vecSendBuffer[s * nValues]);
+		for (int c = 0; c < nVariables; c++) {
+		for (int k = 0; k < nLevels; k++) {
+			pSend[c * nLevels + k] = m_dataInterpLocal[c][k][s];
 		}
-
-		for (int c = 0; c < eqn.GetTracers(); c++) {
-			m_vecTracersVar.push_back(
-				m_pActiveNcOutput->add_var(
-					eqn.GetTracerShortName(c).c_str(),
-					ncDouble, dimTime, dimLev, dimLat, dimLon));
 		}
+	}
 
-		// Vorticity variable
-		if (m_fOutputVorticity) {
-			m_varVorticity =
-				m_pActiveNcOutput->add_var(
-					"ZETA", ncDouble, dimTime, dimLev, dimLat, dimLon);
+	// Send each point to its writer
+	MPI_Alltoallv(
+		(m_vecSendBuffer.size() == 0)?(NULL):(&(m_vecSendBuffer[0])),
+		&(vecSendCount[0]),
+		&(vecSendDispl[0]),
+		MPI_DOUBLE,
+		(m_vecRecvBuffer.size() == 0)?(NULL):(&(m_vecRecvBuffer[0])),
+		&(vecRecvCount[0]),
+		&(vecRecvDispl[0]),
+		MPI_DOUBLE,
+		MPI_COMM_WORLD);
+
+	// Unpack into the rows of this processor
+	for (int r = 0; r < nRecvPoints; r++) {
+		const double * pRecv = &(m_vecRecvBuffer[r * nValues]);
+		const int ix = m_vecRecvPoint[r];
+		for (int c = 0; c < nVariables; c++) {
+		for (int k = 0; k < nLevels; k++) {
+			dInterpData[c][k][ix] = pRecv[c * nLevels + k];
 		}
-
-		// Divergence variable
-		if (m_fOutputDivergence) {
-			m_varDivergence =
-				m_pActiveNcOutput->add_var(
-					"DELTA", ncDouble, dimTime, dimLev, dimLat, dimLon);
 		}
+	}
+}
 
-		// Temperature variable
-		if (m_fOutputTemperature) {
-			m_varTemperature =
-				m_pActiveNcOutput->add_var(
-					"T", ncDouble, dimTime, dimLev, dimLat, dimLon);
-		}
+///////////////
 
-		// Surface pressure variable
-		if (m_fOutputSurfacePressure) {
-			m_varSurfacePressure =
-				m_pActiveNcOutput->add_var(
-					"PS", ncDouble, dimTime, dimLat, dimLon);
-		}
+void OutputManagerReference::DefineNcFile(
+	const std::string & strNcFileName
+) {
+#ifdef TEMPEST_NETCDF
+	// The active model
+	const Model & model = m_grid.GetModel();
 
-		// Richardson number variable
-		if (m_fOutputRichardson) {
-			m_varRichardson =
-				m_pActiveNcOutput->add_var(
-					"Ri", ncDouble, dimTime, dimLev, dimLat, dimLon);
-		}
+	// Check for existing NetCDF file
+	if ((m_pActiveNcOutput != NULL) || (m_ncidParallel != -1)) {
+		_EXCEPTIONT("NetCDF file already open");
+	}
+
+	// Open new NetCDF file; parallel access and deflate require NetCDF-4
+#ifdef TEMPEST_NETCDF_PARALLEL
+	bool fNetcdf4 = true;
+#else
+	bool fNetcdf4 = (m_nDeflateLevel != 0);
+#endif
+	if (fNetcdf4) {
+		m_pActiveNcOutput =
+			new NcFile(
+				strNcFileName.c_str(),
+				NcFile::Replace,
+				NULL,
+				0,
+				NcFile::Netcdf4);
+	} else {
+		m_pActiveNcOutput =
+			new NcFile(strNcFileName.c_str(), NcFile::Replace);
+	}
+	if (m_pActiveNcOutput == NULL) {
+		_EXCEPTION1("Error opening NetCDF file \"%s\"",
+			strNcFileName.c_str());
+	}
+	if (!m_pActiveNcOutput->is_valid()) {
+		_EXCEPTION1("Error opening NetCDF file \"%s\"",
+			strNcFileName.c_str());
+	}
 
-		// User data variables
-		const UserDataMeta & metaUserData = model.GetUserDataMeta();
+	// Create nodal time dimension
+	NcDim * dimTime = m_pActiveNcOutput->add_dim("time");
+	if (dimTime == NULL) {
+		_EXCEPTIONT("Error creating \"time\" dimension");
+	}
 
-		m_vecUserData2DVar.resize(metaUserData.GetUserData2DItemCount());
-		for (int i = 0; i < metaUserData.GetUserData2DItemCount(); i++) {
-			m_vecUserData2DVar[i] =
+	m_varTime = m_pActiveNcOutput->add_var("time", ncDouble, dimTime);
+	if (m_varTime == NULL) {
+		_EXCEPTIONT("Error creating \"time\" variable");
+	}
+
+	std::string strUnits =
+		"days since " + model.GetStartTime().ToDateString();
+
+	std::string strCalendarName = model.GetStartTime().GetCalendarName();
+
+	m_varTime->add_att("long_name", "time");
+	m_varTime->add_att("units", strUnits.c_str());
+	m_varTime->add_att("calendar", strCalendarName.c_str());
+	m_varTime->add_att("bounds", "time_bnds");
+
+	// Create levels dimension
+	NcDim * dimLev =
+		m_pActiveNcOutput->add_dim("lev", m_dREtaCoord.GetRows());
+
+	// Create interfaces dimension
+	NcDim * dimILev =
+		m_pActiveNcOutput->add_dim("ilev", m_grid.GetRElements()+1);
+
+	// Create latitude dimension
+	NcDim * dimLat =
+		m_pActiveNcOutput->add_dim("lat", m_nYReference);
+
+	// Create longitude dimension
+	NcDim * dimLon =
+		m_pActiveNcOutput->add_dim("lon", m_nXReference);
+
+	// Output physical constants
+	const PhysicalConstants & phys = model.GetPhysicalConstants();
+
+	m_pActiveNcOutput->add_att("earth_radius", phys.GetEarthRadius());
+	m_pActiveNcOutput->add_att("g", phys.GetG());
+	m_pActiveNcOutput->add_att("omega", phys.GetOmega());
+	m_pActiveNcOutput->add_att("alpha", phys.GetAlpha());
+	m_pActiveNcOutput->add_att("Rd", phys.GetR());
+	m_pActiveNcOutput->add_att("Cp", phys.GetCp());
+	m_pActiveNcOutput->add_att("T0", phys.GetT0());
+	m_pActiveNcOutput->add_att("P0", phys.GetP0());
+	m_pActiveNcOutput->add_att("rho_water", phys.GetRhoWater());
+	m_pActiveNcOutput->add_att("Rvap", phys.GetRvap());
+	m_pActiveNcOutput->add_att("Mvap", phys.GetMvap());
+	m_pActiveNcOutput->add_att("Lvap", phys.GetLvap());
+
+	// Output grid parameters
+	m_pActiveNcOutput->add_att("Ztop", m_grid.GetZtop());
+
+	// Output equation set
+	const EquationSet & eqn = model.GetEquationSet();
+
+	m_pActiveNcOutput->add_att("equation_set", eqn.GetName().c_str());
+
+	// Create variables
+	for (int c = 0; c < eqn.GetComponents(); c++) {
+		if ((m_fOutputAllVarsOnNodes) ||
+			(m_grid.GetVarLocation(c) == DataLocation_Node)
+		) {
+			m_vecComponentVar.push_back(
+				m_pActiveNcOutput->add_var(
+					eqn.GetComponentShortName(c).c_str(),
+					ncDouble, dimTime, dimLev, dimLat, dimLon));
+		} else {
+			m_vecComponentVar.push_back(
 				m_pActiveNcOutput->add_var(
-					metaUserData.GetUserData2DItemName(i).c_str(),
-					ncDouble, dimTime, dimLat, dimLon);
+					eqn.GetComponentShortName(c).c_str(),
+					ncDouble, dimTime, dimILev, dimLat, dimLon));
 		}
+	}
+
+	for (int c = 0; c < eqn.GetTracers(); c++) {
+		m_vecTracersVar.push_back(
+			m_pActiveNcOutput->add_var(
+				eqn.GetTracerShortName(c).c_str(),
+				ncDouble, dimTime, dimLev, dimLat, dimLon));
+	}
 
-		// Output longitudes and latitudes
-		NcVar * varLon = m_pActiveNcOutput->add_var("lon", ncDouble, dimLon);
-		NcVar * varLat = m_pActiveNcOutput->add_var("lat", ncDouble, dimLat);
+	// Vorticity variable
+	if (m_fOutputVorticity) {
+		m_varVorticity =
+			m_pActiveNcOutput->add_var(
+				"ZETA", ncDouble, dimTime, dimLev, dimLat, dimLon);
+	}
 
-		varLon->put(m_dXCoord, m_dXCoord.GetRows());
-		varLat->put(m_dYCoord, m_dYCoord.GetRows());
+	// Divergence variable
+	if (m_fOutputDivergence) {
+		m_varDivergence =
+			m_pActiveNcOutput->add_var(
+				"DELTA", ncDouble, dimTime, dimLev, dimLat, dimLon);
+	}
 
-		varLon->add_att("long_name", "longitude");
-		varLon->add_att("units", "degrees_east");
+	// Temperature variable
+	if (m_fOutputTemperature) {
+		m_varTemperature =
+			m_pActiveNcOutput->add_var(
+				"T", ncDouble, dimTime, dimLev, dimLat, dimLon);
+	}
 
-		varLat->add_att("long_name", "latitude");
-		varLat->add_att("units", "degrees_north");
+	// Surface pressure variable
+	if (m_fOutputSurfacePressure) {
+		m_varSurfacePressure =
+			m_pActiveNcOutput->add_var(
+				"PS", ncDouble, dimTime, dimLat, dimLon);
+	}
 
-		// Output levels
-		NcVar * varLev =
-			m_pActiveNcOutput->add_var("lev", ncDouble, dimLev);
+	// Richardson number variable
+	if (m_fOutputRichardson) {
+		m_varRichardson =
+			m_pActiveNcOutput->add_var(
+				"Ri", ncDouble, dimTime, dimLev, dimLat, dimLon);
+	}
 
-		varLev->put(
-			m_dREtaCoord,
-			m_dREtaCoord.GetRows());
+	// User data variables
+	const UserDataMeta & metaUserData = model.GetUserDataMeta();
 
-		varLev->add_att("long_name", "level");
-		varLev->add_att("units", "level");
+	m_vecUserData2DVar.resize(metaUserData.GetUserData2DItemCount());
+	for (int i = 0; i < metaUserData.GetUserData2DItemCount(); i++) {
+		m_vecUserData2DVar[i] =
+			m_pActiveNcOutput->add_var(
+				metaUserData.GetUserData2DItemName(i).c_str(),
+				ncDouble, dimTime, dimLat, dimLon);
+	}
 
-		// Output interface levels
-		NcVar * varILev =
-			m_pActiveNcOutput->add_var("ilev", ncDouble, dimILev);
+	// Compression of field variables (must be defined before any data
+	// is written to a NetCDF-4 file)
+	for (int c = 0; c < m_vecComponentVar.size(); c++) {
+		DefineNcVarCompression(m_vecComponentVar[c]);
+	}
+	for (int c = 0; c < m_vecTracersVar.size(); c++) {
+		DefineNcVarCompression(m_vecTracersVar[c]);
+	}
+	for (int c = 0; c < m_vecUserData2DVar.size(); c++) {
+		DefineNcVarCompression(m_vecUserData2DVar[c]);
+	}
+	if (m_fOutputVorticity) {
+		DefineNcVarCompression(m_varVorticity);
+	}
+	if (m_fOutputDivergence) {
+		DefineNcVarCompression(m_varDivergence);
+	}
+	if (m_fOutputTemperature) {
+		DefineNcVarCompression(m_varTemperature);
+	}
+	if (m_fOutputSurfacePressure) {
+		DefineNcVarCompression(m_varSurfacePressure);
+	}
+	if (m_fOutputRichardson) {
+		DefineNcVarCompression(m_varRichardson);
+	}
+
+	// Output longitudes and latitudes
+	NcVar * varLon = m_pActiveNcOutput->add_var("lon", ncDouble, dimLon);
+	NcVar * varLat = m_pActiveNcOutput->add_var("lat", ncDouble, dimLat);
+
+	varLon->put(m_dXCoord, m_dXCoord.GetRows());
+	varLat->put(m_dYCoord, m_dYCoord.GetRows());
+
+	varLon->add_att("long_name", "longitude");
+	varLon->add_att("units", "degrees_east");
+
+	varLat->add_att("long_name", "latitude");
+	varLat->add_att("units", "degrees_north");
+
+	// Output levels
+	NcVar * varLev =
+		m_pActiveNcOutput->add_var("lev", ncDouble, dimLev);
+
+	varLev->put(
+		m_dREtaCoord,
+		m_dREtaCoord.GetRows());
+
+	varLev->add_att("long_name", "level");
+	varLev->add_att("units", "level");
+
+	// Output interface levels
+	NcVar * varILev =
+		m_pActiveNcOutput->add_var("ilev", ncDouble, dimILev);
+
+	varILev->put(
+		m_grid.GetREtaStretchInterfaces(),
+		m_grid.GetREtaStretchInterfaces().GetRows());
+
+	varILev->add_att("long_name", "interface level");
+	varILev->add_att("units", "level");
+
+	// Topography variable
+	m_varTopography =
+		m_pActiveNcOutput->add_var("Zs", ncDouble, dimLat, dimLon);
+
+#ifdef TEMPEST_NETCDF_PARALLEL
+	// Close the file so that it can be reopened on all processors
+	delete(m_pActiveNcOutput);
+	m_pActiveNcOutput = NULL;
+
+	m_vecComponentVar.clear();
+	m_vecTracersVar.clear();
+	m_vecUserData2DVar.clear();
+#endif
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerReference::DefineNcVarCompression(
+	NcVar * var
+) {
+#ifdef TEMPEST_NETCDF
+	if (m_nDeflateLevel != 0) {
+		int iStatus =
+			nc_def_var_deflate(
+				m_pActiveNcOutput->id(),
+				var->id(),
+				1,
+				1,
+				m_nDeflateLevel);
+
+		if (iStatus != NC_NOERR) {
+			_EXCEPTION2("Error defining deflate for \"%s\": %s",
+				var->name(), nc_strerror(iStatus));
+		}
+	}
+
+	if (m_nQuantizeBits != 0) {
+		var->add_att(
+			"quantize_bitround_number_of_significant_bits",
+			m_nQuantizeBits);
+	}
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool OutputManagerReference::OpenFile(
+	const std::string & strFileName
+) {
+#ifdef TEMPEST_NETCDF
+	// Determine processor rank; only proceed if root node
+	int nRank;
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
 
-		varILev->put(
-			m_grid.GetREtaStretchInterfaces(),
-			m_grid.GetREtaStretchInterfaces().GetRows());
+	// Open NetCDF file on root process
+	if (nRank == 0) {
 
-		varILev->add_att("long_name", "interface level");
-		varILev->add_att("units", "level");
+		// Append .nc extension to file
+		std::string strNcFileName = strFileName + ".nc";
 
-		// Topography variable
-		m_varTopography =
-			m_pActiveNcOutput->add_var("Zs", ncDouble, dimLat, dimLon);
+		// Create the file and define its variables
+		DeferFileOperation(
+			std::bind(
+				&OutputManagerReference::DefineNcFile,
+				this,
+				strNcFileName));
 
 		// Fresh output file
 		m_fFreshOutputFile = true;
@@ -508,6 +1016,33 @@ bool OutputManagerReference::OpenFile(
 
 	// Wait for all processes to complete
 	MPI_Barrier(MPI_COMM_WORLD);
+
+#ifdef TEMPEST_NETCDF_PARALLEL
+	// Open the file for collective access on all processors
+	std::string strNcFileName = strFileName + ".nc";
+
+	NcParallelCheck(
+		nc_open_par(
+			strNcFileName.c_str(),
+			NC_WRITE | NC_MPIIO,
+			MPI_COMM_WORLD,
+			MPI_INFO_NULL,
+			&m_ncidParallel),
+		strNcFileName.c_str());
+
+	int nVars;
+	NcParallelCheck(
+		nc_inq_nvars(m_ncidParallel, &nVars),
+		strNcFileName.c_str());
+
+	for (int v = 0; v < nVars; v++) {
+		NcParallelCheck(
+			nc_var_par_access(m_ncidParallel, v, NC_COLLECTIVE),
+			strNcFileName.c_str());
+	}
+
+	m_fFreshOutputFile = true;
+#endif
 #endif
 
 	return true;
@@ -516,6 +1051,23 @@ bool OutputManagerReference::OpenFile(
 ///////////////////////////////////////////////////////////////////////////////
 
 void OutputManagerReference::CloseFile() {
+#ifdef TEMPEST_NETCDF_PARALLEL
+	if (m_ncidParallel != -1) {
+		NcParallelCheck(
+			nc_close(m_ncidParallel),
+			"Error closing NetCDF file");
+
+		m_ncidParallel = -1;
+	}
+#endif
+
+	DeferFileOperation(
+		std::bind(&OutputManagerReference::CloseNcFile, this));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerReference::CloseNcFile() {
 	if (m_pActiveNcOutput != NULL) {
 		delete(m_pActiveNcOutput);
 		m_pActiveNcOutput = NULL;
@@ -527,6 +1079,309 @@ void OutputManagerReference::CloseFile() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void OutputManagerReference::WriteSnapshot(
+	std::shared_ptr<OutputSnapshot> pSnapshot
+) {
+#ifdef TEMPEST_NETCDF
+	// Quantize fields; for asynchronous output this is performed by the
+	// file operation thread while the model continues to step
+	QuantizeSnapshot(*pSnapshot);
+
+	// Equation set
+	const EquationSet & eqn = m_grid.GetModel().GetEquationSet();
+
+	// User data metadata
+	const UserDataMeta & metaUserData = m_grid.GetModel().GetUserDataMeta();
+
+	// Initial outputs to a new Output file
+	if (pSnapshot->fFreshOutputFile) {
+
+		// Output topography
+		m_varTopography->put(
+			&(pSnapshot->dataTopography[0][0][0]),
+			m_dYCoord.GetRows(),
+			m_dXCoord.GetRows());
+	}
+
+	// Add new time
+	m_varTime->set_cur(pSnapshot->ixOutputTime);
+	m_varTime->put(&(pSnapshot->dTimeDays), 1);
+
+	// Store state variable data
+	for (int c = 0; c < eqn.GetComponents(); c++) {
+		if ((m_fOutputAllVarsOnNodes) ||
+			(m_grid.GetVarLocation(c) == DataLocation_Node)
+		) {
+			m_vecComponentVar[c]->set_cur(pSnapshot->ixOutputTime, 0, 0, 0);
+			m_vecComponentVar[c]->put(
+				&(pSnapshot->dataStateNode[c][0][0]),
+				1,
+				pSnapshot->dataStateNode.GetColumns(),
+				m_dYCoord.GetRows(),
+				m_dXCoord.GetRows());
+
+		} else {
+			m_vecComponentVar[c]->set_cur(pSnapshot->ixOutputTime, 0, 0, 0);
+			m_vecComponentVar[c]->put(
+				&(pSnapshot->dataStateREdge[c][0][0]),
+				1,
+				pSnapshot->dataStateREdge.GetColumns(),
+				m_dYCoord.GetRows(),
+				m_dXCoord.GetRows());
+		}
+	}
+
+	// Store tracer variable data
+	if (eqn.GetTracers() != 0) {
+		for (int c = 0; c < eqn.GetTracers(); c++) {
+			m_vecTracersVar[c]->set_cur(pSnapshot->ixOutputTime, 0, 0, 0);
+			m_vecTracersVar[c]->put(
+				&(pSnapshot->dataTracers[c][0][0]),
+				1,
+				pSnapshot->dataTracers.GetColumns(),
+				m_dYCoord.GetRows(),
+				m_dXCoord.GetRows());
+		}
+	}
+
+	// Store user data
+	if (metaUserData.GetUserData2DItemCount() != 0) {
+		for (int c = 0; c < metaUserData.GetUserData2DItemCount(); c++) {
+			m_vecUserData2DVar[c]->set_cur(pSnapshot->ixOutputTime, 0, 0);
+			m_vecUserData2DVar[c]->put(
+				&(pSnapshot->dataUserData2D[c][0][0]),
+				1,
+				m_dYCoord.GetRows(),
+				m_dXCoord.GetRows());
+		}
+	}
+
+	// Store vorticity data
+	if (m_fOutputVorticity) {
+		m_varVorticity->set_cur(pSnapshot->ixOutputTime, 0, 0, 0);
+		m_varVorticity->put(
+			&(pSnapshot->dataVorticity[0][0][0]),
+			1,
+			pSnapshot->dataVorticity.GetColumns(),
+			m_dYCoord.GetRows(),
+			m_dXCoord.GetRows());
+	}
+
+	// Store divergence data
+	if (m_fOutputDivergence) {
+		m_varDivergence->set_cur(pSnapshot->ixOutputTime, 0, 0, 0);
+		m_varDivergence->put(
+			&(pSnapshot->dataDivergence[0][0][0]),
+			1,
+			pSnapshot->dataDivergence.GetColumns(),
+			m_dYCoord.GetRows(),
+			m_dXCoord.GetRows());
+	}
+
+	// Store temperature data
+	if (m_fOutputTemperature) {
+		m_varTemperature->set_cur(pSnapshot->ixOutputTime, 0, 0, 0);
+		m_varTemperature->put(
+			&(pSnapshot->dataTemperature[0][0][0]),
+			1,
+			pSnapshot->dataTemperature.GetColumns(),
+			m_dYCoord.GetRows(),
+			m_dXCoord.GetRows());
+	}
+
+	// Store surface pressure data
+	if (m_fOutputSurfacePressure) {
+		m_varSurfacePressure->set_cur(pSnapshot->ixOutputTime, 0, 0);
+		m_varSurfacePressure->put(
+			&(pSnapshot->dataSurfacePressure[0][0][0]),
+			1,
+			m_dYCoord.GetRows(),
+			m_dXCoord.GetRows());
+	}
+
+	// Store Richardson data
+	if (m_fOutputRichardson) {
+		m_varRichardson->set_cur(pSnapshot->ixOutputTime, 0, 0, 0);
+		m_varRichardson->put(
+			&(pSnapshot->dataRichardson[0][0][0]),
+			1,
+			pSnapshot->dataRichardson.GetColumns(),
+			m_dYCoord.GetRows(),
+			m_dXCoord.GetRows());
+	}
+
+#endif
+}
+
+#ifdef TEMPEST_NETCDF_PARALLEL
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerReference::WriteParallelRows(
+	double dTimeDays
+) {
+	// Get processor rank
+	int nRank;
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+
+	// Equation set
+	const EquationSet & eqn = m_grid.GetModel().GetEquationSet();
+
+	// User data metadata
+	const UserDataMeta & metaUserData = m_grid.GetModel().GetUserDataMeta();
+
+	// Quantize the rows of this processor in place
+	if (m_nQuantizeBits != 0) {
+		OutputSnapshot snapshot;
+		TakeSnapshot(snapshot, false);
+		QuantizeSnapshot(snapshot);
+	}
+
+	// Output topography
+	if (m_fFreshOutputFile) {
+		PutParallelRows(
+			m_ncidParallel, "Zs", -1, 0,
+			m_iRowBegin, m_iRowEnd, m_nXReference,
+			&(m_dataTopography[0][0][0]));
+	}
+
+	// Add new time; written by the root processor
+	{
+		int varidTime;
+		NcParallelCheck(
+			nc_inq_varid(m_ncidParallel, "time", &varidTime),
+			"time");
+
+		size_t sStart = m_ixOutputTime;
+		size_t sCount = (nRank == 0)?(1):(0);
+
+		NcParallelCheck(
+			nc_put_vara_double(
+				m_ncidParallel, varidTime, &sStart, &sCount, &dTimeDays),
+			"time");
+	}
+
+	// Store state variable data
+	for (int c = 0; c < eqn.GetComponents(); c++) {
+		if ((m_fOutputAllVarsOnNodes) ||
+			(m_grid.GetVarLocation(c) == DataLocation_Node)
+		) {
+			PutParallelRows(
+				m_ncidParallel, eqn.GetComponentShortName(c),
+				m_ixOutputTime, m_dataStateNode.GetColumns(),
+				m_iRowBegin, m_iRowEnd, m_nXReference,
+				&(m_dataStateNode[c][0][0]));
+
+		} else {
+			PutParallelRows(
+				m_ncidParallel, eqn.GetComponentShortName(c),
+				m_ixOutputTime, m_dataStateREdge.GetColumns(),
+				m_iRowBegin, m_iRowEnd, m_nXReference,
+				&(m_dataStateREdge[c][0][0]));
+		}
+	}
+
+	// Store tracer variable data
+	for (int c = 0; c < eqn.GetTracers(); c++) {
+		PutParallelRows(
+			m_ncidParallel, eqn.GetTracerShortName(c),
+			m_ixOutputTime, m_dataTracers.GetColumns(),
+			m_iRowBegin, m_iRowEnd, m_nXReference,
+			&(m_dataTracers[c][0][0]));
+	}
+
+	// Store user data
+	for (int c = 0; c < metaUserData.GetUserData2DItemCount(); c++) {
+		PutParallelRows(
+			m_ncidParallel, metaUserData.GetUserData2DItemName(c),
+			m_ixOutputTime, 0,
+			m_iRowBegin, m_iRowEnd, m_nXReference,
+			&(m_dataUserData2D[c][0][0]));
+	}
+
+	// Store derived quantities
+	if (m_fOutputVorticity) {
+		PutParallelRows(
+			m_ncidParallel, "ZETA",
+			m_ixOutputTime, m_dataVorticity.GetColumns(),
+			m_iRowBegin, m_iRowEnd, m_nXReference,
+			&(m_dataVorticity[0][0][0]));
+	}
+
+	if (m_fOutputDivergence) {
+		PutParallelRows(
+			m_ncidParallel, "DELTA",
+			m_ixOutputTime, m_dataDivergence.GetColumns(),
+			m_iRowBegin, m_iRowEnd, m_nXReference,
+			&(m_dataDivergence[0][0][0]));
+	}
+
+	if (m_fOutputTemperature) {
+		PutParallelRows(
+			m_ncidParallel, "T",
+			m_ixOutputTime, m_dataTemperature.GetColumns(),
+			m_iRowBegin, m_iRowEnd, m_nXReference,
+			&(m_dataTemperature[0][0][0]));
+	}
+
+	if (m_fOutputSurfacePressure) {
+		PutParallelRows(
+			m_ncidParallel, "PS",
+			m_ixOutputTime, 0,
+			m_iRowBegin, m_iRowEnd, m_nXReference,
+			&(m_dataSurfacePressure[0][0][0]));
+	}
+
+	if (m_fOutputRichardson) {
+		PutParallelRows(
+			m_ncidParallel, "Ri",
+			m_ixOutputTime, m_dataRichardson.GetColumns(),
+			m_iRowBegin, m_iRowEnd, m_nXReference,
+			&(m_dataRichardson[0][0][0]));
+	}
+}
+
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerReference::TakeSnapshot(
+	OutputSnapshot & snapshot,
+	bool fCopy
+) {
+	SnapshotArray(m_dataTopography, snapshot.dataTopography, fCopy);
+	SnapshotArray(m_dataStateNode, snapshot.dataStateNode, fCopy);
+	SnapshotArray(m_dataStateREdge, snapshot.dataStateREdge, fCopy);
+	SnapshotArray(m_dataTracers, snapshot.dataTracers, fCopy);
+	SnapshotArray(m_dataUserData2D, snapshot.dataUserData2D, fCopy);
+	SnapshotArray(m_dataVorticity, snapshot.dataVorticity, fCopy);
+	SnapshotArray(m_dataDivergence, snapshot.dataDivergence, fCopy);
+	SnapshotArray(m_dataTemperature, snapshot.dataTemperature, fCopy);
+	SnapshotArray(
+		m_dataSurfacePressure, snapshot.dataSurfacePressure, fCopy);
+	SnapshotArray(m_dataRichardson, snapshot.dataRichardson, fCopy);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerReference::QuantizeSnapshot(
+	OutputSnapshot & snapshot
+) const {
+	if (m_nQuantizeBits == 0) {
+		return;
+	}
+
+	QuantizeArray(snapshot.dataStateNode, m_nQuantizeBits);
+	QuantizeArray(snapshot.dataStateREdge, m_nQuantizeBits);
+	QuantizeArray(snapshot.dataTracers, m_nQuantizeBits);
+	QuantizeArray(snapshot.dataUserData2D, m_nQuantizeBits);
+	QuantizeArray(snapshot.dataVorticity, m_nQuantizeBits);
+	QuantizeArray(snapshot.dataDivergence, m_nQuantizeBits);
+	QuantizeArray(snapshot.dataTemperature, m_nQuantizeBits);
+	QuantizeArray(snapshot.dataSurfacePressure, m_nQuantizeBits);
+	QuantizeArray(snapshot.dataRichardson, m_nQuantizeBits);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void OutputManagerReference::Output(
 	const Time & time
 ) {
@@ -543,29 +1398,13 @@ void OutputManagerReference::Output(
 	// Update reference grid
 	CalculatePatchCoordinates();
 
-	// Initial outputs to a new Output file
-	if ((nRank == 0) && (m_fFreshOutputFile)) {
-
-		// Output topography
-		m_varTopography->put(
-			&(m_dataTopography[0][0][0]),
-			m_dYCoord.GetRows(),
-			m_dXCoord.GetRows());
-	}
-
-	// Equation set
-	const EquationSet & eqn = m_grid.GetModel().GetEquationSet();
-
 	// User data metadata
 	const UserDataMeta & metaUserData = m_grid.GetModel().GetUserDataMeta();
 
-	// Add new time
-	if (nRank == 0) {
+	// Time of this output
 #pragma message "FIX: Doesn't give correct count of days"
-		double dTimeDays = (time - m_grid.GetModel().GetStartTime()) / 86400.0;
-		m_varTime->set_cur(m_ixOutputTime);
-		m_varTime->put(&dTimeDays, 1);
-	}
+	double dTimeDays = (time - m_grid.GetModel().GetStartTime()) / 86400.0;
+
 /*
 	// Vertically interpolate data to model levels
 	if (m_fOutputAllVarsOnNodes) {
@@ -576,15 +1415,12 @@ void OutputManagerReference::Output(
 		}
 	}
 */
-	// Perform Interpolate / Reduction on state data
+	// Interpolate and distribute state data
 	m_dataStateNode.Zero();
 
-	m_grid.ReduceInterpolate(
+	DistributeInterpolate(
 		DataType_State,
 		m_dREtaCoord,
-		m_dAlpha,
-		m_dBeta,
-		m_iPatch,
 		m_dataStateNode,
 		(m_fOutputAllVarsOnNodes)?(DataLocation_None):(DataLocation_Node),
 		!m_fRemoveReferenceProfile);
@@ -592,212 +1428,105 @@ void OutputManagerReference::Output(
 	if (!m_fOutputAllVarsOnNodes) {
 		m_dataStateREdge.Zero();
 
-		m_grid.ReduceInterpolate(
+		DistributeInterpolate(
 			DataType_State,
 			m_grid.GetREtaInterfaces(),
-			m_dAlpha,
-			m_dBeta,
-			m_iPatch,
 			m_dataStateREdge,
 			DataLocation_REdge,
 			!m_fRemoveReferenceProfile);
 	}
 
-	// Perform Interpolate / Reduction on tracers data
+	// Interpolate and distribute tracers data
 	if (m_grid.GetModel().GetEquationSet().GetTracers() != 0) {
 		m_dataTracers.Zero();
 
-		m_grid.ReduceInterpolate(
+		DistributeInterpolate(
 			DataType_Tracers,
 			m_dREtaCoord,
-			m_dAlpha,
-			m_dBeta,
-			m_iPatch,
 			m_dataTracers,
 			DataLocation_None,
 			true);
 	}
 
-	// Perform Interpolate / Reduction on user data
+	// Interpolate and distribute user data
 	if (metaUserData.GetUserData2DItemCount() != 0) {
 		m_dataUserData2D.Zero();
 
-		m_grid.ReduceInterpolate(
+		DistributeInterpolate(
 			DataType_Auxiliary2D,
 			m_dREtaSurface,
-			m_dAlpha,
-			m_dBeta,
-			m_iPatch,
 			m_dataUserData2D);
 	}
 
-	// Perform Interpolate / Reduction on computed vorticity
+	// Interpolate and distribute computed vorticity
 	if (m_fOutputVorticity || m_fOutputDivergence) {
 		m_grid.ComputeVorticityDivergence(0);
 
 		if (m_fOutputVorticity) {
-			m_grid.ReduceInterpolate(
+			DistributeInterpolate(
 				DataType_Vorticity,
 				m_dREtaCoord,
-				m_dAlpha,
-				m_dBeta,
-				m_iPatch,
 				m_dataVorticity);
 		}
 		if (m_fOutputDivergence) {
-			m_grid.ReduceInterpolate(
+			DistributeInterpolate(
 				DataType_Divergence,
 				m_dREtaCoord,
-				m_dAlpha,
-				m_dBeta,
-				m_iPatch,
 				m_dataDivergence);
 		}
 	}
 
-	// Perform Interpolate / Reduction on temperature
+	// Interpolate and distribute temperature
 	if (m_fOutputTemperature) {
 		m_grid.ComputeTemperature(0);
 
-		m_grid.ReduceInterpolate(
+		DistributeInterpolate(
 			DataType_Temperature,
 			m_dREtaCoord,
-			m_dAlpha,
-			m_dBeta,
-			m_iPatch,
 			m_dataTemperature);
 	}
 
-	// Perform Interpolate / Reduction on temperature
+	// Interpolate and distribute surface pressure
 	if (m_fOutputSurfacePressure) {
 		m_grid.ComputeSurfacePressure(0);
 
-		m_grid.ReduceInterpolate(
+		DistributeInterpolate(
 			DataType_SurfacePressure,
 			m_dREtaSurface,
-			m_dAlpha,
-			m_dBeta,
-			m_iPatch,
 			m_dataSurfacePressure);
 	}
 
-	// Perform Interpolate / Reduction on Richardson number
+	// Interpolate and distribute Richardson number
 	if (m_fOutputRichardson) {
 		m_grid.ComputeRichardson(0);
 
-		m_grid.ReduceInterpolate(
+		DistributeInterpolate(
 			DataType_Richardson,
 			m_dREtaCoord,
-			m_dAlpha,
-			m_dBeta,
-			m_iPatch,
 			m_dataRichardson);
 	}
 
-	// Store state variable data
+#ifdef TEMPEST_NETCDF_PARALLEL
+	// Store all data collectively; each processor writes its rows
+	WriteParallelRows(dTimeDays);
+#else
+	// Write data on root processor
 	if (nRank == 0) {
-		for (int c = 0; c < eqn.GetComponents(); c++) {
-			if ((m_fOutputAllVarsOnNodes) ||
-				(m_grid.GetVarLocation(c) == DataLocation_Node)
-			) {
-				m_vecComponentVar[c]->set_cur(m_ixOutputTime, 0, 0, 0);
-				m_vecComponentVar[c]->put(
-					&(m_dataStateNode[c][0][0]),
-					1,
-					m_dataStateNode.GetColumns(),
-					m_dYCoord.GetRows(),
-					m_dXCoord.GetRows());
-
-			} else {
-				m_vecComponentVar[c]->set_cur(m_ixOutputTime, 0, 0, 0);
-				m_vecComponentVar[c]->put(
-					&(m_dataStateREdge[c][0][0]),
-					1,
-					m_dataStateREdge.GetColumns(),
-					m_dYCoord.GetRows(),
-					m_dXCoord.GetRows());
-			}
-		}
+		std::shared_ptr<OutputSnapshot> pSnapshot(new OutputSnapshot);
 
-		// Store tracer variable data
-		if (eqn.GetTracers() != 0) {
-			for (int c = 0; c < eqn.GetTracers(); c++) {
-				m_vecTracersVar[c]->set_cur(m_ixOutputTime, 0, 0, 0);
-				m_vecTracersVar[c]->put(
-					&(m_dataTracers[c][0][0]),
-					1,
-					m_dataTracers.GetColumns(),
-					m_dYCoord.GetRows(),
-					m_dXCoord.GetRows());
-			}
-		}
+		pSnapshot->ixOutputTime = m_ixOutputTime;
+		pSnapshot->fFreshOutputFile = m_fFreshOutputFile;
+		pSnapshot->dTimeDays = dTimeDays;
 
-		// Store user data
-		if (metaUserData.GetUserData2DItemCount() != 0) {
-			for (int c = 0; c < metaUserData.GetUserData2DItemCount(); c++) {
-				m_vecUserData2DVar[c]->set_cur(m_ixOutputTime, 0, 0);
-				m_vecUserData2DVar[c]->put(
-					&(m_dataUserData2D[c][0][0]),
-					1,
-					m_dYCoord.GetRows(),
-					m_dXCoord.GetRows());
-			}
-		}
+		TakeSnapshot(*pSnapshot, IsAsynchronous());
 
-		// Store vorticity data
-		if (m_fOutputVorticity) {
-			m_varVorticity->set_cur(m_ixOutputTime, 0, 0, 0);
-			m_varVorticity->put(
-				&(m_dataVorticity[0][0][0]),
-				1,
-				m_dataVorticity.GetColumns(),
-				m_dYCoord.GetRows(),
-				m_dXCoord.GetRows());
-		}
-
-		// Store divergence data
-		if (m_fOutputDivergence) {
-			m_varDivergence->set_cur(m_ixOutputTime, 0, 0, 0);
-			m_varDivergence->put(
-				&(m_dataDivergence[0][0][0]),
-				1,
-				m_dataDivergence.GetColumns(),
-				m_dYCoord.GetRows(),
-				m_dXCoord.GetRows());
-		}
-
-		// Store temperature data
-		if (m_fOutputTemperature) {
-			m_varTemperature->set_cur(m_ixOutputTime, 0, 0, 0);
-			m_varTemperature->put(
-				&(m_dataTemperature[0][0][0]),
-				1,
-				m_dataTemperature.GetColumns(),
-				m_dYCoord.GetRows(),
-				m_dXCoord.GetRows());
-		}
-
-		// Store surface pressure data
-		if (m_fOutputSurfacePressure) {
-			m_varSurfacePressure->set_cur(m_ixOutputTime, 0, 0);
-			m_varSurfacePressure->put(
-				&(m_dataSurfacePressure[0][0][0]),
-				1,
-				m_dYCoord.GetRows(),
-				m_dXCoord.GetRows());
-		}
-
-		// Store Richardson data
-		if (m_fOutputRichardson) {
-			m_varRichardson->set_cur(m_ixOutputTime, 0, 0, 0);
-			m_varRichardson->put(
-				&(m_dataRichardson[0][0][0]),
-				1,
-				m_dataRichardson.GetColumns(),
-				m_dYCoord.GetRows(),
-				m_dXCoord.GetRows());
-		}
+		DeferFileOperation(
+			std::bind(
+				&OutputManagerReference::WriteSnapshot,
+				this,
+				pSnapshot));
 	}
+#endif
 
 	// No longer fresh file
 	m_fFreshOutputFile = false;
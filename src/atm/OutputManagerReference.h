@@ -20,6 +20,13 @@
 #include "OutputManager.h"
 
 #include "DataArray3D.h"
+#include "DataType.h"
+#include "DataLocation.h"
+#include "RemapOperator.h"
+
+#include <memory>
+#include <string>
+#include <vector>
 
 class Time;
 
@@ -107,12 +114,137 @@ public:
 		bool fOutputRichardson = true
 	);
 
+	///	<summary>
+	///		Compress the fields written to the output file.  Fields are
+	///		rounded to nQuantizeBits significant bits of mantissa, which bounds
+	///		the relative error by 2^-(nQuantizeBits+1), and compressed with
+	///		deflate at level nDeflateLevel.  A value of zero disables either
+	///		stage.  Deflate requires NetCDF-4.
+	///	</summary>
+	void SetCompression(
+		int nDeflateLevel,
+		int nQuantizeBits
+	);
+
 private:
 	///	<summary>
 	///		Calculate the patch coordinates of the reference points.
 	///	</summary>
 	bool CalculatePatchCoordinates();
 
+	///	<summary>
+	///		Assign bands of rows of the reference grid to processors and
+	///		build the plan which sends each interpolated reference point
+	///		from the processor that owns it to the processor that writes it.
+	///		Without parallel NetCDF all rows are written by the root
+	///		processor.
+	///	</summary>
+	void BuildOutputPlan();
+
+	///	<summary>
+	///		Interpolate data to the reference points on the active patches
+	///		of this processor and send each point to the processor that
+	///		writes it.  On return dInterpData contains rows m_iRowBegin to
+	///		m_iRowEnd of the reference grid.
+	///	</summary>
+	void DistributeInterpolate(
+		DataType eDataType,
+		const DataArray1D<double> & dREta,
+		DataArray3D<double> & dInterpData,
+		DataLocation eOnlyVariablesAt = DataLocation_None,
+		bool fIncludeReferenceState = true
+	);
+
+	///	<summary>
+	///		Data written to the active NetCDF file by one call to Output.
+	///	</summary>
+	struct OutputSnapshot {
+		int ixOutputTime;
+		bool fFreshOutputFile;
+		double dTimeDays;
+
+		DataArray3D<double> dataTopography;
+		DataArray3D<double> dataStateNode;
+		DataArray3D<double> dataStateREdge;
+		DataArray3D<double> dataTracers;
+		DataArray3D<double> dataUserData2D;
+		DataArray3D<double> dataVorticity;
+		DataArray3D<double> dataDivergence;
+		DataArray3D<double> dataTemperature;
+		DataArray3D<double> dataSurfacePressure;
+		DataArray3D<double> dataRichardson;
+	};
+
+	///	<summary>
+	///		Fill a snapshot with the interpolated data.  If fCopy is true
+	///		the snapshot holds a copy of the data, otherwise it refers to
+	///		the data arrays of this OutputManager.
+	///	</summary>
+	void TakeSnapshot(
+		OutputSnapshot & snapshot,
+		bool fCopy
+	);
+
+	///	<summary>
+	///		Round the fields of a snapshot to the number of significant bits
+	///		of mantissa given by SetCompression.
+	///	</summary>
+	void QuantizeSnapshot(
+		OutputSnapshot & snapshot
+	) const;
+
+	///	<summary>
+	///		Create a new NetCDF file and define its dimensions and
+	///		variables (root processor only).
+	///	</summary>
+	void DefineNcFile(
+		const std::string & strNcFileName
+	);
+
+	///	<summary>
+	///		Close the active NetCDF file (root processor only).
+	///	</summary>
+	void CloseNcFile();
+
+#ifdef TEMPEST_NETCDF_PARALLEL
+	///	<summary>
+	///		Collectively write the rows of this processor to the NetCDF
+	///		file opened for parallel access.
+	///	</summary>
+	void WriteParallelRows(
+		double dTimeDays
+	);
+#endif
+
+	///	<summary>
+	///		Enable compression of a field variable of the active NetCDF
+	///		file (root processor only).
+	///	</summary>
+	void DefineNcVarCompression(
+		NcVar * var
+	);
+
+	///	<summary>
+	///		Write a snapshot to the active NetCDF file (root processor
+	///		only).
+	///	</summary>
+	void WriteSnapshot(
+		std::shared_ptr<OutputSnapshot> pSnapshot
+	);
+
+protected:
+	///	<summary>
+	///		Returns true if this OutputManager supports asynchronous output.
+	///		Parallel NetCDF writes are collective and remain synchronous.
+	///	</summary>
+	virtual bool SupportsAsynchronousOutput() const {
+#if defined(TEMPEST_NETCDF) && !defined(TEMPEST_NETCDF_PARALLEL)
+		return true;
+#else
+		return false;
+#endif
+	}
+
 protected:
 	///	<summary>
 	///		Open a new NetCDF file.
@@ -206,11 +338,84 @@ protected:
 	///	</summary>
 	DataArray1D<int> m_iPatch;
 
+	///	<summary>
+	///		Operator which interpolates from the active patches of this
+	///		processor to the reference points on those patches, in the
+	///		order in which they are sent.
+	///	</summary>
+	RemapOperator m_opRemap;
+
+	///	<summary>
+	///		First row of the reference grid written by this processor.
+	///	</summary>
+	int m_iRowBegin;
+
+	///	<summary>
+	///		One past the last row of the reference grid written by this
+	///		processor.
+	///	</summary>
+	int m_iRowEnd;
+
+	///	<summary>
+	///		Reference points on the active patches of this processor, in
+	///		the order in which they are sent.
+	///	</summary>
+	std::vector<int> m_vecSendPoint;
+
+	///	<summary>
+	///		Number of reference points sent to each processor.
+	///	</summary>
+	std::vector<int> m_vecSendCount;
+
+	///	<summary>
+	///		Offset of the first reference point sent to each processor.
+	///	</summary>
+	std::vector<int> m_vecSendDispl;
+
+	///	<summary>
+	///		Index within the rows of this processor of each reference point
+	///		received, in the order in which they are received.
+	///	</summary>
+	std::vector<int> m_vecRecvPoint;
+
+	///	<summary>
+	///		Number of reference points received from each processor.
+	///	</summary>
+	std::vector<int> m_vecRecvCount;
+
+	///	<summary>
+	///		Offset of the first reference point received from each
+	///		processor.
+	///	</summary>
+	std::vector<int> m_vecRecvDispl;
+
+	///	<summary>
+	///		Interpolated data at the reference points on the active patches
+	///		of this processor, in the order in which they are sent.
+	///	</summary>
+	DataArray3D<double> m_dataInterpLocal;
+
+	///	<summary>
+	///		Buffer of interpolated data sent to other processors.
+	///	</summary>
+	std::vector<double> m_vecSendBuffer;
+
+	///	<summary>
+	///		Buffer of interpolated data received from other processors.
+	///	</summary>
+	std::vector<double> m_vecRecvBuffer;
+
 	///	<summary>
 	///		Active output file.
 	///	</summary>
 	NcFile * m_pActiveNcOutput;
 
+	///	<summary>
+	///		NetCDF id of the active output file opened for parallel access
+	///		on all processors, or -1.
+	///	</summary>
+	int m_ncidParallel;
+
 	///	<summary>
 	///		Time variable.
 	///	</summary>
@@ -340,6 +545,17 @@ private:
 	///	</summary>
 	DataArray3D<double> m_dataRichardson;
 
+	///	<summary>
+	///		Deflate level of field variables (0 for no deflate).
+	///	</summary>
+	int m_nDeflateLevel;
+
+	///	<summary>
+	///		Number of significant bits of mantissa retained in field
+	///		variables (0 for no quantization).
+	///	</summary>
+	int m_nQuantizeBits;
+
 };
 
 ///////////////////////////////////////////////////////////////////////////////
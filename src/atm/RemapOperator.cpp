@@ -0,0 +1,134 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    RemapOperator.cpp
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "RemapOperator.h"
+#include "Exception.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+void PatchRemapOperator::Initialize(
+	int ixPatch,
+	int nOrder
+) {
+	if (nOrder < 1) {
+		_EXCEPTIONT("Invalid horizontal order in PatchRemapOperator");
+	}
+
+	m_ixPatch = ixPatch;
+	m_nOrder = nOrder;
+
+	m_vecPoint.clear();
+	m_vecAlpha.clear();
+	m_vecBeta.clear();
+	m_vecNodeA.clear();
+	m_vecNodeB.clear();
+	m_vecWeight.clear();
+
+	m_vecColumnLocation.clear();
+	m_vecColumnRElements.clear();
+	m_vecColumnREta.clear();
+	m_vecColumnOp.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void PatchRemapOperator::AddPoint(
+	int ix,
+	double dAlpha,
+	double dBeta,
+	int iA,
+	int iB,
+	const DataArray1D<double> & dACoeffs,
+	const DataArray1D<double> & dBCoeffs
+) {
+	if ((dACoeffs.GetRows() != m_nOrder) ||
+		(dBCoeffs.GetRows() != m_nOrder)
+	) {
+		_EXCEPTIONT("Invalid number of coefficients in PatchRemapOperator");
+	}
+
+	m_vecPoint.push_back(ix);
+	m_vecAlpha.push_back(dAlpha);
+	m_vecBeta.push_back(dBeta);
+	m_vecNodeA.push_back(iA);
+	m_vecNodeB.push_back(iB);
+
+	for (int m = 0; m < m_nOrder; m++) {
+	for (int n = 0; n < m_nOrder; n++) {
+		m_vecWeight.push_back(dACoeffs[m] * dBCoeffs[n]);
+	}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int PatchRemapOperator::FindColumnOperator(
+	DataLocation eDataLocation,
+	int nRElements,
+	const DataArray1D<double> & dREta
+) const {
+	for (int i = 0; i < m_vecColumnOp.size(); i++) {
+		if (m_vecColumnLocation[i] != eDataLocation) {
+			continue;
+		}
+		if (m_vecColumnRElements[i] != nRElements) {
+			continue;
+		}
+
+		const std::vector<double> & vecREta = m_vecColumnREta[i];
+		if (vecREta.size() != dREta.GetRows()) {
+			continue;
+		}
+
+		int k = 0;
+		for (; k < vecREta.size(); k++) {
+			if (vecREta[k] != dREta[k]) {
+				break;
+			}
+		}
+		if (k == vecREta.size()) {
+			return i;
+		}
+	}
+
+	return (-1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+LinearColumnInterpFEM & PatchRemapOperator::AddColumnOperator(
+	DataLocation eDataLocation,
+	int nRElements,
+	const DataArray1D<double> & dREta
+) {
+	m_vecColumnLocation.push_back(eDataLocation);
+	m_vecColumnRElements.push_back(nRElements);
+	m_vecColumnREta.push_back(
+		std::vector<double>(dREta.GetRows()));
+
+	std::vector<double> & vecREta = m_vecColumnREta.back();
+	for (int k = 0; k < vecREta.size(); k++) {
+		vecREta[k] = dREta[k];
+	}
+
+	m_vecColumnOp.push_back(
+		std::shared_ptr<LinearColumnInterpFEM>(new LinearColumnInterpFEM));
+
+	return *(m_vecColumnOp.back());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,309 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    RemapOperator.h
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _REMAPOPERATOR_H_
+#define _REMAPOPERATOR_H_
+
+#include "DataArray1D.h"
+#include "DataLocation.h"
+#include "LinearColumnOperatorFEM.h"
+
+#include <memory>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A precomputed linear map from the nodes of one GridPatch to a set of
+///		points.  Each point is a row of the horizontal operator with
+///		nOrder * nOrder weights applied to the nodes of a single element,
+///		so rows are stored with a fixed stride and only the first node of
+///		the element is kept as the column index.  Vertical interpolation
+///		operators are built on first use and cached by DataLocation and
+///		target levels.
+///	</summary>
+class PatchRemapOperator {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	PatchRemapOperator() :
+		m_ixPatch(-1),
+		m_nOrder(0)
+	{ }
+
+public:
+	///	<summary>
+	///		Remove all points and vertical operators and set the patch index
+	///		and horizontal order of the operator.
+	///	</summary>
+	void Initialize(
+		int ixPatch,
+		int nOrder
+	);
+
+	///	<summary>
+	///		Add a point to the operator.  The point is interpolated from
+	///		the nodes (iA+m, iB+n) with weight dACoeffs[m] * dBCoeffs[n].
+	///	</summary>
+	void AddPoint(
+		int ix,
+		double dAlpha,
+		double dBeta,
+		int iA,
+		int iB,
+		const DataArray1D<double> & dACoeffs,
+		const DataArray1D<double> & dBCoeffs
+	);
+
+public:
+	///	<summary>
+	///		Find the vertical operator for the given DataLocation, number of
+	///		source levels and target levels.  Returns -1 if the operator
+	///		has not been added.
+	///	</summary>
+	int FindColumnOperator(
+		DataLocation eDataLocation,
+		int nRElements,
+		const DataArray1D<double> & dREta
+	) const;
+
+	///	<summary>
+	///		Add an uninitialized vertical operator for the given
+	///		DataLocation, number of source levels and target levels.
+	///	</summary>
+	LinearColumnInterpFEM & AddColumnOperator(
+		DataLocation eDataLocation,
+		int nRElements,
+		const DataArray1D<double> & dREta
+	);
+
+	///	<summary>
+	///		Get the number of vertical operators.
+	///	</summary>
+	int GetColumnOperatorCount() const {
+		return static_cast<int>(m_vecColumnOp.size());
+	}
+
+	///	<summary>
+	///		Get a vertical operator.
+	///	</summary>
+	const LinearColumnInterpFEM & GetColumnOperator(int ix) const {
+		return *(m_vecColumnOp[ix]);
+	}
+
+public:
+	///	<summary>
+	///		Get the index of the patch on which this operator is defined.
+	///	</summary>
+	int GetPatchIndex() const {
+		return m_ixPatch;
+	}
+
+	///	<summary>
+	///		Get the horizontal order of the operator.
+	///	</summary>
+	int GetOrder() const {
+		return m_nOrder;
+	}
+
+	///	<summary>
+	///		Get the number of points.
+	///	</summary>
+	int GetPointCount() const {
+		return static_cast<int>(m_vecPoint.size());
+	}
+
+	///	<summary>
+	///		Get the index of a point in the array of points.
+	///	</summary>
+	int GetPoint(int p) const {
+		return m_vecPoint[p];
+	}
+
+	///	<summary>
+	///		Get the alpha coordinate of a point.
+	///	</summary>
+	double GetAlpha(int p) const {
+		return m_vecAlpha[p];
+	}
+
+	///	<summary>
+	///		Get the beta coordinate of a point.
+	///	</summary>
+	double GetBeta(int p) const {
+		return m_vecBeta[p];
+	}
+
+	///	<summary>
+	///		Get the first alpha node of the element containing a point.
+	///	</summary>
+	int GetNodeA(int p) const {
+		return m_vecNodeA[p];
+	}
+
+	///	<summary>
+	///		Get the first beta node of the element containing a point.
+	///	</summary>
+	int GetNodeB(int p) const {
+		return m_vecNodeB[p];
+	}
+
+	///	<summary>
+	///		Get the nOrder * nOrder weights of a point.
+	///	</summary>
+	const double * GetWeights(int p) const {
+		return &(m_vecWeight[p * m_nOrder * m_nOrder]);
+	}
+
+private:
+	///	<summary>
+	///		Index of the patch.
+	///	</summary>
+	int m_ixPatch;
+
+	///	<summary>
+	///		Horizontal order.
+	///	</summary>
+	int m_nOrder;
+
+	///	<summary>
+	///		Index of each point.
+	///	</summary>
+	std::vector<int> m_vecPoint;
+
+	///	<summary>
+	///		Alpha coordinate of each point.
+	///	</summary>
+	std::vector<double> m_vecAlpha;
+
+	///	<summary>
+	///		Beta coordinate of each point.
+	///	</summary>
+	std::vector<double> m_vecBeta;
+
+	///	<summary>
+	///		First alpha node of the element containing each point.
+	///	</summary>
+	std::vector<int> m_vecNodeA;
+
+	///	<summary>
+	///		First beta node of the element containing each point.
+	///	</summary>
+	std::vector<int> m_vecNodeB;
+
+	///	<summary>
+	///		Horizontal weights of each point.
+	///	</summary>
+	std::vector<double> m_vecWeight;
+
+	///	<summary>
+	///		DataLocation of each vertical operator.
+	///	</summary>
+	std::vector<DataLocation> m_vecColumnLocation;
+
+	///	<summary>
+	///		Number of source levels of each vertical operator.
+	///	</summary>
+	std::vector<int> m_vecColumnRElements;
+
+	///	<summary>
+	///		Target levels of each vertical operator.
+	///	</summary>
+	std::vector< std::vector<double> > m_vecColumnREta;
+
+	///	<summary>
+	///		Vertical operators.  Operators are held by pointer since
+	///		LinearColumnOperator cannot be copied.
+	///	</summary>
+	std::vector< std::shared_ptr<LinearColumnInterpFEM> > m_vecColumnOp;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A precomputed linear map from the active patches of a Grid to a set
+///		of points, with one PatchRemapOperator per active patch.
+///	</summary>
+class RemapOperator {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	RemapOperator() :
+		m_nPoints(0)
+	{ }
+
+public:
+	///	<summary>
+	///		Remove all patch operators and set the total number of points
+	///		and the number of patch operators.
+	///	</summary>
+	void Initialize(
+		int nPoints,
+		int nPatches
+	) {
+		m_nPoints = nPoints;
+		m_vecPatchOp.clear();
+		m_vecPatchOp.resize(nPatches);
+	}
+
+	///	<summary>
+	///		Get the total number of points.
+	///	</summary>
+	int GetPointCount() const {
+		return m_nPoints;
+	}
+
+	///	<summary>
+	///		Get the number of patch operators.
+	///	</summary>
+	int GetPatchCount() const {
+		return static_cast<int>(m_vecPatchOp.size());
+	}
+
+	///	<summary>
+	///		Get a patch operator.
+	///	</summary>
+	PatchRemapOperator & GetPatchOperator(int n) {
+		return m_vecPatchOp[n];
+	}
+
+	///	<summary>
+	///		Get a patch operator.
+	///	</summary>
+	const PatchRemapOperator & GetPatchOperator(int n) const {
+		return m_vecPatchOp[n];
+	}
+
+private:
+	///	<summary>
+	///		Total number of points.
+	///	</summary>
+	int m_nPoints;
+
+	///	<summary>
+	///		Operator on each active patch.
+	///	</summary>
+	std::vector<PatchRemapOperator> m_vecPatchOp;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
@@ -25,6 +25,7 @@
 #include "TimestepSchemeARK232.h"
 #include "TimestepSchemeGARK2.h"
 #include "TimestepSchemeARS343.h"
+#include "TimestepSchemeIMEX.h"
 #include "TimestepSchemeARS443.h"
 #include "TimestepSchemeSSP3332.h"
 #include "TimestepSchemeSplitExp.h"
@@ -37,7 +38,9 @@
 #include "VerticalDynamicsFLL.h"
 #include "OutputManagerComposite.h"
 #include "OutputManagerReference.h"
+#include "OutputManagerNative.h"
 #include "OutputManagerChecksum.h"
+#include "ZonalAverageProcess.h"
 #include "GridCSGLL.h"
 #include "GridCartesianGLL.h"
 #include "VerticalStretch.h"
@@ -46,10 +49,13 @@
 #include "Announce.h"
 #include "CommandLine.h"
 #include "STLStringHelper.h"
+#include "ThreadTools.h"
+#include "DataAllocator.h"
 
 #include <mpi.h>
 
 #include <string>
+#include <cstdio>
 
 #ifdef TEMPEST_PETSC
 #include <petscsnes.h>
@@ -63,6 +69,10 @@ struct _TempestCommandLineVariables {
 	std::string strOutputPrefix;
 	std::string strRestartFile;
 	int nOutputsPerFile;
+	int nOutputAsync;
+	int nOutputDeflate;
+	int nOutputQuantizeBits;
+	bool fOutputRestartCompress;
 	Time timeOutputDeltaT;
 	Time timeOutputRestartDeltaT;
 	Time timeDeltaT;
@@ -75,6 +85,12 @@ struct _TempestCommandLineVariables {
 	bool fOutputTemperature;
 	bool fOutputSurfacePressure;
 	bool fOutputRichardson;
+	bool fOutputNative;
+	std::string strZonalVariables;
+	Time timeZonalSampleDeltaT;
+	Time timeZonalOutputDeltaT;
+	int nZonalLatitudes;
+	bool fZonalVariance;
 	bool fNoReferenceState;
 	bool fNoTracers;
 	bool fNoHyperviscosity;
@@ -92,6 +108,10 @@ struct _TempestCommandLineVariables {
 	std::string strTimestepScheme;
 	std::string strHorizontalDynamics;
 	std::string strVerticalDynamics;
+	int nJacobianReuse;
+	int nThreads;
+	bool fHugePages;
+	std::string strMemoryReport;
 	int nResolutionX;
 	int nResolutionY;
 	int nLevels;
@@ -121,7 +141,11 @@ struct _TempestCommandLineVariables {
 	CommandLineString(_tempestvars.strOutputPrefix, "output_prefix", "out"); \
 	CommandLineString(_tempestvars.strRestartFile, "restart_file", ""); \
 	CommandLineInt(_tempestvars.nOutputsPerFile, "output_perfile", -1); \
+	CommandLineInt(_tempestvars.nOutputAsync, "output_async", 0); \
+	CommandLineInt(_tempestvars.nOutputDeflate, "output_deflate", 0); \
+	CommandLineInt(_tempestvars.nOutputQuantizeBits, "output_quantize", 0); \
 	CommandLineDeltaTime(_tempestvars.timeOutputRestartDeltaT, "output_restart_dt", ""); \
+	CommandLineBool(_tempestvars.fOutputRestartCompress, "output_restart_compress"); \
 	CommandLineInt(_tempestvars.nOutputResX, "output_x", 360); \
 	CommandLineInt(_tempestvars.nOutputResY, "output_y", 180); \
 	CommandLineInt(_tempestvars.nOutputResZ, "output_z", 0); \
@@ -130,6 +154,12 @@ struct _TempestCommandLineVariables {
 	CommandLineBool(_tempestvars.fOutputTemperature, "output_temp"); \
 	CommandLineBool(_tempestvars.fOutputSurfacePressure, "output_ps"); \
 	CommandLineBool(_tempestvars.fOutputRichardson, "output_Ri"); \
+	CommandLineBool(_tempestvars.fOutputNative, "output_native"); \
+	CommandLineString(_tempestvars.strZonalVariables, "zonal_vars", ""); \
+	CommandLineDeltaTime(_tempestvars.timeZonalSampleDeltaT, "zonal_sample_dt", ""); \
+	CommandLineDeltaTime(_tempestvars.timeZonalOutputDeltaT, "zonal_outputtime", ""); \
+	CommandLineInt(_tempestvars.nZonalLatitudes, "zonal_lat", 0); \
+	CommandLineBool(_tempestvars.fZonalVariance, "zonal_variance"); \
 	CommandLineBool(_tempestvars.fNoReferenceState, "norefstate"); \
 	CommandLineBool(_tempestvars.fNoTracers, "notracers"); \
 	CommandLineBool(_tempestvars.fNoHyperviscosity, "nohypervis"); \
@@ -146,6 +176,10 @@ struct _TempestCommandLineVariables {
 	CommandLineInt(_tempestvars.nVerticalHyperdiffOrder, "vhypervisorder", 0); \
 	CommandLineString(_tempestvars.strTimestepScheme, "timescheme", "strang"); \
 	CommandLineStringD(_tempestvars.strVerticalDynamics, "vmethod", "DEFAULT", "(DEFAULT | SCHUR | FLL)"); \
+	CommandLineInt(_tempestvars.nJacobianReuse, "jacobianreuse", 0); \
+	CommandLineInt(_tempestvars.nThreads, "threads", 1); \
+	CommandLineBool(_tempestvars.fHugePages, "hugepages"); \
+	CommandLineString(_tempestvars.strMemoryReport, "memory_report", ""); \
 	CommandLineInt(_tempestvars.iARKode_nvectors, "arkode_nvectors", 50); \
 	CommandLineDouble(_tempestvars.dARKode_rtol, "arkode_rtol", 1.0e-6); \
 	CommandLineDouble(_tempestvars.dARKode_atol, "arkode_atol", 1.0e-11); \
@@ -200,10 +234,45 @@ struct _TempestCommandLineVariables {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		Returns true if MPI was initialized with MPI_THREAD_FUNNELED
+///		support, so that worker threads may be active while the master
+///		thread makes MPI calls.
+///	</summary>
+bool _TempestHasMPIThreadSupport() {
+#ifdef TEMPEST_MPIOMP
+	int iThreadSupport;
+	MPI_Query_thread(&iThreadSupport);
+	return (iThreadSupport >= MPI_THREAD_FUNNELED);
+#else
+	return true;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void _TempestSetupMethodOfLines(
 	Model & model,
 	_TempestCommandLineVariables & vars
 ) {
+	// Set the number of threads per rank
+	if (vars.nThreads < 1) {
+		_EXCEPTIONT("Invalid value for --threads: Expected positive integer");
+	}
+	if (HasThreadSupport()) {
+		if ((vars.nThreads > 1) && !_TempestHasMPIThreadSupport()) {
+			_EXCEPTIONT("--threads > 1 requires MPI_THREAD_FUNNELED, "
+				"which is not provided by this MPI implementation");
+		}
+		SetThreadCount(vars.nThreads);
+
+	} else if (vars.nThreads != 1) {
+		Announce("WARNING: Built without thread support; ignoring --threads");
+	}
+
+	// Back large data containers with transparent huge pages
+	GetDefaultDataAllocator().SetHugePages(vars.fHugePages);
+
 	// Set the timestep scheme
 	AnnounceStartBlock("Initializing time scheme");
 
@@ -261,6 +330,22 @@ void _TempestSetupMethodOfLines(
 		model.SetTimestepScheme(
 			new TimestepSchemeARS443(model));
 
+	} else if (vars.strTimestepScheme == "imex/ars222") {
+		model.SetTimestepScheme(
+			new TimestepSchemeIMEX(model, TimestepSchemeIMEX::ARS222));
+
+	} else if (vars.strTimestepScheme == "imex/ars232") {
+		model.SetTimestepScheme(
+			new TimestepSchemeIMEX(model, TimestepSchemeIMEX::ARS232));
+
+	} else if (vars.strTimestepScheme == "imex/ars343") {
+		model.SetTimestepScheme(
+			new TimestepSchemeIMEX(model, TimestepSchemeIMEX::ARS343));
+
+	} else if (vars.strTimestepScheme == "imex/ars443") {
+		model.SetTimestepScheme(
+			new TimestepSchemeIMEX(model, TimestepSchemeIMEX::ARS443));
+
 	} else if (vars.strTimestepScheme == "ssp3_332") {
 		model.SetTimestepScheme(
 			new TimestepSchemeSSP3332(model));
@@ -306,7 +391,9 @@ void _TempestSetupMethodOfLines(
 	} else {
 		_EXCEPTIONT("Invalid timescheme: Expected "
 			"\"Strang\", \"ARS222\", \"ARS232\", \"ARK232\", "
-			"\"ARS343\", \"ARS443\", \"SSP3_332\"");
+			"\"ARS343\", \"ARS443\", \"SSP3_332\", "
+			"\"IMEX/ARS222\", \"IMEX/ARS232\", \"IMEX/ARS343\", "
+			"\"IMEX/ARS443\"");
 	}
 	AnnounceEndBlock("Done");
 
@@ -352,7 +439,8 @@ void _TempestSetupMethodOfLines(
 				vars.nVerticalHyperdiffOrder,
 				vars.fExplicitVertical,
 				!vars.fNoReferenceState,
-				vars.fForceMassFluxOnLevels));
+				vars.fForceMassFluxOnLevels,
+				vars.nJacobianReuse));
 
 	} else if (vars.strVerticalDynamics == "schur") {
 		model.SetVerticalDynamics(
@@ -389,8 +477,45 @@ void _TempestSetupOutputManagers(
 	Model & model,
 	_TempestCommandLineVariables & vars
 ) {
+	// Set the native output manager for the model
+	if (!vars.fNoOutput && vars.fOutputNative) {
+		AnnounceStartBlock("Creating native output manager");
+		OutputManagerNative * pOutmanNative =
+			new OutputManagerNative(
+				*(model.GetGrid()),
+				vars.timeOutputDeltaT,
+				vars.strOutputDir,
+				vars.strOutputPrefix,
+				vars.nOutputsPerFile);
+
+		if (vars.fOutputVorticity) {
+			pOutmanNative->OutputVorticity();
+		}
+		if (vars.fOutputDivergence) {
+			pOutmanNative->OutputDivergence();
+		}
+		if (vars.fOutputTemperature) {
+			pOutmanNative->OutputTemperature();
+		}
+		if (vars.fOutputSurfacePressure) {
+			pOutmanNative->OutputSurfacePressure();
+		}
+		if (vars.fOutputRichardson) {
+			Announce("WARNING: --output_Ri not supported by native output");
+		}
+		if (vars.nOutputAsync != 0) {
+			Announce("WARNING: --output_async not supported by native output");
+		}
+		if ((vars.nOutputDeflate != 0) || (vars.nOutputQuantizeBits != 0)) {
+			Announce("WARNING: --output_deflate and --output_quantize not "
+				"supported by native output");
+		}
+
+		model.AttachOutputManager(pOutmanNative);
+		AnnounceEndBlock("Done");
+
 	// Set the reference output manager for the model
-	if (!vars.fNoOutput) {
+	} else if (!vars.fNoOutput) {
 		AnnounceStartBlock("Creating reference output manager");
 		OutputManagerReference * pOutmanRef =
 			new OutputManagerReference(
@@ -420,6 +545,14 @@ void _TempestSetupOutputManagers(
 		if (vars.fOutputRichardson) {
 			pOutmanRef->OutputRichardson();
 		}
+		if (vars.nOutputAsync != 0) {
+			pOutmanRef->SetAsynchronous(vars.nOutputAsync);
+		}
+		if ((vars.nOutputDeflate != 0) || (vars.nOutputQuantizeBits != 0)) {
+			pOutmanRef->SetCompression(
+				vars.nOutputDeflate,
+				vars.nOutputQuantizeBits);
+		}
 
 		model.AttachOutputManager(pOutmanRef);
 		AnnounceEndBlock("Done");
@@ -428,12 +561,20 @@ void _TempestSetupOutputManagers(
 	// Set the composite output manager for the model
 	if (!vars.timeOutputRestartDeltaT.IsZero()) {
 		AnnounceStartBlock("Creating composite output manager");
-		model.AttachOutputManager(
+		OutputManagerComposite * pOutmanComposite =
 			new OutputManagerComposite(
 				*(model.GetGrid()),
 				vars.timeOutputRestartDeltaT,
 				vars.strOutputDir,
-				vars.strOutputPrefix));
+				vars.strOutputPrefix);
+
+		// Compress restart data on a background thread while stepping
+		if (vars.fOutputRestartCompress) {
+			pOutmanComposite->SetCompression();
+			pOutmanComposite->SetAsynchronous(1);
+		}
+
+		model.AttachOutputManager(pOutmanComposite);
 		AnnounceEndBlock("Done");
 	}
 
@@ -448,6 +589,49 @@ void _TempestSetupOutputManagers(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void _TempestSetupZonalAverage(
+	Model & model,
+	_TempestCommandLineVariables & vars
+) {
+	if (vars.strZonalVariables == "") {
+		return;
+	}
+
+	AnnounceStartBlock("Creating zonal average process");
+
+	// Sample every time step and write averages with the history output
+	// unless otherwise specified
+	Time timeSampleDeltaT = vars.timeZonalSampleDeltaT;
+	if (timeSampleDeltaT.IsZero()) {
+		timeSampleDeltaT = model.GetDeltaT();
+	}
+
+	Time timeOutputDeltaT = vars.timeZonalOutputDeltaT;
+	if (timeOutputDeltaT.IsZero()) {
+		timeOutputDeltaT = vars.timeOutputDeltaT;
+	}
+
+	int nLatitudes = vars.nZonalLatitudes;
+	if (nLatitudes == 0) {
+		nLatitudes = vars.nOutputResY;
+	}
+
+	model.AttachWorkflowProcess(
+		new ZonalAverageProcess(
+			model,
+			timeSampleDeltaT,
+			timeOutputDeltaT,
+			vars.strOutputDir,
+			vars.strOutputPrefix,
+			vars.strZonalVariables,
+			nLatitudes,
+			vars.fZonalVariance));
+
+	AnnounceEndBlock("Done");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void _TempestSetupCubedSphereModel(
 	Model & model,
 	_TempestCommandLineVariables & vars
@@ -456,6 +640,9 @@ void _TempestSetupCubedSphereModel(
 	model.SetDeltaT(vars.timeDeltaT);
 	model.SetEndTime(vars.timeEndTime);
 
+	// Set the memory report file
+	model.SetMemoryReportFile(vars.strMemoryReport);
+
 	// Setup Method of Lines
 	_TempestSetupMethodOfLines(model, vars);
 
@@ -499,8 +686,13 @@ void _TempestSetupCubedSphereModel(
 		int nCommSize;
 		MPI_Comm_size(MPI_COMM_WORLD, &nCommSize);
 
-		if (nCommSize < 6) {
-			nCommSize = 6;
+		int nPatchCount = nCommSize;
+#ifdef TEMPEST_TASKS
+		// Provide at least one patch per thread of the task runtime
+		nPatchCount *= GetMaxThreadCount();
+#endif
+		if (nPatchCount < 6) {
+			nPatchCount = 6;
 		}
 
 		GridCSGLL * pGrid = new GridCSGLL(model);
@@ -509,7 +701,7 @@ void _TempestSetupCubedSphereModel(
 
 		pGrid->SetParameters(
 			vars.nLevels,
-			nCommSize,
+			nPatchCount,
 			vars.nResolutionX,
 			4,
 			vars.nHorizontalOrder,
@@ -556,6 +748,9 @@ void _TempestSetupCubedSphereModel(
 
 	// Setup OutputManagers
 	_TempestSetupOutputManagers(model, vars);
+
+	// Setup in-situ zonal averages
+	_TempestSetupZonalAverage(model, vars);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -572,6 +767,9 @@ void _TempestSetupCartesianModel(
 	model.SetDeltaT(vars.timeDeltaT);
 	model.SetEndTime(vars.timeEndTime);
 
+	// Set the memory report file
+	model.SetMemoryReportFile(vars.strMemoryReport);
+
 	// Setup Method of Lines
 	_TempestSetupMethodOfLines(model, vars);
 
@@ -615,13 +813,19 @@ void _TempestSetupCartesianModel(
 		int nCommSize;
 		MPI_Comm_size(MPI_COMM_WORLD, &nCommSize);
 
+		int nPatchCount = nCommSize;
+#ifdef TEMPEST_TASKS
+		// Provide at least one patch per thread of the task runtime
+		nPatchCount *= GetMaxThreadCount();
+#endif
+
 		GridCartesianGLL * pGrid = new GridCartesianGLL(model);
 
 		pGrid->DefineParameters();
 
 		pGrid->SetParameters(
 			vars.nLevels,
-			nCommSize,
+			nPatchCount,
 			vars.nResolutionX,
 			vars.nResolutionY,
 			4,
@@ -671,6 +875,10 @@ void _TempestSetupCartesianModel(
 
 	// Setup OutputManagers
 	_TempestSetupOutputManagers(model, vars);
+
+	if (vars.strZonalVariables != "") {
+		Announce("WARNING: --zonal_vars not supported on Cartesian grids");
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -690,8 +898,24 @@ void TempestInitialize(int * argc, char*** argv) {
 	PetscInitialize(argc, argv, NULL, NULL);
 #endif
 #ifdef TEMPEST_MPIOMP
-	// Initialize MPI
-	MPI_Init(argc, argv);
+	// Initialize MPI (only the master thread makes MPI calls, but OpenMP
+	// threads and the asynchronous output thread may be active).  The
+	// provided level is checked when a threaded mode is requested.
+	int iThreadSupport;
+	MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &iThreadSupport);
+
+#ifdef TEMPEST_TASKS
+	// The task runtime always runs worker threads alongside MPI
+	if (iThreadSupport < MPI_THREAD_FUNNELED) {
+		int nRank;
+		MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+		if (nRank == 0) {
+			fprintf(stderr, "PARALLEL=MPITASK requires MPI_THREAD_FUNNELED, "
+				"which is not provided by this MPI implementation\n");
+		}
+		MPI_Abort(MPI_COMM_WORLD, 1);
+	}
+#endif
 #endif
 
 }
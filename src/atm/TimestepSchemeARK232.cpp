@@ -94,14 +94,12 @@ void TimestepSchemeARK232::Step(
 	SubcycleStageExplicit(time, m_dExpCf[0][0], dDeltaT, 2, 0, 1, 
 		pHorizontalDynamics, pVerticalDynamics, pGrid);
 /*
-	pGrid->CopyData(0, 1, DataType_State);
-	pGrid->CopyData(0, 1, DataType_Tracers);
+	pGrid->CopyData(0, 1, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(
 		0, 1, time, m_dExpCf[0][0] * dDeltaT);
 	pVerticalDynamics->StepExplicit(
 		0, 1, time, m_dExpCf[0][0] * dDeltaT);
-	pGrid->PostProcessSubstage(1, DataType_State);
-	pGrid->PostProcessSubstage(1, DataType_Tracers);
+	pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 */
 	// Compute ug1 into index 2 (NO IMPLICIT SOLVE NEEDED HERE)
 	SubcycleStageImplicitExplicitly(time, m_dImpCf[0][0], dDeltaT, 1, 1, 2, 
@@ -111,55 +109,46 @@ void TimestepSchemeARK232::Step(
 	pGrid->CopyData(1, 2, DataType_State);
 	pVerticalDynamics->StepImplicitTermsExplicitly(
 		1, 2, time, m_dImpCf[0][0] * dDeltaT);
-	pGrid->PostProcessSubstage(2, DataType_State);
-	pGrid->PostProcessSubstage(2, DataType_Tracers);
+	pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 */
 	// Compute u1 into index 3
 	pGrid->CopyData(2, 3, DataType_State);
 	pGrid->CopyData(2, 3, DataType_State);
 	pVerticalDynamics->StepImplicit(
 		3, 3, time, m_dImpCf[0][1] * dDeltaT);
-	pGrid->PostProcessSubstage(3, DataType_State);
-	pGrid->PostProcessSubstage(3, DataType_Tracers);
+	pGrid->PostProcessSubstage(3, {DataType_State, DataType_Tracers});
 
 	// STAGE 2
 	// Compute uf2 from u1 (index 2) into index 6
-	pGrid->LinearCombineData(m_du2fCombo, 6, DataType_State);
-	pGrid->LinearCombineData(m_du2fCombo, 6, DataType_Tracers);
-	pGrid->CopyData(6, 4, DataType_State);
-	pGrid->CopyData(6, 4, DataType_Tracers);
+	pGrid->StageUpdateData(
+		m_du2fCombo, 6, 4, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(
 		3, 4, time, m_dExpCf[1][1] * dDeltaT);
 	pVerticalDynamics->StepExplicit(
 		3, 4, time, m_dExpCf[1][1] * dDeltaT);
-	pGrid->PostProcessSubstage(4, DataType_State);
-	pGrid->PostProcessSubstage(4, DataType_Tracers);
+	pGrid->PostProcessSubstage(4, {DataType_State, DataType_Tracers});
 
 	// Compute u2 from uf2 (index 3) into index 4
 	pGrid->CopyData(4, 5, DataType_State);
 	pGrid->CopyData(4, 5, DataType_State);
 	pVerticalDynamics->StepImplicit(
 		5, 5, time, m_dImpCf[1][2] * dDeltaT);
-	pGrid->PostProcessSubstage(5, DataType_State);
-	pGrid->PostProcessSubstage(5, DataType_Tracers);
+	pGrid->PostProcessSubstage(5, {DataType_State, DataType_Tracers});
 
 	// STAGE 3
 	// Compute uf3 from u2 (index 4) into index 8
-	pGrid->LinearCombineData(m_du3fCombo, 7, DataType_State);
-	pGrid->LinearCombineData(m_du3fCombo, 7, DataType_Tracers);
+	pGrid->LinearCombineData(
+		m_du3fCombo, 7, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(
 		5, 7, time, m_dExpCf[2][2] * dDeltaT);
 	pVerticalDynamics->StepExplicit(
 		5, 7, time, m_dExpCf[2][2] * dDeltaT);
-	pGrid->PostProcessSubstage(7, DataType_State);
-	pGrid->PostProcessSubstage(7, DataType_Tracers);
+	pGrid->PostProcessSubstage(7, {DataType_State, DataType_Tracers});
 
 	// Apply hyperdiffusion at the end of the explicit substep (ask Paul)
-	pGrid->CopyData(7, 2, DataType_State);
-	pGrid->CopyData(7, 2, DataType_Tracers);
+	pGrid->CopyData(7, 2, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepAfterSubCycle(7, 1, 3, time, dDeltaT);
-	pGrid->CopyData(1, 0, DataType_State);
-	pGrid->CopyData(1, 0, DataType_Tracers);
+	pGrid->CopyData(1, 0, {DataType_State, DataType_Tracers});
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -176,20 +165,17 @@ void TimestepSchemeARK232::SubcycleStageExplicit(
 	Grid * pGrid
 ) {
 	for (int n = 0; n < iNS; n++) {
-		pGrid->CopyData(iinpIndex, ioutIndex, DataType_State);
-		pGrid->CopyData(iinpIndex, ioutIndex, DataType_Tracers);
+		pGrid->CopyData(iinpIndex, ioutIndex, {DataType_State, DataType_Tracers});
 
 		pHorizontalDynamics->StepExplicit(
 			iinpIndex, ioutIndex, time, dStageCoeff * dDeltaT / iNS);
 		pVerticalDynamics->StepExplicit(
 			iinpIndex, ioutIndex, time, dStageCoeff * dDeltaT / iNS);
 
-		pGrid->PostProcessSubstage(ioutIndex, DataType_State);
-		pGrid->PostProcessSubstage(ioutIndex, DataType_Tracers);
+		pGrid->PostProcessSubstage(ioutIndex, {DataType_State, DataType_Tracers});
 
 		if (n < iNS - 1) {
-			pGrid->CopyData(ioutIndex, iinpIndex, DataType_State);
-			pGrid->CopyData(ioutIndex, iinpIndex, DataType_Tracers);
+			pGrid->CopyData(ioutIndex, iinpIndex, {DataType_State, DataType_Tracers});
 		}
 	}
 }
@@ -208,18 +194,15 @@ void TimestepSchemeARK232::SubcycleStageImplicitExplicitly(
 	Grid * pGrid
 ) {
 	for (int n = 0; n < iNS; n++) {
-		pGrid->CopyData(iinpIndex, ioutIndex, DataType_State);
-		pGrid->CopyData(iinpIndex, ioutIndex, DataType_Tracers);
+		pGrid->CopyData(iinpIndex, ioutIndex, {DataType_State, DataType_Tracers});
 
 		pVerticalDynamics->StepImplicitTermsExplicitly(
 			iinpIndex, ioutIndex, time, dStageCoeff * dDeltaT / iNS);
 
-		pGrid->PostProcessSubstage(ioutIndex, DataType_State);
-		pGrid->PostProcessSubstage(ioutIndex, DataType_Tracers);
+		pGrid->PostProcessSubstage(ioutIndex, {DataType_State, DataType_Tracers});
 
 		if (n < iNS - 1) {
-			pGrid->CopyData(ioutIndex, iinpIndex, DataType_State);
-			pGrid->CopyData(ioutIndex, iinpIndex, DataType_Tracers);
+			pGrid->CopyData(ioutIndex, iinpIndex, {DataType_State, DataType_Tracers});
 		}
 	}
 }
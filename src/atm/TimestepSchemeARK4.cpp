@@ -282,8 +282,7 @@ void TimestepSchemeARK4::Step(
     pGrid->CopyData(0, 1, DataType_State);
     pHorizontalDynamics->StepImplicit(0, 1, timeSub0, dtSub0);
 	pVerticalDynamics->StepImplicit(0, 1, timeSub0, dtSub0);
-    pGrid->PostProcessSubstage(1, DataType_State);
-    pGrid->PostProcessSubstage(1, DataType_Tracers);
+    pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
     // Store the evaluation K1 to index 3
     pGrid->LinearCombineData(m_dK0Combo, 3, DataType_State);
@@ -295,8 +294,7 @@ void TimestepSchemeARK4::Step(
     pGrid->LinearCombineData(m_du1fCombo, 1, DataType_State);
     pHorizontalDynamics->StepExplicit(0, 1, timeSub1, dtSub1);
 	pVerticalDynamics->StepExplicit(0, 1, timeSub1, dtSub1);
-    pGrid->PostProcessSubstage(1, DataType_State);
-    pGrid->PostProcessSubstage(1, DataType_Tracers);
+    pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
     // Store the evaluation Kh1 to index 4
     pGrid->LinearCombineData(m_dKh1Combo, 4, DataType_State);
@@ -305,8 +303,7 @@ void TimestepSchemeARK4::Step(
     pGrid->CopyData(1, 2, DataType_State);
     dtSub1 = m_dImpCf[1][1] * dDeltaT;
     pVerticalDynamics->StepImplicit(1, 2, timeSub1, dtSub1);
-    pGrid->PostProcessSubstage(2, DataType_State);
-    pGrid->PostProcessSubstage(2, DataType_Tracers);
+    pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
     // Store the evaluation K1 to index 3
     pGrid->LinearCombineData(m_dK1Combo, 5, DataType_State);
@@ -320,8 +317,7 @@ void TimestepSchemeARK4::Step(
     pGrid->LinearCombineData(m_du2fCombo, 1, DataType_State);
     pHorizontalDynamics->StepExplicit(2, 1, timeSub2, dtSub2);
     pVerticalDynamics->StepExplicit(2, 1, timeSub2, dtSub2);
-    pGrid->PostProcessSubstage(1, DataType_State);
-    pGrid->PostProcessSubstage(1, DataType_Tracers);
+    pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
     // Store the evaluation Kh2 to index 6
     pGrid->LinearCombineData(m_dKh2Combo, 6, DataType_State);
@@ -330,8 +326,7 @@ void TimestepSchemeARK4::Step(
     dtSub2 = m_dImpCf[2][2] * dDeltaT;
     pGrid->CopyData(1, 2, DataType_State);
     pVerticalDynamics->StepImplicit(1, 2, timeSub2, dtSub2);
-    pGrid->PostProcessSubstage(2, DataType_State);
-    pGrid->PostProcessSubstage(2, DataType_Tracers);
+    pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
     // Store the evaluation K2 to index 7
     pGrid->LinearCombineData(m_dK2Combo, 7, DataType_State);
@@ -345,8 +340,7 @@ void TimestepSchemeARK4::Step(
     pGrid->LinearCombineData(m_du3fCombo, 1, DataType_State);
     pHorizontalDynamics->StepExplicit(2, 1, timeSub2, dtSub2);
     pVerticalDynamics->StepExplicit(2, 1, timeSub2, dtSub2);
-    pGrid->PostProcessSubstage(1, DataType_State);
-    pGrid->PostProcessSubstage(1, DataType_Tracers);
+    pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
     // Store the evaluation Kh3 to index 8
     pGrid->LinearCombineData(m_dKh3Combo, 8, DataType_State);
@@ -355,8 +349,7 @@ void TimestepSchemeARK4::Step(
     dtSub3 = m_dImpCf[3][3] * dDeltaT;
     pGrid->CopyData(1, 2, DataType_State);
     pVerticalDynamics->StepImplicit(1, 2, timeSub3, dtSub3);
-    pGrid->PostProcessSubstage(2, DataType_State);
-    pGrid->PostProcessSubstage(2, DataType_Tracers);
+    pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
     // Store the evaluation K3 to index 9
     pGrid->LinearCombineData(m_dK3Combo, 9, DataType_State);
@@ -370,8 +363,7 @@ void TimestepSchemeARK4::Step(
     pGrid->LinearCombineData(m_du4fCombo, 1, DataType_State);
     pHorizontalDynamics->StepExplicit(2, 1, timeSub4, dtSub4);
     pVerticalDynamics->StepExplicit(2, 1, timeSub4, dtSub4);
-    pGrid->PostProcessSubstage(1, DataType_State);
-    pGrid->PostProcessSubstage(1, DataType_Tracers);
+    pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
 	// Store the evaluation Kh4 to index 10
     pGrid->LinearCombineData(m_dKh4Combo, 10, DataType_State);
@@ -382,8 +374,7 @@ void TimestepSchemeARK4::Step(
 	// Start with the previous data sum here because of the explicit zero
 	pGrid->LinearCombineData(m_du4fCombo, 2, DataType_State);
     pVerticalDynamics->StepImplicit(2, 2, timeSub4, dtSub4);
-    pGrid->PostProcessSubstage(2, DataType_State);
-    pGrid->PostProcessSubstage(2, DataType_Tracers);
+    pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
 	// Store the evaluation K4 to index 11
     pGrid->LinearCombineData(m_dK4Combo, 11, DataType_State);
@@ -397,8 +388,7 @@ void TimestepSchemeARK4::Step(
     pGrid->LinearCombineData(m_du5fCombo, 1, DataType_State);
     pHorizontalDynamics->StepExplicit(2, 1, timeSub5, dtSub5);
     pVerticalDynamics->StepExplicit(2, 1, timeSub5, dtSub5);
-    pGrid->PostProcessSubstage(1, DataType_State);
-    pGrid->PostProcessSubstage(1, DataType_Tracers);
+    pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
 	// Store the evaluation Kh5 to index 12
     pGrid->LinearCombineData(m_dKh5Combo, 12, DataType_State);
@@ -407,8 +397,7 @@ void TimestepSchemeARK4::Step(
     dtSub5 = m_dImpCf[5][5] * dDeltaT;
     pGrid->CopyData(1, 2, DataType_State);
     pVerticalDynamics->StepImplicit(1, 2, timeSub5, dtSub5);
-    pGrid->PostProcessSubstage(2, DataType_State);
-    pGrid->PostProcessSubstage(2, DataType_Tracers);
+    pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
 	// Store the evaluation K5 to index 13
     pGrid->LinearCombineData(m_dK5Combo, 13, DataType_State);
@@ -422,15 +411,13 @@ void TimestepSchemeARK4::Step(
     pGrid->LinearCombineData(m_du6fCombo, 1, DataType_State);
     pHorizontalDynamics->StepExplicit(2, 1, timeSub6, dtSub6);
     pVerticalDynamics->StepExplicit(2, 1, timeSub6, dtSub6);
-    pGrid->PostProcessSubstage(1, DataType_State);
-    pGrid->PostProcessSubstage(1, DataType_Tracers);
+    pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
     // Compute u5 from uf5 and store it to index 2 (over u4)
     dtSub5 = m_dImpCf[6][6] * dDeltaT;
     pGrid->CopyData(1, 2, DataType_State);
     pVerticalDynamics->StepImplicit(1, 2, timeSub6, dtSub6);
-    pGrid->PostProcessSubstage(2, DataType_State);
-    pGrid->PostProcessSubstage(2, DataType_Tracers);
+    pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
     // Apply hyperdiffusion at the end of the explicit substep (ask Paul)
 	pGrid->CopyData(2, 1, DataType_State);
@@ -455,8 +455,7 @@ static int ARKodePostProcessStep(
   pVerticalDynamicsFEM->FilterNegativeTracers(iY);
   
   // Perform DSS (average values at shared nodes)
-  pGrid->PostProcessSubstage(iY, DataType_State);
-  pGrid->PostProcessSubstage(iY, DataType_Tracers);
+  pGrid->PostProcessSubstage(iY, {DataType_State, DataType_Tracers});
 
   // Get last time step size <<< NEED TO ADJUST STEP SIZE WITH ADAPTIVE STEPPING
   Time timeT     = pModel->GetCurrentTime();  // model still has old time
@@ -464,13 +463,11 @@ static int ARKodePostProcessStep(
   double dDeltaT = time - dOldT;
    
   // Apply hyperdiffusion (initial, update, temp)
-  pGrid->CopyData(iY, 2, DataType_State);
-  pGrid->CopyData(iY, 2, DataType_Tracers);
+  pGrid->CopyData(iY, 2, {DataType_State, DataType_Tracers});
   
   pHorizontalDynamicsFEM->StepAfterSubCycle(2, 1, iY, timeT, dDeltaT);
   
-  pGrid->CopyData(1, iY, DataType_State);
-  pGrid->CopyData(1, iY, DataType_Tracers);
+  pGrid->CopyData(1, iY, {DataType_State, DataType_Tracers});
 
 #ifdef DEBUG_OUTPUT
   AnnounceEndBlock("Done");
@@ -521,8 +518,7 @@ static int ARKodeExplicitRHS(
 
 #ifdef DSS_INPUT
   // Perform DSS (average values at shared nodes)
-  pGrid->PostProcessSubstage(iY, DataType_State);
-  pGrid->PostProcessSubstage(iY, DataType_Tracers);
+  pGrid->PostProcessSubstage(iY, {DataType_State, DataType_Tracers});
 #endif
 
   // zero out iYdot
@@ -535,8 +531,7 @@ static int ARKodeExplicitRHS(
 
 #ifdef DSS_OUTPUT
   // Perform DSS on RHS (average values at shared nodes)
-  pGrid->PostProcessSubstage(iYdot, DataType_State);
-  pGrid->PostProcessSubstage(iYdot, DataType_Tracers);
+  pGrid->PostProcessSubstage(iYdot, {DataType_State, DataType_Tracers});
 #endif
 
 #ifdef DEBUG_OUTPUT
@@ -590,8 +585,7 @@ static int ARKodeImplicitRHS(
 
 #ifdef DSS_INPUT
   // Perform DSS (average values at shared nodes)
-  pGrid->PostProcessSubstage(iY, DataType_State);
-  pGrid->PostProcessSubstage(iY, DataType_Tracers);
+  pGrid->PostProcessSubstage(iY, {DataType_State, DataType_Tracers});
 #endif
 
   // zero out iYdot
@@ -603,8 +597,7 @@ static int ARKodeImplicitRHS(
 
 #ifdef DSS_OUTPUT
   // Perform DSS on RHS (average values at shared nodes)
-  pGrid->PostProcessSubstage(iYdot, DataType_State);
-  pGrid->PostProcessSubstage(iYdot, DataType_Tracers);
+  pGrid->PostProcessSubstage(iYdot, {DataType_State, DataType_Tracers});
 #endif
 
 
@@ -674,8 +667,7 @@ static int ARKodeFullRHS(
 
 #ifdef DSS_INPUT
   // Perform DSS (average values at shared nodes)
-  pGrid->PostProcessSubstage(iY, DataType_State);
-  pGrid->PostProcessSubstage(iY, DataType_Tracers);
+  pGrid->PostProcessSubstage(iY, {DataType_State, DataType_Tracers});
 #endif
     
   // zero out iYdot
@@ -688,8 +680,7 @@ static int ARKodeFullRHS(
 
 #ifdef DSS_OUTPUT
   // Perform DSS on RHS (average values at shared nodes)
-  pGrid->PostProcessSubstage(iYdot, DataType_State);
-  pGrid->PostProcessSubstage(iYdot, DataType_Tracers);
+  pGrid->PostProcessSubstage(iYdot, {DataType_State, DataType_Tracers});
 #endif
 
 #ifdef DEBUG_OUTPUT
@@ -86,54 +86,44 @@ void TimestepSchemeARS232::Step(
 
 	// STAGE 1
 	// Compute uf1 into index 1
-	pGrid->CopyData(0, 1, DataType_State);
-	pGrid->CopyData(0, 1, DataType_Tracers);
+	pGrid->CopyData(0, 1, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(
 		0, 1, time, m_dExpCf[0][0] * dDeltaT);
 	pVerticalDynamics->StepExplicit(
 		0, 1, time, m_dExpCf[0][0] * dDeltaT);
-	pGrid->PostProcessSubstage(1, DataType_State);
-	pGrid->PostProcessSubstage(1, DataType_Tracers);
+	pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
 	// Compute u1 into index 2
-	pGrid->CopyData(1, 2, DataType_State);
-	pGrid->CopyData(1, 2, DataType_Tracers);
+	pGrid->CopyData(1, 2, {DataType_State, DataType_Tracers});
 	pVerticalDynamics->StepImplicit(
 		2, 2, time, m_dImpCf[0][0] * dDeltaT);
-	pGrid->PostProcessSubstage(2, DataType_State);
-	pGrid->PostProcessSubstage(2, DataType_Tracers);
+	pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
 	// STAGE 2
 	// Compute uf2 from u1 (index 2) into index 5
-	pGrid->LinearCombineData(m_du2fCombo, 5, DataType_State);
-	pGrid->LinearCombineData(m_du2fCombo, 5, DataType_Tracers);
-	pGrid->CopyData(5, 3, DataType_State);
-	pGrid->CopyData(5, 3, DataType_Tracers);
+	pGrid->StageUpdateData(
+		m_du2fCombo, 5, 3, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(
 		2, 3, time, m_dExpCf[1][1] * dDeltaT);
 	pVerticalDynamics->StepExplicit(
 		2, 3, time, m_dExpCf[1][1] * dDeltaT);
-	pGrid->PostProcessSubstage(3, DataType_State);
-	pGrid->PostProcessSubstage(3, DataType_Tracers);
+	pGrid->PostProcessSubstage(3, {DataType_State, DataType_Tracers});
 
 	// Compute u2 from uf2 (index 3) into index 4
-	pGrid->CopyData(3, 4, DataType_State);
-	pGrid->CopyData(3, 4, DataType_Tracers);
+	pGrid->CopyData(3, 4, {DataType_State, DataType_Tracers});
 	pVerticalDynamics->StepImplicit(
 		4, 4, time, m_dImpCf[1][1] * dDeltaT);
-	pGrid->PostProcessSubstage(4, DataType_State);
-	pGrid->PostProcessSubstage(4, DataType_Tracers);
+	pGrid->PostProcessSubstage(4, {DataType_State, DataType_Tracers});
 
 	// STAGE 3
 	// Compute uf3 from u2 (index 4) into index 6
-	pGrid->LinearCombineData(m_du3fCombo, 6, DataType_State);
-	pGrid->LinearCombineData(m_du3fCombo, 6, DataType_Tracers);
+	pGrid->LinearCombineData(
+		m_du3fCombo, 6, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(
 		4, 6, time, m_dExpCf[2][2] * dDeltaT);
 	pVerticalDynamics->StepExplicit(
 		4, 6, time, m_dExpCf[2][2] * dDeltaT);
-	pGrid->PostProcessSubstage(6, DataType_State);
-	pGrid->PostProcessSubstage(6, DataType_Tracers);
+	pGrid->PostProcessSubstage(6, {DataType_State, DataType_Tracers});
 
 	// Compute u3 from uf3 (index 3) into index 6
 	//pVerticalDynamics->StepImplicit(
@@ -142,11 +132,9 @@ void TimestepSchemeARS232::Step(
 	//pGrid->PostProcessSubstage(6, DataType_Tracers);
 
 	// Apply hyperdiffusion at the end of the explicit substep (ask Paul)
-	pGrid->CopyData(6, 2, DataType_State);
-	pGrid->CopyData(6, 2, DataType_Tracers);
+	pGrid->CopyData(6, 2, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepAfterSubCycle(2, 1, 6, time, dDeltaT);
-	pGrid->CopyData(1, 0, DataType_State);
-	pGrid->CopyData(1, 0, DataType_Tracers);
+	pGrid->CopyData(1, 0, {DataType_State, DataType_Tracers});
 }
 
 ///////////////////////////////////////////////////////////////////////////////
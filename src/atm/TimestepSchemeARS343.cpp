@@ -132,84 +132,67 @@ void TimestepSchemeARS343::Step(
 
 	// STAGE 1
 	// Compute uf1 into index 1
-	pGrid->CopyData(0, 1, DataType_State);
-	pGrid->CopyData(0, 1, DataType_Tracers);
+	pGrid->CopyData(0, 1, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(
 		0, 1, time, m_dExpCf[0][0] * dDeltaT);
 	pVerticalDynamics->StepExplicit(
 		0, 1, time, m_dExpCf[0][0] * dDeltaT);
-	pGrid->PostProcessSubstage(1, DataType_State);
-	pGrid->PostProcessSubstage(1, DataType_Tracers);
+	pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
 	// Compute u1 into index 2
-	pGrid->CopyData(1, 2, DataType_State);
-	pGrid->CopyData(1, 2, DataType_Tracers);
+	pGrid->CopyData(1, 2, {DataType_State, DataType_Tracers});
 	pVerticalDynamics->StepImplicit(
 		2, 2, time, m_dImpCf[0][0] * dDeltaT);
-	pGrid->PostProcessSubstage(2, DataType_State);
-	pGrid->PostProcessSubstage(2, DataType_Tracers);
+	pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
 	// STAGE 2
 	// Compute uf2 from u1 (index 2) into index 7
-	pGrid->LinearCombineData(m_du2fCombo, 7, DataType_State);
-	pGrid->LinearCombineData(m_du2fCombo, 7, DataType_Tracers);
-	pGrid->CopyData(7, 3, DataType_State);
-	pGrid->CopyData(7, 3, DataType_Tracers);
+	pGrid->StageUpdateData(
+		m_du2fCombo, 7, 3, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(
 		2, 3, time, m_dExpCf[1][1] * dDeltaT);
 	pVerticalDynamics->StepExplicit(
 		2, 3, time, m_dExpCf[1][1] * dDeltaT);
-	pGrid->PostProcessSubstage(3, DataType_State);
-	pGrid->PostProcessSubstage(3, DataType_Tracers);
+	pGrid->PostProcessSubstage(3, {DataType_State, DataType_Tracers});
 
 	// Compute u2 from uf2 (index 3) into index 4
-	pGrid->CopyData(3, 4, DataType_State);
-	pGrid->CopyData(3, 4, DataType_Tracers);
+	pGrid->CopyData(3, 4, {DataType_State, DataType_Tracers});
 	pVerticalDynamics->StepImplicit(
 		4, 4, time, m_dImpCf[1][1] * dDeltaT);
-	pGrid->PostProcessSubstage(4, DataType_State);
-	pGrid->PostProcessSubstage(4, DataType_Tracers);
+	pGrid->PostProcessSubstage(4, {DataType_State, DataType_Tracers});
 
 	// STAGE 3
 	// Compute uf3 from u2 (index 4) into index 8
-	pGrid->LinearCombineData(m_du3fCombo, 8, DataType_State);
-	pGrid->LinearCombineData(m_du3fCombo, 8, DataType_Tracers);
-	pGrid->CopyData(8, 5, DataType_State);
-	pGrid->CopyData(8, 5, DataType_Tracers);
+	pGrid->StageUpdateData(
+		m_du3fCombo, 8, 5, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(
 		4, 5, time, m_dExpCf[2][2] * dDeltaT);
 	pVerticalDynamics->StepExplicit(
 		4, 5, time, m_dExpCf[2][2] * dDeltaT);
-	pGrid->PostProcessSubstage(5, DataType_State);
-	pGrid->PostProcessSubstage(5, DataType_Tracers);
+	pGrid->PostProcessSubstage(5, {DataType_State, DataType_Tracers});
 
 	// Compute u3 from uf3 (index 3) into index 6
-	pGrid->CopyData(5, 6, DataType_State);
-	pGrid->CopyData(5, 6, DataType_Tracers);
+	pGrid->CopyData(5, 6, {DataType_State, DataType_Tracers});
 	pVerticalDynamics->StepImplicit(
 		6, 6, time, m_dImpCf[2][2] * dDeltaT);
-	pGrid->PostProcessSubstage(6, DataType_State);
-	pGrid->PostProcessSubstage(6, DataType_Tracers);
+	pGrid->PostProcessSubstage(6, {DataType_State, DataType_Tracers});
 
 	// STAGE 4
 	// Compute uf4 from u3 (index 6) into index 9
-	pGrid->LinearCombineData(m_du4fCombo, 9, DataType_State);
-	pGrid->LinearCombineData(m_du4fCombo, 9, DataType_Tracers);
+	pGrid->LinearCombineData(
+		m_du4fCombo, 9, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(
 		6, 9, time, m_dExpCf[3][3] * dDeltaT);
 	pVerticalDynamics->StepExplicit(
 		6, 9, time, m_dExpCf[3][3] * dDeltaT);
-	pGrid->PostProcessSubstage(9, DataType_State);
-	pGrid->PostProcessSubstage(9, DataType_Tracers);
+	pGrid->PostProcessSubstage(9, {DataType_State, DataType_Tracers});
 
 	// NO IMPLICIT STEP ON THE LAST STAGE
 
 	// Apply hyperdiffusion at the end of the explicit substep (ask Paul)
-	pGrid->CopyData(9, 2, DataType_State);
-	pGrid->CopyData(9, 2, DataType_Tracers);
+	pGrid->CopyData(9, 2, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepAfterSubCycle(2, 1, 9, time, dDeltaT);
-	pGrid->CopyData(1, 0, DataType_State);
-	pGrid->CopyData(1, 0, DataType_Tracers);
+	pGrid->CopyData(1, 0, {DataType_State, DataType_Tracers});
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -92,50 +92,43 @@ void TimestepSchemeGARK2::Step(
 
 	// STAGE 1
 	// Compute uf1 into index 1
-	pGrid->CopyData(0, 1, DataType_State);
-	pGrid->CopyData(0, 1, DataType_Tracers);
+	pGrid->CopyData(0, 1, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(
 		0, 1, time, m_dIECf[0][0] * dDeltaT);
 	pVerticalDynamics->StepExplicit(
 		0, 1, time, m_dIECf[0][0] * dDeltaT);
-	pGrid->PostProcessSubstage(1, DataType_State);
-	pGrid->PostProcessSubstage(1, DataType_Tracers);
+	pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
 	// Compute u1 into index 2
 	pGrid->CopyData(1, 2, DataType_State);
 	pGrid->CopyData(1, 2, DataType_State);
 	pVerticalDynamics->StepImplicit(
 		2, 2, time, m_dImpCf[0][0] * dDeltaT);
-	pGrid->PostProcessSubstage(2, DataType_State);
-	pGrid->PostProcessSubstage(2, DataType_Tracers);
+	pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
 	// Compute uf2 from u1 (index 2) into index 3
-	pGrid->LinearCombineData(m_du2fCombo, 3, DataType_State);
-	pGrid->LinearCombineData(m_du2fCombo, 3, DataType_Tracers);
+	pGrid->LinearCombineData(
+		m_du2fCombo, 3, {DataType_State, DataType_Tracers});
 
 	// STAGE 2
 	// Compute uf2 from u1 (index 2) into index 3
-	pGrid->LinearCombineData(m_du3fCombo, 4, DataType_State);
-	pGrid->LinearCombineData(m_du3fCombo, 4, DataType_Tracers);
+	pGrid->LinearCombineData(
+		m_du3fCombo, 4, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(
 		3, 4, time, m_dIECf[1][1] * dDeltaT);
 	pVerticalDynamics->StepExplicit(
 		3, 4, time, m_dIECf[1][1] * dDeltaT);
-	pGrid->PostProcessSubstage(4, DataType_State);
-	pGrid->PostProcessSubstage(4, DataType_Tracers);
+	pGrid->PostProcessSubstage(4, {DataType_State, DataType_Tracers});
 
 	// Compute u2 from uf2 (index 3) into index 2
 	pVerticalDynamics->StepImplicit(
 		4, 4, time, m_dImpCf[1][1] * dDeltaT);
-	pGrid->PostProcessSubstage(4, DataType_State);
-	pGrid->PostProcessSubstage(4, DataType_Tracers);
+	pGrid->PostProcessSubstage(4, {DataType_State, DataType_Tracers});
 
 	// Apply hyperdiffusion at the end of the explicit substep (ask Paul)
-	pGrid->CopyData(4, 2, DataType_State);
-	pGrid->CopyData(4, 2, DataType_Tracers);
+	pGrid->CopyData(4, 2, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepAfterSubCycle(2, 1, 4, time, dDeltaT);
-	pGrid->CopyData(1, 0, DataType_State);
-	pGrid->CopyData(1, 0, DataType_Tracers);
+	pGrid->CopyData(1, 0, {DataType_State, DataType_Tracers});
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,473 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    TimestepSchemeIMEX.cpp
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "TimestepSchemeIMEX.h"
+#include "Model.h"
+#include "Grid.h"
+#include "HorizontalDynamics.h"
+#include "VerticalDynamics.h"
+#include "Announce.h"
+
+#include <cmath>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Terms of a linear combination of data instances.
+///	</summary>
+typedef std::vector< std::pair<int, double> > CombinationTerms;
+
+///////////////////////////////////////////////////////////////////////////////
+
+TimestepSchemeIMEX::TimestepSchemeIMEX(
+	Model & model,
+	Tableau eTableau
+) :
+	TimestepScheme(model),
+	m_nInstances(0)
+{
+	// ARS(2,2,2) from Ascher et al. 1997 pg. 9
+	if (eTableau == ARS222) {
+		const double dGamma = 1.0 - 0.5 * std::sqrt(2.0);
+		const double dDelta = 1.0 - 1.0 / (2.0 * dGamma);
+
+		m_dExpCf.Allocate(2, 2);
+		m_dExpCf[0][0] = dGamma;
+		m_dExpCf[1][0] = dDelta;
+		m_dExpCf[1][1] = 1.0 - dDelta;
+
+		m_dImpCf.Allocate(2, 2);
+		m_dImpCf[0][0] = dGamma;
+		m_dImpCf[1][0] = 1.0 - dGamma;
+		m_dImpCf[1][1] = dGamma;
+
+	// ARS(2,3,2) from Ascher et al. 1997 section 2.5
+	} else if (eTableau == ARS232) {
+		const double dGamma = 1.0 - 1.0 / std::sqrt(2.0);
+		const double dDelta = -(2.0 * std::sqrt(2.0)) / 3.0;
+
+		m_dExpCf.Allocate(3, 3);
+		m_dExpCf[0][0] = dGamma;
+		m_dExpCf[1][0] = dDelta;
+		m_dExpCf[1][1] = 1.0 - dDelta;
+		m_dExpCf[2][1] = 1.0 - dGamma;
+		m_dExpCf[2][2] = dGamma;
+
+		m_dImpCf.Allocate(3, 3);
+		m_dImpCf[0][0] = dGamma;
+		m_dImpCf[1][0] = 1.0 - dGamma;
+		m_dImpCf[1][1] = dGamma;
+		m_dImpCf[2][0] = 1.0 - dGamma;
+		m_dImpCf[2][1] = dGamma;
+
+	// ARS(3,4,3) from Ascher et al. 1997 pg. 9
+	} else if (eTableau == ARS343) {
+		const double dGamma = 0.4358665215084590;
+		const double dB1 = -1.5 * dGamma * dGamma + 4.0 * dGamma - 0.25;
+		const double dB2 =  1.5 * dGamma * dGamma - 5.0 * dGamma + 1.2;
+
+		m_dExpCf.Allocate(4, 4);
+		m_dExpCf[0][0] = dGamma;
+		m_dExpCf[1][0] = 0.3212788860286278;
+		m_dExpCf[1][1] = 0.3966543747256017;
+		m_dExpCf[2][0] = -0.1058582960718797;
+		m_dExpCf[2][1] = 0.5529291480359398;
+		m_dExpCf[2][2] = 0.5529291480359398;
+		m_dExpCf[3][1] = 1.208496649176010;
+		m_dExpCf[3][2] = -0.6443631706844690;
+		m_dExpCf[3][3] = dGamma;
+
+		m_dImpCf.Allocate(4, 4);
+		m_dImpCf[0][0] = dGamma;
+		m_dImpCf[1][0] = 0.5 * (1.0 - dGamma);
+		m_dImpCf[1][1] = dGamma;
+		m_dImpCf[2][0] = dB1;
+		m_dImpCf[2][1] = dB2;
+		m_dImpCf[2][2] = dGamma;
+		m_dImpCf[3][0] = 1.208496649176010;
+		m_dImpCf[3][1] = -0.6443631706844690;
+		m_dImpCf[3][2] = dGamma;
+
+	// ARS(4,4,3) from Ascher et al. 1997 pg. 9
+	} else if (eTableau == ARS443) {
+		m_dExpCf.Allocate(4, 4);
+		m_dExpCf[0][0] = 1.0/2.0;
+		m_dExpCf[1][0] = 11.0/18.0;
+		m_dExpCf[1][1] = 1.0/18.0;
+		m_dExpCf[2][0] = 5.0/6.0;
+		m_dExpCf[2][1] = -5.0/6.0;
+		m_dExpCf[2][2] = 1.0/2.0;
+		m_dExpCf[3][0] = 1.0/4.0;
+		m_dExpCf[3][1] = 7.0/4.0;
+		m_dExpCf[3][2] = 3.0/4.0;
+		m_dExpCf[3][3] = -7.0/4.0;
+
+		m_dImpCf.Allocate(4, 4);
+		m_dImpCf[0][0] = 1.0/2.0;
+		m_dImpCf[1][0] = 1.0/6.0;
+		m_dImpCf[1][1] = 1.0/2.0;
+		m_dImpCf[2][0] = -1.0/2.0;
+		m_dImpCf[2][1] = 1.0/2.0;
+		m_dImpCf[2][2] = 1.0/2.0;
+		m_dImpCf[3][0] = 3.0/2.0;
+		m_dImpCf[3][1] = -3.0/2.0;
+		m_dImpCf[3][2] = 1.0/2.0;
+		m_dImpCf[3][3] = 1.0/2.0;
+
+	} else {
+		_EXCEPTIONT("Invalid IMEX tableau");
+	}
+
+	BuildPlan();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+TimestepSchemeIMEX::TimestepSchemeIMEX(
+	Model & model,
+	const DataArray2D<double> & dExpCf,
+	const DataArray2D<double> & dImpCf
+) :
+	TimestepScheme(model),
+	m_dExpCf(dExpCf),
+	m_dImpCf(dImpCf),
+	m_nInstances(0)
+{
+	BuildPlan();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TimestepSchemeIMEX::BuildPlan() {
+
+	const int nRows = m_dExpCf.GetRows();
+
+	if ((nRows < 1) ||
+	    (m_dExpCf.GetColumns() != nRows) ||
+	    (m_dImpCf.GetRows() != nRows) ||
+	    (m_dImpCf.GetColumns() != nRows)
+	) {
+		_EXCEPTIONT("IMEX tableaux must be square and of the same size");
+	}
+
+	// Determine which tendencies of each stage are used by later rows
+	std::vector<bool> fNeedExp(nRows, false);
+	std::vector<bool> fNeedImp(nRows, false);
+
+	for (int r = 0; r < nRows; r++) {
+		for (int q = 0; q < nRows; q++) {
+			if (q < r) {
+				if ((m_dExpCf[q][r] != 0.0) || (m_dImpCf[q][r] != 0.0)) {
+					_EXCEPTIONT("IMEX tableaux must be lower triangular");
+				}
+			}
+			if (q > r) {
+				if (m_dExpCf[q][r] != 0.0) {
+					fNeedExp[r] = true;
+				}
+				if (m_dImpCf[q][r] != 0.0) {
+					fNeedImp[r] = true;
+				}
+			}
+		}
+
+		// Tendencies are recovered from the change they produced, so
+		// they must have been applied in their own stage
+		if ((fNeedExp[r]) && (m_dExpCf[r][r] == 0.0)) {
+			_EXCEPTION1("Explicit tendency of stage %i is not evaluated "
+				"but is required by a later stage", r);
+		}
+		if ((fNeedImp[r]) && (m_dImpCf[r][r] == 0.0)) {
+			_EXCEPTION1("Implicit tendency of stage %i is not evaluated "
+				"but is required by a later stage", r);
+		}
+	}
+
+	// Data instances in use; index 0 holds the state at the beginning
+	// of the step and is only overwritten by the final update
+	std::vector<bool> fInUse(1, true);
+
+	auto Acquire = [&fInUse]() -> int {
+		for (int m = 1; m < fInUse.size(); m++) {
+			if (!fInUse[m]) {
+				fInUse[m] = true;
+				return m;
+			}
+		}
+		fInUse.push_back(true);
+		return (static_cast<int>(fInUse.size()) - 1);
+	};
+
+	auto Release = [&fInUse](int ix) {
+		if (ix > 0) {
+			fInUse[ix] = false;
+		}
+	};
+
+	// Terms of each combination, converted to coefficients once the
+	// number of data instances is known
+	std::vector<CombinationTerms> vecTerms;
+
+	auto AddOperation = [this, &vecTerms](
+		OperationType eType,
+		int ixSource,
+		int ixTarget,
+		double dCoeff,
+		const CombinationTerms & terms
+	) {
+		Operation op;
+		op.eType = eType;
+		op.ixSource = ixSource;
+		op.ixTarget = ixTarget;
+		op.dCoeff = dCoeff;
+		m_vecPlan.push_back(op);
+		vecTerms.push_back(terms);
+	};
+
+	// Running sum for each later row (-1 if no contribution yet)
+	std::vector<int> ixAccum(nRows, -1);
+
+	// Data indices of the current stage: combination before the explicit
+	// tendency, state after the explicit tendency and state after the
+	// implicit solve
+	int ixC = 0;
+	int ixUF = 0;
+	int ixU = 0;
+
+	// Complete row q, given the last contribution to its running sum,
+	// and prepare its explicit target
+	auto FinalizeRow = [&](int q, CombinationTerms terms) {
+		const bool fModified =
+			(m_dExpCf[q][q] != 0.0) || (m_dImpCf[q][q] != 0.0);
+
+		if (terms.size() == 0) {
+			ixC = (ixAccum[q] == (-1))?(0):(ixAccum[q]);
+
+			if ((fNeedExp[q]) || ((ixC == 0) && (fModified))) {
+				ixUF = Acquire();
+				AddOperation(
+					Operation_Copy, ixC, ixUF, 0.0, CombinationTerms());
+			} else {
+				ixUF = ixC;
+			}
+
+		} else {
+			if (ixAccum[q] == (-1)) {
+				ixC = Acquire();
+				terms.push_back(std::pair<int, double>(0, 1.0));
+			} else {
+				ixC = ixAccum[q];
+				terms.push_back(std::pair<int, double>(ixC, 1.0));
+			}
+
+			// The copy is fused with the final combination
+			if (fNeedExp[q]) {
+				ixUF = Acquire();
+			} else {
+				ixUF = ixC;
+			}
+
+			AddOperation(
+				Operation_Combine,
+				ixC,
+				(ixUF == ixC)?(-1):(ixUF),
+				0.0,
+				terms);
+		}
+	};
+
+	FinalizeRow(0, CombinationTerms());
+
+	int ixPrevU = 0;
+
+	for (int r = 0; r < nRows; r++) {
+
+		// Explicit tendency at the end of the previous stage
+		if (m_dExpCf[r][r] != 0.0) {
+			AddOperation(
+				Operation_Explicit, ixPrevU, ixUF,
+				m_dExpCf[r][r], CombinationTerms());
+		}
+		if ((ixPrevU != ixC) && (ixPrevU != ixUF)) {
+			Release(ixPrevU);
+		}
+
+		// Implicit solve, in place unless the explicit state is needed
+		if (m_dImpCf[r][r] != 0.0) {
+			if ((fNeedExp[r]) || (fNeedImp[r])) {
+				ixU = Acquire();
+				AddOperation(
+					Operation_Copy, ixUF, ixU, 0.0, CombinationTerms());
+			} else {
+				ixU = ixUF;
+			}
+			AddOperation(
+				Operation_Implicit, ixU, ixU,
+				m_dImpCf[r][r], CombinationTerms());
+
+		} else {
+			ixU = ixUF;
+		}
+
+		// Final row: apply filters and diffusion into index 0
+		if (r == nRows-1) {
+			if (ixU == 0) {
+				_EXCEPTIONT("IMEX tableau does not update the state");
+			}
+			int ixWorking = Acquire();
+			AddOperation(
+				Operation_AfterSubCycle, ixU, ixWorking,
+				0.0, CombinationTerms());
+			break;
+		}
+
+		// Contribution of this stage to each later row
+		std::vector<CombinationTerms> vecRowTerms(nRows);
+		for (int q = r+1; q < nRows; q++) {
+			if (m_dExpCf[q][r] != 0.0) {
+				double dExp = m_dExpCf[q][r] / m_dExpCf[r][r];
+				vecRowTerms[q].push_back(std::pair<int, double>(ixUF, dExp));
+				vecRowTerms[q].push_back(std::pair<int, double>(ixC, -dExp));
+			}
+			if (m_dImpCf[q][r] != 0.0) {
+				double dImp = m_dImpCf[q][r] / m_dImpCf[r][r];
+				vecRowTerms[q].push_back(std::pair<int, double>(ixU, dImp));
+				vecRowTerms[q].push_back(std::pair<int, double>(ixUF, -dImp));
+			}
+		}
+
+		// Fold into the running sums of rows beyond the next
+		for (int q = nRows-1; q > r+1; q--) {
+			if (vecRowTerms[q].size() == 0) {
+				continue;
+			}
+			if (ixAccum[q] == (-1)) {
+				ixAccum[q] = Acquire();
+				vecRowTerms[q].push_back(std::pair<int, double>(0, 1.0));
+			} else {
+				vecRowTerms[q].push_back(
+					std::pair<int, double>(ixAccum[q], 1.0));
+			}
+			AddOperation(
+				Operation_Combine, ixAccum[q], (-1), 0.0, vecRowTerms[q]);
+		}
+
+		// Complete the next row; all data from this stage except the
+		// final state can then be released
+		int ixStageC = ixC;
+		int ixStageUF = ixUF;
+
+		ixPrevU = ixU;
+
+		FinalizeRow(r+1, vecRowTerms[r+1]);
+
+		if (ixStageC != ixPrevU) {
+			Release(ixStageC);
+		}
+		if (ixStageUF != ixPrevU) {
+			Release(ixStageUF);
+		}
+	}
+
+	// At least three instances are needed to compute error norms
+	m_nInstances = static_cast<int>(fInUse.size());
+	if (m_nInstances < 3) {
+		m_nInstances = 3;
+	}
+
+	// Convert terms to coefficients
+	for (int i = 0; i < m_vecPlan.size(); i++) {
+		if (m_vecPlan[i].eType != Operation_Combine) {
+			continue;
+		}
+		m_vecPlan[i].dCombo.Allocate(m_nInstances);
+		for (int t = 0; t < vecTerms[i].size(); t++) {
+			m_vecPlan[i].dCombo[vecTerms[i][t].first] +=
+				vecTerms[i][t].second;
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TimestepSchemeIMEX::Initialize() {
+	Announce("IMEX storage plan: %i stages, %i operations, %i data instances",
+		static_cast<int>(m_dExpCf.GetRows()),
+		static_cast<int>(m_vecPlan.size()),
+		m_nInstances);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TimestepSchemeIMEX::Step(
+	bool fFirstStep,
+	bool fLastStep,
+	const Time & time,
+	double dDeltaT
+) {
+	// Get a copy of the grid
+	Grid * pGrid = m_model.GetGrid();
+
+	// Get a copy of the HorizontalDynamics
+	HorizontalDynamics * pHorizontalDynamics = m_model.GetHorizontalDynamics();
+
+	// Get a copy of the VerticalDynamics
+	VerticalDynamics * pVerticalDynamics = m_model.GetVerticalDynamics();
+
+	// Execute the storage plan
+	for (int i = 0; i < m_vecPlan.size(); i++) {
+		const Operation & op = m_vecPlan[i];
+
+		switch (op.eType) {
+			case Operation_Copy:
+				pGrid->CopyData(
+					op.ixSource, op.ixTarget,
+					{DataType_State, DataType_Tracers});
+				break;
+
+			case Operation_Combine:
+				pGrid->StageUpdateData(
+					op.dCombo, op.ixSource, op.ixTarget,
+					{DataType_State, DataType_Tracers});
+				break;
+
+			case Operation_Explicit:
+				pHorizontalDynamics->StepExplicit(
+					op.ixSource, op.ixTarget, time, op.dCoeff * dDeltaT);
+				pVerticalDynamics->StepExplicit(
+					op.ixSource, op.ixTarget, time, op.dCoeff * dDeltaT);
+				pGrid->PostProcessSubstage(
+					op.ixTarget, {DataType_State, DataType_Tracers});
+				break;
+
+			case Operation_Implicit:
+				pVerticalDynamics->StepImplicit(
+					op.ixTarget, op.ixTarget, time, op.dCoeff * dDeltaT);
+				pGrid->PostProcessSubstage(
+					op.ixTarget, {DataType_State, DataType_Tracers});
+				break;
+
+			case Operation_AfterSubCycle:
+				pHorizontalDynamics->StepAfterSubCycle(
+					op.ixSource, 0, op.ixTarget, time, dDeltaT);
+				break;
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
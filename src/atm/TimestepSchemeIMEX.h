@@ -0,0 +1,199 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    TimestepSchemeIMEX.h
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _TIMESTEPSCHEMEIMEX_H_
+#define _TIMESTEPSCHEMEIMEX_H_
+
+#include "TimestepScheme.h"
+#include "Exception.h"
+#include "DataArray1D.h"
+#include "DataArray2D.h"
+
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+
+class Model;
+class Time;
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Generic IMEX Runge-Kutta time stepping driven by a pair of Butcher
+///		tableaux, with horizontal dynamics treated explicitly and vertical
+///		dynamics treated implicitly.
+///	</summary>
+///	<remarks>
+///		The tableaux use the same convention as TimestepSchemeARS343: row r
+///		of the explicit tableau gives the weights of the explicit tendencies
+///		evaluated at the initial state (column 0) and at the end of each
+///		earlier stage, with the diagonal entry applied to a new evaluation
+///		at the end of stage r-1.  Row r of the implicit tableau gives the
+///		weights of the implicit tendencies of stages 0 to r, with the
+///		diagonal entry applied by the implicit solve of stage r.  The last
+///		row produces the updated state.
+///
+///		Tendencies are never stored directly; each one is recovered as the
+///		difference of the state before and after it was applied.  When the
+///		scheme is constructed a storage plan is built which folds the
+///		contribution of each stage into a running sum for every later row
+///		as soon as the stage is complete, so that stage vectors can be
+///		released immediately.  The final contribution to each row is fused
+///		with the copy into its explicit target, and states that are not
+///		needed afterwards are updated in place.  Only the data instances
+///		used by the plan are allocated.
+///	</remarks>
+class TimestepSchemeIMEX : public TimestepScheme {
+
+public:
+	///	<summary>
+	///		Available tableau pairs.
+	///	</summary>
+	enum Tableau {
+		ARS222,
+		ARS232,
+		ARS343,
+		ARS443
+	};
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	TimestepSchemeIMEX(
+		Model & model,
+		Tableau eTableau
+	);
+
+	///	<summary>
+	///		Constructor from an arbitrary tableau pair.  Both tableaux must
+	///		be square and of the same size.
+	///	</summary>
+	TimestepSchemeIMEX(
+		Model & model,
+		const DataArray2D<double> & dExpCf,
+		const DataArray2D<double> & dImpCf
+	);
+
+public:
+	///	<summary>
+	///		Get the number of component data instances.
+	///	</summary>
+	virtual int GetComponentDataInstances() const {
+		return m_nInstances;
+	}
+
+	///	<summary>
+	///		Get the number of tracer data instances.
+	///	</summary>
+	virtual int GetTracerDataInstances() const {
+		return m_nInstances;
+	}
+
+public:
+	///	<summary>
+	///		Initializer.  Called prior to model execution.
+	///	</summary>
+	virtual void Initialize();
+
+protected:
+	///	<summary>
+	///		Build the storage plan from the tableaux.
+	///	</summary>
+	void BuildPlan();
+
+	///	<summary>
+	///		Perform one time step.
+	///	</summary>
+	virtual void Step(
+		bool fFirstStep,
+		bool fLastStep,
+		const Time & time,
+		double dDeltaT
+	);
+
+private:
+	///	<summary>
+	///		Type of an operation in the storage plan.
+	///	</summary>
+	enum OperationType {
+		Operation_Copy,
+		Operation_Combine,
+		Operation_Explicit,
+		Operation_Implicit,
+		Operation_AfterSubCycle
+	};
+
+	///	<summary>
+	///		An operation in the storage plan.
+	///	</summary>
+	struct Operation {
+
+		///	<summary>
+		///		Type of operation.
+		///	</summary>
+		OperationType eType;
+
+		///	<summary>
+		///		Source data index (Copy, Explicit, AfterSubCycle) or
+		///		destination of the combination (Combine).
+		///	</summary>
+		int ixSource;
+
+		///	<summary>
+		///		Target data index (Copy, Explicit, Implicit), copy of the
+		///		combination or -1 (Combine), or working data index
+		///		(AfterSubCycle).
+		///	</summary>
+		int ixTarget;
+
+		///	<summary>
+		///		Tableau coefficient multiplying the time step (Explicit,
+		///		Implicit).
+		///	</summary>
+		double dCoeff;
+
+		///	<summary>
+		///		Coefficients of the combination (Combine).
+		///	</summary>
+		DataArray1D<double> dCombo;
+	};
+
+	///	<summary>
+	///		Explicit tableau.
+	///	</summary>
+	DataArray2D<double> m_dExpCf;
+
+	///	<summary>
+	///		Implicit tableau.
+	///	</summary>
+	DataArray2D<double> m_dImpCf;
+
+	///	<summary>
+	///		Storage plan for one time step.
+	///	</summary>
+	std::vector<Operation> m_vecPlan;
+
+	///	<summary>
+	///		Number of data instances required by the plan.
+	///	</summary>
+	int m_nInstances;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
@@ -92,129 +92,99 @@ void TimestepSchemeSplitExp::Step(
 	//std::cout << "Number of small steps: " << ns << std::endl;
 
 	// Take the full horizontal step with KGU53
-	pGrid->CopyData(0, 1, DataType_State);
-	pGrid->CopyData(0, 1, DataType_Tracers);
+	pGrid->CopyData(0, 1, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(0, 1, time, dDeltaT / 5.0);
-	pGrid->PostProcessSubstage(1, DataType_State);
-	pGrid->PostProcessSubstage(1, DataType_Tracers);
+	pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
-	pGrid->CopyData(0, 2, DataType_State);
-	pGrid->CopyData(0, 2, DataType_Tracers);
+	pGrid->CopyData(0, 2, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(1, 2, time, dDeltaT / 5.0);
-	pGrid->PostProcessSubstage(2, DataType_State);
-	pGrid->PostProcessSubstage(2, DataType_Tracers);
+	pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
-	pGrid->CopyData(0, 3, DataType_State);
-	pGrid->CopyData(0, 3, DataType_Tracers);
+	pGrid->CopyData(0, 3, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(2, 3, time, dDeltaT / 3.0);
-	pGrid->PostProcessSubstage(3, DataType_State);
-	pGrid->PostProcessSubstage(3, DataType_Tracers);
+	pGrid->PostProcessSubstage(3, {DataType_State, DataType_Tracers});
 
-	pGrid->CopyData(0, 2, DataType_State);
-	pGrid->CopyData(0, 2, DataType_Tracers);
+	pGrid->CopyData(0, 2, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(3, 2, time, 2.0 * dDeltaT / 3.0);
-	pGrid->PostProcessSubstage(2, DataType_State);
-	pGrid->PostProcessSubstage(2, DataType_Tracers);
+	pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
 	pGrid->LinearCombineData(
 		m_dKinnmarkGrayUllrichCombination, 4, DataType_State);
 	pGrid->LinearCombineData(
 		m_dKinnmarkGrayUllrichCombination, 4, DataType_Tracers);
 	pHorizontalDynamics->StepExplicit(2, 4, time, 3.0 * dDeltaT / 4.0);
-	pGrid->PostProcessSubstage(4, DataType_State);
-	pGrid->PostProcessSubstage(4, DataType_Tracers);
+	pGrid->PostProcessSubstage(4, {DataType_State, DataType_Tracers});
 
 /*	// Take the full horizontal step with SSPRK3
 	pHorizontalDynamics->StepExplicit(0, 1, time, dDeltaT);
-	pGrid->PostProcessSubstage(1, DataType_State);
-	pGrid->PostProcessSubstage(1, DataType_Tracers);
+	pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
-	pGrid->LinearCombineData(m_dSSPRK3CombinationA, 2, DataType_State);
-	pGrid->LinearCombineData(m_dSSPRK3CombinationA, 2, DataType_Tracers);
+	pGrid->LinearCombineData(
+		m_dSSPRK3CombinationA, 2, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(1, 2, time, 0.25 * dDeltaT);
-	pGrid->PostProcessSubstage(2, DataType_State);
-	pGrid->PostProcessSubstage(2, DataType_Tracers);
+	pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
-	pGrid->LinearCombineData(m_dSSPRK3CombinationB, 4, DataType_State);
-	pGrid->LinearCombineData(m_dSSPRK3CombinationB, 4, DataType_Tracers);
+	pGrid->LinearCombineData(
+		m_dSSPRK3CombinationB, 4, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepExplicit(2, 4, time, (2.0/3.0) * dDeltaT);
-	pGrid->PostProcessSubstage(4, DataType_State);
-	pGrid->PostProcessSubstage(4, DataType_Tracers);
+	pGrid->PostProcessSubstage(4, {DataType_State, DataType_Tracers});
 
 	// Apply hyperdiffusion
-	pGrid->CopyData(4, 1, DataType_State);
-	pGrid->CopyData(4, 1, DataType_Tracers);
+	pGrid->CopyData(4, 1, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepAfterSubCycle(4, 1, 2, time, dDeltaT);
-	pGrid->CopyData(1, 0, DataType_State);
-	pGrid->CopyData(1, 0, DataType_Tracers);
+	pGrid->CopyData(1, 0, {DataType_State, DataType_Tracers});
 */
-	pGrid->CopyData(4, 0, DataType_State);
-	pGrid->CopyData(4, 0, DataType_Tracers);
+	pGrid->CopyData(4, 0, {DataType_State, DataType_Tracers});
 
 	//std::cout << "Entering substages at the timestep... \n";
 	// Compute the small step loop for stiff vertical terms
 
 	for (int n = 0; n < ns; n++) {
-		pGrid->CopyData(0, 1, DataType_State);
-		pGrid->CopyData(0, 1, DataType_Tracers);
+		pGrid->CopyData(0, 1, {DataType_State, DataType_Tracers});
 /*
 		pVerticalDynamics->StepExplicit(0, 1, time, dDeltaT / 5.0 / ns);
-		pGrid->PostProcessSubstage(1, DataType_State);
-		pGrid->PostProcessSubstage(1, DataType_Tracers);
+		pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
-		pGrid->CopyData(0, 2, DataType_State);
-		pGrid->CopyData(0, 2, DataType_Tracers);
+		pGrid->CopyData(0, 2, {DataType_State, DataType_Tracers});
 		pVerticalDynamics->StepExplicit(1, 2, time, dDeltaT / 5.0 / ns);
-		pGrid->PostProcessSubstage(2, DataType_State);
-		pGrid->PostProcessSubstage(2, DataType_Tracers);
+		pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
-		pGrid->CopyData(0, 3, DataType_State);
-		pGrid->CopyData(0, 3, DataType_Tracers);
+		pGrid->CopyData(0, 3, {DataType_State, DataType_Tracers});
 		pVerticalDynamics->StepExplicit(2, 3, time, dDeltaT / 3.0 / ns);
-		pGrid->PostProcessSubstage(3, DataType_State);
-		pGrid->PostProcessSubstage(3, DataType_Tracers);
+		pGrid->PostProcessSubstage(3, {DataType_State, DataType_Tracers});
 
-		pGrid->CopyData(0, 2, DataType_State);
-		pGrid->CopyData(0, 2, DataType_Tracers);
+		pGrid->CopyData(0, 2, {DataType_State, DataType_Tracers});
 		pVerticalDynamics->StepExplicit(3, 2, time, 2.0 * dDeltaT / 3.0 / ns);
-		pGrid->PostProcessSubstage(2, DataType_State);
-		pGrid->PostProcessSubstage(2, DataType_Tracers);
+		pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
 		pGrid->LinearCombineData(
 		m_dKinnmarkGrayUllrichCombination, 4, DataType_State);
 		pGrid->LinearCombineData(
 		m_dKinnmarkGrayUllrichCombination, 4, DataType_Tracers);
 		pVerticalDynamics->StepExplicit(2, 4, time, 3.0 * dDeltaT / 4.0 / ns);
-		pGrid->PostProcessSubstage(4, DataType_State);
-		pGrid->PostProcessSubstage(4, DataType_Tracers);
+		pGrid->PostProcessSubstage(4, {DataType_State, DataType_Tracers});
 */
 		pVerticalDynamics->StepExplicit(0, 1, time, dDeltaT / ns);
-		pGrid->PostProcessSubstage(1, DataType_State);
-		pGrid->PostProcessSubstage(1, DataType_Tracers);
+		pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
-		pGrid->LinearCombineData(m_dSSPRK3CombinationA, 2, DataType_State);
-		pGrid->LinearCombineData(m_dSSPRK3CombinationA, 2, DataType_Tracers);
+		pGrid->LinearCombineData(
+			m_dSSPRK3CombinationA, 2, {DataType_State, DataType_Tracers});
 		pVerticalDynamics->StepExplicit(1, 2, time, 0.25 * dDeltaT / ns);
-		pGrid->PostProcessSubstage(2, DataType_State);
-		pGrid->PostProcessSubstage(2, DataType_Tracers);
+		pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
-		pGrid->LinearCombineData(m_dSSPRK3CombinationB, 4, DataType_State);
-		pGrid->LinearCombineData(m_dSSPRK3CombinationB, 4, DataType_Tracers);
+		pGrid->LinearCombineData(
+			m_dSSPRK3CombinationB, 4, {DataType_State, DataType_Tracers});
 		pVerticalDynamics->StepExplicit(2, 4, time, (2.0/3.0) * dDeltaT / ns);
-		pGrid->PostProcessSubstage(4, DataType_State);
-		pGrid->PostProcessSubstage(4, DataType_Tracers);
+		pGrid->PostProcessSubstage(4, {DataType_State, DataType_Tracers});
 
 		if (n == ns - 1) {
 		// Apply hyperdiffusion
-		pGrid->CopyData(4, 1, DataType_State);
-		pGrid->CopyData(4, 1, DataType_Tracers);
+		pGrid->CopyData(4, 1, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepAfterSubCycle(4, 1, 2, time, dDeltaT);
-		pGrid->CopyData(1, 0, DataType_State);
-		pGrid->CopyData(1, 0, DataType_Tracers);
+		pGrid->CopyData(1, 0, {DataType_State, DataType_Tracers});
 		}
 		else {
-		pGrid->CopyData(4, 0, DataType_State);
-		pGrid->CopyData(4, 0, DataType_Tracers);
+		pGrid->CopyData(4, 0, {DataType_State, DataType_Tracers});
 		}
 	}
 }
@@ -236,8 +236,8 @@ int TimestepSchemeStrang::SubStep(
 			pVerticalDynamics->StepImplicit(0, 0, time, dHalfDeltaT);
 
 		} else {
-			pGrid->LinearCombineData(m_dCarryoverCombination, 0, DataType_State);
-			pGrid->LinearCombineData(m_dCarryoverCombination, 0, DataType_Tracers);
+			pGrid->LinearCombineData(
+				m_dCarryoverCombination, 0, {DataType_State, DataType_Tracers});
 
 			pVerticalDynamics->FilterNegativeTracers(0);
 		}
@@ -246,8 +246,7 @@ int TimestepSchemeStrang::SubStep(
 	// Forward Euler
 	if (m_eExplicitDiscretization == ForwardEuler) {
 		if (iSubStep == 0) {
-			pGrid->CopyData(0, 4, DataType_State);
-			pGrid->CopyData(0, 4, DataType_Tracers);
+			pGrid->CopyData(0, 4, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(0, 4, time, dDeltaT);
 			pVerticalDynamics->StepExplicit(0, 4, time, dDeltaT);
 
@@ -257,32 +256,29 @@ int TimestepSchemeStrang::SubStep(
 	// Explicit fourth-order Runge-Kutta
 	} else if (m_eExplicitDiscretization == RungeKutta4) {
 		if (iSubStep == 0) {
-			pGrid->CopyData(0, 1, DataType_State);
-			pGrid->CopyData(0, 1, DataType_Tracers);
+			pGrid->CopyData(0, 1, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(0, 1, time, dHalfDeltaT);
 			pVerticalDynamics->StepExplicit(0, 1, time, dHalfDeltaT);
 
 			return 1;
 
 		} else if (iSubStep == 1) {
-			pGrid->CopyData(0, 2, DataType_State);
-			pGrid->CopyData(0, 2, DataType_Tracers);
+			pGrid->CopyData(0, 2, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(1, 2, time, dHalfDeltaT);
 			pVerticalDynamics->StepExplicit(1, 2, time, dHalfDeltaT);
 
 			return 2;
 
 		} else if (iSubStep == 2) {
-			pGrid->CopyData(0, 3, DataType_State);
-			pGrid->CopyData(0, 3, DataType_Tracers);
+			pGrid->CopyData(0, 3, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(2, 3, time, dDeltaT);
 			pVerticalDynamics->StepExplicit(2, 3, time, dDeltaT);
 
 			return 3;
 
 		} else if (iSubStep == 3) {
-			pGrid->LinearCombineData(m_dRK4Combination, 4, DataType_State);
-			pGrid->LinearCombineData(m_dRK4Combination, 4, DataType_Tracers);
+			pGrid->LinearCombineData(
+				m_dRK4Combination, 4, {DataType_State, DataType_Tracers});
 
 			pHorizontalDynamics->StepExplicit(3, 4, time, dDeltaT / 6.0);
 			pVerticalDynamics->StepExplicit(3, 4, time, dDeltaT / 6.0);
@@ -293,24 +289,23 @@ int TimestepSchemeStrang::SubStep(
 	// Explicit strong stability preserving third-order Runge-Kutta
 	} else if (m_eExplicitDiscretization == RungeKuttaSSP3) {
 		if (iSubStep == 0) {
-			pGrid->CopyData(0, 1, DataType_State);
-			pGrid->CopyData(0, 1, DataType_Tracers);
+			pGrid->CopyData(0, 1, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(0, 1, time, dDeltaT);
 			pVerticalDynamics->StepExplicit(0, 1, time, dDeltaT);
 
 			return 1;
 
 		} else if (iSubStep == 1) {
-			pGrid->LinearCombineData(m_dSSPRK3CombinationA, 2, DataType_State);
-			pGrid->LinearCombineData(m_dSSPRK3CombinationA, 2, DataType_Tracers);
+			pGrid->LinearCombineData(
+				m_dSSPRK3CombinationA, 2, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(1, 2, time, 0.25 * dDeltaT);
 			pVerticalDynamics->StepExplicit(1, 2, time, 0.25 * dDeltaT);
 
 			return 2;
 
 		} else if (iSubStep == 2) {
-			pGrid->LinearCombineData(m_dSSPRK3CombinationB, 4, DataType_State);
-			pGrid->LinearCombineData(m_dSSPRK3CombinationB, 4, DataType_Tracers);
+			pGrid->LinearCombineData(
+				m_dSSPRK3CombinationB, 4, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(2, 4, time, (2.0/3.0) * dDeltaT);
 			pVerticalDynamics->StepExplicit(2, 4, time, (2.0/3.0) * dDeltaT);
 
@@ -320,32 +315,28 @@ int TimestepSchemeStrang::SubStep(
 	// Explicit Kinnmark, Gray and Ullrich third-order five-stage Runge-Kutta
 	} else if (m_eExplicitDiscretization == KinnmarkGrayUllrich35) {
 		if (iSubStep == 0) {
-			pGrid->CopyData(0, 1, DataType_State);
-			pGrid->CopyData(0, 1, DataType_Tracers);
+			pGrid->CopyData(0, 1, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(0, 1, time, dDeltaT / 5.0);
 			pVerticalDynamics->StepExplicit(0, 1, time, dDeltaT / 5.0);
 
 			return 1;
 
 		} else if (iSubStep == 1) {
-			pGrid->CopyData(0, 2, DataType_State);
-			pGrid->CopyData(0, 2, DataType_Tracers);
+			pGrid->CopyData(0, 2, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(1, 2, time, dDeltaT / 5.0);
 			pVerticalDynamics->StepExplicit(1, 2, time, dDeltaT / 5.0);
 
 			return 2;
 
 		} else if (iSubStep == 2) {
-			pGrid->CopyData(0, 3, DataType_State);
-			pGrid->CopyData(0, 3, DataType_Tracers);
+			pGrid->CopyData(0, 3, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(2, 3, time, dDeltaT / 3.0);
 			pVerticalDynamics->StepExplicit(2, 3, time, dDeltaT / 3.0);
 
 			return 3;
 
 		} else if (iSubStep == 3) {
-			pGrid->CopyData(0, 2, DataType_State);
-			pGrid->CopyData(0, 2, DataType_Tracers);
+			pGrid->CopyData(0, 2, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(3, 2, time, 2.0 * dDeltaT / 3.0);
 			pVerticalDynamics->StepExplicit(3, 2, time, 2.0 * dDeltaT / 3.0);
 
@@ -367,8 +358,7 @@ int TimestepSchemeStrang::SubStep(
 		if (iSubStep == 0) {
 			const double dStepOne = 0.377268915331368;
 
-			pGrid->CopyData(0, 1, DataType_State);
-			pGrid->CopyData(0, 1, DataType_Tracers);
+			pGrid->CopyData(0, 1, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(0, 1, time, dStepOne * dDeltaT);
 			pVerticalDynamics->StepExplicit(0, 1, time, dStepOne * dDeltaT);
 
@@ -377,8 +367,7 @@ int TimestepSchemeStrang::SubStep(
 		} else if (iSubStep == 1) {
 			const double dStepOne = 0.377268915331368;
 
-			pGrid->CopyData(1, 2, DataType_State);
-			pGrid->CopyData(1, 2, DataType_Tracers);
+			pGrid->CopyData(1, 2, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(1, 2, time, dStepOne * dDeltaT);
 			pVerticalDynamics->StepExplicit(1, 2, time, dStepOne * dDeltaT);
 
@@ -387,8 +376,8 @@ int TimestepSchemeStrang::SubStep(
 		} else if (iSubStep == 2) {
 			const double dStepThree = 0.242995220537396;
 
-			pGrid->LinearCombineData(m_dSSPRK53CombinationA, 3, DataType_State);
-			pGrid->LinearCombineData(m_dSSPRK53CombinationA, 3, DataType_Tracers);
+			pGrid->LinearCombineData(
+				m_dSSPRK53CombinationA, 3, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(2, 3, time, dStepThree * dDeltaT);
 			pVerticalDynamics->StepExplicit(2, 3, time, dStepThree * dDeltaT);
 
@@ -397,8 +386,8 @@ int TimestepSchemeStrang::SubStep(
 		} else if (iSubStep == 3) {
 			const double dStepFour = 0.238458932846290;
 
-			pGrid->LinearCombineData(m_dSSPRK53CombinationB, 0, DataType_State);
-			pGrid->LinearCombineData(m_dSSPRK53CombinationB, 0, DataType_Tracers);
+			pGrid->LinearCombineData(
+				m_dSSPRK53CombinationB, 0, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(3, 0, time, dStepFour * dDeltaT);
 			pVerticalDynamics->StepExplicit(3, 0, time, dStepFour * dDeltaT);
 
@@ -407,8 +396,8 @@ int TimestepSchemeStrang::SubStep(
 		} else if (iSubStep == 4) {
 			const double dStepFive = 0.287632146308408;
 
-			pGrid->LinearCombineData(m_dSSPRK53CombinationC, 4, DataType_State);
-			pGrid->LinearCombineData(m_dSSPRK53CombinationC, 4, DataType_Tracers);
+			pGrid->LinearCombineData(
+				m_dSSPRK53CombinationC, 4, {DataType_State, DataType_Tracers});
 			pHorizontalDynamics->StepExplicit(0, 4, time, dStepFive * dDeltaT);
 			pVerticalDynamics->StepExplicit(0, 4, time, dStepFive * dDeltaT);
 
@@ -427,13 +416,12 @@ int TimestepSchemeStrang::SubStep(
 	} else if (
 		iSubStep == m_nExplicitSubSteps + nHorizontalDynamicsSubSteps
 	) {
-		pGrid->CopyData(1, 0, DataType_State);
-		pGrid->CopyData(1, 0, DataType_Tracers);
+		pGrid->CopyData(1, 0, {DataType_State, DataType_Tracers});
 		pVerticalDynamics->StepImplicit(0, 0, time, 0.5 * dDeltaT);
 
 		if (!fLastStep) {
-			pGrid->LinearCombineData(m_dCarryoverFinal, 1, DataType_State);
-			pGrid->LinearCombineData(m_dCarryoverFinal, 1, DataType_Tracers);
+			pGrid->LinearCombineData(
+				m_dCarryoverFinal, 1, {DataType_State, DataType_Tracers});
 		}
 
 #pragma message "Merge this vertical timestep in above"
@@ -473,106 +461,85 @@ void TimestepSchemeStrang::Step(
 		pVerticalDynamics->StepImplicit(0, 0, time, dHalfDeltaT);
 
 	} else {
-		pGrid->LinearCombineData(m_dCarryoverCombination, 0, DataType_State);
-		pGrid->LinearCombineData(m_dCarryoverCombination, 0, DataType_Tracers);
+		pGrid->LinearCombineData(
+			m_dCarryoverCombination, 0, {DataType_State, DataType_Tracers});
 
 		pVerticalDynamics->FilterNegativeTracers(0);
 	}
 
 	// Forward Euler
 	if (m_eExplicitDiscretization == ForwardEuler) {
-		pGrid->CopyData(0, 4, DataType_State);
-		pGrid->CopyData(0, 4, DataType_Tracers);
+		pGrid->CopyData(0, 4, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(0, 4, time, dDeltaT);
 		pVerticalDynamics->StepExplicit(0, 4, time, dDeltaT);
-		pGrid->PostProcessSubstage(4, DataType_State);
-		pGrid->PostProcessSubstage(4, DataType_Tracers);
+		pGrid->PostProcessSubstage(4, {DataType_State, DataType_Tracers});
 
 	// Explicit fourth-order Runge-Kutta
 	} else if (m_eExplicitDiscretization == RungeKutta4) {
-		pGrid->CopyData(0, 1, DataType_State);
-		pGrid->CopyData(0, 1, DataType_Tracers);
+		pGrid->CopyData(0, 1, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(0, 1, time, dHalfDeltaT);
 		pVerticalDynamics->StepExplicit(0, 1, time, dHalfDeltaT);
-		pGrid->PostProcessSubstage(1, DataType_State);
-		pGrid->PostProcessSubstage(1, DataType_Tracers);
+		pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
-		pGrid->CopyData(0, 2, DataType_State);
-		pGrid->CopyData(0, 2, DataType_Tracers);
+		pGrid->CopyData(0, 2, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(1, 2, time, dHalfDeltaT);
 		pVerticalDynamics->StepExplicit(1, 2, time, dHalfDeltaT);
-		pGrid->PostProcessSubstage(2, DataType_State);
-		pGrid->PostProcessSubstage(2, DataType_Tracers);
+		pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
-		pGrid->CopyData(0, 3, DataType_State);
-		pGrid->CopyData(0, 3, DataType_Tracers);
+		pGrid->CopyData(0, 3, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(2, 3, time, dDeltaT);
 		pVerticalDynamics->StepExplicit(2, 3, time, dDeltaT);
-		pGrid->PostProcessSubstage(3, DataType_State);
-		pGrid->PostProcessSubstage(3, DataType_Tracers);
+		pGrid->PostProcessSubstage(3, {DataType_State, DataType_Tracers});
 
-		pGrid->LinearCombineData(m_dRK4Combination, 4, DataType_State);
-		pGrid->LinearCombineData(m_dRK4Combination, 4, DataType_Tracers);
+		pGrid->LinearCombineData(
+			m_dRK4Combination, 4, {DataType_State, DataType_Tracers});
 
 		pHorizontalDynamics->StepExplicit(3, 4, time, dDeltaT / 6.0);
 		pVerticalDynamics->StepExplicit(3, 4, time, dDeltaT / 6.0);
-		pGrid->PostProcessSubstage(4, DataType_State);
-		pGrid->PostProcessSubstage(4, DataType_Tracers);
+		pGrid->PostProcessSubstage(4, {DataType_State, DataType_Tracers});
 
 	// Explicit strong stability preserving third-order Runge-Kutta
 	} else if (m_eExplicitDiscretization == RungeKuttaSSP3) {
 
-		pGrid->CopyData(0, 1, DataType_State);
-		pGrid->CopyData(0, 1, DataType_Tracers);
+		pGrid->CopyData(0, 1, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(0, 1, time, dDeltaT);
 		pVerticalDynamics->StepExplicit(0, 1, time, dDeltaT);
-		pGrid->PostProcessSubstage(1, DataType_State);
-		pGrid->PostProcessSubstage(1, DataType_Tracers);
+		pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
-		pGrid->LinearCombineData(m_dSSPRK3CombinationA, 2, DataType_State);
-		pGrid->LinearCombineData(m_dSSPRK3CombinationA, 2, DataType_Tracers);
+		pGrid->LinearCombineData(
+			m_dSSPRK3CombinationA, 2, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(1, 2, time, 0.25 * dDeltaT);
 		pVerticalDynamics->StepExplicit(1, 2, time, 0.25 * dDeltaT);
-		pGrid->PostProcessSubstage(2, DataType_State);
-		pGrid->PostProcessSubstage(2, DataType_Tracers);
+		pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
-		pGrid->LinearCombineData(m_dSSPRK3CombinationB, 4, DataType_State);
-		pGrid->LinearCombineData(m_dSSPRK3CombinationB, 4, DataType_Tracers);
+		pGrid->LinearCombineData(
+			m_dSSPRK3CombinationB, 4, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(2, 4, time, (2.0/3.0) * dDeltaT);
 		pVerticalDynamics->StepExplicit(2, 4, time, (2.0/3.0) * dDeltaT);
-		pGrid->PostProcessSubstage(4, DataType_State);
-		pGrid->PostProcessSubstage(4, DataType_Tracers);
+		pGrid->PostProcessSubstage(4, {DataType_State, DataType_Tracers});
 
 	// Explicit Kinnmark, Gray and Ullrich third-order five-stage Runge-Kutta
 	} else if (m_eExplicitDiscretization == KinnmarkGrayUllrich35) {
 
-		pGrid->CopyData(0, 1, DataType_State);
-		pGrid->CopyData(0, 1, DataType_Tracers);
+		pGrid->CopyData(0, 1, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(0, 1, time, dDeltaT / 5.0);
 		pVerticalDynamics->StepExplicit(0, 1, time, dDeltaT / 5.0);
-		pGrid->PostProcessSubstage(1, DataType_State);
-		pGrid->PostProcessSubstage(1, DataType_Tracers);
+		pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
-		pGrid->CopyData(0, 2, DataType_State);
-		pGrid->CopyData(0, 2, DataType_Tracers);
+		pGrid->CopyData(0, 2, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(1, 2, time, dDeltaT / 5.0);
 		pVerticalDynamics->StepExplicit(1, 2, time, dDeltaT / 5.0);
-		pGrid->PostProcessSubstage(2, DataType_State);
-		pGrid->PostProcessSubstage(2, DataType_Tracers);
+		pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
-		pGrid->CopyData(0, 3, DataType_State);
-		pGrid->CopyData(0, 3, DataType_Tracers);
+		pGrid->CopyData(0, 3, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(2, 3, time, dDeltaT / 3.0);
 		pVerticalDynamics->StepExplicit(2, 3, time, dDeltaT / 3.0);
-		pGrid->PostProcessSubstage(3, DataType_State);
-		pGrid->PostProcessSubstage(3, DataType_Tracers);
+		pGrid->PostProcessSubstage(3, {DataType_State, DataType_Tracers});
 
-		pGrid->CopyData(0, 2, DataType_State);
-		pGrid->CopyData(0, 2, DataType_Tracers);
+		pGrid->CopyData(0, 2, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(3, 2, time, 2.0 * dDeltaT / 3.0);
 		pVerticalDynamics->StepExplicit(3, 2, time, 2.0 * dDeltaT / 3.0);
-		pGrid->PostProcessSubstage(2, DataType_State);
-		pGrid->PostProcessSubstage(2, DataType_Tracers);
+		pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
 		pGrid->LinearCombineData(
 			m_dKinnmarkGrayUllrichCombination, 4, DataType_State);
@@ -580,54 +547,46 @@ void TimestepSchemeStrang::Step(
 			m_dKinnmarkGrayUllrichCombination, 4, DataType_Tracers);
 		pHorizontalDynamics->StepExplicit(2, 4, time, 3.0 * dDeltaT / 4.0);
 		pVerticalDynamics->StepExplicit(2, 4, time, 3.0 * dDeltaT / 4.0);
-		pGrid->PostProcessSubstage(4, DataType_State);
-		pGrid->PostProcessSubstage(4, DataType_Tracers);
+		pGrid->PostProcessSubstage(4, {DataType_State, DataType_Tracers});
 
 	// Explicit strong stability preserving five-stage third-order Runge-Kutta
 	} else if (m_eExplicitDiscretization == RungeKuttaSSPRK53) {
 
 		const double dStepOne = 0.377268915331368;
 
-		pGrid->CopyData(0, 1, DataType_State);
-		pGrid->CopyData(0, 1, DataType_Tracers);
+		pGrid->CopyData(0, 1, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(0, 1, time, dStepOne * dDeltaT);
 		pVerticalDynamics->StepExplicit(0, 1, time, dStepOne * dDeltaT);
-		pGrid->PostProcessSubstage(1, DataType_State);
-		pGrid->PostProcessSubstage(1, DataType_Tracers);
+		pGrid->PostProcessSubstage(1, {DataType_State, DataType_Tracers});
 
-		pGrid->CopyData(1, 2, DataType_State);
-		pGrid->CopyData(1, 2, DataType_Tracers);
+		pGrid->CopyData(1, 2, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(1, 2, time, dStepOne * dDeltaT);
 		pVerticalDynamics->StepExplicit(1, 2, time, dStepOne * dDeltaT);
-		pGrid->PostProcessSubstage(2, DataType_State);
-		pGrid->PostProcessSubstage(2, DataType_Tracers);
+		pGrid->PostProcessSubstage(2, {DataType_State, DataType_Tracers});
 
 		const double dStepThree = 0.242995220537396;
 
-		pGrid->LinearCombineData(m_dSSPRK53CombinationA, 3, DataType_State);
-		pGrid->LinearCombineData(m_dSSPRK53CombinationA, 3, DataType_Tracers);
+		pGrid->LinearCombineData(
+			m_dSSPRK53CombinationA, 3, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(2, 3, time, dStepThree * dDeltaT);
 		pVerticalDynamics->StepExplicit(2, 3, time, dStepThree * dDeltaT);
-		pGrid->PostProcessSubstage(3, DataType_State);
-		pGrid->PostProcessSubstage(3, DataType_Tracers);
+		pGrid->PostProcessSubstage(3, {DataType_State, DataType_Tracers});
 
 		const double dStepFour = 0.238458932846290;
 
-		pGrid->LinearCombineData(m_dSSPRK53CombinationB, 0, DataType_State);
-		pGrid->LinearCombineData(m_dSSPRK53CombinationB, 0, DataType_Tracers);
+		pGrid->LinearCombineData(
+			m_dSSPRK53CombinationB, 0, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(3, 0, time, dStepFour * dDeltaT);
 		pVerticalDynamics->StepExplicit(3, 0, time, dStepFour * dDeltaT);
-		pGrid->PostProcessSubstage(0, DataType_State);
-		pGrid->PostProcessSubstage(0, DataType_Tracers);
+		pGrid->PostProcessSubstage(0, {DataType_State, DataType_Tracers});
 
 		const double dStepFive = 0.287632146308408;
 
-		pGrid->LinearCombineData(m_dSSPRK53CombinationC, 4, DataType_State);
-		pGrid->LinearCombineData(m_dSSPRK53CombinationC, 4, DataType_Tracers);
+		pGrid->LinearCombineData(
+			m_dSSPRK53CombinationC, 4, {DataType_State, DataType_Tracers});
 		pHorizontalDynamics->StepExplicit(0, 4, time, dStepFive * dDeltaT);
 		pVerticalDynamics->StepExplicit(0, 4, time, dStepFive * dDeltaT);
-		pGrid->PostProcessSubstage(4, DataType_State);
-		pGrid->PostProcessSubstage(4, DataType_Tracers);
+		pGrid->PostProcessSubstage(4, {DataType_State, DataType_Tracers});
 
 	// Invalid explicit discretization
 	} else {
@@ -635,23 +594,21 @@ void TimestepSchemeStrang::Step(
 	}
 
 	// Apply hyperdiffusion
-	pGrid->CopyData(4, 1, DataType_State);
-	pGrid->CopyData(4, 1, DataType_Tracers);
+	pGrid->CopyData(4, 1, {DataType_State, DataType_Tracers});
 	pHorizontalDynamics->StepAfterSubCycle(4, 1, 2, time, dDeltaT);
 
 	// Vertical timestep
 	double dOffCenterDeltaT = 0.5 * (1.0 + m_dOffCentering) * dDeltaT;
 
-	pGrid->CopyData(1, 0, DataType_State);
-	pGrid->CopyData(1, 0, DataType_Tracers);
+	pGrid->CopyData(1, 0, {DataType_State, DataType_Tracers});
 	pVerticalDynamics->StepImplicit(0, 0, time, dOffCenterDeltaT);
 
-	pGrid->LinearCombineData(m_dOffCenteringCombination, 0, DataType_State);
-	pGrid->LinearCombineData(m_dOffCenteringCombination, 0, DataType_Tracers);
+	pGrid->LinearCombineData(
+		m_dOffCenteringCombination, 0, {DataType_State, DataType_Tracers});
 
 	if (!fLastStep) {
-		pGrid->LinearCombineData(m_dCarryoverFinal, 1, DataType_State);
-		pGrid->LinearCombineData(m_dCarryoverFinal, 1, DataType_Tracers);
+		pGrid->LinearCombineData(
+			m_dCarryoverFinal, 1, {DataType_State, DataType_Tracers});
 	}
 
 	//pGrid->CopyData(0, 1, DataType_State);
@@ -0,0 +1,49 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    TracerArray.h
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _TRACERARRAY_H_
+#define _TRACERARRAY_H_
+
+#include "DataArray3D.h"
+#include "DataArray4D.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Storage type of the tracers held by each GridPatch.  With single
+///		precision tracers only the stored values are rounded; tendencies
+///		are accumulated in double precision and rounded once when written.
+///	</summary>
+#if defined(TEMPEST_SINGLE_PRECISION_TRACERS)
+typedef float TracerReal;
+#else
+typedef double TracerReal;
+#endif
+
+///	<summary>
+///		Tracer data on a GridPatch (tracer, level, alpha, beta).
+///	</summary>
+typedef DataArray4D<TracerReal> TracerArray4D;
+
+///	<summary>
+///		A single tracer on a GridPatch (level, alpha, beta).
+///	</summary>
+typedef DataArray3D<TracerReal> TracerArray3D;
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
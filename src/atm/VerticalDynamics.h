@@ -125,6 +125,12 @@ public:
 	) {
 	}
 
+public:
+	///	<summary>
+	///		Report solver statistics.  Called after time stepping.
+	///	</summary>
+	virtual void ReportStatistics() { }
+
 protected:
 	///	<summary>
 	///		Reference to the model.
@@ -29,6 +29,9 @@
 #include "TimeObj.h"
 #include "PolynomialInterp.h"
 #include "LinearAlgebra.h"
+#include "ThreadTools.h"
+
+#include <algorithm>
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -57,6 +60,64 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		Relative change in timestep size that forces a retained column
+///		Jacobian to be rebuilt.
+///	</summary>
+static const double JacobianReuseDeltaTTolerance = 1.0e-8;
+
+///	<summary>
+///		Size of the last correction to the Newton step, relative to the
+///		step, at which iterative refinement with a retained column Jacobian
+///		has converged.  A freshly factored Jacobian solves the Newton
+///		system to roundoff, so the refined step must match it closely:
+///		looser tolerances visibly change the solution (see
+///		test/hpc/run_jacobianreuse.sh).
+///	</summary>
+static const double JacobianReuseTolerance = 1.0e-10;
+
+///	<summary>
+///		Maximum number of back-solves with a retained column Jacobian in a
+///		single implicit solve before the Jacobian is considered to converge
+///		too slowly and is refactored.  Each back-solve typically reduces
+///		the correction by a factor of 10 or more.
+///	</summary>
+static const int JacobianReuseMaxIterations = 16;
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Compute dR = dF - A * dX, where A is an n x n matrix with nKL
+///		subdiagonals and nKU superdiagonals in LAPACK band storage with
+///		leading dimension nLDAB.
+///	</summary>
+static void BandedResidual(
+	int nN,
+	int nKL,
+	int nKU,
+	int nLDAB,
+	const double * dAB,
+	const double * dX,
+	const double * dF,
+	double * dR
+) {
+	for (int i = 0; i < nN; i++) {
+		dR[i] = dF[i];
+	}
+	for (int j = 0; j < nN; j++) {
+		const double * dCol = dAB + j * nLDAB + nKL + nKU - j;
+
+		int iBegin = std::max(0, j - nKU);
+		int iEnd = std::min(nN, j + nKL + 1);
+
+		for (int i = iBegin; i < iEnd; i++) {
+			dR[i] -= dCol[i] * dX[j];
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 VerticalDynamicsFEM::VerticalDynamicsFEM(
 	Model & model,
 	int nHorizontalOrder,
@@ -64,7 +125,8 @@ VerticalDynamicsFEM::VerticalDynamicsFEM(
 	int nHypervisOrder,
 	bool fFullyExplicit,
 	bool fUseReferenceState,
-	bool fForceMassFluxOnLevels
+	bool fForceMassFluxOnLevels,
+	int nJacobianReuse
 ) :
 	VerticalDynamics(model),
 	m_nHorizontalOrder(nHorizontalOrder),
@@ -73,7 +135,8 @@ VerticalDynamicsFEM::VerticalDynamicsFEM(
 	m_fUseReferenceState(fUseReferenceState),
 	m_fForceMassFluxOnLevels(fForceMassFluxOnLevels),
 	m_nHypervisOrder(nHypervisOrder),
-	m_dHypervisCoeff(0.0)
+	m_dHypervisCoeff(0.0),
+	m_nJacobianReuse(nJacobianReuse)
 {
 	if (nHypervisOrder % 2 == 1) {
 		_EXCEPTIONT("Vertical hyperdiffusion order must be even.");
@@ -82,11 +145,139 @@ VerticalDynamicsFEM::VerticalDynamicsFEM(
 	if (nHypervisOrder < 0) {
 		_EXCEPTIONT("Vertical hyperdiffusion order must be nonnegative.");
 	}
+
+	if (nJacobianReuse < 0) {
+		_EXCEPTIONT("Jacobian reuse count must be nonnegative.");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::ColumnWorkspace::Allocate(
+	int nRElements,
+	int nComponents,
+	int nColumnStateSize,
+	int nJacobianFWidth,
+	int nUpwindWeights
+) {
+	// Upwind weights
+	m_dUpwindWeights.Allocate(nUpwindWeights);
+
+	// Allocate column for JFNK
+	m_dColumnState.Allocate(nColumnStateSize);
+
+	// Allocation reference column
+	m_dStateRefNode.Allocate(5, nRElements);
+	m_dStateRefREdge.Allocate(5, nRElements+1);
+
+	// Solution vector from JFNK
+	m_dSoln.Allocate(nColumnStateSize);
+	m_dColumnResidual.Allocate(nColumnStateSize);
+	m_dColumnStep.Allocate(nColumnStateSize);
+
+	// State vector at levels
+	m_dStateNode.Allocate(
+		nComponents,
+		nRElements);
+
+	// State vector at interfaces
+	m_dStateREdge.Allocate(
+		nComponents,
+		nRElements+1);
+
+	// Auxiliary variables
+	m_dStateAux.Allocate(nRElements+1);
+	m_dStateAuxDiff.Allocate(nRElements+1);
+
+	m_dXiDotNode.Allocate(nRElements);
+	m_dXiDotREdge.Allocate(nRElements+1);
+	m_dXiDotREdgeInitial.Allocate(nRElements+1);
+
+	m_dDiffUa.Allocate(nRElements+1);
+	m_dDiffUb.Allocate(nRElements+1);
+
+	m_dDiffPNode.Allocate(nRElements);
+	m_dDiffPREdge.Allocate(nRElements+1);
+
+	m_dDiffDiffStateUpwind.Allocate(
+		nComponents,
+		nRElements+1);
+
+	m_dDiffDiffStateUniform.Allocate(
+		nComponents,
+		nRElements+1);
+
+	m_dDiffDiffStateHypervis.Allocate(
+		nComponents,
+		nRElements+1);
+
+	m_dDiffThetaNode.Allocate(nRElements);
+	m_dDiffThetaREdge.Allocate(nRElements+1);
+
+	m_dDiffWNode.Allocate(nRElements);
+	m_dDiffWREdge.Allocate(nRElements+1);
+
+	m_dHorizKineticEnergyNode.Allocate(nRElements);
+	m_dKineticEnergyNode.Allocate(nRElements);
+	m_dDiffKineticEnergyNode.Allocate(nRElements);
+	m_dDiffKineticEnergyREdge.Allocate(nRElements+1);
+
+	m_dMassFluxNode.Allocate(nRElements);
+	m_dDiffMassFluxNode.Allocate(nRElements);
+	m_dMassFluxREdge.Allocate(nRElements+1);
+	m_dDiffMassFluxREdge.Allocate(nRElements+1);
+
+	m_dPressureFluxNode.Allocate(nRElements);
+	m_dDiffPressureFluxNode.Allocate(nRElements);
+	m_dPressureFluxREdge.Allocate(nRElements+1);
+	m_dDiffPressureFluxREdge.Allocate(nRElements+1);
+
+	m_dExnerNode.Allocate(nRElements);
+	m_dExnerREdge.Allocate(nRElements+1);
+
+	m_dTracerDensityNode.Allocate(nRElements);
+	m_dTracerDensityREdge.Allocate(nRElements+1);
+
+	m_dInitialDensityNode.Allocate(nRElements);
+	m_dInitialDensityREdge.Allocate(nRElements+1);
+
+	m_dUpdateDensityNode.Allocate(nRElements);
+	m_dUpdateDensityREdge.Allocate(nRElements+1);
+
+	m_vecTracersF.Allocate(nRElements);
+	m_matTracersLUDF.Allocate(nRElements, nRElements);
+	m_vecTracersIPiv.Allocate(nRElements);
+
+	// Metric quantities
+	m_dColumnJacobianNode.Allocate(nRElements);
+	m_dColumnJacobianREdge.Allocate(nRElements+1);
+	m_dColumnElementArea.Allocate(nRElements);
+	m_dColumnInvJacobianNode.Allocate(nRElements);
+	m_dColumnInvJacobianREdge.Allocate(nRElements+1);
+	m_dColumnDerivRNode.Allocate(nRElements, 3);
+	m_dColumnDerivRREdge.Allocate(nRElements+1, 3);
+	m_dColumnContraMetricA.Allocate(nRElements, 3);
+	m_dColumnContraMetricB.Allocate(nRElements, 3);
+	m_dColumnContraMetricXi.Allocate(nRElements, 3);
+	m_dColumnContraMetricAREdge.Allocate(nRElements+1, 3);
+	m_dColumnContraMetricBREdge.Allocate(nRElements+1, 3);
+	m_dColumnContraMetricXiREdge.Allocate(nRElements+1, 3);
+
+	// Initialize Jacobian matrix
+	m_matJacobianF.Allocate(nColumnStateSize, nJacobianFWidth);
+
+	// Initialize pivot vector
+	m_vecIPiv.Allocate(nColumnStateSize);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 VerticalDynamicsFEM::~VerticalDynamicsFEM() {
+#ifdef USE_JFNK_GMRES
+	for (int t = 0; t < m_vecColumnJFNK.size(); t++) {
+		delete m_vecColumnJFNK[t];
+	}
+#endif
 #ifdef USE_JFNK_PETSC
 	SNESDestroy(&m_snes);
 	VecDestroy(&m_vecX);
@@ -208,18 +399,6 @@ void VerticalDynamicsFEM::Initialize() {
 #endif
 #endif
 
-#if defined(USE_JACOBIAN_DIAGONAL)
-	// Initialize Jacobian matrix
-	m_matJacobianF.Allocate(m_nColumnStateSize, m_nJacobianFWidth);
-#else
-	// Initialize Jacobian matrix
-	m_matJacobianF.Allocate(m_nColumnStateSize, m_nColumnStateSize);
-#endif
-	
-	// Initialize pivot vector
-	m_vecIPiv.Allocate(m_nColumnStateSize);
-
-
 	// Announce vertical dynamics configuration
 	AnnounceStartBlock("Configuring VerticalDynamicsFEM");
 
@@ -305,99 +484,6 @@ void VerticalDynamicsFEM::Initialize() {
 	// End block
 	AnnounceEndBlock(NULL);
 
-	// Upwind weights
-	if (pGrid->GetVerticalDiscretization() ==
-	    Grid::VerticalDiscretization_FiniteVolume
-	) {
-		m_dUpwindWeights.Allocate(nRElements-1);
-
-	} else {
-		m_dUpwindWeights.Allocate(nRElements / m_nVerticalOrder - 1);
-	}
-
-	// Allocate column for JFNK
-	m_dColumnState.Allocate(m_nColumnStateSize);
-
-	// Allocation reference column
-	m_dStateRefNode.Allocate(5, nRElements);
-	m_dStateRefREdge.Allocate(5, nRElements+1);
-
-	// Solution vector from JFNK
-	m_dSoln.Allocate(m_nColumnStateSize);
-
-	// State vector at levels
-	m_dStateNode.Allocate(
-		m_model.GetEquationSet().GetComponents(),
-		nRElements);
-
-	// State vector at interfaces
-	m_dStateREdge.Allocate(
-		m_model.GetEquationSet().GetComponents(),
-		nRElements+1);
-
-	// Auxiliary variables
-	m_dStateAux.Allocate(nRElements+1);
-	m_dStateAuxDiff.Allocate(nRElements+1);
-
-	m_dXiDotNode.Allocate(nRElements);
-	m_dXiDotREdge.Allocate(nRElements+1);
-	m_dXiDotREdgeInitial.Allocate(nRElements+1);
-
-	m_dDiffUa.Allocate(nRElements+1);
-	m_dDiffUb.Allocate(nRElements+1);
-
-	m_dDiffPNode.Allocate(nRElements);
-	m_dDiffPREdge.Allocate(nRElements+1);
-
-	m_dDiffDiffStateUpwind.Allocate(
-		m_model.GetEquationSet().GetComponents(),
-		nRElements+1);
-
-	m_dDiffDiffStateUniform.Allocate(
-		m_model.GetEquationSet().GetComponents(),
-		nRElements+1);
-
-	m_dDiffDiffStateHypervis.Allocate(
-		m_model.GetEquationSet().GetComponents(),
-		nRElements+1);
-
-	m_dDiffThetaNode.Allocate(nRElements);
-	m_dDiffThetaREdge.Allocate(nRElements+1);
-
-	m_dDiffWNode.Allocate(nRElements);
-	m_dDiffWREdge.Allocate(nRElements+1);
-
-	m_dHorizKineticEnergyNode.Allocate(nRElements);
-	m_dKineticEnergyNode.Allocate(nRElements);
-	m_dDiffKineticEnergyNode.Allocate(nRElements);
-	m_dDiffKineticEnergyREdge.Allocate(nRElements+1);
-
-	m_dMassFluxNode.Allocate(nRElements);
-	m_dDiffMassFluxNode.Allocate(nRElements);
-	m_dMassFluxREdge.Allocate(nRElements+1);
-	m_dDiffMassFluxREdge.Allocate(nRElements+1);
-
-	m_dPressureFluxNode.Allocate(nRElements);
-	m_dDiffPressureFluxNode.Allocate(nRElements);
-	m_dPressureFluxREdge.Allocate(nRElements+1);
-	m_dDiffPressureFluxREdge.Allocate(nRElements+1);
-
-	m_dExnerNode.Allocate(nRElements);
-	m_dExnerREdge.Allocate(nRElements+1);
-
-	m_dTracerDensityNode.Allocate(nRElements);
-	m_dTracerDensityREdge.Allocate(nRElements+1);
-
-	m_dInitialDensityNode.Allocate(nRElements);
-	m_dInitialDensityREdge.Allocate(nRElements+1);
-
-	m_dUpdateDensityNode.Allocate(nRElements);
-	m_dUpdateDensityREdge.Allocate(nRElements+1);
-
-	m_vecTracersF.Allocate(nRElements);
-	m_matTracersLUDF.Allocate(nRElements, nRElements);
-	m_vecTracersIPiv.Allocate(nRElements);
-
 	// Compute upwinding coefficient
 	m_dUpwindCoeff = (1.0 / 2.0)
 		* pow(1.0 / static_cast<double>(nRElements), 1.0);
@@ -426,42 +512,140 @@ void VerticalDynamicsFEM::Initialize() {
 		_EXCEPTIONT("UNIMPLEMENTED: Vertical hyperdiffusion order > 8");
 	}
 
-	// Metric quantities
-	m_dColumnJacobianNode.Allocate(nRElements);
-	m_dColumnJacobianREdge.Allocate(nRElements+1);
-	m_dColumnElementArea.Allocate(nRElements);
-	m_dColumnInvJacobianNode.Allocate(nRElements);
-	m_dColumnInvJacobianREdge.Allocate(nRElements+1);
-	m_dColumnDerivRNode.Allocate(nRElements, 3);
-	m_dColumnDerivRREdge.Allocate(nRElements+1, 3);
-	m_dColumnContraMetricA.Allocate(nRElements, 3);
-	m_dColumnContraMetricB.Allocate(nRElements, 3);
-	m_dColumnContraMetricXi.Allocate(nRElements, 3);
-	m_dColumnContraMetricAREdge.Allocate(nRElements+1, 3);
-	m_dColumnContraMetricBREdge.Allocate(nRElements+1, 3);
-	m_dColumnContraMetricXiREdge.Allocate(nRElements+1, 3);
-}
+	// Column workspaces, one per thread, or one per lane of each thread's
+	// batch when USE_JACOBIAN_BATCHED is defined
+#if defined(USE_DIRECTSOLVE) \
+ && defined(USE_JACOBIAN_DIAGONAL) \
+ && defined(USE_JACOBIAN_BATCHED)
+	int nColumnWorkspaces = GetMaxThreadCount() * BatchedBandedLU::Lanes;
+
+	m_vecColumnBatchLU.resize(GetMaxThreadCount());
+	for (int t = 0; t < m_vecColumnBatchLU.size(); t++) {
+		m_vecColumnBatchLU[t].Initialize(
+			m_nColumnStateSize,
+			m_nJacobianFOffD,
+			m_nJacobianFOffD);
+	}
 
-///////////////////////////////////////////////////////////////////////////////
+	// Retained Jacobians are allocated on the first implicit step
+	m_vecColumnBatchJacobian.clear();
+#else
+	int nColumnWorkspaces = GetMaxThreadCount();
 
-void VerticalDynamicsFEM::StepImplicitTermsExplicitly(
-	int iDataInitial,
-	int iDataUpdate,
-	const Time & time,
-	double dDeltaT
-) {
-	// Get a copy of the grid
-	GridGLL * pGrid = dynamic_cast<GridGLL *>(m_model.GetGrid());
+	if (m_nJacobianReuse > 0) {
+		_EXCEPTIONT("Jacobian reuse requires USE_DIRECTSOLVE, "
+			"USE_JACOBIAN_DIAGONAL and USE_JACOBIAN_BATCHED");
+	}
+#endif
 
-	// Physical constants
-	const PhysicalConstants & phys = m_model.GetPhysicalConstants();
+#if defined(USE_JACOBIAN_DIAGONAL)
+	int nJacobianFWidth = m_nJacobianFWidth;
+#else
+	int nJacobianFWidth = m_nColumnStateSize;
+#endif
 
-	// Indices of EquationSet variables
-	const int UIx = 0;
-	const int VIx = 1;
-	const int PIx = 2;
-	const int WIx = 3;
-	const int RIx = 4;
+	// Number of upwind weights
+	int nUpwindWeights;
+	if (pGrid->GetVerticalDiscretization() ==
+	    Grid::VerticalDiscretization_FiniteVolume
+	) {
+		nUpwindWeights = nRElements-1;
+
+	} else {
+		nUpwindWeights = nRElements / m_nVerticalOrder - 1;
+	}
+
+
+	m_vecColumnWorkspace.clear();
+	m_vecColumnWorkspace.resize(nColumnWorkspaces);
+	for (int t = 0; t < m_vecColumnWorkspace.size(); t++) {
+		m_vecColumnWorkspace[t].Allocate(
+			nRElements,
+			m_model.GetEquationSet().GetComponents(),
+			m_nColumnStateSize,
+			nJacobianFWidth,
+			nUpwindWeights);
+	}
+
+#ifdef USE_JFNK_GMRES
+	// Column JFNK solvers, one per column workspace
+	for (int t = 0; t < m_vecColumnJFNK.size(); t++) {
+		delete m_vecColumnJFNK[t];
+	}
+	m_vecColumnJFNK.resize(m_vecColumnWorkspace.size());
+	for (int t = 0; t < m_vecColumnJFNK.size(); t++) {
+		m_vecColumnJFNK[t] =
+			new ColumnJFNK(*this, m_vecColumnWorkspace[t]);
+		m_vecColumnJFNK[t]->InitializeJFNK(
+			m_nColumnStateSize, m_nColumnStateSize, 1.0e-5);
+	}
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::ReportStatistics() {
+
+#if defined(USE_DIRECTSOLVE) \
+ && defined(USE_JACOBIAN_DIAGONAL) \
+ && defined(USE_JACOBIAN_BATCHED)
+	if (m_nJacobianReuse == 0) {
+		return;
+	}
+
+	// Sum statistics over all retained Jacobians on this rank
+	long lStats[6] = {0, 0, 0, 0, 0, 0};
+	for (int n = 0; n < m_vecColumnBatchJacobian.size(); n++) {
+	for (int b = 0; b < m_vecColumnBatchJacobian[n].size(); b++) {
+		const ColumnBatchJacobian & jac = m_vecColumnBatchJacobian[n][b];
+		lStats[0] += jac.nFactorizations;
+		lStats[1] += jac.nReuses;
+		lStats[2] += jac.nIterations;
+		lStats[3] += jac.nRefreshDeltaT;
+		lStats[4] += jac.nRefreshAge;
+		lStats[5] += jac.nRefreshSlow;
+	}
+	}
+
+	long lGlobalStats[6] = {0, 0, 0, 0, 0, 0};
+#if defined(TEMPEST_MPIOMP)
+	MPI_Reduce(lStats, lGlobalStats,
+		6, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
+#else
+	for (int i = 0; i < 6; i++) {
+		lGlobalStats[i] = lStats[i];
+	}
+#endif
+
+	Announce("Column Jacobian batches: %li factored, %li reused",
+		lGlobalStats[0], lGlobalStats[1]);
+	Announce("Column Jacobian back-solves with retained factors: %li",
+		lGlobalStats[2]);
+	Announce("Column Jacobian refreshes: %li timestep, %li age, %li slow",
+		lGlobalStats[3], lGlobalStats[4], lGlobalStats[5]);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::StepImplicitTermsExplicitly(
+	int iDataInitial,
+	int iDataUpdate,
+	const Time & time,
+	double dDeltaT
+) {
+	// Get a copy of the grid
+	GridGLL * pGrid = dynamic_cast<GridGLL *>(m_model.GetGrid());
+
+	// Physical constants
+	const PhysicalConstants & phys = m_model.GetPhysicalConstants();
+
+	// Indices of EquationSet variables
+	const int UIx = 0;
+	const int VIx = 1;
+	const int PIx = 2;
+	const int WIx = 3;
+	const int RIx = 4;
 
 	// Number of elements
 	const int nRElements = pGrid->GetRElements();
@@ -469,17 +653,20 @@ void VerticalDynamicsFEM::StepImplicitTermsExplicitly(
 	// Number of finite elements in the vertical
 	const int nFiniteElements = nRElements / m_nVerticalOrder;
 
+	// Explicit updates are performed serially in the first workspace
+	ColumnWorkspace & ws = m_vecColumnWorkspace[0];
+
 	// Store timestep size
 	m_dDeltaT = dDeltaT;
 
 	// Reset the reference state
-	memset(m_dStateRefNode[WIx],  0,  nRElements   *sizeof(double));
-	memset(m_dStateRefREdge[WIx], 0, (nRElements+1)*sizeof(double));
+	memset(ws.m_dStateRefNode[WIx],  0,  nRElements   *sizeof(double));
+	memset(ws.m_dStateRefREdge[WIx], 0, (nRElements+1)*sizeof(double));
 /*
 	for (std::ptrdiff_t e = 0; e < nRElements; ++e)
-		m_dStateRefNode[WIx][e];
+		ws.m_dStateRefNode[WIx][e];
 	for (std::ptrdiff_t e = 0; e < (nRElements+1); ++e)
-		m_dStateRefREdge[WIx][e];
+		ws.m_dStateRefREdge[WIx][e];
 */
 	// Perform local update
 	for (int n = 0; n < pGrid->GetActivePatchCount(); n++) {
@@ -506,40 +693,40 @@ void VerticalDynamicsFEM::StepImplicitTermsExplicitly(
 		DataArray4D<double> & dataUpdateREdge =
 			pPatch->GetDataState(iDataUpdate, DataLocation_REdge);
 
-		DataArray4D<double> & dataReferenceTracer =
+		TracerArray4D & dataReferenceTracer =
 			pPatch->GetReferenceTracers();
 
-		DataArray4D<double> & dataInitialTracer =
+		TracerArray4D & dataInitialTracer =
 			pPatch->GetDataTracers(iDataInitial);
 
-		DataArray4D<double> & dataUpdateTracer =
+		TracerArray4D & dataUpdateTracer =
 			pPatch->GetDataTracers(iDataUpdate);
 
 		// Metric quantities
-		const DataArray4D<double> & dDerivRNode =
+		const MetricArray4D & dDerivRNode =
 			pPatch->GetDerivRNode();
 
-		const DataArray4D<double> & dContraMetricXi =
+		const MetricArray4D & dContraMetricXi =
 			pPatch->GetContraMetricXi();
 
-		const DataArray4D<double> & dDerivRREdge =
+		const MetricArray4D & dDerivRREdge =
 			pPatch->GetDerivRREdge();
 
-		const DataArray4D<double> & dContraMetricXiREdge =
+		const MetricArray4D & dContraMetricXiREdge =
 			pPatch->GetContraMetricXiREdge();
 
 #if defined(EXPLICIT_VERTICAL_VELOCITY_ADVECTION) && \
     defined(VERTICAL_VELOCITY_ADVECTION_CLARK)
-		const DataArray4D<double> & dContraMetricA =
+		const MetricArray4D & dContraMetricA =
 			pPatch->GetContraMetricA();
 
-		const DataArray4D<double> & dContraMetricB =
+		const MetricArray4D & dContraMetricB =
 			pPatch->GetContraMetricB();
 
-		const DataArray4D<double> & dContraMetricAREdge =
+		const MetricArray4D & dContraMetricAREdge =
 			pPatch->GetContraMetricAREdge();
 
-		const DataArray4D<double> & dContraMetricBREdge =
+		const MetricArray4D & dContraMetricBREdge =
 			pPatch->GetContraMetricBREdge();
 #endif
 #if defined(EXPLICIT_VERTICAL_VELOCITY_ADVECTION)
@@ -563,24 +750,25 @@ void VerticalDynamicsFEM::StepImplicitTermsExplicitly(
 			int iB = j;
 
 			SetupReferenceColumn(
+				ws,
 				pPatch, iA, iB,
 				dataRefNode,
 				dataInitialNode,
 				dataRefREdge,
 				dataInitialREdge);
 
-			Evaluate(m_dColumnState, m_dSoln);
+			Evaluate(ws, ws.m_dColumnState, ws.m_dSoln);
 
 			// Apply update to P
 			if (pGrid->GetVarLocation(PIx) == DataLocation_REdge) {
 				for (int k = 0; k <= nRElements; k++) {
 					dataUpdateREdge[PIx][k][iA][iB] -=
-						dDeltaT * m_dSoln[VecFIx(FPIx, k)];
+						dDeltaT * ws.m_dSoln[VecFIx(FPIx, k)];
 				}
 			} else {
 				for (int k = 0; k < nRElements; k++) {
 					dataUpdateNode[PIx][k][iA][iB] -=
-						dDeltaT * m_dSoln[VecFIx(FPIx, k)];
+						dDeltaT * ws.m_dSoln[VecFIx(FPIx, k)];
 				}
 			}
 
@@ -588,13 +776,13 @@ void VerticalDynamicsFEM::StepImplicitTermsExplicitly(
 			if (pGrid->GetVarLocation(WIx) == DataLocation_REdge) {
 				for (int k = 0; k <= nRElements; k++) {
 					dataUpdateREdge[WIx][k][iA][iB] -=
-						dDeltaT * m_dSoln[VecFIx(FWIx, k)];
+						dDeltaT * ws.m_dSoln[VecFIx(FWIx, k)];
 				}
 
 			} else {
 				for (int k = 0; k < nRElements; k++) {
 					dataUpdateNode[WIx][k][iA][iB] -=
-						dDeltaT * m_dSoln[VecFIx(FWIx, k)];
+						dDeltaT * ws.m_dSoln[VecFIx(FWIx, k)];
 				}
 			}
 
@@ -602,17 +790,18 @@ void VerticalDynamicsFEM::StepImplicitTermsExplicitly(
 			if (pGrid->GetVarLocation(RIx) == DataLocation_REdge) {
 				for (int k = 0; k <= nRElements; k++) {
 					dataUpdateREdge[RIx][k][iA][iB] -=
-						dDeltaT * m_dSoln[VecFIx(FRIx, k)];
+						dDeltaT * ws.m_dSoln[VecFIx(FRIx, k)];
 				}
 			} else {
 				for (int k = 0; k < nRElements; k++) {
 					dataUpdateNode[RIx][k][iA][iB] -=
-						dDeltaT * m_dSoln[VecFIx(FRIx, k)];
+						dDeltaT * ws.m_dSoln[VecFIx(FRIx, k)];
 				}
 			}
 
 			// Update tracers in column
 			UpdateColumnTracers(
+				ws,
 				dDeltaT,
 				dataInitialNode,
 				dataUpdateNode,
@@ -664,12 +853,15 @@ void VerticalDynamicsFEM::StepExplicit(
 		nNodesPerFiniteElement = 1;
 	}
 
+	// Explicit updates are performed serially in the first workspace
+	ColumnWorkspace & ws = m_vecColumnWorkspace[0];
+
 	// Store timestep size
 	m_dDeltaT = dDeltaT;
 
 	// Reset the reference state
-	memset(m_dStateRefNode[WIx],  0,  nRElements   *sizeof(double));
-	memset(m_dStateRefREdge[WIx], 0, (nRElements+1)*sizeof(double));
+	memset(ws.m_dStateRefNode[WIx],  0,  nRElements   *sizeof(double));
+	memset(ws.m_dStateRefREdge[WIx], 0, (nRElements+1)*sizeof(double));
 
 	// Perform local update
 	for (int n = 0; n < pGrid->GetActivePatchCount(); n++) {
@@ -696,40 +888,40 @@ void VerticalDynamicsFEM::StepExplicit(
 		DataArray4D<double> & dataUpdateREdge =
 			pPatch->GetDataState(iDataUpdate, DataLocation_REdge);
 
-		DataArray4D<double> & dataReferenceTracer =
+		TracerArray4D & dataReferenceTracer =
 			pPatch->GetReferenceTracers();
 
-		DataArray4D<double> & dataInitialTracer =
+		TracerArray4D & dataInitialTracer =
 			pPatch->GetDataTracers(iDataInitial);
 
-		DataArray4D<double> & dataUpdateTracer =
+		TracerArray4D & dataUpdateTracer =
 			pPatch->GetDataTracers(iDataUpdate);
 
 		// Metric quantities
-		const DataArray4D<double> & dDerivRNode =
+		const MetricArray4D & dDerivRNode =
 			pPatch->GetDerivRNode();
 
-		const DataArray4D<double> & dContraMetricXi =
+		const MetricArray4D & dContraMetricXi =
 			pPatch->GetContraMetricXi();
 
-		const DataArray4D<double> & dDerivRREdge =
+		const MetricArray4D & dDerivRREdge =
 			pPatch->GetDerivRREdge();
 
-		const DataArray4D<double> & dContraMetricXiREdge =
+		const MetricArray4D & dContraMetricXiREdge =
 			pPatch->GetContraMetricXiREdge();
 
 #if defined(EXPLICIT_VERTICAL_VELOCITY_ADVECTION) && \
     defined(VERTICAL_VELOCITY_ADVECTION_CLARK)
-		const DataArray4D<double> & dContraMetricA =
+		const MetricArray4D & dContraMetricA =
 			pPatch->GetContraMetricA();
 
-		const DataArray4D<double> & dContraMetricB =
+		const MetricArray4D & dContraMetricB =
 			pPatch->GetContraMetricB();
 
-		const DataArray4D<double> & dContraMetricAREdge =
+		const MetricArray4D & dContraMetricAREdge =
 			pPatch->GetContraMetricAREdge();
 
-		const DataArray4D<double> & dContraMetricBREdge =
+		const MetricArray4D & dContraMetricBREdge =
 			pPatch->GetContraMetricBREdge();
 #endif
 /*
@@ -753,6 +945,7 @@ void VerticalDynamicsFEM::StepExplicit(
 			// Setup the reference column:  Store U and V in m_dState arrays
 			// and interpolate U and V from levels to interfaces.
 			SetupReferenceColumn(
+				ws,
 				pPatch, i, j,
 				dataRefNode,
 				dataInitialNode,
@@ -762,39 +955,39 @@ void VerticalDynamicsFEM::StepExplicit(
 			// Store W in m_dState structure on levels and interfaces
 			if (pGrid->GetVarLocation(WIx) == DataLocation_Node) {
 				for (int k = 0; k < nRElements; k++) {
-					m_dStateNode[WIx][k] = dataInitialNode[WIx][k][i][j];
+					ws.m_dStateNode[WIx][k] = dataInitialNode[WIx][k][i][j];
 				}
 
 				pGrid->InterpolateNodeToREdge(
-					m_dStateNode[WIx],
-					m_dStateREdge[WIx]);
+					ws.m_dStateNode[WIx],
+					ws.m_dStateREdge[WIx]);
 
 			} else {
 				for (int k = 0; k <= nRElements; k++) {
-					m_dStateREdge[WIx][k] = dataInitialREdge[WIx][k][i][j];
+					ws.m_dStateREdge[WIx][k] = dataInitialREdge[WIx][k][i][j];
 				}
 
 				pGrid->InterpolateREdgeToNode(
-					m_dStateREdge[WIx],
-					m_dStateNode[WIx]);
+					ws.m_dStateREdge[WIx],
+					ws.m_dStateNode[WIx]);
 			}
 
 			// Update thermodynamic variables
 			if (m_fFullyExplicit) {
 
 				// Evaluate the time tendency equations
-				Evaluate(m_dColumnState, m_dSoln);
+				Evaluate(ws, ws.m_dColumnState, ws.m_dSoln);
 
 				// Apply update to P
 				if (pGrid->GetVarLocation(PIx) == DataLocation_REdge) {
 					for (int k = 0; k <= nRElements; k++) {
 						dataUpdateREdge[PIx][k][i][j] -=
-							dDeltaT * m_dSoln[VecFIx(FPIx, k)];
+							dDeltaT * ws.m_dSoln[VecFIx(FPIx, k)];
 					}
 				} else {
 					for (int k = 0; k < nRElements; k++) {
 						dataUpdateNode[PIx][k][i][j] -=
-							dDeltaT * m_dSoln[VecFIx(FPIx, k)];
+							dDeltaT * ws.m_dSoln[VecFIx(FPIx, k)];
 					}
 				}
 
@@ -802,13 +995,13 @@ void VerticalDynamicsFEM::StepExplicit(
 				if (pGrid->GetVarLocation(WIx) == DataLocation_REdge) {
 					for (int k = 0; k <= nRElements; k++) {
 						dataUpdateREdge[WIx][k][i][j] -=
-							dDeltaT * m_dSoln[VecFIx(FWIx, k)];
+							dDeltaT * ws.m_dSoln[VecFIx(FWIx, k)];
 					}
 
 				} else {
 					for (int k = 0; k < nRElements; k++) {
 						dataUpdateNode[WIx][k][i][j] -=
-							dDeltaT * m_dSoln[VecFIx(FWIx, k)];
+							dDeltaT * ws.m_dSoln[VecFIx(FWIx, k)];
 					}
 				}
 
@@ -816,17 +1009,18 @@ void VerticalDynamicsFEM::StepExplicit(
 				if (pGrid->GetVarLocation(RIx) == DataLocation_REdge) {
 					for (int k = 0; k <= nRElements; k++) {
 						dataUpdateREdge[RIx][k][i][j] -=
-							dDeltaT * m_dSoln[VecFIx(FRIx, k)];
+							dDeltaT * ws.m_dSoln[VecFIx(FRIx, k)];
 					}
 				} else {
 					for (int k = 0; k < nRElements; k++) {
 						dataUpdateNode[RIx][k][i][j] -=
-							dDeltaT * m_dSoln[VecFIx(FRIx, k)];
+							dDeltaT * ws.m_dSoln[VecFIx(FRIx, k)];
 					}
 				}
 
 				// Update tracers in column
 				UpdateColumnTracers(
+					ws,
 					dDeltaT,
 					dataInitialNode,
 					dataUpdateNode,
@@ -840,39 +1034,39 @@ void VerticalDynamicsFEM::StepExplicit(
 			// when m_fFullyExplicit is enabled)
 			} else {
 				for (int k = 0; k <= nRElements; k++) {
-					double dCovUa = m_dStateREdge[UIx][k];
-					double dCovUb = m_dStateREdge[VIx][k];
+					double dCovUa = ws.m_dStateREdge[UIx][k];
+					double dCovUb = ws.m_dStateREdge[VIx][k];
 					double dCovUx =
-						  m_dStateREdge[WIx][k]
-						* m_dColumnDerivRREdge[k][2];
+						  ws.m_dStateREdge[WIx][k]
+						* ws.m_dColumnDerivRREdge[k][2];
 
-					m_dXiDotREdge[k] =
-						  m_dColumnContraMetricXiREdge[k][0] * dCovUa
-						+ m_dColumnContraMetricXiREdge[k][1] * dCovUb
-						+ m_dColumnContraMetricXiREdge[k][2] * dCovUx;
+					ws.m_dXiDotREdge[k] =
+						  ws.m_dColumnContraMetricXiREdge[k][0] * dCovUa
+						+ ws.m_dColumnContraMetricXiREdge[k][1] * dCovUb
+						+ ws.m_dColumnContraMetricXiREdge[k][2] * dCovUx;
 				}
 
-				m_dXiDotREdge[0] = 0.0;
-				m_dXiDotREdge[nRElements] = 0.0;
+				ws.m_dXiDotREdge[0] = 0.0;
+				ws.m_dXiDotREdge[nRElements] = 0.0;
 
 				// Calculate u^xi on model levels (interpolated
 				// from interfaces)
 				pGrid->InterpolateREdgeToNode(
-					m_dXiDotREdge,
-					m_dXiDotNode);
+					ws.m_dXiDotREdge,
+					ws.m_dXiDotNode);
 
 /*
 				for (int k = 0; k < nRElements; k++) {
-					double dCovUa = m_dStateNode[UIx][k];
-					double dCovUb = m_dStateNode[VIx][k];
+					double dCovUa = ws.m_dStateNode[UIx][k];
+					double dCovUb = ws.m_dStateNode[VIx][k];
 					double dCovUx =
-						  m_dStateNode[WIx][k]
-						* m_dColumnDerivRNode[k][2];
+						  ws.m_dStateNode[WIx][k]
+						* ws.m_dColumnDerivRNode[k][2];
 
-					m_dXiDotNode[k] =
-						  m_dColumnContraMetricXi[k][0] * dCovUa
-						+ m_dColumnContraMetricXi[k][1] * dCovUb
-						+ m_dColumnContraMetricXi[k][2] * dCovUx;
+					ws.m_dXiDotNode[k] =
+						  ws.m_dColumnContraMetricXi[k][0] * dCovUa
+						+ ws.m_dColumnContraMetricXi[k][1] * dCovUb
+						+ ws.m_dColumnContraMetricXi[k][2] * dCovUx;
 				}
 */
 			}
@@ -883,17 +1077,17 @@ void VerticalDynamicsFEM::StepExplicit(
 
 				double dCovDxUa =
 					pGrid->DifferentiateNodeToNode(
-						m_dStateNode[UIx], k);
+						ws.m_dStateNode[UIx], k);
 
 				double dCovDxUb =
 					pGrid->DifferentiateNodeToNode(
-						m_dStateNode[VIx], k);
+						ws.m_dStateNode[VIx], k);
 
 				dataUpdateNode[UIx][k][i][j] -=
-					dDeltaT * m_dXiDotNode[k] * dCovDxUa;
+					dDeltaT * ws.m_dXiDotNode[k] * dCovDxUa;
 
 				dataUpdateNode[VIx][k][i][j] -=
-					dDeltaT * m_dXiDotNode[k] * dCovDxUb;
+					dDeltaT * ws.m_dXiDotNode[k] * dCovDxUb;
 
 			}
 
@@ -906,27 +1100,27 @@ void VerticalDynamicsFEM::StepExplicit(
 			{
 				// Calculate specific kinetic energy on model levels
 				for (int k = 0; k < nRElements; k++) {
-					double dCovUa = m_dStateNode[UIx][k];
-					double dCovUb = m_dStateNode[VIx][k];
-					double dCovUx = m_dStateNode[WIx][k]
+					double dCovUa = ws.m_dStateNode[UIx][k];
+					double dCovUb = ws.m_dStateNode[VIx][k];
+					double dCovUx = ws.m_dStateNode[WIx][k]
 						* dDerivRNode[k][i][j][2];
 
 					double dConUa =
-						  m_dColumnContraMetricA[k][0] * dCovUa
-						+ m_dColumnContraMetricA[k][1] * dCovUb
-						+ m_dColumnContraMetricA[k][2] * dCovUx;
+						  ws.m_dColumnContraMetricA[k][0] * dCovUa
+						+ ws.m_dColumnContraMetricA[k][1] * dCovUb
+						+ ws.m_dColumnContraMetricA[k][2] * dCovUx;
 
 					double dConUb =
-						  m_dColumnContraMetricB[k][0] * dCovUa
-						+ m_dColumnContraMetricB[k][1] * dCovUb
-						+ m_dColumnContraMetricB[k][2] * dCovUx;
+						  ws.m_dColumnContraMetricB[k][0] * dCovUa
+						+ ws.m_dColumnContraMetricB[k][1] * dCovUb
+						+ ws.m_dColumnContraMetricB[k][2] * dCovUx;
 
 					double dConUx =
-						  m_dColumnContraMetricXi[k][0] * dCovUa
-						+ m_dColumnContraMetricXi[k][1] * dCovUb
-						+ m_dColumnContraMetricXi[k][2] * dCovUx;
+						  ws.m_dColumnContraMetricXi[k][0] * dCovUa
+						+ ws.m_dColumnContraMetricXi[k][1] * dCovUb
+						+ ws.m_dColumnContraMetricXi[k][2] * dCovUx;
 
-					m_dKineticEnergyNode[k] = 0.5 * (
+					ws.m_dKineticEnergyNode[k] = 0.5 * (
 						  dConUa * dCovUa
 						+ dConUb * dCovUb
 						+ dConUx * dCovUx);
@@ -934,86 +1128,85 @@ void VerticalDynamicsFEM::StepExplicit(
 
 				// Stride through state matrix
 				int nVerticalStateStride =
-					dataInitialNode.GetSize(2)
-					* dataInitialNode.GetSize(3);
+					dataInitialNode.GetStride(1);
 
 				// Update vertical velocity on levels
 				if (pGrid->GetVarLocation(WIx) == DataLocation_Node) {
 					pGrid->DifferentiateNodeToNode(
-						m_dKineticEnergyNode,
-						m_dDiffKineticEnergyNode);
+						ws.m_dKineticEnergyNode,
+						ws.m_dDiffKineticEnergyNode);
 
 					pGrid->DifferentiateNodeToNode(
-						m_dStateNode[UIx],
-						m_dDiffUa);
+						ws.m_dStateNode[UIx],
+						ws.m_dDiffUa);
 
 					pGrid->DifferentiateNodeToNode(
-						m_dStateNode[VIx],
-						m_dDiffUb);
+						ws.m_dStateNode[VIx],
+						ws.m_dDiffUb);
 
 					for (int k = 0; k < nRElements; k++) {
-						double dCovUa = m_dStateNode[UIx][k];
-						double dCovUb = m_dStateNode[VIx][k];
-						double dCovUx = m_dStateNode[WIx][k]
-							* m_dColumnDerivRNode[k][2];
+						double dCovUa = ws.m_dStateNode[UIx][k];
+						double dCovUb = ws.m_dStateNode[VIx][k];
+						double dCovUx = ws.m_dStateNode[WIx][k]
+							* ws.m_dColumnDerivRNode[k][2];
 
 						double dConUa =
-							  m_dColumnContraMetricA[k][0] * dCovUa
-							+ m_dColumnContraMetricA[k][1] * dCovUb
-							+ m_dColumnContraMetricA[k][2] * dCovUx;
+							  ws.m_dColumnContraMetricA[k][0] * dCovUa
+							+ ws.m_dColumnContraMetricA[k][1] * dCovUb
+							+ ws.m_dColumnContraMetricA[k][2] * dCovUx;
 
 						double dConUb =
-							  m_dColumnContraMetricB[k][0] * dCovUa
-							+ m_dColumnContraMetricB[k][1] * dCovUb
-							+ m_dColumnContraMetricB[k][2] * dCovUx;
+							  ws.m_dColumnContraMetricB[k][0] * dCovUa
+							+ ws.m_dColumnContraMetricB[k][1] * dCovUb
+							+ ws.m_dColumnContraMetricB[k][2] * dCovUx;
 
 						double dCurlTerm =
-							- dConUa * m_dDiffUa[k]
-							- dConUb * m_dDiffUb[k];
+							- dConUa * ws.m_dDiffUa[k]
+							- dConUb * ws.m_dDiffUb[k];
 
 						dataUpdateNode[WIx][k][i][j] -=
 							dDeltaT
-							* (m_dDiffKineticEnergyNode[k] + dCurlTerm)
-							/ m_dColumnDerivRNode[k][2];
+							* (ws.m_dDiffKineticEnergyNode[k] + dCurlTerm)
+							/ ws.m_dColumnDerivRNode[k][2];
 					}
 
 				} else {
 					pGrid->DifferentiateNodeToREdge(
-						m_dKineticEnergyNode,
-						m_dDiffKineticEnergyREdge);
+						ws.m_dKineticEnergyNode,
+						ws.m_dDiffKineticEnergyREdge);
 
 					pGrid->DifferentiateNodeToREdge(
-						m_dStateNode[UIx],
-						m_dDiffUa);
+						ws.m_dStateNode[UIx],
+						ws.m_dDiffUa);
 
 					pGrid->DifferentiateNodeToREdge(
-						m_dStateNode[VIx],
-						m_dDiffUb);
+						ws.m_dStateNode[VIx],
+						ws.m_dDiffUb);
 
 					for (int k = 1; k < nRElements; k++) {
-						double dCovUa = m_dStateREdge[UIx][k];
-						double dCovUb = m_dStateREdge[VIx][k];
-						double dCovUx = m_dStateREdge[WIx][k]
-							* m_dColumnDerivRREdge[k][2];
+						double dCovUa = ws.m_dStateREdge[UIx][k];
+						double dCovUb = ws.m_dStateREdge[VIx][k];
+						double dCovUx = ws.m_dStateREdge[WIx][k]
+							* ws.m_dColumnDerivRREdge[k][2];
 
 						double dConUa =
-							  m_dColumnContraMetricAREdge[k][0] * dCovUa
-							+ m_dColumnContraMetricAREdge[k][1] * dCovUb
-							+ m_dColumnContraMetricAREdge[k][2] * dCovUx;
+							  ws.m_dColumnContraMetricAREdge[k][0] * dCovUa
+							+ ws.m_dColumnContraMetricAREdge[k][1] * dCovUb
+							+ ws.m_dColumnContraMetricAREdge[k][2] * dCovUx;
 
 						double dConUb =
-							  m_dColumnContraMetricBREdge[k][0] * dCovUa
-							+ m_dColumnContraMetricBREdge[k][1] * dCovUb
-							+ m_dColumnContraMetricBREdge[k][2] * dCovUx;
+							  ws.m_dColumnContraMetricBREdge[k][0] * dCovUa
+							+ ws.m_dColumnContraMetricBREdge[k][1] * dCovUb
+							+ ws.m_dColumnContraMetricBREdge[k][2] * dCovUx;
 
 						double dCurlTerm =
-							- dConUa * m_dDiffUa[k]
-							- dConUb * m_dDiffUb[k];
+							- dConUa * ws.m_dDiffUa[k]
+							- dConUb * ws.m_dDiffUb[k];
 
 						dataUpdateREdge[WIx][k][i][j] -=
 							dDeltaT
-							* (m_dDiffKineticEnergyREdge[k] + dCurlTerm)
-							/ m_dColumnDerivRREdge[k][2];
+							* (ws.m_dDiffKineticEnergyREdge[k] + dCurlTerm)
+							/ ws.m_dColumnDerivRREdge[k][2];
 					}
 				}
 			}
@@ -1022,8 +1215,7 @@ void VerticalDynamicsFEM::StepExplicit(
 			{
 				// Stride through state matrix
 				int nVerticalStateStride =
-					dataInitialNode.GetSize(2)
-					* dataInitialNode.GetSize(3);
+					dataInitialNode.GetStride(1);
 
 				// Update vertical velocity on levels
 				if (pGrid->GetVarLocation(WIx) == DataLocation_Node) {
@@ -1034,12 +1226,12 @@ void VerticalDynamicsFEM::StepExplicit(
 					for (int k = 1; k < nRElements; k++) {
 						double dDxW =
 							pGrid->DifferentiateREdgeToREdge(
-								&(m_dStateREdge[WIx][0]),
+								&(ws.m_dStateREdge[WIx][0]),
 								k,
 								nVerticalStateStride);
 
 						dataUpdateREdge[WIx][k][i][j] -=
-							dDeltaT * m_dXiDotREdge[k] * dDxW;
+							dDeltaT * ws.m_dXiDotREdge[k] * dDxW;
 					}
 				}
 			}
@@ -1060,19 +1252,18 @@ void VerticalDynamicsFEM::StepExplicit(
 					pGrid->GetOpDiffNodeToNode();
 
 				int nUpwindStride =
-					dataInitialNode.GetSize(2)
-					* dataInitialNode.GetSize(3);
+					dataInitialNode.GetStride(1);
 
 				opDiffNodeToNode.Apply(
 					&(dataInitialNode[PIx][0][i][j]),
-					&(m_dDiffThetaNode[0]),
+					&(ws.m_dDiffThetaNode[0]),
 					nUpwindStride,
 					1);
 
 				// Calculate update to theta
 				for (int k = 0; k < nRElements; k++) {
 					dataUpdateNode[PIx][k][i][j] -=
-						dDeltaT * m_dXiDotNode[k] * m_dDiffThetaNode[k];
+						dDeltaT * ws.m_dXiDotNode[k] * ws.m_dDiffThetaNode[k];
 				}
 			}
 #endif
@@ -1083,8 +1274,8 @@ void VerticalDynamicsFEM::StepExplicit(
 				// Calculate weights
 				for (int a = 0; a < nFiniteElements - 1; a++) {
 					int k = (a+1) * nNodesPerFiniteElement;
-					m_dUpwindWeights[a] =
-						dDeltaT * fabs(m_dXiDotREdge[k]);
+					ws.m_dUpwindWeights[a] =
+						dDeltaT * fabs(ws.m_dXiDotREdge[k]);
 				}
 
 				// Apply upwinding
@@ -1092,20 +1283,19 @@ void VerticalDynamicsFEM::StepExplicit(
 					pGrid->GetOpPenaltyNodeToNode();
 
 				int nUpwindStride =
-					dataInitialNode.GetSize(2)
-					* dataInitialNode.GetSize(3);
+					dataInitialNode.GetStride(1);
 
 				// Apply upwinding to U and V
 				if (m_fUpwindVar[UIx]) {
 					opPenalty.Apply(
-						&(m_dUpwindWeights[0]),
+						&(ws.m_dUpwindWeights[0]),
 						&(dataInitialNode[UIx][0][i][j]),
 						&(dataUpdateNode[UIx][0][i][j]),
 						nUpwindStride,
 						nUpwindStride);
 
 					opPenalty.Apply(
-						&(m_dUpwindWeights[0]),
+						&(ws.m_dUpwindWeights[0]),
 						&(dataInitialNode[VIx][0][i][j]),
 						&(dataUpdateNode[VIx][0][i][j]),
 						nUpwindStride,
@@ -1120,7 +1310,7 @@ void VerticalDynamicsFEM::StepExplicit(
 							   " on interfaces");
 					} else {
 						opPenalty.Apply(
-							&(m_dUpwindWeights[0]),
+							&(ws.m_dUpwindWeights[0]),
 							&(dataInitialNode[PIx][0][i][j]),
 							&(dataUpdateNode[PIx][0][i][j]),
 							nUpwindStride,
@@ -1134,19 +1324,19 @@ void VerticalDynamicsFEM::StepExplicit(
 					if (pGrid->GetVarLocation(WIx) == DataLocation_REdge) {
 
 						pGrid->DiffDiffREdgeToREdge(
-							m_dStateREdge[WIx],
-							m_dDiffDiffStateUpwind[WIx]);
+							ws.m_dStateREdge[WIx],
+							ws.m_dDiffDiffStateUpwind[WIx]);
 
 						for (int k = 1; k < nRElements; k++) {
 							dataUpdateNode[WIx][k][i][j] +=
 								m_dUpwindCoeff
-								* fabs(m_dXiDotREdge[k])
-								* m_dDiffDiffStateUpwind[WIx][k];
+								* fabs(ws.m_dXiDotREdge[k])
+								* ws.m_dDiffDiffStateUpwind[WIx][k];
 						}
 
 					} else {
 						opPenalty.Apply(
-							&(m_dUpwindWeights[0]),
+							&(ws.m_dUpwindWeights[0]),
 							&(dataInitialNode[WIx][0][i][j]),
 							&(dataUpdateNode[WIx][0][i][j]),
 							nUpwindStride,
@@ -1164,12 +1354,12 @@ void VerticalDynamicsFEM::StepExplicit(
 
 				// Second derivatives of horizontal velocity on model levels
 				pGrid->DiffDiffNodeToNode(
-					m_dStateNode[UIx],
-					m_dDiffDiffStateHypervis[UIx]);
+					ws.m_dStateNode[UIx],
+					ws.m_dDiffDiffStateHypervis[UIx]);
 
 				pGrid->DiffDiffNodeToNode(
-					m_dStateNode[VIx],
-					m_dDiffDiffStateHypervis[VIx]);
+					ws.m_dStateNode[VIx],
+					ws.m_dDiffDiffStateHypervis[VIx]);
 
 				// Apply uniform diffusion in the vertical
 				if (m_fUniformDiffusionVar[UIx]) {
@@ -1180,30 +1370,30 @@ void VerticalDynamicsFEM::StepExplicit(
 						/ (dZtop * dZtop);
 
 					for (int k = 0; k < nRElements; k++) {
-						m_dStateRefNode[UIx][k] = dataRefNode[UIx][k][i][j];
-						m_dStateRefNode[VIx][k] = dataRefNode[VIx][k][i][j];
+						ws.m_dStateRefNode[UIx][k] = dataRefNode[UIx][k][i][j];
+						ws.m_dStateRefNode[VIx][k] = dataRefNode[VIx][k][i][j];
 					}
 
 					pGrid->DiffDiffNodeToNode(
-						m_dStateRefNode[UIx],
-						m_dDiffDiffStateUniform[UIx]);
+						ws.m_dStateRefNode[UIx],
+						ws.m_dDiffDiffStateUniform[UIx]);
 
 					pGrid->DiffDiffNodeToNode(
-						m_dStateRefNode[VIx],
-						m_dDiffDiffStateUniform[VIx]);
+						ws.m_dStateRefNode[VIx],
+						ws.m_dDiffDiffStateUniform[VIx]);
 
 					for (int k = 0; k < nRElements; k++) {
 						dataUpdateNode[UIx][k][i][j] +=
 							dDeltaT
 							* dUniformDiffusionCoeff
-							* (m_dDiffDiffStateHypervis[UIx][k]
-								- m_dDiffDiffStateUniform[UIx][k]);
+							* (ws.m_dDiffDiffStateHypervis[UIx][k]
+								- ws.m_dDiffDiffStateUniform[UIx][k]);
 
 						dataUpdateNode[VIx][k][i][j] +=
 							dDeltaT
 							* dUniformDiffusionCoeff
-							* (m_dDiffDiffStateHypervis[VIx][k]
-								- m_dDiffDiffStateUniform[VIx][k]);
+							* (ws.m_dDiffDiffStateHypervis[VIx][k]
+								- ws.m_dDiffDiffStateUniform[VIx][k]);
 					}
 				}
 
@@ -1219,23 +1409,23 @@ void VerticalDynamicsFEM::StepExplicit(
 					// hyperviscosity
 					for (int h = 2; h < m_nHypervisOrder; h += 2) {
 						memcpy(
-							m_dStateAux,
-							m_dDiffDiffStateHypervis[UIx],
+							ws.m_dStateAux,
+							ws.m_dDiffDiffStateHypervis[UIx],
 							nRElements * sizeof(double));
 
 						pGrid->DiffDiffNodeToNode(
-							m_dStateAux,
-							m_dDiffDiffStateHypervis[UIx]
+							ws.m_dStateAux,
+							ws.m_dDiffDiffStateHypervis[UIx]
 						);
 
 						memcpy(
-							m_dStateAux,
-							m_dDiffDiffStateHypervis[VIx],
+							ws.m_dStateAux,
+							ws.m_dDiffDiffStateHypervis[VIx],
 							nRElements * sizeof(double));
 
 						pGrid->DiffDiffNodeToNode(
-							m_dStateAux,
-							m_dDiffDiffStateHypervis[VIx]
+							ws.m_dStateAux,
+							ws.m_dDiffDiffStateHypervis[VIx]
 						);
 					}
 
@@ -1244,14 +1434,14 @@ void VerticalDynamicsFEM::StepExplicit(
 						dataUpdateNode[UIx][k][i][j] +=
 							dDeltaT
 							* m_dHypervisCoeff
-							* fabs(m_dXiDotNode[k])
-							* m_dDiffDiffStateHypervis[UIx][k];
+							* fabs(ws.m_dXiDotNode[k])
+							* ws.m_dDiffDiffStateHypervis[UIx][k];
 
 						dataUpdateNode[VIx][k][i][j] +=
 							dDeltaT
 							* m_dHypervisCoeff
-							* fabs(m_dXiDotNode[k])
-							* m_dDiffDiffStateHypervis[VIx][k];
+							* fabs(ws.m_dXiDotNode[k])
+							* ws.m_dDiffDiffStateHypervis[VIx][k];
 					}
 				}
 			}
@@ -1262,26 +1452,28 @@ void VerticalDynamicsFEM::StepExplicit(
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void VerticalDynamicsFEM::BootstrapJacobian() {
+void VerticalDynamicsFEM::BootstrapJacobian(
+	ColumnWorkspace & ws
+) {
 
 	static const double Epsilon = 1.0e-5;
 
-	int nDim = m_dColumnState.GetRows();
+	int nDim = ws.m_dColumnState.GetRows();
 
 	DataArray2D<double> dJacobian(nDim, nDim);
 	DataArray1D<double> dJC(nDim);
 	DataArray1D<double> dG(nDim);
 	DataArray1D<double> dJCref(nDim);
 
-	Evaluate(m_dColumnState, dJCref);
+	Evaluate(ws, ws.m_dColumnState, dJCref);
 
-	for (int i = 0; i < m_dColumnState.GetRows(); i++) {
-		dG = m_dColumnState;
+	for (int i = 0; i < ws.m_dColumnState.GetRows(); i++) {
+		dG = ws.m_dColumnState;
 		dG[i] = dG[i] + Epsilon;
 
-		Evaluate(dG, dJC);
+		Evaluate(ws, dG, dJC);
 
-		for (int j = 0; j < m_dColumnState.GetRows(); j++) {
+		for (int j = 0; j < ws.m_dColumnState.GetRows(); j++) {
 			dJacobian[i][j] = (dJC[j] - dJCref[j]) / Epsilon;
 		}
 	}
@@ -1310,7 +1502,7 @@ void VerticalDynamicsFEM::BootstrapJacobian() {
 	}
 	fclose(fp);
 
-	BuildJacobianF(m_dSoln, &(dJacobian[0][0]));
+	BuildJacobianF(ws, ws.m_dSoln, &(dJacobian[0][0]));
 
 	fp = fopen("DG.txt", "w");
 	for (int i = 0; i < nDim; i++) {
@@ -1359,45 +1551,39 @@ void VerticalDynamicsFEM::StepImplicit(
 	// Store timestep size
 	m_dDeltaT = dDeltaT;
 
-	// Perform local update
-	for (int n = 0; n < pGrid->GetActivePatchCount(); n++) {
+#if defined(USE_DIRECTSOLVE) \
+ && defined(USE_JACOBIAN_DIAGONAL) \
+ && defined(USE_JACOBIAN_BATCHED)
+	// With Jacobian reuse, retained factorizations are stored per patch
+	if (m_nJacobianReuse > 0) {
+		if (m_vecColumnBatchJacobian.size() !=
+			pGrid->GetActivePatchCount()
+		) {
+			m_vecColumnBatchJacobian.resize(
+				pGrid->GetActivePatchCount());
+		}
+	}
+#endif
+
+	// Perform local update.  The PetSc solver context is shared, so
+	// patches are updated in order when USE_JFNK_PETSC is defined.
+	PatchOperation fnStepPatch = [&](int n) {
 		GridPatch * pPatch = pGrid->GetActivePatch(n);
 
 		const PatchBox & box = pPatch->GetPatchBox();
 
-		// Contravariant metric components
-		const DataArray4D<double> & dContraMetricA =
-			pPatch->GetContraMetricA();
-		const DataArray4D<double> & dContraMetricB =
-			pPatch->GetContraMetricB();
-
 		// State Data
-		const DataArray4D<double> & dataRefNode =
-			pPatch->GetReferenceState(DataLocation_Node);
-
-		const DataArray4D<double> & dataInitialNode =
-			pPatch->GetDataState(iDataInitial, DataLocation_Node);
-
 		DataArray4D<double> & dataUpdateNode =
 			pPatch->GetDataState(iDataUpdate, DataLocation_Node);
 
-		const DataArray4D<double> & dataRefREdge =
-			pPatch->GetReferenceState(DataLocation_REdge);
-
-		const DataArray4D<double> & dataInitialREdge =
-			pPatch->GetDataState(iDataInitial, DataLocation_REdge);
-
 		DataArray4D<double> & dataUpdateREdge =
 			pPatch->GetDataState(iDataUpdate, DataLocation_REdge);
 
 		// Tracer Data
-		DataArray4D<double> & dataReferenceTracer =
-			pPatch->GetReferenceTracers();
-
-		DataArray4D<double> & dataInitialTracer =
+		TracerArray4D & dataInitialTracer =
 			pPatch->GetDataTracers(iDataInitial);
 
-		DataArray4D<double> & dataUpdateTracer =
+		TracerArray4D & dataUpdateTracer =
 			pPatch->GetDataTracers(iDataUpdate);
 
 		// Number of tracers
@@ -1409,8 +1595,13 @@ void VerticalDynamicsFEM::StepImplicit(
 		int nBElements =
 			box.GetBInteriorWidth() / m_nHorizontalOrder;
 
-		// Loop over all nodes, but only perform calculation on shared
-		// nodes once
+#if defined(USE_DIRECTSOLVE) \
+ && defined(USE_JACOBIAN_DIAGONAL) \
+ && defined(USE_JACOBIAN_BATCHED)
+		// List all nodes, but only include shared nodes once
+		std::vector<int> vecColumnA;
+		std::vector<int> vecColumnB;
+
 		for (int a = 0; a < nAElements; a++) {
 		for (int b = 0; b < nBElements; b++) {
 
@@ -1431,232 +1622,321 @@ void VerticalDynamicsFEM::StepImplicit(
 
 		for (int i = 0; i < iEnd; i++) {
 		for (int j = 0; j < jEnd; j++) {
+			vecColumnA.push_back(
+				box.GetAInteriorBegin() + a * m_nHorizontalOrder + i);
+			vecColumnB.push_back(
+				box.GetBInteriorBegin() + b * m_nHorizontalOrder + j);
+		}
+		}
 
-			int iA = box.GetAInteriorBegin() + a * m_nHorizontalOrder + i;
-			int iB = box.GetBInteriorBegin() + b * m_nHorizontalOrder + j;
+		}
+		}
 
-			SetupReferenceColumn(
-				pPatch, iA, iB,
-				dataRefNode,
-				dataInitialNode,
-				dataRefREdge,
-				dataInitialREdge);
+		// Solve columns in batches.  Each lane of a thread's batch has its
+		// own column workspace for building the Jacobian and applying the
+		// update, while the LU factorization of the batch is interleaved.
+		const int nLanes = BatchedBandedLU::Lanes;
+		const int nColumns = static_cast<int>(vecColumnA.size());
+		const int nBatches = (nColumns + nLanes - 1) / nLanes;
+
+		// With Jacobian reuse, each batch of columns retains its
+		// factorization across implicit solves
+		if (m_nJacobianReuse > 0) {
+			std::vector<ColumnBatchJacobian> & vecPatchJacobian =
+				m_vecColumnBatchJacobian[n];
+
+			if (vecPatchJacobian.size() != nBatches) {
+				vecPatchJacobian.clear();
+				vecPatchJacobian.resize(nBatches);
+				for (int b = 0; b < nBatches; b++) {
+					vecPatchJacobian[b].lu.Initialize(
+						m_nColumnStateSize,
+						m_nJacobianFOffD,
+						m_nJacobianFOffD);
+				}
+			}
+		}
 
-#ifdef USE_JACOBIAN_DEBUG
-			BootstrapJacobian();
+		ParallelExceptionGuard excParallel;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
 #endif
-#ifdef USE_JFNK_PETSC
-			// Use PetSc to solve
-			double * dX;
-			VecGetArray(m_vecX, &dX);
-			memcpy(dX, m_dColumnState, m_nColumnStateSize * sizeof(double));
-			VecRestoreArray(m_vecX, &dX);
-
-			// Solve
-			PetscErrorCode ierr;
-			SNESSolve(m_snes, NULL, m_vecX);
-
-			SNESConvergedReason reason;
-			SNESGetConvergedReason(m_snes, &reason);
-			if ((reason < 0) && (reason != (-5))) {
-				_EXCEPTION1("PetSc solver failed to converge (%i)", reason);
+		for (int iBatch = 0; iBatch < nBatches; iBatch++) {
+		try {
+
+			const int iThread = GetThreadIndex();
+
+			const int iFirstColumn = iBatch * nLanes;
+			const int nActiveLanes =
+				std::min(nLanes, nColumns - iFirstColumn);
+
+			// Determine if a retained Jacobian can be used
+			ColumnBatchJacobian * pJacobian = NULL;
+
+			bool fRefresh = true;
+
+			if (m_nJacobianReuse > 0) {
+				pJacobian = &(m_vecColumnBatchJacobian[n][iBatch]);
+
+				if (pJacobian->fValid) {
+					if (fabs(dDeltaT - pJacobian->dDeltaT)
+						> JacobianReuseDeltaTTolerance
+							* fabs(pJacobian->dDeltaT)
+					) {
+						pJacobian->nRefreshDeltaT++;
+
+					} else if (pJacobian->nUses >= m_nJacobianReuse) {
+						pJacobian->nRefreshAge++;
+
+					} else {
+						fRefresh = false;
+					}
+				}
 			}
 
-			VecGetArray(m_vecX, &dX);
-			memcpy(m_dSoln, dX, m_nColumnStateSize * sizeof(double));
-			VecRestoreArray(m_vecX, &dX);
-#endif
-#ifdef USE_JFNK_GMRES
-			// Use Jacobian-Free Newton-Krylov to solve
-			m_dSoln = m_dColumnState;
-
-			double dError =
-				PerformJFNK_NewtonStep_Safe(
-				//PerformBICGSTAB_NewtonStep_Safe(
-					m_dSoln,
-					m_dSoln.GetRows(),
-					1.0e-8);
-
-			// DEBUG (check for NANs in output)
-			if (!(m_dSoln[0] == m_dSoln[0])) {
-				DataArray1D<double> dEval;
-				dEval.Allocate(m_dColumnState.GetRows());
-				Evaluate(m_dSoln, dEval);
-
-				for (int p = 0; p < dEval.GetRows(); p++) {
-					printf("%1.15e %1.15e %1.15e\n",
-					dEval[p], m_dSoln[p] - m_dColumnState[p], m_dColumnState[p]);
+			BatchedBandedLU & lu =
+				(pJacobian == NULL)?
+					(m_vecColumnBatchLU[iThread]):(pJacobian->lu);
+
+			// The Jacobian is always built, since a retained factorization
+			// is only used to solve the Newton system with this Jacobian
+			for (int w = 0; w < nActiveLanes; w++) {
+				ColumnWorkspace & col =
+					m_vecColumnWorkspace[iThread * nLanes + w];
+
+				BuildImplicitColumn(
+					col,
+					pPatch,
+					vecColumnA[iFirstColumn + w],
+					vecColumnB[iFirstColumn + w],
+					iDataInitial,
+					dDeltaT);
+			}
+
+			// With a retained factorization, refine the Newton step by
+			// iterating on the residual of the Newton system until the
+			// correction in every column of the batch has converged.  If
+			// refinement converges too slowly the batch is refactored with
+			// the new Jacobians and the Newton step is solved directly.
+			bool fConverged = false;
+
+			if (!fRefresh) {
+				bool fLaneConverged[BatchedBandedLU::Lanes];
+
+				int nUnconvergedLanes = nActiveLanes;
+
+				for (int w = 0; w < nActiveLanes; w++) {
+					ColumnWorkspace & col =
+						m_vecColumnWorkspace[iThread * nLanes + w];
+
+					lu.SetRHS(w, col.m_dSoln);
 				}
-				for (int p = 0; p < m_dExnerRefREdge.GetRows(); p++) {
-					printf("%1.15e %1.15e\n",
-						m_dExnerRefREdge[p], dataRefREdge[RIx][p][iA][iB]);
+
+				lu.Solve();
+
+				for (int w = 0; w < nActiveLanes; w++) {
+					ColumnWorkspace & col =
+						m_vecColumnWorkspace[iThread * nLanes + w];
+
+					lu.GetSolution(w, col.m_dColumnStep);
+
+					fLaneConverged[w] = false;
 				}
-				_EXCEPTIONT("Inversion failure");
-	    	}
 
-#endif
-#ifdef USE_DIRECTSOLVE_APPROXJ
-			static const double Epsilon = 1.0e-5;
+				int nIterations = 1;
 
-			// Prepare the column
-			PrepareColumn(m_dColumnState);
+				while (nUnconvergedLanes != 0) {
+					if (nIterations == JacobianReuseMaxIterations) {
+						break;
+					}
 
-			// Build the F vector
-			BuildF(m_dColumnState, m_dSoln);
+					for (int w = 0; w < nActiveLanes; w++) {
+						if (fLaneConverged[w]) {
+							continue;
+						}
 
-			DataArray1D<double> dJC;
-			dJC.Allocate(m_dColumnState.GetRows());
+						ColumnWorkspace & col =
+							m_vecColumnWorkspace[iThread * nLanes + w];
 
-			DataArray1D<double> dG;
-			dG.Allocate(m_dColumnState.GetRows());
+						BandedResidual(
+							m_nColumnStateSize,
+							m_nJacobianFOffD,
+							m_nJacobianFOffD,
+							col.m_matJacobianF.GetColumns(),
+							&(col.m_matJacobianF[0][0]),
+							col.m_dColumnStep,
+							col.m_dSoln,
+							col.m_dColumnResidual);
 
-			DataArray1D<double> dJCref;
-			dJCref.Allocate(m_dColumnState.GetRows());
+						lu.SetRHS(w, col.m_dColumnResidual);
+					}
 
-			Evaluate(m_dColumnState, dJCref);
+					lu.Solve();
 
-			for (int i = 0; i < m_dColumnState.GetRows(); i++) {
-				dG = m_dColumnState;
-				dG[i] = dG[i] + Epsilon;
+					nIterations++;
 
-				Evaluate(dG, dJC);
+					for (int w = 0; w < nActiveLanes; w++) {
+						if (fLaneConverged[w]) {
+							continue;
+						}
 
-				for (int j = 0; j < m_dColumnState.GetRows(); j++) {
-					m_matJacobianF[i][j] = (dJC[j] - dJCref[j]) / Epsilon;
-				}
-			}
+						ColumnWorkspace & col =
+							m_vecColumnWorkspace[iThread * nLanes + w];
 
-			// Use direct solver
-			LAPACK::DGESV(m_matJacobianF, m_dSoln, m_vecIPiv);
+						lu.GetSolution(w, col.m_dColumnResidual);
 
-			for (int k = 0; k < m_dSoln.GetRows(); k++) {
-				m_dSoln[k] = m_dColumnState[k] - m_dSoln[k];
-			}
-#endif
-#ifdef USE_DIRECTSOLVE
-			// Prepare the column
-			PrepareColumn(m_dColumnState);
+						double dNormStep = 0.0;
+						double dNormCorrection = 0.0;
+						for (int k = 0; k < col.m_dColumnStep.GetRows(); k++) {
+							col.m_dColumnStep[k] += col.m_dColumnResidual[k];
+							dNormStep +=
+								col.m_dColumnStep[k] * col.m_dColumnStep[k];
+							dNormCorrection +=
+								col.m_dColumnResidual[k]
+								* col.m_dColumnResidual[k];
+						}
 
-			// Build the F vector
-			BuildF(m_dColumnState, m_dSoln);
+						if (sqrt(dNormCorrection)
+							<= JacobianReuseTolerance * sqrt(dNormStep)
+						) {
+							fLaneConverged[w] = true;
+							nUnconvergedLanes--;
+						}
+					}
+				}
 
-			// Build the Jacobian
-			BuildJacobianF(m_dColumnState, &(m_matJacobianF[0][0]));
+				fConverged = (nUnconvergedLanes == 0);
 
-#ifdef USE_JACOBIAN_GENERAL
-			// Use direct solver
-			int iInfo = LAPACK::DGESV(m_matJacobianF, m_dSoln, m_vecIPiv);
+				pJacobian->nIterations += nIterations;
 
-			if (iInfo != 0) {
-				_EXCEPTION1("Solution failed: %i", iInfo);
+				if (fConverged) {
+					pJacobian->nReuses++;
+				} else {
+					pJacobian->nRefreshSlow++;
+				}
 			}
-#endif
-#ifdef USE_JACOBIAN_DIAGONAL
-			// Use diagonal solver
-			int iInfo = LAPACK::DGBSV(
-				m_matJacobianF, m_dSoln, m_vecIPiv,
-				m_nJacobianFOffD, m_nJacobianFOffD);
 
-			if (iInfo != 0) {
-				_EXCEPTION1("Solution failed: %i", iInfo);
-			}
-#endif
+			// Factor the new Jacobians and solve the Newton step directly
+			if (!fConverged) {
+				for (int w = 0; w < nActiveLanes; w++) {
+					ColumnWorkspace & col =
+						m_vecColumnWorkspace[iThread * nLanes + w];
 
-			// DEBUG (check for NANs in output)
-			if (!(m_dSoln[0] == m_dSoln[0])) {
-				DataArray1D<double> dEval;
-				dEval.Allocate(m_dColumnState.GetRows());
-				Evaluate(m_dSoln, dEval);
+					lu.SetMatrix(w, &(col.m_matJacobianF[0][0]));
+					lu.SetRHS(w, col.m_dSoln);
+				}
+				for (int w = nActiveLanes; w < nLanes; w++) {
+					lu.SetIdentity(w);
+				}
 
-				for (int p = 0; p < dEval.GetRows(); p++) {
-					printf("%1.15e %1.15e %1.15e\n",
-						dEval[p], m_dSoln[p] - m_dColumnState[p], m_dColumnState[p]);
+				int iInfo = lu.Factor();
+				if (iInfo != 0) {
+					_EXCEPTION1("Solution failed: %i", iInfo);
 				}
-				for (int p = 0; p < m_dExnerRefREdge.GetRows(); p++) {
-					printf("%1.15e %1.15e\n",
-						m_dExnerRefREdge[p], dataRefREdge[RIx][p][iA][iB]);
+
+				lu.Solve();
+
+				if (pJacobian != NULL) {
+					pJacobian->fValid = true;
+					pJacobian->dDeltaT = dDeltaT;
+					pJacobian->nUses = 0;
+					pJacobian->nFactorizations++;
 				}
-				_EXCEPTIONT("Inversion failure");
 			}
 
-			for (int k = 0; k < m_dSoln.GetRows(); k++) {
-				m_dSoln[k] = m_dColumnState[k] - m_dSoln[k];
+			if (pJacobian != NULL) {
+				pJacobian->nUses++;
 			}
-#endif
 
-#if defined(EXPLICIT_THERMO)
-			// Verify thermodynamic closure is untouched by update
-			if (pGrid->GetVarLocation(PIx) == DataLocation_REdge) {
-				for (int k = 0; k <= pGrid->GetRElements(); k++) {
-					if (fabs(m_dSoln[VecFIx(FPIx, k)] - dataInitialREdge[PIx][k][iA][iB]) > 1.0e-12) {
-						_EXCEPTIONT("Logic error");
-					}
-				}
+			for (int w = 0; w < nActiveLanes; w++) {
+				ColumnWorkspace & col =
+					m_vecColumnWorkspace[iThread * nLanes + w];
 
-			} else {
-				for (int k = 0; k < pGrid->GetRElements(); k++) {
-					if (fabs(m_dSoln[VecFIx(FPIx, k)] - dataInitialNode[PIx][k][iA][iB]) > 1.0e-12) {
-						_EXCEPTIONT("Logic error");
-					}
+				// Apply the Newton step
+				if (!fConverged) {
+					lu.GetSolution(w, col.m_dColumnStep);
 				}
-			}
 
-#else
-			// Apply updated state to thermodynamic closure
-			if (pGrid->GetVarLocation(PIx) == DataLocation_REdge) {
-				for (int k = 0; k <= pGrid->GetRElements(); k++) {
-					dataUpdateREdge[PIx][k][iA][iB] =
-						m_dSoln[VecFIx(FPIx, k)];
+				for (int k = 0; k < col.m_dSoln.GetRows(); k++) {
+					col.m_dSoln[k] =
+						col.m_dColumnState[k] - col.m_dColumnStep[k];
 				}
-			} else {
-				for (int k = 0; k < pGrid->GetRElements(); k++) {
-					dataUpdateNode[PIx][k][iA][iB] =
-						m_dSoln[VecFIx(FPIx, k)];
+
+				// Check for NaNs in the solution
+				if (!(col.m_dSoln[0] == col.m_dSoln[0])) {
+					_EXCEPTIONT("Inversion failure");
 				}
+
+				ApplyImplicitColumn(
+					col,
+					pPatch,
+					vecColumnA[iFirstColumn + w],
+					vecColumnB[iFirstColumn + w],
+					iDataInitial,
+					iDataUpdate,
+					dDeltaT);
 			}
+		} catch(...) {
+			excParallel.Capture();
+		}
+		}
+		excParallel.Rethrow();
+#else
+		// Loop over all nodes, but only perform calculation on shared
+		// nodes once.  Columns are independent, so each thread solves
+		// its columns in its own column workspace.
+		ParallelExceptionGuard excParallel;
+
+#ifndef USE_JFNK_PETSC
+#ifdef _OPENMP
+#pragma omp parallel for collapse(2) schedule(static)
 #endif
+#endif
+		for (int a = 0; a < nAElements; a++) {
+		for (int b = 0; b < nBElements; b++) {
+		try {
 
-			// Copy over W
-			if (pGrid->GetVarLocation(WIx) == DataLocation_REdge) {
-				for (int k = 0; k <= pGrid->GetRElements(); k++) {
-					dataUpdateREdge[WIx][k][iA][iB] =
-						m_dSoln[VecFIx(FWIx, k)];
-				}
+			ColumnWorkspace & col =
+				m_vecColumnWorkspace[GetThreadIndex()];
+
+			int iEnd;
+			int jEnd;
+
+			if (a == nAElements-1) {
+				iEnd = m_nHorizontalOrder;
 			} else {
-				for (int k = 0; k < pGrid->GetRElements(); k++) {
-					dataUpdateNode[WIx][k][iA][iB] =
-						m_dSoln[VecFIx(FWIx, k)];
-				}
+				iEnd = m_nHorizontalOrder-1;
 			}
 
-			// Copy over Rho
-			if (pGrid->GetVarLocation(RIx) == DataLocation_REdge) {
-				for (int k = 0; k <= pGrid->GetRElements(); k++) {
-					dataUpdateREdge[RIx][k][iA][iB] =
-						m_dSoln[VecFIx(FRIx, k)];
-				}
+			if (b == nBElements-1) {
+				jEnd = m_nHorizontalOrder;
 			} else {
-				for (int k = 0; k < pGrid->GetRElements(); k++) {
-					dataUpdateNode[RIx][k][iA][iB] =
-						m_dSoln[VecFIx(FRIx, k)];
-				}
+				jEnd = m_nHorizontalOrder-1;
 			}
 
-			// Update tracers in column
-			UpdateColumnTracers(
-				dDeltaT,
-				dataInitialNode,
-				dataUpdateNode,
-				dataInitialREdge,
-				dataUpdateREdge,
-				dataReferenceTracer,
-				dataInitialTracer,
-				dataUpdateTracer);
+		for (int i = 0; i < iEnd; i++) {
+		for (int j = 0; j < jEnd; j++) {
+
+			int iA = box.GetAInteriorBegin() + a * m_nHorizontalOrder + i;
+			int iB = box.GetBInteriorBegin() + b * m_nHorizontalOrder + j;
+
+			StepImplicitColumn(
+				col,
+				pPatch, iA, iB,
+				iDataInitial,
+				iDataUpdate,
+				dDeltaT);
 		}
 		}
 
+		} catch(...) {
+			excParallel.Capture();
+		}
 		}
 		}
+		excParallel.Rethrow();
+#endif
 
 		// Copy over new state on shared nodes (edges of constant alpha)
 		for (int a = 1; a < nAElements; a++) {
@@ -1711,50 +1991,398 @@ void VerticalDynamicsFEM::StepImplicit(
 			}
 		}
 
-		// Copy over new state on shared nodes (edges of constant beta)
-		for (int b = 1; b < nBElements; b++) {
-		for (int i = box.GetAInteriorBegin(); i < box.GetAInteriorEnd(); i++) {
-			int iB = box.GetBInteriorBegin() + b * m_nHorizontalOrder - 1;
+		// Copy over new state on shared nodes (edges of constant beta)
+		for (int b = 1; b < nBElements; b++) {
+		for (int i = box.GetAInteriorBegin(); i < box.GetAInteriorEnd(); i++) {
+			int iB = box.GetBInteriorBegin() + b * m_nHorizontalOrder - 1;
+
+			for (int k = 0; k < pGrid->GetRElements(); k++) {
+				//dataUpdateNode[UIx][k][i][iB]
+				//	= dataUpdateNode[UIx][k][i][iB+1];
+				//dataUpdateNode[VIx][k][i][iB]
+				//	= dataUpdateNode[VIx][k][i][iB+1];
+				dataUpdateNode[PIx][k][i][iB]
+					= dataUpdateNode[PIx][k][i][iB+1];
+				dataUpdateNode[WIx][k][i][iB]
+					= dataUpdateNode[WIx][k][i][iB+1];
+				dataUpdateNode[RIx][k][i][iB]
+					= dataUpdateNode[RIx][k][i][iB+1];
+
+				for (int c = 0; c < nTracerCount; c++) {
+					dataUpdateTracer[c][k][i][iB]
+						= dataUpdateTracer[c][k][i][iB+1];
+				}
+
+			}
+
+			for (int k = 0; k <= pGrid->GetRElements(); k++) {
+				//dataUpdateREdge[UIx][k][i][iB]
+				//	= dataUpdateREdge[UIx][k][i][iB+1];
+				//dataUpdateREdge[VIx][k][i][iB]
+				//	= dataUpdateREdge[VIx][k][i][iB+1];
+				dataUpdateREdge[PIx][k][i][iB]
+					= dataUpdateREdge[PIx][k][i][iB+1];
+				dataUpdateREdge[WIx][k][i][iB]
+					= dataUpdateREdge[WIx][k][i][iB+1];
+				dataUpdateREdge[RIx][k][i][iB]
+					= dataUpdateREdge[RIx][k][i][iB+1];
+			}
+		}
+		}
+	};
+
+#ifdef USE_JFNK_PETSC
+	for (int n = 0; n < pGrid->GetActivePatchCount(); n++) {
+		fnStepPatch(n);
+	}
+#else
+	pGrid->ForEachActivePatch(fnStepPatch);
+#endif
+
+#ifndef USE_SUNDIALS
+	// Filter negative tracers
+	FilterNegativeTracers(iDataUpdate);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::StepImplicitColumn(
+	ColumnWorkspace & ws,
+	GridPatch * pPatch,
+	int iA,
+	int iB,
+	int iDataInitial,
+	int iDataUpdate,
+	double dDeltaT
+) {
+	// Indices of EquationSet variables
+	const int RIx = 4;
+
+	// State Data
+	const DataArray4D<double> & dataRefNode =
+		pPatch->GetReferenceState(DataLocation_Node);
+
+	const DataArray4D<double> & dataInitialNode =
+		pPatch->GetDataState(iDataInitial, DataLocation_Node);
+
+	const DataArray4D<double> & dataRefREdge =
+		pPatch->GetReferenceState(DataLocation_REdge);
+
+	const DataArray4D<double> & dataInitialREdge =
+		pPatch->GetDataState(iDataInitial, DataLocation_REdge);
+
+	SetupReferenceColumn(
+		ws,
+		pPatch, iA, iB,
+		dataRefNode,
+		dataInitialNode,
+		dataRefREdge,
+		dataInitialREdge);
+
+#ifdef USE_JACOBIAN_DEBUG
+	BootstrapJacobian(ws);
+#endif
+#ifdef USE_JFNK_PETSC
+	// Use PetSc to solve
+	double * dX;
+	VecGetArray(m_vecX, &dX);
+	memcpy(dX, ws.m_dColumnState, m_nColumnStateSize * sizeof(double));
+	VecRestoreArray(m_vecX, &dX);
+
+	// Solve
+	PetscErrorCode ierr;
+	SNESSolve(m_snes, NULL, m_vecX);
+
+	SNESConvergedReason reason;
+	SNESGetConvergedReason(m_snes, &reason);
+	if ((reason < 0) && (reason != (-5))) {
+		_EXCEPTION1("PetSc solver failed to converge (%i)", reason);
+	}
+
+	VecGetArray(m_vecX, &dX);
+	memcpy(ws.m_dSoln, dX, m_nColumnStateSize * sizeof(double));
+	VecRestoreArray(m_vecX, &dX);
+#endif
+#ifdef USE_JFNK_GMRES
+	// Use Jacobian-Free Newton-Krylov to solve
+	ws.m_dSoln = ws.m_dColumnState;
+
+	double dError =
+		m_vecColumnJFNK[GetThreadIndex()]->PerformJFNK_NewtonStep_Safe(
+		//PerformBICGSTAB_NewtonStep_Safe(
+			ws.m_dSoln,
+			ws.m_dSoln.GetRows(),
+			1.0e-8);
+
+	// DEBUG (check for NANs in output)
+	if (!(ws.m_dSoln[0] == ws.m_dSoln[0])) {
+		DataArray1D<double> dEval;
+		dEval.Allocate(ws.m_dColumnState.GetRows());
+		Evaluate(ws, ws.m_dSoln, dEval);
+
+		for (int p = 0; p < dEval.GetRows(); p++) {
+			printf("%1.15e %1.15e %1.15e\n",
+			dEval[p], ws.m_dSoln[p] - ws.m_dColumnState[p], ws.m_dColumnState[p]);
+		}
+		for (int p = 0; p < ws.m_dExnerRefREdge.GetRows(); p++) {
+			printf("%1.15e %1.15e\n",
+				ws.m_dExnerRefREdge[p], dataRefREdge[RIx][p][iA][iB]);
+		}
+		_EXCEPTIONT("Inversion failure");
+	    	}
+
+#endif
+#ifdef USE_DIRECTSOLVE_APPROXJ
+	static const double Epsilon = 1.0e-5;
+
+	// Prepare the column
+	PrepareColumn(ws, ws.m_dColumnState);
+
+	// Build the F vector
+	BuildF(ws, ws.m_dColumnState, ws.m_dSoln);
+
+	DataArray1D<double> dJC;
+	dJC.Allocate(ws.m_dColumnState.GetRows());
+
+	DataArray1D<double> dG;
+	dG.Allocate(ws.m_dColumnState.GetRows());
+
+	DataArray1D<double> dJCref;
+	dJCref.Allocate(ws.m_dColumnState.GetRows());
+
+	Evaluate(ws, ws.m_dColumnState, dJCref);
+
+	for (int i = 0; i < ws.m_dColumnState.GetRows(); i++) {
+		dG = ws.m_dColumnState;
+		dG[i] = dG[i] + Epsilon;
+
+		Evaluate(ws, dG, dJC);
+
+		for (int j = 0; j < ws.m_dColumnState.GetRows(); j++) {
+			ws.m_matJacobianF[i][j] = (dJC[j] - dJCref[j]) / Epsilon;
+		}
+	}
+
+	// Use direct solver
+	LAPACK::DGESV(ws.m_matJacobianF, ws.m_dSoln, ws.m_vecIPiv);
+
+	for (int k = 0; k < ws.m_dSoln.GetRows(); k++) {
+		ws.m_dSoln[k] = ws.m_dColumnState[k] - ws.m_dSoln[k];
+	}
+#endif
+#ifdef USE_DIRECTSOLVE
+	// Prepare the column
+	PrepareColumn(ws, ws.m_dColumnState);
+
+	// Build the F vector
+	BuildF(ws, ws.m_dColumnState, ws.m_dSoln);
+
+	// Build the Jacobian
+	BuildJacobianF(ws, ws.m_dColumnState, &(ws.m_matJacobianF[0][0]));
+
+#ifdef USE_JACOBIAN_GENERAL
+	// Use direct solver
+	int iInfo = LAPACK::DGESV(ws.m_matJacobianF, ws.m_dSoln, ws.m_vecIPiv);
+
+	if (iInfo != 0) {
+		_EXCEPTION1("Solution failed: %i", iInfo);
+	}
+#endif
+#ifdef USE_JACOBIAN_DIAGONAL
+	// Use diagonal solver
+	int iInfo = LAPACK::DGBSV(
+		ws.m_matJacobianF, ws.m_dSoln, ws.m_vecIPiv,
+		m_nJacobianFOffD, m_nJacobianFOffD);
+
+	if (iInfo != 0) {
+		_EXCEPTION1("Solution failed: %i", iInfo);
+	}
+#endif
+
+	// DEBUG (check for NANs in output)
+	if (!(ws.m_dSoln[0] == ws.m_dSoln[0])) {
+		DataArray1D<double> dEval;
+		dEval.Allocate(ws.m_dColumnState.GetRows());
+		Evaluate(ws, ws.m_dSoln, dEval);
+
+		for (int p = 0; p < dEval.GetRows(); p++) {
+			printf("%1.15e %1.15e %1.15e\n",
+				dEval[p], ws.m_dSoln[p] - ws.m_dColumnState[p], ws.m_dColumnState[p]);
+		}
+		for (int p = 0; p < ws.m_dExnerRefREdge.GetRows(); p++) {
+			printf("%1.15e %1.15e\n",
+				ws.m_dExnerRefREdge[p], dataRefREdge[RIx][p][iA][iB]);
+		}
+		_EXCEPTIONT("Inversion failure");
+	}
+
+	for (int k = 0; k < ws.m_dSoln.GetRows(); k++) {
+		ws.m_dSoln[k] = ws.m_dColumnState[k] - ws.m_dSoln[k];
+	}
+#endif
+
+	// Apply the solution to the state and update tracers
+	ApplyImplicitColumn(
+		ws,
+		pPatch, iA, iB,
+		iDataInitial,
+		iDataUpdate,
+		dDeltaT);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::BuildImplicitColumn(
+	ColumnWorkspace & ws,
+	GridPatch * pPatch,
+	int iA,
+	int iB,
+	int iDataInitial,
+	double dDeltaT
+) {
+	// State Data
+	const DataArray4D<double> & dataRefNode =
+		pPatch->GetReferenceState(DataLocation_Node);
+
+	const DataArray4D<double> & dataInitialNode =
+		pPatch->GetDataState(iDataInitial, DataLocation_Node);
+
+	const DataArray4D<double> & dataRefREdge =
+		pPatch->GetReferenceState(DataLocation_REdge);
+
+	const DataArray4D<double> & dataInitialREdge =
+		pPatch->GetDataState(iDataInitial, DataLocation_REdge);
+
+	SetupReferenceColumn(
+		ws,
+		pPatch, iA, iB,
+		dataRefNode,
+		dataInitialNode,
+		dataRefREdge,
+		dataInitialREdge);
+
+	// Prepare the column
+	PrepareColumn(ws, ws.m_dColumnState);
+
+	// Build the F vector
+	BuildF(ws, ws.m_dColumnState, ws.m_dSoln);
+
+	// Build the Jacobian
+	BuildJacobianF(ws, ws.m_dColumnState, &(ws.m_matJacobianF[0][0]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::ApplyImplicitColumn(
+	ColumnWorkspace & ws,
+	GridPatch * pPatch,
+	int iA,
+	int iB,
+	int iDataInitial,
+	int iDataUpdate,
+	double dDeltaT
+) {
+	// Get a copy of the grid
+	Grid * pGrid = m_model.GetGrid();
+
+	// Indices of EquationSet variables
+	const int PIx = 2;
+	const int WIx = 3;
+	const int RIx = 4;
+
+	// State Data
+	const DataArray4D<double> & dataInitialNode =
+		pPatch->GetDataState(iDataInitial, DataLocation_Node);
+
+	DataArray4D<double> & dataUpdateNode =
+		pPatch->GetDataState(iDataUpdate, DataLocation_Node);
+
+	const DataArray4D<double> & dataInitialREdge =
+		pPatch->GetDataState(iDataInitial, DataLocation_REdge);
+
+	DataArray4D<double> & dataUpdateREdge =
+		pPatch->GetDataState(iDataUpdate, DataLocation_REdge);
+
+	// Tracer Data
+	TracerArray4D & dataReferenceTracer =
+		pPatch->GetReferenceTracers();
 
-			for (int k = 0; k < pGrid->GetRElements(); k++) {
-				//dataUpdateNode[UIx][k][i][iB]
-				//	= dataUpdateNode[UIx][k][i][iB+1];
-				//dataUpdateNode[VIx][k][i][iB]
-				//	= dataUpdateNode[VIx][k][i][iB+1];
-				dataUpdateNode[PIx][k][i][iB]
-					= dataUpdateNode[PIx][k][i][iB+1];
-				dataUpdateNode[WIx][k][i][iB]
-					= dataUpdateNode[WIx][k][i][iB+1];
-				dataUpdateNode[RIx][k][i][iB]
-					= dataUpdateNode[RIx][k][i][iB+1];
+	TracerArray4D & dataInitialTracer =
+		pPatch->GetDataTracers(iDataInitial);
 
-				for (int c = 0; c < nTracerCount; c++) {
-					dataUpdateTracer[c][k][i][iB]
-						= dataUpdateTracer[c][k][i][iB+1];
-				}
+	TracerArray4D & dataUpdateTracer =
+		pPatch->GetDataTracers(iDataUpdate);
 
+#if defined(EXPLICIT_THERMO)
+	// Verify thermodynamic closure is untouched by update
+	if (pGrid->GetVarLocation(PIx) == DataLocation_REdge) {
+		for (int k = 0; k <= pGrid->GetRElements(); k++) {
+			if (fabs(ws.m_dSoln[VecFIx(FPIx, k)] - dataInitialREdge[PIx][k][iA][iB]) > 1.0e-12) {
+				_EXCEPTIONT("Logic error");
 			}
+		}
 
-			for (int k = 0; k <= pGrid->GetRElements(); k++) {
-				//dataUpdateREdge[UIx][k][i][iB]
-				//	= dataUpdateREdge[UIx][k][i][iB+1];
-				//dataUpdateREdge[VIx][k][i][iB]
-				//	= dataUpdateREdge[VIx][k][i][iB+1];
-				dataUpdateREdge[PIx][k][i][iB]
-					= dataUpdateREdge[PIx][k][i][iB+1];
-				dataUpdateREdge[WIx][k][i][iB]
-					= dataUpdateREdge[WIx][k][i][iB+1];
-				dataUpdateREdge[RIx][k][i][iB]
-					= dataUpdateREdge[RIx][k][i][iB+1];
+	} else {
+		for (int k = 0; k < pGrid->GetRElements(); k++) {
+			if (fabs(ws.m_dSoln[VecFIx(FPIx, k)] - dataInitialNode[PIx][k][iA][iB]) > 1.0e-12) {
+				_EXCEPTIONT("Logic error");
 			}
 		}
-		}
 	}
 
-#ifndef USE_SUNDIALS
-	// Filter negative tracers
-	FilterNegativeTracers(iDataUpdate);
+#else
+	// Apply updated state to thermodynamic closure
+	if (pGrid->GetVarLocation(PIx) == DataLocation_REdge) {
+		for (int k = 0; k <= pGrid->GetRElements(); k++) {
+			dataUpdateREdge[PIx][k][iA][iB] =
+				ws.m_dSoln[VecFIx(FPIx, k)];
+		}
+	} else {
+		for (int k = 0; k < pGrid->GetRElements(); k++) {
+			dataUpdateNode[PIx][k][iA][iB] =
+				ws.m_dSoln[VecFIx(FPIx, k)];
+		}
+	}
 #endif
+
+	// Copy over W
+	if (pGrid->GetVarLocation(WIx) == DataLocation_REdge) {
+		for (int k = 0; k <= pGrid->GetRElements(); k++) {
+			dataUpdateREdge[WIx][k][iA][iB] =
+				ws.m_dSoln[VecFIx(FWIx, k)];
+		}
+	} else {
+		for (int k = 0; k < pGrid->GetRElements(); k++) {
+			dataUpdateNode[WIx][k][iA][iB] =
+				ws.m_dSoln[VecFIx(FWIx, k)];
+		}
+	}
+
+	// Copy over Rho
+	if (pGrid->GetVarLocation(RIx) == DataLocation_REdge) {
+		for (int k = 0; k <= pGrid->GetRElements(); k++) {
+			dataUpdateREdge[RIx][k][iA][iB] =
+				ws.m_dSoln[VecFIx(FRIx, k)];
+		}
+	} else {
+		for (int k = 0; k < pGrid->GetRElements(); k++) {
+			dataUpdateNode[RIx][k][iA][iB] =
+				ws.m_dSoln[VecFIx(FRIx, k)];
+		}
+	}
+
+	// Update tracers in column
+	UpdateColumnTracers(
+		ws,
+		dDeltaT,
+		dataInitialNode,
+		dataUpdateNode,
+		dataInitialREdge,
+		dataUpdateREdge,
+		dataReferenceTracer,
+		dataInitialTracer,
+		dataUpdateTracer);
 }
 
 
@@ -1794,52 +2422,41 @@ void VerticalDynamicsFEM::SolveImplicit(
 
 		const PatchBox & box = pPatch->GetPatchBox();
 
-		// Contravariant metric components
-		const DataArray4D<double> & dContraMetricA =
-			pPatch->GetContraMetricA();
-		const DataArray4D<double> & dContraMetricB =
-			pPatch->GetContraMetricB();
-
 		// State Data
-		const DataArray4D<double> & dataRefNode =
-			pPatch->GetReferenceState(DataLocation_Node);
-
-		const DataArray4D<double> & dataInitialNode =
-			pPatch->GetDataState(iDataInitial, DataLocation_Node);
-
 		DataArray4D<double> & dataRHSNode =
 			pPatch->GetDataState(iDataRHS, DataLocation_Node);
 
-		const DataArray4D<double> & dataRefREdge =
-			pPatch->GetReferenceState(DataLocation_REdge);
-
-		const DataArray4D<double> & dataInitialREdge =
-			pPatch->GetDataState(iDataInitial, DataLocation_REdge);
-
 		DataArray4D<double> & dataRHSREdge =
 			pPatch->GetDataState(iDataRHS, DataLocation_REdge);
 
 		// Tracer Data
-		DataArray4D<double> & dataReferenceTracer =
-			pPatch->GetReferenceTracers();
-
-		DataArray4D<double> & dataInitialTracer =
+		TracerArray4D & dataInitialTracer =
 			pPatch->GetDataTracers(iDataInitial);
 
-		DataArray4D<double> & dataRHSTracer =
+		TracerArray4D & dataRHSTracer =
 			pPatch->GetDataTracers(iDataRHS);
 
 		// Number of tracers
 		const int nTracerCount = dataInitialTracer.GetSize(0);
 
+		// Tracer update is accumulated into the zeroed RHS
+		if (nTracerCount > 0) {
+			dataRHSTracer.Constant(0.0);
+		}
+
 		// Number of finite elements
 		int nAElements =
 			box.GetAInteriorWidth() / m_nHorizontalOrder;
 		int nBElements =
 			box.GetBInteriorWidth() / m_nHorizontalOrder;
 
-		// Loop over all nodes, but only perform calculation on shared
-		// nodes once
+#if defined(USE_DIRECTSOLVE) \
+ && defined(USE_JACOBIAN_DIAGONAL) \
+ && defined(USE_JACOBIAN_BATCHED)
+		// List all nodes, but only include shared nodes once
+		std::vector<int> vecColumnA;
+		std::vector<int> vecColumnB;
+
 		for (int a = 0; a < nAElements; a++) {
 		for (int b = 0; b < nBElements; b++) {
 
@@ -1860,127 +2477,140 @@ void VerticalDynamicsFEM::SolveImplicit(
 
 		for (int i = 0; i < iEnd; i++) {
 		for (int j = 0; j < jEnd; j++) {
+			vecColumnA.push_back(
+				box.GetAInteriorBegin() + a * m_nHorizontalOrder + i);
+			vecColumnB.push_back(
+				box.GetBInteriorBegin() + b * m_nHorizontalOrder + j);
+		}
+		}
 
-			int iA = box.GetAInteriorBegin() + a * m_nHorizontalOrder + i;
-			int iB = box.GetBInteriorBegin() + b * m_nHorizontalOrder + j;
+		}
+		}
 
-			// fill m_dColumnState with initial state data
-			SetupReferenceColumn(
-				pPatch, iA, iB,
-				dataRefNode,
-				dataInitialNode,
-				dataRefREdge,
-				dataInitialREdge);
+		// Solve columns in batches, as in StepImplicit.  The scaling of
+		// the Jacobian changes between solves, so the factorization of
+		// each batch is not retained.
+		const int nLanes = BatchedBandedLU::Lanes;
+		const int nColumns = static_cast<int>(vecColumnA.size());
+		const int nBatches = (nColumns + nLanes - 1) / nLanes;
 
-			// Prepare the column (computes metric terms, fills internal 
-			// storage with data from m_dColumnState)
-			PrepareColumn(m_dColumnState);
+		ParallelExceptionGuard excParallel;
 
-			// Build the F vector (don't actually need F, but we do need
-			// temporary data stored internally in class)
-			BuildF(m_dColumnState, m_dSoln);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+		for (int iBatch = 0; iBatch < nBatches; iBatch++) {
+		try {
 
-			// Build the Jacobian (uses internal data structures filled by BuildF)
-			BuildJacobianF(m_dColumnState, &(m_matJacobianF[0][0]));
+			const int iThread = GetThreadIndex();
 
-			// modify Jacobian (rescale all entries by m_dDeltaT)
-			m_matJacobianF.Scale(m_dDeltaT);
+			const int iFirstColumn = iBatch * nLanes;
+			const int nActiveLanes =
+				std::min(nLanes, nColumns - iFirstColumn);
 
-			// fill m_dSoln with RHS data
-			//    first fill m_dColumnState with RHS data instead of state data
-			SetupReferenceColumn(
-				pPatch, iA, iB,
-				dataRefNode,
-				dataRHSNode,
-				dataRefREdge,
-				dataRHSREdge);
+			BatchedBandedLU & lu = m_vecColumnBatchLU[iThread];
 
-  			//    then copy RHS into m_dSoln
-			for (int ivec=0; ivec<m_nColumnStateSize; ivec++)
-			  m_dSoln[ivec] = m_dColumnState[ivec];
+			for (int w = 0; w < nActiveLanes; w++) {
+				ColumnWorkspace & col =
+					m_vecColumnWorkspace[iThread * nLanes + w];
 
-			// Use diagonal solver
-			int iInfo = LAPACK::DGBSV(
-				m_matJacobianF, m_dSoln, m_vecIPiv,
-				m_nJacobianFOffD, m_nJacobianFOffD);
+				BuildSolveImplicitColumn(
+					col,
+					pPatch,
+					vecColumnA[iFirstColumn + w],
+					vecColumnB[iFirstColumn + w],
+					iDataInitial,
+					iDataRHS);
+
+				lu.SetMatrix(w, &(col.m_matJacobianF[0][0]));
+				lu.SetRHS(w, col.m_dSoln);
+			}
+			for (int w = nActiveLanes; w < nLanes; w++) {
+				lu.SetIdentity(w);
+			}
+
+			int iInfo = lu.Factor();
 			if (iInfo != 0) {
 				_EXCEPTION1("Solution failed: %i", iInfo);
 			}
 
-			// DEBUG (check for NANs in output)
-			if (!(m_dSoln[0] == m_dSoln[0])) {
-				DataArray1D<double> dEval;
-				dEval.Allocate(m_dColumnState.GetRows());
-				Evaluate(m_dSoln, dEval);
+			lu.Solve();
 
-				for (int p = 0; p < dEval.GetRows(); p++) {
-					printf("%1.15e %1.15e %1.15e\n",
-						dEval[p], m_dSoln[p] - m_dColumnState[p], m_dColumnState[p]);
-				}
-				for (int p = 0; p < m_dExnerRefREdge.GetRows(); p++) {
-					printf("%1.15e %1.15e\n",
-						m_dExnerRefREdge[p], dataRefREdge[RIx][p][iA][iB]);
-				}
-				_EXCEPTIONT("Inversion failure");
-			}
+			for (int w = 0; w < nActiveLanes; w++) {
+				ColumnWorkspace & col =
+					m_vecColumnWorkspace[iThread * nLanes + w];
 
+				lu.GetSolution(w, col.m_dSoln);
 
-			// Copy solution to thermodynamic closure
-			if (pGrid->GetVarLocation(PIx) == DataLocation_REdge) {
-				for (int k = 0; k <= pGrid->GetRElements(); k++) {
-					dataRHSREdge[PIx][k][iA][iB] =
-						m_dSoln[VecFIx(FPIx, k)];
-				}
-			} else {
-				for (int k = 0; k < pGrid->GetRElements(); k++) {
-					dataRHSNode[PIx][k][iA][iB] =
-						m_dSoln[VecFIx(FPIx, k)];
-				}
+				ApplySolveImplicitColumn(
+					col,
+					pPatch,
+					vecColumnA[iFirstColumn + w],
+					vecColumnB[iFirstColumn + w],
+					iDataInitial,
+					iDataRHS,
+					dDeltaT);
 			}
+		} catch(...) {
+			excParallel.Capture();
+		}
+		}
+		excParallel.Rethrow();
+#else
+		// Loop over all nodes, but only perform calculation on shared
+		// nodes once.  Columns are independent, so each thread solves
+		// its columns in its own column workspace.
+		ParallelExceptionGuard excParallel;
 
-			// Copy over W
-			if (pGrid->GetVarLocation(WIx) == DataLocation_REdge) {
-				for (int k = 0; k <= pGrid->GetRElements(); k++) {
-					dataRHSREdge[WIx][k][iA][iB] =
-						m_dSoln[VecFIx(FWIx, k)];
-				}
+#ifndef USE_JFNK_PETSC
+#ifdef _OPENMP
+#pragma omp parallel for collapse(2) schedule(static)
+#endif
+#endif
+		for (int a = 0; a < nAElements; a++) {
+		for (int b = 0; b < nBElements; b++) {
+		try {
+
+			ColumnWorkspace & col =
+				m_vecColumnWorkspace[GetThreadIndex()];
+
+			int iEnd;
+			int jEnd;
+
+			if (a == nAElements-1) {
+				iEnd = m_nHorizontalOrder;
 			} else {
-				for (int k = 0; k < pGrid->GetRElements(); k++) {
-					dataRHSNode[WIx][k][iA][iB] =
-						m_dSoln[VecFIx(FWIx, k)];
-				}
+				iEnd = m_nHorizontalOrder-1;
 			}
 
-			// Copy over Rho
-			if (pGrid->GetVarLocation(RIx) == DataLocation_REdge) {
-				for (int k = 0; k <= pGrid->GetRElements(); k++) {
-					dataRHSREdge[RIx][k][iA][iB] =
-						m_dSoln[VecFIx(FRIx, k)];
-				}
+			if (b == nBElements-1) {
+				jEnd = m_nHorizontalOrder;
 			} else {
-				for (int k = 0; k < pGrid->GetRElements(); k++) {
-					dataRHSNode[RIx][k][iA][iB] =
-						m_dSoln[VecFIx(FRIx, k)];
-				}
+				jEnd = m_nHorizontalOrder-1;
 			}
 
-			// "Update" tracers in column: initialize to zero, then apply update
-			if (dataInitialTracer.GetSize(0) > 0) {
-			  dataRHSTracer.Constant(0.0);
-			  UpdateColumnTracers(dDeltaT,
-					      dataInitialNode,
-					      dataRHSNode,
-					      dataInitialREdge,
-					      dataRHSREdge,
-					      dataReferenceTracer,
-					      dataInitialTracer,
-					      dataRHSTracer);
-			}
+		for (int i = 0; i < iEnd; i++) {
+		for (int j = 0; j < jEnd; j++) {
+
+			int iA = box.GetAInteriorBegin() + a * m_nHorizontalOrder + i;
+			int iB = box.GetBInteriorBegin() + b * m_nHorizontalOrder + j;
+
+			SolveImplicitColumn(
+				col,
+				pPatch, iA, iB,
+				iDataInitial,
+				iDataRHS,
+				dDeltaT);
 		}
 		}
 
+		} catch(...) {
+			excParallel.Capture();
 		}
 		}
+		}
+		excParallel.Rethrow();
+#endif
 
 		// Copy over new state on shared nodes (edges of constant alpha)
 		for (int a = 1; a < nAElements; a++) {
@@ -2063,9 +2693,240 @@ void VerticalDynamicsFEM::SolveImplicit(
 }
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+#ifdef USE_SUNDIALS
+
+void VerticalDynamicsFEM::SolveImplicitColumn(
+	ColumnWorkspace & ws,
+	GridPatch * pPatch,
+	int iA,
+	int iB,
+	int iDataInitial,
+	int iDataRHS,
+	double dDeltaT
+) {
+
+#ifdef ENABLE_JFNK_PRECONDITIONING
+	BuildSolveImplicitColumn(
+		ws,
+		pPatch, iA, iB,
+		iDataInitial,
+		iDataRHS);
+
+	// Use diagonal solver
+	int iInfo = LAPACK::DGBSV(
+		ws.m_matJacobianF, ws.m_dSoln, ws.m_vecIPiv,
+		m_nJacobianFOffD, m_nJacobianFOffD);
+	if (iInfo != 0) {
+		_EXCEPTION1("Solution failed: %i", iInfo);
+	}
+
+	ApplySolveImplicitColumn(
+		ws,
+		pPatch, iA, iB,
+		iDataInitial,
+		iDataRHS,
+		dDeltaT);
+#endif
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+#ifdef USE_SUNDIALS
+
+void VerticalDynamicsFEM::BuildSolveImplicitColumn(
+	ColumnWorkspace & ws,
+	GridPatch * pPatch,
+	int iA,
+	int iB,
+	int iDataInitial,
+	int iDataRHS
+) {
+
+#ifdef ENABLE_JFNK_PRECONDITIONING
+	// State Data
+	const DataArray4D<double> & dataRefNode =
+		pPatch->GetReferenceState(DataLocation_Node);
+
+	const DataArray4D<double> & dataInitialNode =
+		pPatch->GetDataState(iDataInitial, DataLocation_Node);
+
+	const DataArray4D<double> & dataRHSNode =
+		pPatch->GetDataState(iDataRHS, DataLocation_Node);
+
+	const DataArray4D<double> & dataRefREdge =
+		pPatch->GetReferenceState(DataLocation_REdge);
+
+	const DataArray4D<double> & dataInitialREdge =
+		pPatch->GetDataState(iDataInitial, DataLocation_REdge);
+
+	const DataArray4D<double> & dataRHSREdge =
+		pPatch->GetDataState(iDataRHS, DataLocation_REdge);
+
+	// fill ws.m_dColumnState with initial state data
+	SetupReferenceColumn(
+		ws,
+		pPatch, iA, iB,
+		dataRefNode,
+		dataInitialNode,
+		dataRefREdge,
+		dataInitialREdge);
+
+	// Prepare the column (computes metric terms, fills internal 
+	// storage with data from ws.m_dColumnState)
+	PrepareColumn(ws, ws.m_dColumnState);
+
+	// Build the F vector (don't actually need F, but we do need
+	// temporary data stored internally in class)
+	BuildF(ws, ws.m_dColumnState, ws.m_dSoln);
+
+	// Build the Jacobian (uses internal data structures filled by BuildF)
+	BuildJacobianF(ws, ws.m_dColumnState, &(ws.m_matJacobianF[0][0]));
+
+	// modify Jacobian (rescale all entries by m_dDeltaT)
+	ws.m_matJacobianF.Scale(m_dDeltaT);
+
+	// fill ws.m_dSoln with RHS data
+	//    first fill ws.m_dColumnState with RHS data instead of state data
+	SetupReferenceColumn(
+		ws,
+		pPatch, iA, iB,
+		dataRefNode,
+		dataRHSNode,
+		dataRefREdge,
+		dataRHSREdge);
+
+  			//    then copy RHS into ws.m_dSoln
+	for (int ivec=0; ivec<m_nColumnStateSize; ivec++)
+	  ws.m_dSoln[ivec] = ws.m_dColumnState[ivec];
+#endif
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+#ifdef USE_SUNDIALS
+
+void VerticalDynamicsFEM::ApplySolveImplicitColumn(
+	ColumnWorkspace & ws,
+	GridPatch * pPatch,
+	int iA,
+	int iB,
+	int iDataInitial,
+	int iDataRHS,
+	double dDeltaT
+) {
+
+#ifdef ENABLE_JFNK_PRECONDITIONING
+	// Get a copy of the grid
+	Grid * pGrid = m_model.GetGrid();
+
+	// Indices of EquationSet variables
+	const int PIx = 2;
+	const int WIx = 3;
+	const int RIx = 4;
+
+	// State Data
+	const DataArray4D<double> & dataInitialNode =
+		pPatch->GetDataState(iDataInitial, DataLocation_Node);
+
+	DataArray4D<double> & dataRHSNode =
+		pPatch->GetDataState(iDataRHS, DataLocation_Node);
+
+	const DataArray4D<double> & dataRefREdge =
+		pPatch->GetReferenceState(DataLocation_REdge);
+
+	const DataArray4D<double> & dataInitialREdge =
+		pPatch->GetDataState(iDataInitial, DataLocation_REdge);
+
+	DataArray4D<double> & dataRHSREdge =
+		pPatch->GetDataState(iDataRHS, DataLocation_REdge);
+
+	// Tracer Data
+	TracerArray4D & dataReferenceTracer =
+		pPatch->GetReferenceTracers();
+
+	TracerArray4D & dataInitialTracer =
+		pPatch->GetDataTracers(iDataInitial);
+
+	TracerArray4D & dataRHSTracer =
+		pPatch->GetDataTracers(iDataRHS);
+
+	// DEBUG (check for NANs in output)
+	if (!(ws.m_dSoln[0] == ws.m_dSoln[0])) {
+		DataArray1D<double> dEval;
+		dEval.Allocate(ws.m_dColumnState.GetRows());
+		Evaluate(ws, ws.m_dSoln, dEval);
+
+		for (int p = 0; p < dEval.GetRows(); p++) {
+			printf("%1.15e %1.15e %1.15e\n",
+				dEval[p], ws.m_dSoln[p] - ws.m_dColumnState[p], ws.m_dColumnState[p]);
+		}
+		for (int p = 0; p < ws.m_dExnerRefREdge.GetRows(); p++) {
+			printf("%1.15e %1.15e\n",
+				ws.m_dExnerRefREdge[p], dataRefREdge[RIx][p][iA][iB]);
+		}
+		_EXCEPTIONT("Inversion failure");
+	}
+
+
+	// Copy solution to thermodynamic closure
+	if (pGrid->GetVarLocation(PIx) == DataLocation_REdge) {
+		for (int k = 0; k <= pGrid->GetRElements(); k++) {
+			dataRHSREdge[PIx][k][iA][iB] =
+				ws.m_dSoln[VecFIx(FPIx, k)];
+		}
+	} else {
+		for (int k = 0; k < pGrid->GetRElements(); k++) {
+			dataRHSNode[PIx][k][iA][iB] =
+				ws.m_dSoln[VecFIx(FPIx, k)];
+		}
+	}
+
+	// Copy over W
+	if (pGrid->GetVarLocation(WIx) == DataLocation_REdge) {
+		for (int k = 0; k <= pGrid->GetRElements(); k++) {
+			dataRHSREdge[WIx][k][iA][iB] =
+				ws.m_dSoln[VecFIx(FWIx, k)];
+		}
+	} else {
+		for (int k = 0; k < pGrid->GetRElements(); k++) {
+			dataRHSNode[WIx][k][iA][iB] =
+				ws.m_dSoln[VecFIx(FWIx, k)];
+		}
+	}
+
+	// Copy over Rho
+	if (pGrid->GetVarLocation(RIx) == DataLocation_REdge) {
+		for (int k = 0; k <= pGrid->GetRElements(); k++) {
+			dataRHSREdge[RIx][k][iA][iB] =
+				ws.m_dSoln[VecFIx(FRIx, k)];
+		}
+	} else {
+		for (int k = 0; k < pGrid->GetRElements(); k++) {
+			dataRHSNode[RIx][k][iA][iB] =
+				ws.m_dSoln[VecFIx(FRIx, k)];
+		}
+	}
+
+	// "Update" tracers in column (zeroed prior to the column loop)
+	if (dataInitialTracer.GetSize(0) > 0) {
+	  UpdateColumnTracers(ws, dDeltaT,
+			      dataInitialNode,
+			      dataRHSNode,
+			      dataInitialREdge,
+			      dataRHSREdge,
+			      dataReferenceTracer,
+			      dataInitialTracer,
+			      dataRHSTracer);
+	}
+#endif
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void VerticalDynamicsFEM::SetupReferenceColumn(
+	ColumnWorkspace & ws,
 	GridPatch * pPatch,
 	int iA,
 	int iB,
@@ -2089,30 +2950,30 @@ void VerticalDynamicsFEM::SetupReferenceColumn(
 	const int nRElements = pGrid->GetRElements();
 
 	// Store active patch in index
-	m_pPatch = pPatch;
-	m_iA = iA;
-	m_iB = iB;
+	ws.m_pPatch = pPatch;
+	ws.m_iA = iA;
+	ws.m_iB = iB;
 
 	// Store U in State structure
 	for (int k = 0; k < nRElements; k++) {
-		m_dStateNode[UIx][k] = dataInitialNode[UIx][k][iA][iB];
+		ws.m_dStateNode[UIx][k] = dataInitialNode[UIx][k][iA][iB];
 	}
 
 	if (pGrid->GetVarsAtLocation(DataLocation_REdge) != 0) {
 		pGrid->InterpolateNodeToREdge(
-			m_dStateNode[UIx],
-			m_dStateREdge[UIx]);
+			ws.m_dStateNode[UIx],
+			ws.m_dStateREdge[UIx]);
 	}
 
 	// Store V in State structure
 	for (int k = 0; k < nRElements; k++) {
-		m_dStateNode[VIx][k] = dataInitialNode[VIx][k][iA][iB];
+		ws.m_dStateNode[VIx][k] = dataInitialNode[VIx][k][iA][iB];
 	}
 
 	if (pGrid->GetVarsAtLocation(DataLocation_REdge) != 0) {
 		pGrid->InterpolateNodeToREdge(
-			m_dStateNode[VIx],
-			m_dStateREdge[VIx]);
+			ws.m_dStateNode[VIx],
+			ws.m_dStateREdge[VIx]);
 	}
 
 #if !defined(EXPLICIT_VERTICAL_VELOCITY_ADVECTION) && \
@@ -2120,33 +2981,33 @@ void VerticalDynamicsFEM::SetupReferenceColumn(
 	// Calculate vertical derivatives of horizontal velocity
 	if (pGrid->GetVarLocation(WIx) == DataLocation_Node) {
 		pGrid->DifferentiateNodeToNode(
-			m_dStateNode[UIx],
-			m_dDiffUa);
+			ws.m_dStateNode[UIx],
+			ws.m_dDiffUa);
 
 		pGrid->DifferentiateNodeToNode(
-			m_dStateNode[VIx],
-			m_dDiffUb);
+			ws.m_dStateNode[VIx],
+			ws.m_dDiffUb);
 
 	} else {
 		pGrid->DifferentiateNodeToREdge(
-			m_dStateNode[UIx],
-			m_dDiffUa);
+			ws.m_dStateNode[UIx],
+			ws.m_dDiffUa);
 
 		pGrid->DifferentiateNodeToREdge(
-			m_dStateNode[VIx],
-			m_dDiffUb);
+			ws.m_dStateNode[VIx],
+			ws.m_dDiffUb);
 	}
 #endif
 
 	// Copy over Theta
 	if (pGrid->GetVarLocation(PIx) == DataLocation_REdge) {
 		for (int k = 0; k <= pGrid->GetRElements(); k++) {
-			m_dColumnState[VecFIx(FPIx, k)] =
+			ws.m_dColumnState[VecFIx(FPIx, k)] =
 				dataInitialREdge[PIx][k][iA][iB];
 		}
 	} else {
 		for (int k = 0; k < pGrid->GetRElements(); k++) {
-			m_dColumnState[VecFIx(FPIx, k)] =
+			ws.m_dColumnState[VecFIx(FPIx, k)] =
 				dataInitialNode[PIx][k][iA][iB];
 		}
 	}
@@ -2154,12 +3015,12 @@ void VerticalDynamicsFEM::SetupReferenceColumn(
 	// Copy over W
 	if (pGrid->GetVarLocation(WIx) == DataLocation_REdge) {
 		for (int k = 0; k <= pGrid->GetRElements(); k++) {
-			m_dColumnState[VecFIx(FWIx, k)] =
+			ws.m_dColumnState[VecFIx(FWIx, k)] =
 				dataInitialREdge[WIx][k][iA][iB];
 		}
 	} else {
 		for (int k = 0; k < pGrid->GetRElements(); k++) {
-			m_dColumnState[VecFIx(FWIx, k)] =
+			ws.m_dColumnState[VecFIx(FWIx, k)] =
 				dataInitialNode[WIx][k][iA][iB];
 		}
 	}
@@ -2167,12 +3028,12 @@ void VerticalDynamicsFEM::SetupReferenceColumn(
 	// Copy over rho
 	if (pGrid->GetVarLocation(RIx) == DataLocation_REdge) {
 		for (int k = 0; k <= pGrid->GetRElements(); k++) {
-			m_dColumnState[VecFIx(FRIx, k)] =
+			ws.m_dColumnState[VecFIx(FRIx, k)] =
 				dataInitialREdge[RIx][k][iA][iB];
 		}
 	} else {
 		for (int k = 0; k < pGrid->GetRElements(); k++) {
-			m_dColumnState[VecFIx(FRIx, k)] =
+			ws.m_dColumnState[VecFIx(FRIx, k)] =
 				dataInitialNode[RIx][k][iA][iB];
 		}
 	}
@@ -2180,88 +3041,89 @@ void VerticalDynamicsFEM::SetupReferenceColumn(
 	// Construct reference column
 	if ((pGrid->HasUniformDiffusion()) && (m_fUseReferenceState)) {
 		for (int k = 0; k < pGrid->GetRElements(); k++) {
-			m_dStateRefNode[RIx][k] = dataRefNode[RIx][k][iA][iB];
-			m_dStateRefNode[WIx][k] = dataRefNode[WIx][k][iA][iB];
-			m_dStateRefNode[PIx][k] = dataRefNode[PIx][k][iA][iB];
+			ws.m_dStateRefNode[RIx][k] = dataRefNode[RIx][k][iA][iB];
+			ws.m_dStateRefNode[WIx][k] = dataRefNode[WIx][k][iA][iB];
+			ws.m_dStateRefNode[PIx][k] = dataRefNode[PIx][k][iA][iB];
 		}
 		for (int k = 0; k <= pGrid->GetRElements(); k++) {
-			m_dStateRefREdge[RIx][k] = dataRefREdge[RIx][k][iA][iB];
-			m_dStateRefREdge[WIx][k] = dataRefREdge[WIx][k][iA][iB];
-			m_dStateRefREdge[PIx][k] = dataRefREdge[PIx][k][iA][iB];
+			ws.m_dStateRefREdge[RIx][k] = dataRefREdge[RIx][k][iA][iB];
+			ws.m_dStateRefREdge[WIx][k] = dataRefREdge[WIx][k][iA][iB];
+			ws.m_dStateRefREdge[PIx][k] = dataRefREdge[PIx][k][iA][iB];
 		}
 	}
 
 	// Metric terms
-	const DataArray3D<double> & dJacobian =
-		m_pPatch->GetJacobian();
+	const MetricArray3D & dJacobian =
+		ws.m_pPatch->GetJacobian();
 	const DataArray3D<double> & dElementArea =
-		m_pPatch->GetElementArea();
-	const DataArray3D<double> & dJacobianREdge =
-		m_pPatch->GetJacobianREdge();
-	const DataArray4D<double> & dDerivRNode =
-		m_pPatch->GetDerivRNode();
-	const DataArray4D<double> & dDerivRREdge =
-		m_pPatch->GetDerivRREdge();
-	const DataArray4D<double> & dContraMetricA =
-		m_pPatch->GetContraMetricA();
-	const DataArray4D<double> & dContraMetricB =
-		m_pPatch->GetContraMetricB();
-	const DataArray4D<double> & dContraMetricXi =
-		m_pPatch->GetContraMetricXi();
-	const DataArray4D<double> & dContraMetricAREdge =
-		m_pPatch->GetContraMetricAREdge();
-	const DataArray4D<double> & dContraMetricBREdge =
-		m_pPatch->GetContraMetricBREdge();
-	const DataArray4D<double> & dContraMetricXiREdge =
-		m_pPatch->GetContraMetricXiREdge();
+		ws.m_pPatch->GetElementArea();
+	const MetricArray3D & dJacobianREdge =
+		ws.m_pPatch->GetJacobianREdge();
+	const MetricArray4D & dDerivRNode =
+		ws.m_pPatch->GetDerivRNode();
+	const MetricArray4D & dDerivRREdge =
+		ws.m_pPatch->GetDerivRREdge();
+	const MetricArray4D & dContraMetricA =
+		ws.m_pPatch->GetContraMetricA();
+	const MetricArray4D & dContraMetricB =
+		ws.m_pPatch->GetContraMetricB();
+	const MetricArray4D & dContraMetricXi =
+		ws.m_pPatch->GetContraMetricXi();
+	const MetricArray4D & dContraMetricAREdge =
+		ws.m_pPatch->GetContraMetricAREdge();
+	const MetricArray4D & dContraMetricBREdge =
+		ws.m_pPatch->GetContraMetricBREdge();
+	const MetricArray4D & dContraMetricXiREdge =
+		ws.m_pPatch->GetContraMetricXiREdge();
 
 	for (int k = 0; k < pGrid->GetRElements(); k++) {
-		m_dColumnJacobianNode[k] = dJacobian[k][iA][iB];
-		m_dColumnElementArea[k] = dElementArea[k][iA][iB];
-		m_dColumnInvJacobianNode[k] = 1.0 / m_dColumnJacobianNode[k];
+		ws.m_dColumnJacobianNode[k] = dJacobian[k][iA][iB];
+		ws.m_dColumnElementArea[k] = dElementArea[k][iA][iB];
+		ws.m_dColumnInvJacobianNode[k] = 1.0 / ws.m_dColumnJacobianNode[k];
 
-		m_dColumnDerivRNode[k][0] = dDerivRNode[k][iA][iB][0];
-		m_dColumnDerivRNode[k][1] = dDerivRNode[k][iA][iB][1];
-		m_dColumnDerivRNode[k][2] = dDerivRNode[k][iA][iB][2];
+		ws.m_dColumnDerivRNode[k][0] = dDerivRNode[k][iA][iB][0];
+		ws.m_dColumnDerivRNode[k][1] = dDerivRNode[k][iA][iB][1];
+		ws.m_dColumnDerivRNode[k][2] = dDerivRNode[k][iA][iB][2];
 
-		m_dColumnContraMetricA[k][0] = dContraMetricA[k][iA][iB][0];
-		m_dColumnContraMetricA[k][1] = dContraMetricA[k][iA][iB][1];
-		m_dColumnContraMetricA[k][2] = dContraMetricA[k][iA][iB][2];
+		ws.m_dColumnContraMetricA[k][0] = dContraMetricA[k][iA][iB][0];
+		ws.m_dColumnContraMetricA[k][1] = dContraMetricA[k][iA][iB][1];
+		ws.m_dColumnContraMetricA[k][2] = dContraMetricA[k][iA][iB][2];
 
-		m_dColumnContraMetricB[k][0] = dContraMetricB[k][iA][iB][0];
-		m_dColumnContraMetricB[k][1] = dContraMetricB[k][iA][iB][1];
-		m_dColumnContraMetricB[k][2] = dContraMetricB[k][iA][iB][2];
+		ws.m_dColumnContraMetricB[k][0] = dContraMetricB[k][iA][iB][0];
+		ws.m_dColumnContraMetricB[k][1] = dContraMetricB[k][iA][iB][1];
+		ws.m_dColumnContraMetricB[k][2] = dContraMetricB[k][iA][iB][2];
 
-		m_dColumnContraMetricXi[k][0] = dContraMetricXi[k][iA][iB][0];
-		m_dColumnContraMetricXi[k][1] = dContraMetricXi[k][iA][iB][1];
-		m_dColumnContraMetricXi[k][2] = dContraMetricXi[k][iA][iB][2];
+		ws.m_dColumnContraMetricXi[k][0] = dContraMetricXi[k][iA][iB][0];
+		ws.m_dColumnContraMetricXi[k][1] = dContraMetricXi[k][iA][iB][1];
+		ws.m_dColumnContraMetricXi[k][2] = dContraMetricXi[k][iA][iB][2];
 	}
 
 	for (int k = 0; k <= pGrid->GetRElements(); k++) {
-		m_dColumnJacobianREdge[k] = dJacobianREdge[k][iA][iB];
-		m_dColumnInvJacobianREdge[k] = 1.0 / m_dColumnJacobianREdge[k];
+		ws.m_dColumnJacobianREdge[k] = dJacobianREdge[k][iA][iB];
+		ws.m_dColumnInvJacobianREdge[k] = 1.0 / ws.m_dColumnJacobianREdge[k];
 
-		m_dColumnDerivRREdge[k][0] = dDerivRREdge[k][iA][iB][0];
-		m_dColumnDerivRREdge[k][1] = dDerivRREdge[k][iA][iB][1];
-		m_dColumnDerivRREdge[k][2] = dDerivRREdge[k][iA][iB][2];
+		ws.m_dColumnDerivRREdge[k][0] = dDerivRREdge[k][iA][iB][0];
+		ws.m_dColumnDerivRREdge[k][1] = dDerivRREdge[k][iA][iB][1];
+		ws.m_dColumnDerivRREdge[k][2] = dDerivRREdge[k][iA][iB][2];
 
-		m_dColumnContraMetricAREdge[k][0] = dContraMetricAREdge[k][iA][iB][0];
-		m_dColumnContraMetricAREdge[k][1] = dContraMetricAREdge[k][iA][iB][1];
-		m_dColumnContraMetricAREdge[k][2] = dContraMetricAREdge[k][iA][iB][2];
+		ws.m_dColumnContraMetricAREdge[k][0] = dContraMetricAREdge[k][iA][iB][0];
+		ws.m_dColumnContraMetricAREdge[k][1] = dContraMetricAREdge[k][iA][iB][1];
+		ws.m_dColumnContraMetricAREdge[k][2] = dContraMetricAREdge[k][iA][iB][2];
 
-		m_dColumnContraMetricBREdge[k][0] = dContraMetricBREdge[k][iA][iB][0];
-		m_dColumnContraMetricBREdge[k][1] = dContraMetricBREdge[k][iA][iB][1];
-		m_dColumnContraMetricBREdge[k][2] = dContraMetricBREdge[k][iA][iB][2];
+		ws.m_dColumnContraMetricBREdge[k][0] = dContraMetricBREdge[k][iA][iB][0];
+		ws.m_dColumnContraMetricBREdge[k][1] = dContraMetricBREdge[k][iA][iB][1];
+		ws.m_dColumnContraMetricBREdge[k][2] = dContraMetricBREdge[k][iA][iB][2];
 
-		m_dColumnContraMetricXiREdge[k][0] = dContraMetricXiREdge[k][iA][iB][0];
-		m_dColumnContraMetricXiREdge[k][1] = dContraMetricXiREdge[k][iA][iB][1];
-		m_dColumnContraMetricXiREdge[k][2] = dContraMetricXiREdge[k][iA][iB][2];
+		ws.m_dColumnContraMetricXiREdge[k][0] = dContraMetricXiREdge[k][iA][iB][0];
+		ws.m_dColumnContraMetricXiREdge[k][1] = dContraMetricXiREdge[k][iA][iB][1];
+		ws.m_dColumnContraMetricXiREdge[k][2] = dContraMetricXiREdge[k][iA][iB][2];
 	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 void VerticalDynamicsFEM::PrepareColumn(
+	ColumnWorkspace & ws,
 	const double * dX
 ) {
 	// Indices of EquationSet variables
@@ -2285,27 +3147,27 @@ void VerticalDynamicsFEM::PrepareColumn(
 
 		// Store pressure
 		if (pGrid->GetVarLocation(PIx) == DataLocation_Node) {
-			m_dStateNode[PIx][k] = dX[VecFIx(FPIx, k)];
+			ws.m_dStateNode[PIx][k] = dX[VecFIx(FPIx, k)];
 		} else {
-			m_dStateREdge[PIx][k] = dX[VecFIx(FPIx, k)];
+			ws.m_dStateREdge[PIx][k] = dX[VecFIx(FPIx, k)];
 		}
 
 		// Store vertical velocity
 		if (pGrid->GetVarLocation(WIx) == DataLocation_Node) {
-			m_dStateNode[WIx][k] = dX[VecFIx(FWIx, k)];
+			ws.m_dStateNode[WIx][k] = dX[VecFIx(FWIx, k)];
 		} else {
-			m_dStateREdge[WIx][k] = dX[VecFIx(FWIx, k)];
+			ws.m_dStateREdge[WIx][k] = dX[VecFIx(FWIx, k)];
 		}
 
 		// Store density
-		m_dStateNode[RIx][k] = dX[VecFIx(FRIx, k)];
+		ws.m_dStateNode[RIx][k] = dX[VecFIx(FRIx, k)];
 	}
 
 	if (pGrid->GetVarLocation(WIx) == DataLocation_REdge) {
-		m_dStateREdge[WIx][nRElements] = dX[VecFIx(FWIx, nRElements)];
+		ws.m_dStateREdge[WIx][nRElements] = dX[VecFIx(FWIx, nRElements)];
 	}
 	if (pGrid->GetVarLocation(PIx) == DataLocation_REdge) {
-		m_dStateREdge[PIx][nRElements] = dX[VecFIx(FPIx, nRElements)];
+		ws.m_dStateREdge[PIx][nRElements] = dX[VecFIx(FPIx, nRElements)];
 	}
 
 	// Vertical velocity on model levels
@@ -2314,55 +3176,55 @@ void VerticalDynamicsFEM::PrepareColumn(
 #ifdef FORMULATION_PRESSURE
 		// Calculate derivative of P at nodes
 		pGrid->DifferentiateNodeToNode(
-			m_dStateNode[PIx],
-			m_dDiffPNode);
+			ws.m_dStateNode[PIx],
+			ws.m_dDiffPNode);
 #endif
 #ifdef FORMULATION_RHOTHETA_PI
 		// Calculate Exner pressure at nodes
 		for (int k = 0; k < nRElements; k++) {
-			m_dExnerNode[k] =
-				phys.ExnerPressureFromRhoTheta(m_dStateNode[PIx][k]);
+			ws.m_dExnerNode[k] =
+				phys.ExnerPressureFromRhoTheta(ws.m_dStateNode[PIx][k]);
 		}
 
 		// Calculate derivative of Exner pressure at nodes
 		pGrid->DifferentiateNodeToNode(
-			m_dExnerNode,
-			m_dDiffPNode);
+			ws.m_dExnerNode,
+			ws.m_dDiffPNode);
 #endif
 #ifdef FORMULATION_RHOTHETA_P
 		// Calculate pressure at nodes
 		for (int k = 0; k < nRElements; k++) {
-			m_dExnerNode[k] =
-				phys.PressureFromRhoTheta(m_dStateNode[PIx][k]);
+			ws.m_dExnerNode[k] =
+				phys.PressureFromRhoTheta(ws.m_dStateNode[PIx][k]);
 		}
 
 		// Calculate derivative of Exner pressure at nodes
 		pGrid->DifferentiateNodeToNode(
-			m_dExnerNode,
-			m_dDiffPNode);
+			ws.m_dExnerNode,
+			ws.m_dDiffPNode);
 #endif
 #if defined(FORMULATION_THETA) || defined(FORMULATION_THETA_FLUX)
 		// Calculate Exner pressure at nodes
 		for (int k = 0; k < nRElements; k++) {
-			m_dExnerNode[k] =
+			ws.m_dExnerNode[k] =
 				phys.ExnerPressureFromRhoTheta(
-					m_dStateNode[RIx][k] * m_dStateNode[PIx][k]);
+					ws.m_dStateNode[RIx][k] * ws.m_dStateNode[PIx][k]);
 		}
 
 		// Calculate derivative of Exner pressure at nodes
 		pGrid->DifferentiateNodeToNode(
-			m_dExnerNode,
-			m_dDiffPNode);
+			ws.m_dExnerNode,
+			ws.m_dDiffPNode);
 
 		// Theta derivatives on model levels
 		if (pGrid->GetVarLocation(PIx) == DataLocation_Node) {
 			pGrid->DifferentiateNodeToNode(
-				m_dStateNode[PIx],
-				m_dDiffThetaNode);
+				ws.m_dStateNode[PIx],
+				ws.m_dDiffThetaNode);
 		} else {
 			pGrid->DifferentiateREdgeToREdge(
-				m_dStateREdge[PIx],
-				m_dDiffThetaREdge);
+				ws.m_dStateREdge[PIx],
+				ws.m_dDiffThetaREdge);
 		}
 
 #endif
@@ -2374,67 +3236,67 @@ void VerticalDynamicsFEM::PrepareColumn(
 
 		// W is needed on model levels
 		pGrid->InterpolateREdgeToNode(
-			m_dStateREdge[WIx],
-			m_dStateNode[WIx]);
+			ws.m_dStateREdge[WIx],
+			ws.m_dStateNode[WIx]);
 
 		// Rho are needed on model interfaces
 		pGrid->InterpolateNodeToREdge(
-			m_dStateNode[RIx],
-			m_dStateREdge[RIx]);
+			ws.m_dStateNode[RIx],
+			ws.m_dStateREdge[RIx]);
 
 #ifdef FORMULATION_PRESSURE
 		// Interpolate P to edges
 		pGrid->InterpolateNodeToREdge(
-			m_dStateNode[PIx],
-			m_dStateREdge[PIx]);
+			ws.m_dStateNode[PIx],
+			ws.m_dStateREdge[PIx]);
 
 		// Calculate derivative of P at edges
 		pGrid->DifferentiateNodeToREdge(
-			m_dStateNode[PIx],
-			m_dDiffPREdge);
+			ws.m_dStateNode[PIx],
+			ws.m_dDiffPREdge);
 
 		// Calculate derivative of P at nodes
 		if (pGrid->GetVarLocation(PIx) == DataLocation_Node) {
 			pGrid->DifferentiateNodeToNode(
-				m_dStateNode[PIx],
-				m_dDiffPNode);
+				ws.m_dStateNode[PIx],
+				ws.m_dDiffPNode);
 		}
 #endif
 #ifdef FORMULATION_RHOTHETA_PI
 		// Interpolate RhoTheta to edges
 		pGrid->InterpolateNodeToREdge(
-			m_dStateNode[PIx],
-			m_dStateREdge[PIx]);
+			ws.m_dStateNode[PIx],
+			ws.m_dStateREdge[PIx]);
 
 		// Calculate Exner pressure at nodes
 		for (int k = 0; k < nRElements; k++) {
-			m_dExnerNode[k] =
+			ws.m_dExnerNode[k] =
 				phys.ExnerPressureFromRhoTheta(
-					m_dStateNode[PIx][k]);
+					ws.m_dStateNode[PIx][k]);
 		}
 
 		// Calculate derivative of Exner pressure at interfaces
 		pGrid->DifferentiateNodeToREdge(
-			m_dExnerNode,
-			m_dDiffPREdge);
+			ws.m_dExnerNode,
+			ws.m_dDiffPREdge);
 #endif
 #ifdef FORMULATION_RHOTHETA_P
 		// Interpolate RhoTheta to edges
 		pGrid->InterpolateNodeToREdge(
-			m_dStateNode[PIx],
-			m_dStateREdge[PIx]);
+			ws.m_dStateNode[PIx],
+			ws.m_dStateREdge[PIx]);
 
 		// Calculate pressure at nodes
 		for (int k = 0; k < nRElements; k++) {
-			m_dExnerNode[k] =
+			ws.m_dExnerNode[k] =
 				phys.PressureFromRhoTheta(
-					m_dStateNode[PIx][k]);
+					ws.m_dStateNode[PIx][k]);
 		}
 
 		// Calculate derivative of pressure at interfaces
 		pGrid->DifferentiateNodeToREdge(
-			m_dExnerNode,
-			m_dDiffPREdge);
+			ws.m_dExnerNode,
+			ws.m_dDiffPREdge);
 #endif
 #if defined(FORMULATION_THETA) || defined(FORMULATION_THETA_FLUX)
 
@@ -2442,77 +3304,77 @@ void VerticalDynamicsFEM::PrepareColumn(
 		if (pGrid->GetVarLocation(PIx) == DataLocation_Node) {	
 			// Theta is needed on model interfaces
 			pGrid->InterpolateNodeToREdge(
-				m_dStateNode[PIx],
-				m_dStateREdge[PIx]);
+				ws.m_dStateNode[PIx],
+				ws.m_dStateREdge[PIx]);
 
 			// Theta derivatives on model levels
 			pGrid->DifferentiateNodeToNode(
-				m_dStateNode[PIx],
-				m_dDiffThetaNode);
+				ws.m_dStateNode[PIx],
+				ws.m_dDiffThetaNode);
 
 		// Theta on model interfaces
 		} else {
 			// Theta is needed on model levels
 			pGrid->InterpolateREdgeToNode(
-				m_dStateREdge[PIx],
-				m_dStateNode[PIx]);
+				ws.m_dStateREdge[PIx],
+				ws.m_dStateNode[PIx]);
 
 			// Theta derivatives on model interfaces
 			pGrid->DifferentiateREdgeToREdge(
-				m_dStateREdge[PIx],
-				m_dDiffThetaREdge);
+				ws.m_dStateREdge[PIx],
+				ws.m_dDiffThetaREdge);
 		}
 
 		// Calculate Exner pressure at nodes
 		for (int k = 0; k < nRElements; k++) {
-			m_dExnerNode[k] =
+			ws.m_dExnerNode[k] =
 				phys.ExnerPressureFromRhoTheta(
-					m_dStateNode[RIx][k] * m_dStateNode[PIx][k]);
+					ws.m_dStateNode[RIx][k] * ws.m_dStateNode[PIx][k]);
 		}
 
 		// Calculate derivative of Exner pressure at interfaces
 		pGrid->DifferentiateNodeToREdge(
-			m_dExnerNode,
-			m_dDiffPREdge);
+			ws.m_dExnerNode,
+			ws.m_dDiffPREdge);
 #endif
 	}
 
 	// Calculate u^xi on model levels
 	for (int k = 0; k < nRElements; k++) {
 		double dCovUx =
-			m_dStateNode[WIx][k] * m_dColumnDerivRNode[k][2];
+			ws.m_dStateNode[WIx][k] * ws.m_dColumnDerivRNode[k][2];
 
-		m_dXiDotNode[k] =
-			  m_dColumnContraMetricXi[k][0] * m_dStateNode[UIx][k]
-			+ m_dColumnContraMetricXi[k][1] * m_dStateNode[VIx][k]
-			+ m_dColumnContraMetricXi[k][2] * dCovUx;
+		ws.m_dXiDotNode[k] =
+			  ws.m_dColumnContraMetricXi[k][0] * ws.m_dStateNode[UIx][k]
+			+ ws.m_dColumnContraMetricXi[k][1] * ws.m_dStateNode[VIx][k]
+			+ ws.m_dColumnContraMetricXi[k][2] * dCovUx;
 	}
 
 	// Calculate u^xi on model interfaces
 	for (int k = 1; k < nRElements; k++) {
 		double dCovUx =
-			m_dStateREdge[WIx][k] * m_dColumnDerivRREdge[k][2];
+			ws.m_dStateREdge[WIx][k] * ws.m_dColumnDerivRREdge[k][2];
 
-		m_dXiDotREdge[k] =
-			  m_dColumnContraMetricXiREdge[k][0] * m_dStateREdge[UIx][k]
-			+ m_dColumnContraMetricXiREdge[k][1] * m_dStateREdge[VIx][k]
-			+ m_dColumnContraMetricXiREdge[k][2] * dCovUx;
+		ws.m_dXiDotREdge[k] =
+			  ws.m_dColumnContraMetricXiREdge[k][0] * ws.m_dStateREdge[UIx][k]
+			+ ws.m_dColumnContraMetricXiREdge[k][1] * ws.m_dStateREdge[VIx][k]
+			+ ws.m_dColumnContraMetricXiREdge[k][2] * dCovUx;
 	}
 
-	m_dXiDotREdge[0] = 0.0;
-	m_dXiDotREdge[nRElements] = 0.0;
+	ws.m_dXiDotREdge[0] = 0.0;
+	ws.m_dXiDotREdge[nRElements] = 0.0;
 
 #if !defined(EXPLICIT_VERTICAL_VELOCITY_ADVECTION) \
  && !defined(VERTICAL_VELOCITY_ADVECTION_CLARK)
 	// Calculate vertical derivatives of W needed for advective form of W
 	if (pGrid->GetVarLocation(WIx) == DataLocation_Node) {
 		pGrid->DifferentiateNodeToNode(
-			m_dStateNode[WIx],
-			m_dDiffWNode);
+			ws.m_dStateNode[WIx],
+			ws.m_dDiffWNode);
 	} else {
 		pGrid->DifferentiateREdgeToREdge(
-			m_dStateREdge[WIx],
-			m_dDiffWREdge);
+			ws.m_dStateREdge[WIx],
+			ws.m_dDiffWREdge);
 	}
 #endif
 
@@ -2524,8 +3386,8 @@ void VerticalDynamicsFEM::PrepareColumn(
 
 		if (pGrid->GetVarLocation(c) == DataLocation_REdge) {
 			pGrid->DiffDiffREdgeToREdge(
-				m_dStateREdge[c],
-				m_dDiffDiffStateUpwind[c]);
+				ws.m_dStateREdge[c],
+				ws.m_dDiffDiffStateUpwind[c]);
 		}
 	}
 
@@ -2541,19 +3403,19 @@ void VerticalDynamicsFEM::PrepareColumn(
 		// Variable on model interfaces
 		if (pGrid->GetVarLocation(c) == DataLocation_REdge) {
 			pGrid->DiffDiffREdgeToREdge(
-				m_dStateREdge[c],
-				m_dDiffDiffStateHypervis[c]);
+				ws.m_dStateREdge[c],
+				ws.m_dDiffDiffStateHypervis[c]);
 
 			// Calculate second-derivative of variable minus reference
 			if (m_fUniformDiffusionVar[c]) {
 				pGrid->DiffDiffREdgeToREdge(
-					m_dStateRefREdge[c],
-					m_dDiffDiffStateUniform[c]);
+					ws.m_dStateRefREdge[c],
+					ws.m_dDiffDiffStateUniform[c]);
 
 				for (int k = 0; k <= nRElements; k++) {
-					m_dDiffDiffStateUniform[c][k] =
-						m_dDiffDiffStateHypervis[c][k]
-						- m_dDiffDiffStateUniform[c][k];
+					ws.m_dDiffDiffStateUniform[c][k] =
+						ws.m_dDiffDiffStateHypervis[c][k]
+						- ws.m_dDiffDiffStateUniform[c][k];
 				}
 			}
 
@@ -2561,13 +3423,13 @@ void VerticalDynamicsFEM::PrepareColumn(
 			if (m_fHypervisVar[c]) {
 				for (int h = 2; h < m_nHypervisOrder; h += 2) {
 					memcpy(
-						m_dStateAux,
-						m_dDiffDiffStateHypervis[c],
+						ws.m_dStateAux,
+						ws.m_dDiffDiffStateHypervis[c],
 						(nRElements+1) * sizeof(double));
 	
 					pGrid->DiffDiffREdgeToREdge(
-						m_dStateAux,
-						m_dDiffDiffStateHypervis[c]
+						ws.m_dStateAux,
+						ws.m_dDiffDiffStateHypervis[c]
 					);
 				}
 			}
@@ -2575,19 +3437,19 @@ void VerticalDynamicsFEM::PrepareColumn(
 		// Variable on model levels
 		} else {
 			pGrid->DiffDiffNodeToNode(
-				m_dStateNode[c],
-				m_dDiffDiffStateHypervis[c]);
+				ws.m_dStateNode[c],
+				ws.m_dDiffDiffStateHypervis[c]);
 
 			// Calculate second-derivative of variable minus reference
 			if (m_fUniformDiffusionVar[c]) {
 				pGrid->DiffDiffNodeToNode(
-					m_dStateRefNode[c],
-					m_dDiffDiffStateUniform[c]);
+					ws.m_dStateRefNode[c],
+					ws.m_dDiffDiffStateUniform[c]);
 
 				for (int k = 0; k < nRElements; k++) {
-					m_dDiffDiffStateUniform[c][k] =
-						m_dDiffDiffStateHypervis[c][k]
-						- m_dDiffDiffStateUniform[c][k];
+					ws.m_dDiffDiffStateUniform[c][k] =
+						ws.m_dDiffDiffStateHypervis[c][k]
+						- ws.m_dDiffDiffStateUniform[c][k];
 				}
 			}
 
@@ -2595,13 +3457,13 @@ void VerticalDynamicsFEM::PrepareColumn(
 			if (m_fHypervisVar[c]) {
 				for (int h = 2; h < m_nHypervisOrder; h += 2) {
 					memcpy(
-						m_dStateAux,
-						m_dDiffDiffStateHypervis[c],
+						ws.m_dStateAux,
+						ws.m_dDiffDiffStateHypervis[c],
 						nRElements * sizeof(double));
 
 					pGrid->DiffDiffNodeToNode(
-						m_dStateAux,
-						m_dDiffDiffStateHypervis[c]
+						ws.m_dStateAux,
+						ws.m_dDiffDiffStateHypervis[c]
 					);
 				}
 			}
@@ -2612,6 +3474,7 @@ void VerticalDynamicsFEM::PrepareColumn(
 ///////////////////////////////////////////////////////////////////////////////
 
 void VerticalDynamicsFEM::BuildF(
+	ColumnWorkspace & ws,
 	const double * dX,
 	double * dF
 ) {
@@ -2649,39 +3512,39 @@ void VerticalDynamicsFEM::BuildF(
 	// Mass flux on model interfaces
 	if (!fMassFluxOnLevels) {
 		for (int k = 1; k < nRElements; k++) {
-			m_dMassFluxREdge[k] =
-				m_dColumnJacobianREdge[k]
-				* m_dStateREdge[RIx][k]
-				* m_dXiDotREdge[k];
+			ws.m_dMassFluxREdge[k] =
+				ws.m_dColumnJacobianREdge[k]
+				* ws.m_dStateREdge[RIx][k]
+				* ws.m_dXiDotREdge[k];
 		}
 
 		pGrid->DifferentiateREdgeToNode(
-			m_dMassFluxREdge,
-			m_dDiffMassFluxNode);
+			ws.m_dMassFluxREdge,
+			ws.m_dDiffMassFluxNode);
 
 	// Mass flux on model levels
 	} else {
 		for (int k = 0; k < nRElements; k++) {
-			m_dMassFluxNode[k] =
-				m_dColumnJacobianNode[k]
-				* m_dStateNode[RIx][k]
-				* m_dXiDotNode[k];
+			ws.m_dMassFluxNode[k] =
+				ws.m_dColumnJacobianNode[k]
+				* ws.m_dStateNode[RIx][k]
+				* ws.m_dXiDotNode[k];
 		}
 
 		pGrid->DifferentiateNodeToNode(
-			m_dMassFluxNode,
-			m_dDiffMassFluxNode,
+			ws.m_dMassFluxNode,
+			ws.m_dDiffMassFluxNode,
 			fZeroBoundaries);
 	}
 
 	// Change in density on model levels
 	double dSum = 0.0;
 	for (int k = 0; k < nRElements; k++) {
-		dSum += m_dColumnElementArea[k] * m_dDiffMassFluxNode[k];
+		dSum += ws.m_dColumnElementArea[k] * ws.m_dDiffMassFluxNode[k];
 
 		dF[VecFIx(FRIx, k)] =
-			m_dDiffMassFluxNode[k]
-			* m_dColumnInvJacobianNode[k];
+			ws.m_dDiffMassFluxNode[k]
+			* ws.m_dColumnInvJacobianNode[k];
 	}
 
 #if !defined(EXPLICIT_THERMO)
@@ -2689,30 +3552,30 @@ void VerticalDynamicsFEM::BuildF(
 	// Pressure flux calculated on model interfaces
 	if (!fMassFluxOnLevels) {
 		for (int k = 1; k < nRElements; k++) {
-			m_dPressureFluxREdge[k] =
-				m_dColumnJacobianREdge[k]
+			ws.m_dPressureFluxREdge[k] =
+				ws.m_dColumnJacobianREdge[k]
 				* phys.GetGamma()
-				* m_dStateREdge[PIx][k]
-				* m_dXiDotREdge[k];
+				* ws.m_dStateREdge[PIx][k]
+				* ws.m_dXiDotREdge[k];
 		}
 
 		pGrid->DifferentiateREdgeToNode(
-			m_dPressureFluxREdge,
-			m_dDiffPressureFluxNode);
+			ws.m_dPressureFluxREdge,
+			ws.m_dDiffPressureFluxNode);
 
 	// Pressure flux calculated on model levels
 	} else {
 		for (int k = 0; k < nRElements; k++) {
-			m_dPressureFluxNode[k] =
-				m_dColumnJacobianNode[k]
+			ws.m_dPressureFluxNode[k] =
+				ws.m_dColumnJacobianNode[k]
 				* phys.GetGamma()
-				* m_dStateNode[PIx][k]
-				* m_dXiDotNode[k];
+				* ws.m_dStateNode[PIx][k]
+				* ws.m_dXiDotNode[k];
 		}
 
 		pGrid->DifferentiateNodeToNode(
-			m_dPressureFluxNode,
-			m_dDiffPressureFluxNode,
+			ws.m_dPressureFluxNode,
+			ws.m_dDiffPressureFluxNode,
 			fZeroBoundaries);
 	}
 
@@ -2720,48 +3583,48 @@ void VerticalDynamicsFEM::BuildF(
 	for (int k = 0; k < nRElements; k++) {
 		dF[VecFIx(FPIx, k)] =
 			- (phys.GetGamma() - 1.0)
-			* m_dXiDotNode[k]
-			* m_dDiffPNode[k];
+			* ws.m_dXiDotNode[k]
+			* ws.m_dDiffPNode[k];
 
 		dF[VecFIx(FPIx, k)] +=
-			m_dDiffPressureFluxNode[k]
-			* m_dColumnInvJacobianNode[k];
+			ws.m_dDiffPressureFluxNode[k]
+			* ws.m_dColumnInvJacobianNode[k];
 	}
 #endif
 #if defined(FORMULATION_RHOTHETA_PI) || defined(FORMULATION_RHOTHETA_P)
 	// RhoTheta flux on model interfaces
 	if (!fMassFluxOnLevels) {
 		for (int k = 1; k < nRElements; k++) {
-			m_dPressureFluxREdge[k] =
-				m_dColumnJacobianREdge[k]
-				* m_dStateREdge[PIx][k]
-				* m_dXiDotREdge[k];
+			ws.m_dPressureFluxREdge[k] =
+				ws.m_dColumnJacobianREdge[k]
+				* ws.m_dStateREdge[PIx][k]
+				* ws.m_dXiDotREdge[k];
 		}
 
 		pGrid->DifferentiateREdgeToNode(
-			m_dPressureFluxREdge,
-			m_dDiffPressureFluxNode);
+			ws.m_dPressureFluxREdge,
+			ws.m_dDiffPressureFluxNode);
 
 	// RhoTheta flux on model levels
 	} else {
 		for (int k = 0; k < nRElements; k++) {
-			m_dPressureFluxNode[k] =
-				m_dColumnJacobianNode[k]
-				* m_dStateNode[PIx][k]
-				* m_dXiDotNode[k];
+			ws.m_dPressureFluxNode[k] =
+				ws.m_dColumnJacobianNode[k]
+				* ws.m_dStateNode[PIx][k]
+				* ws.m_dXiDotNode[k];
 		}
 
 		pGrid->DifferentiateNodeToNode(
-			m_dPressureFluxNode,
-			m_dDiffPressureFluxNode,
+			ws.m_dPressureFluxNode,
+			ws.m_dDiffPressureFluxNode,
 			fZeroBoundaries);
 	}
 
 	// Change in RhoTheta on model levels
 	for (int k = 0; k < nRElements; k++) {
 		dF[VecFIx(FPIx, k)] +=
-			m_dDiffPressureFluxNode[k]
-			* m_dColumnInvJacobianNode[k];
+			ws.m_dDiffPressureFluxNode[k]
+			* ws.m_dColumnInvJacobianNode[k];
 	}
 
 #endif
@@ -2771,13 +3634,13 @@ void VerticalDynamicsFEM::BuildF(
 
 		// Test using u^xi on interfaces interpolated to nodes for Lorenz
 		pGrid->InterpolateREdgeToNode(
-				m_dXiDotREdge,
-				m_dXiDotNode);
+				ws.m_dXiDotREdge,
+				ws.m_dXiDotNode);
 
 		// Change in Theta on model levels
 		for (int k = 0; k < nRElements; k++) {
 			dF[VecFIx(FPIx, k)] +=
-				m_dXiDotNode[k] * m_dDiffThetaNode[k];
+				ws.m_dXiDotNode[k] * ws.m_dDiffThetaNode[k];
 		}
 
 	// Update theta on model interfaces
@@ -2785,7 +3648,7 @@ void VerticalDynamicsFEM::BuildF(
 		// Change in Theta on model interfaces
 		for (int k = 0; k <= nRElements; k++) {
 			dF[VecFIx(FPIx, k)] +=
-				m_dXiDotREdge[k] * m_dDiffThetaREdge[k];
+				ws.m_dXiDotREdge[k] * ws.m_dDiffThetaREdge[k];
 		}
 	}
 #endif
@@ -2795,67 +3658,67 @@ void VerticalDynamicsFEM::BuildF(
 
 		// Test using u^xi on interfaces interpolated to nodes for Lorenz
 		pGrid->InterpolateREdgeToNode(
-				m_dXiDotREdge,
-				m_dXiDotNode);
+				ws.m_dXiDotREdge,
+				ws.m_dXiDotNode);
 
 		// Pressure flux on model levels
 		for (int k = 0; k < nRElements; k++) {
-			m_dPressureFluxNode[k] =
-				m_dColumnJacobianNode[k]
-				* m_dStateNode[PIx][k]
-				* m_dXiDotNode[k];
+			ws.m_dPressureFluxNode[k] =
+				ws.m_dColumnJacobianNode[k]
+				* ws.m_dStateNode[PIx][k]
+				* ws.m_dXiDotNode[k];
 		}
 
 		// Xidot derivatives on model levels
 		pGrid->DifferentiateNodeToNode(
-			m_dXiDotNode,
-			m_dStateAuxDiff);
+			ws.m_dXiDotNode,
+			ws.m_dStateAuxDiff);
 
 		// Theta flux derivatives on model levels
 		pGrid->DifferentiateNodeToNode(
-			m_dPressureFluxNode,
-			m_dDiffPressureFluxNode);
+			ws.m_dPressureFluxNode,
+			ws.m_dDiffPressureFluxNode);
 
 		// Change in Theta on model levels
 		for (int k = 0; k < nRElements; k++) {
 			dF[VecFIx(FPIx, k)] +=
-				m_dDiffPressureFluxNode[k]
-			  * m_dColumnInvJacobianNode[k];
+				ws.m_dDiffPressureFluxNode[k]
+			  * ws.m_dColumnInvJacobianNode[k];
 
 			dF[VecFIx(FPIx, k)] -=
-				m_dStateNode[PIx][k] * m_dStateAuxDiff[k];
+				ws.m_dStateNode[PIx][k] * ws.m_dStateAuxDiff[k];
 		}
 
 	// Update theta on model interfaces
 	} else {
 		// Pressure flux on model levels
 		for (int k = 0; k <= nRElements; k++) {
-			m_dPressureFluxREdge[k] =
-				m_dColumnJacobianREdge[k]
-				* m_dStateREdge[PIx][k]
-				* m_dXiDotREdge[k];
-
-			m_dStateAux[k] =
-				m_dColumnJacobianREdge[k]
-				* m_dXiDotREdge[k];
+			ws.m_dPressureFluxREdge[k] =
+				ws.m_dColumnJacobianREdge[k]
+				* ws.m_dStateREdge[PIx][k]
+				* ws.m_dXiDotREdge[k];
+
+			ws.m_dStateAux[k] =
+				ws.m_dColumnJacobianREdge[k]
+				* ws.m_dXiDotREdge[k];
 		}
 
 		// Xidot divergence on model interfaces
 		pGrid->DifferentiateREdgeToREdge(
-			m_dStateAux,
-			m_dStateAuxDiff);
+			ws.m_dStateAux,
+			ws.m_dStateAuxDiff);
 
 		// Theta flux derivatives on model interfaces
 		pGrid->DifferentiateREdgeToREdge(
-			m_dPressureFluxREdge,
-			m_dDiffPressureFluxREdge);
+			ws.m_dPressureFluxREdge,
+			ws.m_dDiffPressureFluxREdge);
 
 		// Change in Theta on model interfaces
 		for (int k = 0; k <= nRElements; k++) {
 			dF[VecFIx(FPIx, k)] +=
-				(m_dDiffPressureFluxREdge[k]
-				- m_dStateREdge[PIx][k] * m_dStateAuxDiff[k])
-				* m_dColumnInvJacobianREdge[k];
+				(ws.m_dDiffPressureFluxREdge[k]
+				- ws.m_dStateREdge[PIx][k] * ws.m_dStateAuxDiff[k])
+				* ws.m_dColumnInvJacobianREdge[k];
 		}
 	}
 #endif
@@ -2865,38 +3728,38 @@ void VerticalDynamicsFEM::BuildF(
 #if defined(VERTICAL_VELOCITY_ADVECTION_CLARK)
 	// Kinetic energy on model levels
 	for (int k = 0; k < nRElements; k++) {
-		double dCovUa = m_dStateNode[UIx][k];
-		double dCovUb = m_dStateNode[VIx][k];
-		double dCovUx = m_dStateNode[WIx][k] * m_dColumnDerivRNode[k][2];
+		double dCovUa = ws.m_dStateNode[UIx][k];
+		double dCovUb = ws.m_dStateNode[VIx][k];
+		double dCovUx = ws.m_dStateNode[WIx][k] * ws.m_dColumnDerivRNode[k][2];
 
 		double dConUa =
-			  m_dColumnContraMetricA[k][0] * dCovUa
-			+ m_dColumnContraMetricA[k][1] * dCovUb
-			+ m_dColumnContraMetricA[k][2] * dCovUx;
+			  ws.m_dColumnContraMetricA[k][0] * dCovUa
+			+ ws.m_dColumnContraMetricA[k][1] * dCovUb
+			+ ws.m_dColumnContraMetricA[k][2] * dCovUx;
 
 		double dConUb =
-			  m_dColumnContraMetricB[k][0] * dCovUa
-			+ m_dColumnContraMetricB[k][1] * dCovUb
-			+ m_dColumnContraMetricB[k][2] * dCovUx;
+			  ws.m_dColumnContraMetricB[k][0] * dCovUa
+			+ ws.m_dColumnContraMetricB[k][1] * dCovUb
+			+ ws.m_dColumnContraMetricB[k][2] * dCovUx;
 
 		double dConUx =
-			  m_dColumnContraMetricXi[k][0] * dCovUa
-			+ m_dColumnContraMetricXi[k][1] * dCovUb
-			+ m_dColumnContraMetricXi[k][2] * dCovUx;
+			  ws.m_dColumnContraMetricXi[k][0] * dCovUa
+			+ ws.m_dColumnContraMetricXi[k][1] * dCovUb
+			+ ws.m_dColumnContraMetricXi[k][2] * dCovUx;
 
 		// Specific kinetic energy
-		m_dKineticEnergyNode[k] =
+		ws.m_dKineticEnergyNode[k] =
 			  0.5 * (dConUa * dCovUa + dConUb * dCovUb + dConUx * dCovUx);
 	}
 
 	if (pGrid->GetVarLocation(WIx) == DataLocation_Node) {
 		pGrid->DifferentiateNodeToNode(
-			m_dKineticEnergyNode,
-			m_dDiffKineticEnergyNode);
+			ws.m_dKineticEnergyNode,
+			ws.m_dDiffKineticEnergyNode);
 	} else {
 		pGrid->DifferentiateNodeToREdge(
-			m_dKineticEnergyNode,
-			m_dDiffKineticEnergyREdge);
+			ws.m_dKineticEnergyNode,
+			ws.m_dDiffKineticEnergyREdge);
 	}
 #endif
 #endif
@@ -2910,22 +3773,22 @@ void VerticalDynamicsFEM::BuildF(
 #if defined(FORMULATION_PRESSURE) \
  || defined(FORMULATION_RHOTHETA_P)
 			double dPressureGradientForce =
-				m_dDiffPNode[k] / m_dStateNode[RIx][k];
+				ws.m_dDiffPNode[k] / ws.m_dStateNode[RIx][k];
 #endif
 #ifdef FORMULATION_RHOTHETA_PI
 			double dPressureGradientForce =
-				  m_dDiffPNode[k]
-				* m_dStateNode[PIx][k]
-				/ m_dStateNode[RIx][k];
+				  ws.m_dDiffPNode[k]
+				* ws.m_dStateNode[PIx][k]
+				/ ws.m_dStateNode[RIx][k];
 #endif
 #if defined(FORMULATION_THETA) || defined(FORMULATION_THETA_FLUX)
 			double dPressureGradientForce =
-				  m_dDiffPNode[k]
-				* m_dStateNode[PIx][k];
+				  ws.m_dDiffPNode[k]
+				* ws.m_dStateNode[PIx][k];
 #endif
 
 			dF[VecFIx(FWIx, k)] =
-				dPressureGradientForce / m_dColumnDerivRNode[k][2];
+				dPressureGradientForce / ws.m_dColumnDerivRNode[k][2];
 
 			dF[VecFIx(FWIx, k)] +=
 				phys.GetG();
@@ -2933,31 +3796,31 @@ void VerticalDynamicsFEM::BuildF(
 #if !defined(EXPLICIT_VERTICAL_VELOCITY_ADVECTION)
 #if defined(VERTICAL_VELOCITY_ADVECTION_CLARK)
 			// Vertical advection of vertical velocity
-			double dCovUa = m_dStateNode[UIx][k];
-			double dCovUb = m_dStateNode[VIx][k];
-			double dCovUx = m_dStateNode[WIx][k] * m_dColumnDerivRNode[k][2];
+			double dCovUa = ws.m_dStateNode[UIx][k];
+			double dCovUb = ws.m_dStateNode[VIx][k];
+			double dCovUx = ws.m_dStateNode[WIx][k] * ws.m_dColumnDerivRNode[k][2];
 
 			double dConUa =
-				  m_dColumnContraMetricA[k][0] * dCovUa
-				+ m_dColumnContraMetricA[k][1] * dCovUb
-				+ m_dColumnContraMetricA[k][2] * dCovUx;
+				  ws.m_dColumnContraMetricA[k][0] * dCovUa
+				+ ws.m_dColumnContraMetricA[k][1] * dCovUb
+				+ ws.m_dColumnContraMetricA[k][2] * dCovUx;
 
 			double dConUb =
-				  m_dColumnContraMetricB[k][0] * dCovUa
-				+ m_dColumnContraMetricB[k][1] * dCovUb
-				+ m_dColumnContraMetricB[k][2] * dCovUx;
+				  ws.m_dColumnContraMetricB[k][0] * dCovUa
+				+ ws.m_dColumnContraMetricB[k][1] * dCovUb
+				+ ws.m_dColumnContraMetricB[k][2] * dCovUx;
 
 			double dCurlTerm =
-				- dConUa * m_dDiffUa[k]
-				- dConUb * m_dDiffUb[k];
+				- dConUa * ws.m_dDiffUa[k]
+				- dConUb * ws.m_dDiffUb[k];
 
 			dF[VecFIx(FWIx, k)] +=
-				(m_dDiffKineticEnergyNode[k] + dCurlTerm)
-					/ m_dColumnDerivRNode[k][2];
+				(ws.m_dDiffKineticEnergyNode[k] + dCurlTerm)
+					/ ws.m_dColumnDerivRNode[k][2];
 
 #else // VERTICAL VELOCITY ADVECTION (ADVECTIVE FORM)
 			dF[VecFIx(FWIx, k)] +=
-				m_dXiDotNode[k] * m_dDiffWNode[k];
+				ws.m_dXiDotNode[k] * ws.m_dDiffWNode[k];
 #endif
 #endif
 		}
@@ -2970,22 +3833,22 @@ void VerticalDynamicsFEM::BuildF(
 #if defined(FORMULATION_PRESSURE) \
  || defined(FORMULATION_RHOTHETA_P)
 			double dPressureGradientForce =
-				m_dDiffPREdge[k] / m_dStateREdge[RIx][k];
+				ws.m_dDiffPREdge[k] / ws.m_dStateREdge[RIx][k];
 #endif
 #ifdef FORMULATION_RHOTHETA_PI
 			double dPressureGradientForce =
-				  m_dDiffPREdge[k]
-				* m_dStateREdge[PIx][k]
-				/ m_dStateREdge[RIx][k];
+				  ws.m_dDiffPREdge[k]
+				* ws.m_dStateREdge[PIx][k]
+				/ ws.m_dStateREdge[RIx][k];
 #endif
 #if defined(FORMULATION_THETA) || defined(FORMULATION_THETA_FLUX)
 			double dPressureGradientForce =
-				  m_dDiffPREdge[k]
-				* m_dStateREdge[PIx][k];
+				  ws.m_dDiffPREdge[k]
+				* ws.m_dStateREdge[PIx][k];
 #endif
 
 			dF[VecFIx(FWIx, k)] =
-				dPressureGradientForce / m_dColumnDerivRREdge[k][2];
+				dPressureGradientForce / ws.m_dColumnDerivRREdge[k][2];
 
 			dF[VecFIx(FWIx, k)] +=
 				phys.GetG();
@@ -2993,31 +3856,31 @@ void VerticalDynamicsFEM::BuildF(
 #if !defined(EXPLICIT_VERTICAL_VELOCITY_ADVECTION)
 #if defined(VERTICAL_VELOCITY_ADVECTION_CLARK)
 			// Vertical advection of vertical velocity
-			double dCovUa = m_dStateREdge[UIx][k];
-			double dCovUb = m_dStateREdge[VIx][k];
-			double dCovUx = m_dStateREdge[WIx][k] * m_dColumnDerivRREdge[k][2];
+			double dCovUa = ws.m_dStateREdge[UIx][k];
+			double dCovUb = ws.m_dStateREdge[VIx][k];
+			double dCovUx = ws.m_dStateREdge[WIx][k] * ws.m_dColumnDerivRREdge[k][2];
 
 			double dConUa =
-				  m_dColumnContraMetricAREdge[k][0] * dCovUa
-				+ m_dColumnContraMetricAREdge[k][1] * dCovUb
-				+ m_dColumnContraMetricAREdge[k][2] * dCovUx;
+				  ws.m_dColumnContraMetricAREdge[k][0] * dCovUa
+				+ ws.m_dColumnContraMetricAREdge[k][1] * dCovUb
+				+ ws.m_dColumnContraMetricAREdge[k][2] * dCovUx;
 
 			double dConUb =
-				  m_dColumnContraMetricBREdge[k][0] * dCovUa
-				+ m_dColumnContraMetricBREdge[k][1] * dCovUb
-				+ m_dColumnContraMetricBREdge[k][2] * dCovUx;
+				  ws.m_dColumnContraMetricBREdge[k][0] * dCovUa
+				+ ws.m_dColumnContraMetricBREdge[k][1] * dCovUb
+				+ ws.m_dColumnContraMetricBREdge[k][2] * dCovUx;
 
 			double dCurlTerm =
-				- dConUa * m_dDiffUa[k]
-				- dConUb * m_dDiffUb[k];
+				- dConUa * ws.m_dDiffUa[k]
+				- dConUb * ws.m_dDiffUb[k];
 
 			dF[VecFIx(FWIx, k)] +=
-				(m_dDiffKineticEnergyREdge[k] + dCurlTerm)
-					/ m_dColumnDerivRREdge[k][2];
+				(ws.m_dDiffKineticEnergyREdge[k] + dCurlTerm)
+					/ ws.m_dColumnDerivRREdge[k][2];
 
 #else // VERTICAL VELOCITY ADVECTION (ADVECTIVE FORM)
 			dF[VecFIx(FWIx, k)] +=
-				m_dXiDotREdge[k] * m_dDiffWREdge[k];
+				ws.m_dXiDotREdge[k] * ws.m_dDiffWREdge[k];
 
 #endif
 #endif
@@ -3037,8 +3900,8 @@ void VerticalDynamicsFEM::BuildF(
 
 		// Do not diffusion vertical velocity on boundaries
 		if (c == WIx) {
-			m_dDiffDiffStateUniform[c][0] = 0.0;
-			m_dDiffDiffStateUniform[c][nRElements] = 0.0;
+			ws.m_dDiffDiffStateUniform[c][0] = 0.0;
+			ws.m_dDiffDiffStateUniform[c][nRElements] = 0.0;
 		}
 
 		// Uniform diffusion coefficient
@@ -3057,7 +3920,7 @@ void VerticalDynamicsFEM::BuildF(
 			for (int k = 0; k <= nRElements; k++) {
 				dF[VecFIx(FIxFromCIx(c), k)] -=
 					dUniformDiffusionCoeff
-					* m_dDiffDiffStateUniform[c][k];
+					* ws.m_dDiffDiffStateUniform[c][k];
 			}
 
 		// Uniform diffusion on levels
@@ -3065,7 +3928,7 @@ void VerticalDynamicsFEM::BuildF(
 			for (int k = 0; k < nRElements; k++) {
 				dF[VecFIx(FIxFromCIx(c), k)] -=
 					dUniformDiffusionCoeff
-					* m_dDiffDiffStateUniform[c][k];
+					* ws.m_dDiffDiffStateUniform[c][k];
 			}
 		}
 	}
@@ -3091,7 +3954,7 @@ void VerticalDynamicsFEM::BuildF(
 		// Calculate weights
 		for (int a = 0; a < nFiniteElements - 1; a++) {
 			int k = (a+1) * nNodesPerFiniteElement;
-			m_dUpwindWeights[a] = fabs(m_dXiDotREdge[k]);
+			ws.m_dUpwindWeights[a] = fabs(ws.m_dXiDotREdge[k]);
 		}
 
 		// Loop through all variables
@@ -3126,29 +3989,29 @@ void VerticalDynamicsFEM::BuildF(
 
 				// No upwinding on W on domain boundaries
 				if (c == WIx) {
-					m_dDiffDiffStateUpwind[c][0] = 0.0;
-					m_dDiffDiffStateUpwind[c][nRElements] = 0.0;
+					ws.m_dDiffDiffStateUpwind[c][0] = 0.0;
+					ws.m_dDiffDiffStateUpwind[c][nRElements] = 0.0;
 				}
 
 				for (int k = 0; k <= nRElements; k++) {
 					dF[VecFIx(FIxFromCIx(c), k)] -=
 						m_dUpwindCoeff
-						* fabs(m_dXiDotREdge[k])
-						* m_dDiffDiffStateUpwind[c][k];
+						* fabs(ws.m_dXiDotREdge[k])
+						* ws.m_dDiffDiffStateUpwind[c][k];
 				}
 
 			// Upwinding on levels (discontinuous penalization)
 			} else {
-				m_dStateAux.Zero();
+				ws.m_dStateAux.Zero();
 				opPenalty.Apply(
-					&(m_dUpwindWeights[0]),
-					&(m_dStateNode[c][0]),
-					&(m_dStateAux[0]),
+					&(ws.m_dUpwindWeights[0]),
+					&(ws.m_dStateNode[c][0]),
+					&(ws.m_dStateAux[0]),
 					1,
 					1);
 
 				for (int k = 0; k < nRElements; k++) {
-					dF[VecFIx(FIxFromCIx(c), k)] -= m_dStateAux[k];
+					dF[VecFIx(FIxFromCIx(c), k)] -= ws.m_dStateAux[k];
 				}
 			}
 		}
@@ -3169,8 +4032,8 @@ void VerticalDynamicsFEM::BuildF(
 				for (int k = 0; k <= nRElements; k++) {
 					dF[VecFIx(FIxFromCIx(c), k)] -=
 						m_dHypervisCoeff
-						* fabs(m_dXiDotREdge[k])
-						* m_dDiffDiffStateHypervis[c][k];
+						* fabs(ws.m_dXiDotREdge[k])
+						* ws.m_dDiffDiffStateHypervis[c][k];
 				}
 
 			// Flow-dependent hyperviscosity on levels
@@ -3179,8 +4042,8 @@ void VerticalDynamicsFEM::BuildF(
 				for (int k = 0; k < nRElements; k++) {
 					dF[VecFIx(FIxFromCIx(c), k)] -=
 						m_dHypervisCoeff
-						* fabs(m_dXiDotNode[k])
-						* m_dDiffDiffStateHypervis[c][k];
+						* fabs(ws.m_dXiDotNode[k])
+						* ws.m_dDiffDiffStateHypervis[c][k];
 				}
 			}
 		}
@@ -3217,13 +4080,14 @@ void VerticalDynamicsFEM::BuildF(
 	// Construct the time-dependent component of the RHS
 	double dInvDeltaT = 1.0 / m_dDeltaT;
 	for (int i = 0; i < m_nColumnStateSize; i++) {
-		dF[i] += (dX[i] - m_dColumnState[i]) * dInvDeltaT;
+		dF[i] += (dX[i] - ws.m_dColumnState[i]) * dInvDeltaT;
 	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 void VerticalDynamicsFEM::BuildJacobianF_Diffusion(
+	ColumnWorkspace & ws,
 	const double * dX,
 	double * dDG
 ) {
@@ -3330,9 +4194,9 @@ void VerticalDynamicsFEM::BuildJacobianF_Diffusion(
 			// dC_k/dW_k
 			for (int k = 0; k <= nRElements; k++) {
 				double dSignWeight;
-				if (m_dXiDotREdge[k] > 0.0) {
+				if (ws.m_dXiDotREdge[k] > 0.0) {
 					dSignWeight = 1.0;
-				} else if (m_dXiDotREdge[k] < 0.0) {
+				} else if (ws.m_dXiDotREdge[k] < 0.0) {
 					dSignWeight = -1.0;
 				} else {
 					dSignWeight = 0.0;
@@ -3341,8 +4205,8 @@ void VerticalDynamicsFEM::BuildJacobianF_Diffusion(
 				dDG[MatFIx(FWIx, k, FIxFromCIx(c), k)] -=
 					m_dUpwindCoeff
 					* dSignWeight
-					/ m_dColumnDerivRREdge[k][2]
-					* m_dDiffDiffStateUpwind[c][k];
+					/ ws.m_dColumnDerivRREdge[k][2]
+					* ws.m_dDiffDiffStateUpwind[c][k];
 			}
 
 			// dC_k/dC_n
@@ -3351,7 +4215,7 @@ void VerticalDynamicsFEM::BuildJacobianF_Diffusion(
 				for (; n < iDiffDiffREdgeToREdgeEnd[k]; n++) {
 					dDG[MatFIx(FIxFromCIx(c), n, FIxFromCIx(c), k)] -=
 						m_dUpwindCoeff
-						* fabs(m_dXiDotREdge[k])
+						* fabs(ws.m_dXiDotREdge[k])
 						* dDiffDiffREdgeToREdge[k][n];
 				}
 			}
@@ -3361,12 +4225,12 @@ void VerticalDynamicsFEM::BuildJacobianF_Diffusion(
 
 			for (int a = 1; a < nFiniteElements; a++) {
 				double dWeight =
-					fabs(m_dXiDotREdge[a * nNodesPerFiniteElement]);
+					fabs(ws.m_dXiDotREdge[a * nNodesPerFiniteElement]);
 
 				double dSignWeight;
-				if (m_dXiDotREdge[a * nNodesPerFiniteElement] > 0.0) {
+				if (ws.m_dXiDotREdge[a * nNodesPerFiniteElement] > 0.0) {
 					dSignWeight = 1.0;
-				} else if (m_dXiDotREdge[a * nNodesPerFiniteElement] < 0.0) {
+				} else if (ws.m_dXiDotREdge[a * nNodesPerFiniteElement] < 0.0) {
 					dSignWeight = -1.0;
 				} else {
 					dSignWeight = 0.0;
@@ -3384,9 +4248,9 @@ void VerticalDynamicsFEM::BuildJacobianF_Diffusion(
 					for (; n < iPenaltyLeftEnd[k]; n++) {
 						dDG[MatFIx(FWIx, kLeftEnd, FIxFromCIx(c), k)] -=
 							dSignWeight
-							/ m_dColumnDerivRREdge[kLeftEnd][2]
+							/ ws.m_dColumnDerivRREdge[kLeftEnd][2]
 							* dPenaltyLeft[k][n]
-							* m_dStateNode[c][n];
+							* ws.m_dStateNode[c][n];
 					}
 				}
 
@@ -3396,9 +4260,9 @@ void VerticalDynamicsFEM::BuildJacobianF_Diffusion(
 					for (; n < iPenaltyRightEnd[k]; n++) {
 						dDG[MatFIx(FWIx, kRightBegin, FIxFromCIx(c), k)] -=
 							dSignWeight
-							/ m_dColumnDerivRREdge[kRightBegin][2]
+							/ ws.m_dColumnDerivRREdge[kRightBegin][2]
 							* dPenaltyRight[k][n]
-							* m_dStateNode[c][n];
+							* ws.m_dStateNode[c][n];
 					}
 				}
 
@@ -3427,6 +4291,7 @@ void VerticalDynamicsFEM::BuildJacobianF_Diffusion(
 ///////////////////////////////////////////////////////////////////////////////
 
 void VerticalDynamicsFEM::BuildJacobianF_LOR_RhoTheta_Pi(
+	ColumnWorkspace & ws,
 	const double * dX,
 	double * dDG
 ) {
@@ -3532,18 +4397,18 @@ void VerticalDynamicsFEM::BuildJacobianF_LOR_RhoTheta_Pi(
 			if ((m != 0) && (m != nRElements)) {
 				double dMassFluxCoeff =
 					dDiffREdgeToNode[k][m]
-					* m_dColumnJacobianREdge[m]
-					* m_dColumnInvJacobianNode[k]
-					* m_dColumnContraMetricXiREdge[m][2]
-					* m_dColumnDerivRREdge[m][2];
+					* ws.m_dColumnJacobianREdge[m]
+					* ws.m_dColumnInvJacobianNode[k]
+					* ws.m_dColumnContraMetricXiREdge[m][2]
+					* ws.m_dColumnDerivRREdge[m][2];
 
 				// dP_k/dW_l
 				dDG[MatFIx(FWIx, m, FPIx, k)] +=
-					dMassFluxCoeff * m_dStateREdge[PIx][m];
+					dMassFluxCoeff * ws.m_dStateREdge[PIx][m];
 
 				// dR_k/dW_l
 				dDG[MatFIx(FWIx, m, FRIx, k)] +=
-					dMassFluxCoeff * m_dStateREdge[RIx][m];
+					dMassFluxCoeff * ws.m_dStateREdge[RIx][m];
 			}
 
 			// dR_k/dR_n
@@ -3552,10 +4417,10 @@ void VerticalDynamicsFEM::BuildJacobianF_LOR_RhoTheta_Pi(
 
 				double dCoeffVerticalFlux = 
 					dDiffREdgeToNode[k][m]
-					* m_dColumnJacobianREdge[m]
-					* m_dColumnInvJacobianNode[k]
+					* ws.m_dColumnJacobianREdge[m]
+					* ws.m_dColumnInvJacobianNode[k]
 					* dInterpNodeToREdge[m][n]
-					* m_dXiDotREdge[m];
+					* ws.m_dXiDotREdge[m];
 
 				dDG[MatFIx(FRIx, n, FRIx, k)] += dCoeffVerticalFlux;
 
@@ -3569,10 +4434,10 @@ void VerticalDynamicsFEM::BuildJacobianF_LOR_RhoTheta_Pi(
 
 		// dW_k/dP_m (in pressure gradient)
 		double dRHSWCoeffA = 
-			m_dStateREdge[PIx][k]
+			ws.m_dStateREdge[PIx][k]
 			* phys.GetR()
-			/ (m_dColumnDerivRNode[k][2]
-				* m_dStateREdge[RIx][k]
+			/ (ws.m_dColumnDerivRNode[k][2]
+				* ws.m_dStateREdge[RIx][k]
 				* phys.GetCv());
 
 		int m = iDiffNodeToREdgeBegin[k];
@@ -3580,15 +4445,15 @@ void VerticalDynamicsFEM::BuildJacobianF_LOR_RhoTheta_Pi(
 			dDG[MatFIx(FPIx, m, FWIx, k)] +=
 				dRHSWCoeffA 
 				* dDiffNodeToREdge[k][m]
-				* m_dExnerNode[m]
-				/ m_dStateNode[PIx][m];
+				* ws.m_dExnerNode[m]
+				/ ws.m_dStateNode[PIx][m];
 		}
 
 		// Rhotheta/rho term in front of pressure gradient
 		double dRHSWCoeffB = 
-			1.0 / m_dColumnDerivRREdge[k][2]
-			/ (m_dStateREdge[RIx][k] * m_dStateREdge[RIx][k])
-			* m_dDiffPREdge[k];
+			1.0 / ws.m_dColumnDerivRREdge[k][2]
+			/ (ws.m_dStateREdge[RIx][k] * ws.m_dStateREdge[RIx][k])
+			* ws.m_dDiffPREdge[k];
 
 		int n = iInterpNodeToREdgeBegin[k];
 		for (; n < iInterpNodeToREdgeEnd[k]; n++) {
@@ -3597,11 +4462,11 @@ void VerticalDynamicsFEM::BuildJacobianF_LOR_RhoTheta_Pi(
 
 			// dW_k/dP_n (first rhotheta in RHS)
 			dDG[MatFIx(FPIx, n, FWIx, k)] +=
-				dRHSWCoeffC * m_dStateREdge[RIx][k];
+				dRHSWCoeffC * ws.m_dStateREdge[RIx][k];
 
 			// dW_k/dR_l (first rho in RHS)
 			dDG[MatFIx(FRIx, n, FWIx, k)] +=
-				- dRHSWCoeffC * m_dStateREdge[PIx][k];
+				- dRHSWCoeffC * ws.m_dStateREdge[PIx][k];
 		}
 	}
 
@@ -3618,16 +4483,16 @@ void VerticalDynamicsFEM::BuildJacobianF_LOR_RhoTheta_Pi(
 				dDG[MatFIx(FWIx, m, FWIx, k)] +=
 					dInterpREdgeToNode[l][m]
 					* dDiffNodeToREdge[k][l]
-					/ m_dColumnDerivRREdge[k][2]
-					* m_dColumnDerivRNode[l][2]
-					* m_dXiDotNode[l];
+					/ ws.m_dColumnDerivRREdge[k][2]
+					* ws.m_dColumnDerivRNode[l][2]
+					* ws.m_dXiDotNode[l];
 			}
 		}
 	}
 #endif
 
 	// Add the diffusion terms
-	BuildJacobianF_Diffusion(dX, dDG);
+	BuildJacobianF_Diffusion(ws, dX, dDG);
 
 	// Add the identity components
 	for (int k = 0; k <= nRElements; k++) {
@@ -3641,17 +4506,18 @@ void VerticalDynamicsFEM::BuildJacobianF_LOR_RhoTheta_Pi(
 	    Grid::VerticalStaggering_Interfaces
 	) {
 		dDG[MatFIx(FWIx, 0, FWIx, 0)] =
-			m_dColumnDerivRNode[0][2]
-			* m_dColumnContraMetricXi[0][2];
+			ws.m_dColumnDerivRNode[0][2]
+			* ws.m_dColumnContraMetricXi[0][2];
 		dDG[MatFIx(FWIx, nRElements-1, FWIx, nRElements-1)] =
-			m_dColumnDerivRNode[nRElements-1][2]
-			* m_dColumnContraMetricXi[nRElements-1][2];
+			ws.m_dColumnDerivRNode[nRElements-1][2]
+			* ws.m_dColumnContraMetricXi[nRElements-1][2];
 	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 void VerticalDynamicsFEM::BuildJacobianF(
+	ColumnWorkspace & ws,
 	const double * dX,
 	double * dDG
 ) {
@@ -3669,7 +4535,7 @@ void VerticalDynamicsFEM::BuildJacobianF(
 #if defined(FORMULATION_RHOTHETA_PI)
 #if !defined(EXPLICIT_THERMO)
 	if (pGrid->GetVarLocation(PIx) == DataLocation_Node) {
-		BuildJacobianF_LOR_RhoTheta_Pi(dX, dDG);
+		BuildJacobianF_LOR_RhoTheta_Pi(ws, dX, dDG);
 		return;
 	}
 #endif
@@ -3776,15 +4642,15 @@ void VerticalDynamicsFEM::BuildJacobianF(
 				// Pressure flux
 				dDG[MatFIx(FPIx, n, FPIx, k)] +=
 					phys.GetGamma()
-					* m_dColumnJacobianNode[n]
-					* m_dColumnInvJacobianNode[k]
+					* ws.m_dColumnJacobianNode[n]
+					* ws.m_dColumnInvJacobianNode[k]
 					* dDiffNodeToNode[k][n]
-					* m_dXiDotNode[n];
+					* ws.m_dXiDotNode[n];
 
 				// Correction terms
 				dDG[MatFIx(FPIx, n, FPIx, k)] +=
 					- (phys.GetGamma() - 1.0)
-					* m_dXiDotNode[k]
+					* ws.m_dXiDotNode[k]
 					* dDiffNodeToNode[k][n];
 			}
 		}
@@ -3805,12 +4671,12 @@ void VerticalDynamicsFEM::BuildJacobianF(
 				// Pressure flux
 				dDG[MatFIx(FWIx, n, FPIx, k)] +=
 					dDiffNodeToNode[k][n]
-					* m_dColumnInvJacobianNode[k]
-					* m_dColumnJacobianNode[n]
+					* ws.m_dColumnInvJacobianNode[k]
+					* ws.m_dColumnJacobianNode[n]
 					* phys.GetGamma()
-					* m_dStateNode[PIx][n]
-					* m_dColumnContraMetricXi[n][2]
-					* m_dColumnDerivRNode[n][2];
+					* ws.m_dStateNode[PIx][n]
+					* ws.m_dColumnContraMetricXi[n][2]
+					* ws.m_dColumnDerivRNode[n][2];
 			}
 
 			// Correction terms
@@ -3824,9 +4690,9 @@ void VerticalDynamicsFEM::BuildJacobianF(
 
 			dDG[MatFIx(FWIx, k, FPIx, k)] +=
 				- (phys.GetGamma() - 1.0)
-				* m_dColumnContraMetricXi[k][2]
-				* m_dColumnDerivRNode[k][2]
-				* m_dDiffPNode[k];
+				* ws.m_dColumnContraMetricXi[k][2]
+				* ws.m_dColumnDerivRNode[k][2]
+				* ws.m_dDiffPNode[k];
 		}
 #endif
 
@@ -3848,14 +4714,14 @@ void VerticalDynamicsFEM::BuildJacobianF(
 			for (; n < iDiffNodeToNodeEnd[k]; n++) {
 				dDG[MatFIx(FPIx, n, FWIx, k)] +=
 					dDiffNodeToNode[k][n]
-					/ m_dStateNode[RIx][k]
-					/ m_dColumnDerivRNode[k][2];
+					/ ws.m_dStateNode[RIx][k]
+					/ ws.m_dColumnDerivRNode[k][2];
 			}
 
 			dDG[MatFIx(FRIx, k, FWIx, k)] +=
-				- m_dDiffPNode[k]
-				/ m_dColumnDerivRNode[k][2]
-				/ (m_dStateNode[RIx][k] * m_dStateNode[RIx][k]);
+				- ws.m_dDiffPNode[k]
+				/ ws.m_dColumnDerivRNode[k][2]
+				/ (ws.m_dStateNode[RIx][k] * ws.m_dStateNode[RIx][k]);
 		}
 	}
 
@@ -3880,15 +4746,15 @@ void VerticalDynamicsFEM::BuildJacobianF(
 
 			double dFluxCoeff = 
 				dDiffREdgeToNode[k][m]
-				* m_dColumnJacobianREdge[m]
-				* m_dColumnInvJacobianNode[k];
+				* ws.m_dColumnJacobianREdge[m]
+				* ws.m_dColumnInvJacobianNode[k];
 
 			if ((m != 0) && (m != nRElements)) {
 				dDG[MatFIx(FWIx, m, FPIx, k)] +=
 					dFluxCoeff
-					* m_dStateREdge[PIx][m]
-					* m_dColumnContraMetricXiREdge[m][2]
-					* m_dColumnDerivRREdge[m][2];
+					* ws.m_dStateREdge[PIx][m]
+					* ws.m_dColumnContraMetricXiREdge[m][2]
+					* ws.m_dColumnDerivRREdge[m][2];
 			}
 
 			int n = iInterpNodeToREdgeBegin[m];
@@ -3897,7 +4763,7 @@ void VerticalDynamicsFEM::BuildJacobianF(
 				dDG[MatFIx(FPIx, n, FPIx, k)] +=
 					dFluxCoeff
 					* dInterpNodeToREdge[m][n]
-					* m_dXiDotREdge[m];
+					* ws.m_dXiDotREdge[m];
 			}
 		}
 	}
@@ -3906,9 +4772,9 @@ void VerticalDynamicsFEM::BuildJacobianF(
 	for (int k = 1; k < nRElements; k++) {
 
 		double dRHSWCoeff = 
-			1.0 / m_dColumnDerivRNode[k][2]
-			* m_dStateREdge[PIx][k]
-			/ m_dStateREdge[RIx][k]
+			1.0 / ws.m_dColumnDerivRNode[k][2]
+			* ws.m_dStateREdge[PIx][k]
+			/ ws.m_dStateREdge[RIx][k]
 			* phys.GetR()
 			/ phys.GetCv();
 
@@ -3917,8 +4783,8 @@ void VerticalDynamicsFEM::BuildJacobianF(
 			dDG[MatFIx(FPIx, m, FWIx, k)] +=
 				dRHSWCoeff 
 				* dDiffNodeToREdge[k][m]
-				* m_dExnerNode[m]
-				/ m_dStateNode[PIx][m];
+				* ws.m_dExnerNode[m]
+				/ ws.m_dStateNode[PIx][m];
 		}
 	}
 
@@ -3927,11 +4793,11 @@ void VerticalDynamicsFEM::BuildJacobianF(
 		int l = iInterpNodeToREdgeBegin[k];
 		for (; l < iInterpNodeToREdgeEnd[k]; l++) {
 			dDG[MatFIx(FRIx, l, FWIx, k)] +=
-				 - 1.0 / m_dColumnDerivRREdge[k][2]
+				 - 1.0 / ws.m_dColumnDerivRREdge[k][2]
 				 * dInterpNodeToREdge[k][l]
-				 * m_dStateREdge[PIx][k]
-				 / (m_dStateREdge[RIx][k] * m_dStateREdge[RIx][k])
-				 * m_dDiffPREdge[k];
+				 * ws.m_dStateREdge[PIx][k]
+				 / (ws.m_dStateREdge[RIx][k] * ws.m_dStateREdge[RIx][k])
+				 * ws.m_dDiffPREdge[k];
 		}
 	}
 
@@ -3940,10 +4806,10 @@ void VerticalDynamicsFEM::BuildJacobianF(
 		int l = iInterpNodeToREdgeBegin[k];
 		for (; l < iInterpNodeToREdgeEnd[k]; l++) {
 			dDG[MatFIx(FPIx, l, FWIx, k)] +=
-				 1.0 / m_dColumnDerivRREdge[k][2]
+				 1.0 / ws.m_dColumnDerivRREdge[k][2]
 				 * dInterpNodeToREdge[k][l]
-				 / m_dStateREdge[RIx][k]
-				 * m_dDiffPREdge[k];
+				 / ws.m_dStateREdge[RIx][k]
+				 * ws.m_dDiffPREdge[k];
 		}
 	}
 
@@ -3968,17 +4834,17 @@ void VerticalDynamicsFEM::BuildJacobianF(
 			int l = iInterpREdgeToNodeBegin[k];
 			for (; l < iInterpREdgeToNodeEnd[k]; l++) {
 				dDG[MatFIx(FWIx, l, FPIx, k)] +=
-					m_dDiffThetaNode[k]
+					ws.m_dDiffThetaNode[k]
 					* dInterpREdgeToNode[k][l]
-					* m_dColumnContraMetricXi[k][2]
-					* m_dColumnDerivRNode[k][2];
+					* ws.m_dColumnContraMetricXi[k][2]
+					* ws.m_dColumnDerivRNode[k][2];
 			}
 		}
 
 		// Test using u^xi on interfaces interpolated to nodes for Lorenz
 		pGrid->InterpolateREdgeToNode(
-				m_dXiDotREdge,
-				m_dXiDotNode);
+				ws.m_dXiDotREdge,
+				ws.m_dXiDotNode);
 
 		// dT_k/dT_l
 		for (int k = 0; k < nRElements; k++) {
@@ -3986,7 +4852,7 @@ void VerticalDynamicsFEM::BuildJacobianF(
 			for (; l < iDiffNodeToNodeEnd[k]; l++) {
 				dDG[MatFIx(FPIx, l, FPIx, k)] +=
 					dDiffNodeToNode[k][l]
-					* m_dXiDotNode[k];
+					* ws.m_dXiDotNode[k];
 			}
 		}
 #endif
@@ -3995,8 +4861,8 @@ void VerticalDynamicsFEM::BuildJacobianF(
 		for (int k = 1; k < nRElements; k++) {
 
 			double dRHSWCoeff = 
-				1.0 / m_dColumnDerivRNode[k][2]
-				* m_dStateREdge[PIx][k]
+				1.0 / ws.m_dColumnDerivRNode[k][2]
+				* ws.m_dStateREdge[PIx][k]
 				* phys.GetR()
 				/ phys.GetCv();
 
@@ -4006,14 +4872,14 @@ void VerticalDynamicsFEM::BuildJacobianF(
 				dDG[MatFIx(FPIx, m, FWIx, k)] +=
 					dRHSWCoeff 
 					* dDiffNodeToREdge[k][m]
-					* m_dExnerNode[m]
-					/ m_dStateNode[PIx][m];
+					* ws.m_dExnerNode[m]
+					/ ws.m_dStateNode[PIx][m];
 
 				dDG[MatFIx(FRIx, m, FWIx, k)] +=
 					dRHSWCoeff
 					* dDiffNodeToREdge[k][m]
-					* m_dExnerNode[m]
-					/ m_dStateNode[RIx][m];
+					* ws.m_dExnerNode[m]
+					/ ws.m_dStateNode[RIx][m];
 			}
 		}
 
@@ -4022,9 +4888,9 @@ void VerticalDynamicsFEM::BuildJacobianF(
 			int l = iInterpNodeToREdgeBegin[k];
 			for (; l < iInterpNodeToREdgeEnd[k]; l++) {
 				dDG[MatFIx(FPIx, l, FWIx, k)] +=
-					 1.0 / m_dColumnDerivRREdge[k][2]
+					 1.0 / ws.m_dColumnDerivRREdge[k][2]
 					 * dInterpNodeToREdge[k][l]
-					 * m_dDiffPREdge[k];
+					 * ws.m_dDiffPREdge[k];
 			}
 		}
 
@@ -4038,9 +4904,9 @@ void VerticalDynamicsFEM::BuildJacobianF(
 		// dT_k/dW_k
 		for (int k = 1; k < nRElements; k++) {
 			dDG[MatFIx(FWIx, k, FPIx, k)] +=
-				m_dDiffThetaREdge[k]
-				* m_dColumnContraMetricXiREdge[k][2]
-				* m_dColumnDerivRREdge[k][2];
+				ws.m_dDiffThetaREdge[k]
+				* ws.m_dColumnContraMetricXiREdge[k][2]
+				* ws.m_dColumnDerivRREdge[k][2];
 		}
 
 		// dT_k/dT_l
@@ -4049,7 +4915,7 @@ void VerticalDynamicsFEM::BuildJacobianF(
 			for (; l < iDiffREdgeToREdgeEnd[k]; l++) {
 				dDG[MatFIx(FPIx, l, FPIx, k)] +=
 					dDiffREdgeToREdge[k][l]
-					* m_dXiDotREdge[k];
+					* ws.m_dXiDotREdge[k];
 			}
 		}
 #endif
@@ -4058,8 +4924,8 @@ void VerticalDynamicsFEM::BuildJacobianF(
 		for (int k = 1; k < nRElements; k++) {
 
 			double dRHSWCoeff = 
-				1.0 / m_dColumnDerivRNode[k][2]
-				* m_dStateREdge[PIx][k]
+				1.0 / ws.m_dColumnDerivRNode[k][2]
+				* ws.m_dStateREdge[PIx][k]
 				* phys.GetR()
 				/ phys.GetCv();
 
@@ -4069,8 +4935,8 @@ void VerticalDynamicsFEM::BuildJacobianF(
 				double dTEntry =
 					dRHSWCoeff 
 					* dDiffNodeToREdge[k][m]
-					* m_dExnerNode[m]
-					/ m_dStateNode[PIx][m];
+					* ws.m_dExnerNode[m]
+					/ ws.m_dStateNode[PIx][m];
 
 				int l = iInterpREdgeToNodeBegin[m];
 				for (; l < iInterpREdgeToNodeEnd[m]; l++) {
@@ -4081,16 +4947,16 @@ void VerticalDynamicsFEM::BuildJacobianF(
 				dDG[MatFIx(FRIx, m, FWIx, k)] +=
 					dRHSWCoeff
 					* dDiffNodeToREdge[k][m]
-					* m_dExnerNode[m]
-					/ m_dStateNode[RIx][m];
+					* ws.m_dExnerNode[m]
+					/ ws.m_dStateNode[RIx][m];
 			}
 		}
 
 		// dW_k/dT_k (first theta in RHS)
 		for (int k = 1; k < nRElements; k++) {
 			dDG[MatFIx(FPIx, k, FWIx, k)] +=
-				 1.0 / m_dColumnDerivRREdge[k][2]
-				 * m_dDiffPREdge[k];
+				 1.0 / ws.m_dColumnDerivRREdge[k][2]
+				 * ws.m_dDiffPREdge[k];
 		}
 	}
 #endif
@@ -4105,15 +4971,15 @@ void VerticalDynamicsFEM::BuildJacobianF(
 
 				double dFluxCoeff = 
 					dDiffREdgeToNode[k][m]
-					* m_dColumnJacobianREdge[m]
-					* m_dColumnInvJacobianNode[k];
+					* ws.m_dColumnJacobianREdge[m]
+					* ws.m_dColumnInvJacobianNode[k];
 
 				if ((m != 0) && (m != nRElements)) {
 					dDG[MatFIx(FWIx, m, FRIx, k)] +=
 						dFluxCoeff
-						* m_dStateREdge[RIx][m]
-						* m_dColumnContraMetricXiREdge[m][2]
-						* m_dColumnDerivRREdge[m][2];
+						* ws.m_dStateREdge[RIx][m]
+						* ws.m_dColumnContraMetricXiREdge[m][2]
+						* ws.m_dColumnDerivRREdge[m][2];
 				}
 
 				int n = iInterpNodeToREdgeBegin[m];
@@ -4122,7 +4988,7 @@ void VerticalDynamicsFEM::BuildJacobianF(
 					dDG[MatFIx(FRIx, n, FRIx, k)] +=
 						dFluxCoeff
 						* dInterpNodeToREdge[m][n]
-						* m_dXiDotREdge[m];
+						* ws.m_dXiDotREdge[m];
 				}
 			}
 		}
@@ -4139,9 +5005,9 @@ void VerticalDynamicsFEM::BuildJacobianF(
 					dDG[MatFIx(FWIx, m, FWIx, k)] +=
 						dInterpREdgeToNode[l][m]
 						* dDiffNodeToREdge[k][l]
-						/ m_dColumnDerivRREdge[k][2]
-						* m_dColumnDerivRNode[l][2]
-						* m_dXiDotNode[l];
+						/ ws.m_dColumnDerivRREdge[k][2]
+						* ws.m_dColumnDerivRNode[l][2]
+						* ws.m_dXiDotNode[l];
 				}
 			}
 		}
@@ -4152,14 +5018,14 @@ void VerticalDynamicsFEM::BuildJacobianF(
 			int m = iDiffREdgeToREdgeBegin[k];
 			for (; m < iDiffREdgeToREdgeEnd[k]; m++) {
 				dDG[MatFIx(FWIx, m, FWIx, k)] +=
-					m_dXiDotREdge[k]
+					ws.m_dXiDotREdge[k]
 					* dDiffREdgeToREdge[k][m];
 			}
 
 			dDG[MatFIx(FWIx, k, FWIx, k)] +=
-				m_dDiffWREdge[k]
-				* m_dColumnContraMetricXiREdge[k][2]
-				* m_dColumnDerivRREdge[k][2];
+				ws.m_dDiffWREdge[k]
+				* ws.m_dColumnContraMetricXiREdge[k][2]
+				* ws.m_dColumnDerivRREdge[k][2];
 		}
 
 #endif
@@ -4176,9 +5042,9 @@ void VerticalDynamicsFEM::BuildJacobianF(
 				// dRho_k/dRho_n
 				dDG[MatFIx(FRIx, n, FRIx, k)] +=
 					dDiffNodeToNode[k][n]
-					* m_dColumnJacobianNode[n]
-					* m_dColumnInvJacobianNode[k]
-					* m_dXiDotNode[n];
+					* ws.m_dColumnJacobianNode[n]
+					* ws.m_dColumnInvJacobianNode[k]
+					* ws.m_dXiDotNode[n];
 
 				// Boundary conditions
 				if (pGrid->GetVerticalStaggering() ==
@@ -4192,11 +5058,11 @@ void VerticalDynamicsFEM::BuildJacobianF(
 				// dRho_k/dW_n
 				dDG[MatFIx(FWIx, n, FRIx, k)] +=
 					dDiffNodeToNode[k][n]
-					* m_dColumnJacobianNode[n]
-					* m_dColumnInvJacobianNode[k]
-					* m_dStateNode[RIx][n]
-					* m_dColumnDerivRNode[n][2]
-					* m_dColumnContraMetricXi[n][2];
+					* ws.m_dColumnJacobianNode[n]
+					* ws.m_dColumnInvJacobianNode[k]
+					* ws.m_dStateNode[RIx][n]
+					* ws.m_dColumnDerivRNode[n][2]
+					* ws.m_dColumnContraMetricXi[n][2];
 			}
 
 			// Boundary conditions
@@ -4215,9 +5081,9 @@ void VerticalDynamicsFEM::BuildJacobianF(
 			for (; n < iDiffNodeToNodeEnd[k]; n++) {
 				dDG[MatFIx(FWIx, n, FWIx, k)] +=
 					dDiffNodeToNode[k][n]
-					/ m_dColumnDerivRNode[k][2]
-					* m_dColumnDerivRNode[n][2]
-					* m_dXiDotNode[n];
+					/ ws.m_dColumnDerivRNode[k][2]
+					* ws.m_dColumnDerivRNode[n][2]
+					* ws.m_dXiDotNode[n];
 
 			}
 #else
@@ -4226,13 +5092,13 @@ void VerticalDynamicsFEM::BuildJacobianF(
 			int m = iDiffNodeToNodeBegin[k];
 			for (; m < iDiffNodeToNodeEnd[k]; m++) {
 				dDG[MatFIx(FWIx, m, FWIx, k)] +=
-					m_dXiDotNode[k]
+					ws.m_dXiDotNode[k]
 					* dDiffNodeToNode[k][m];
 			}
 
 			dDG[MatFIx(FWIx, k, FWIx, k)] +=
-				m_dDiffWNode[k]
-				* m_dColumnContraMetricXi[k][2];
+				ws.m_dDiffWNode[k]
+				* ws.m_dColumnContraMetricXi[k][2];
 		}
 #endif
 #endif
@@ -4241,7 +5107,7 @@ void VerticalDynamicsFEM::BuildJacobianF(
 	}
 
 	// Add the diffusion terms
-	BuildJacobianF_Diffusion(dX, dDG);
+	BuildJacobianF_Diffusion(ws, dX, dDG);
 
 	// Add the identity components
 	for (int k = 0; k <= nRElements; k++) {
@@ -4255,11 +5121,11 @@ void VerticalDynamicsFEM::BuildJacobianF(
 	    Grid::VerticalStaggering_Interfaces
 	) {
 		dDG[MatFIx(FWIx, 0, FWIx, 0)] =
-			m_dColumnDerivRNode[0][2]
-			* m_dColumnContraMetricXi[0][2];
+			ws.m_dColumnDerivRNode[0][2]
+			* ws.m_dColumnContraMetricXi[0][2];
 		dDG[MatFIx(FWIx, nRElements-1, FWIx, nRElements-1)] =
-			m_dColumnDerivRNode[nRElements-1][2]
-			* m_dColumnContraMetricXi[nRElements-1][2];
+			ws.m_dColumnDerivRNode[nRElements-1][2]
+			* ws.m_dColumnContraMetricXi[nRElements-1][2];
 	}
 
 }
@@ -4269,25 +5135,37 @@ void VerticalDynamicsFEM::BuildJacobianF(
 void VerticalDynamicsFEM::Evaluate(
 	const double * dX,
 	double * dF
+) {
+	// Solvers using this interface operate on a single column at a time
+	Evaluate(m_vecColumnWorkspace[0], dX, dF);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::Evaluate(
+	ColumnWorkspace & ws,
+	const double * dX,
+	double * dF
 ) {
 	// Prepare the column
-	PrepareColumn(dX);
+	PrepareColumn(ws, dX);
 
 	// Evaluate the zero equations
-	BuildF(dX, dF);
+	BuildF(ws, dX, dF);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 void VerticalDynamicsFEM::UpdateColumnTracers(
+	ColumnWorkspace & ws,
 	double dDeltaT,
 	const DataArray4D<double> & dataInitialNode,
 	const DataArray4D<double> & dataUpdateNode,
 	const DataArray4D<double> & dataInitialREdge,
 	const DataArray4D<double> & dataUpdateREdge,
-	const DataArray4D<double> & dataRefTracer,
-	const DataArray4D<double> & dataInitialTracer,
-	DataArray4D<double> & dataUpdateTracer
+	const TracerArray4D & dataRefTracer,
+	const TracerArray4D & dataInitialTracer,
+	TracerArray4D & dataUpdateTracer
 ) {
 	// Indices of EquationSet variables
 	const int UIx = 0;
@@ -4375,20 +5253,20 @@ void VerticalDynamicsFEM::UpdateColumnTracers(
 		opPenaltyRight.GetIxEnd();
 
 	// Metric quantities
-	const DataArray4D<double> & dContraMetricXi =
-		m_pPatch->GetContraMetricXi();
-	const DataArray4D<double> & dContraMetricXiREdge =
-		m_pPatch->GetContraMetricXiREdge();
+	const MetricArray4D & dContraMetricXi =
+		ws.m_pPatch->GetContraMetricXi();
+	const MetricArray4D & dContraMetricXiREdge =
+		ws.m_pPatch->GetContraMetricXiREdge();
 	const DataArray3D<double> & dElementArea =
-		m_pPatch->GetElementArea();
-	const DataArray3D<double> & dJacobianNode =
-		m_pPatch->GetJacobian();
-	const DataArray3D<double> & dJacobianREdge =
-		m_pPatch->GetJacobianREdge();
-	const DataArray4D<double> & dDerivRNode =
-		m_pPatch->GetDerivRNode();
-	const DataArray4D<double> & dDerivRREdge =
-		m_pPatch->GetDerivRREdge();
+		ws.m_pPatch->GetElementArea();
+	const MetricArray3D & dJacobianNode =
+		ws.m_pPatch->GetJacobian();
+	const MetricArray3D & dJacobianREdge =
+		ws.m_pPatch->GetJacobianREdge();
+	const MetricArray4D & dDerivRNode =
+		ws.m_pPatch->GetDerivRNode();
+	const MetricArray4D & dDerivRREdge =
+		ws.m_pPatch->GetDerivRREdge();
 
 	// Under this configuration, set fluxes at boundaries to zero
 	bool fZeroBoundaries =
@@ -4403,8 +5281,8 @@ void VerticalDynamicsFEM::UpdateColumnTracers(
 	}
 
 	// Zero the Jacobian
-	m_matTracersLUDF.Zero();
-	double * dTracersLUDF = &(m_matTracersLUDF[0][0]);
+	ws.m_matTracersLUDF.Zero();
+	double * dTracersLUDF = &(ws.m_matTracersLUDF[0][0]);
 
 	// Only compute off-diagonal terms of the Jacobian if implicit advection
 	// is being performed.
@@ -4418,45 +5296,45 @@ void VerticalDynamicsFEM::UpdateColumnTracers(
 		// Calculate u^xi on model interfaces and nodes
 		if (pGrid->GetVarLocation(WIx) == DataLocation_REdge) {
 			for (int k = 0; k <= nRElements; k++) {
-				m_dStateREdge[WIx][k] = m_dColumnState[VecFIx(FWIx, k)];
+				ws.m_dStateREdge[WIx][k] = ws.m_dColumnState[VecFIx(FWIx, k)];
 			}
 
 			pGrid->InterpolateREdgeToNode(
-				m_dStateREdge[WIx],
-				m_dStateNode[WIx]);
+				ws.m_dStateREdge[WIx],
+				ws.m_dStateNode[WIx]);
 
 		} else {
 			for (int k = 0; k < nRElements; k++) {
-				m_dStateNode[WIx][k] = m_dColumnState[VecFIx(FWIx, k)];
+				ws.m_dStateNode[WIx][k] = ws.m_dColumnState[VecFIx(FWIx, k)];
 			}
 
 			pGrid->InterpolateNodeToREdge(
-				m_dStateNode[WIx],
-				m_dStateREdge[WIx]);
+				ws.m_dStateNode[WIx],
+				ws.m_dStateREdge[WIx]);
 		}
 
 #pragma message "Replace with column arrays"
 		// Calculate u^xi on interfaces
 		for (int k = 1; k < nRElements; k++) {
 			double dCovUx =
-				m_dStateREdge[WIx][k] * dDerivRREdge[k][m_iA][m_iB][2];
-
-			m_dXiDotREdge[k] =
-				  dContraMetricXiREdge[k][m_iA][m_iB][0]
-					* m_dStateREdge[UIx][k]
-				+ dContraMetricXiREdge[k][m_iA][m_iB][1]
-					* m_dStateREdge[VIx][k]
-				+ dContraMetricXiREdge[k][m_iA][m_iB][2]
+				ws.m_dStateREdge[WIx][k] * dDerivRREdge[k][ws.m_iA][ws.m_iB][2];
+
+			ws.m_dXiDotREdge[k] =
+				  dContraMetricXiREdge[k][ws.m_iA][ws.m_iB][0]
+					* ws.m_dStateREdge[UIx][k]
+				+ dContraMetricXiREdge[k][ws.m_iA][ws.m_iB][1]
+					* ws.m_dStateREdge[VIx][k]
+				+ dContraMetricXiREdge[k][ws.m_iA][ws.m_iB][2]
 					* dCovUx;
 
-			m_dXiDotREdgeInitial[k] = m_dXiDotREdge[k];
+			ws.m_dXiDotREdgeInitial[k] = ws.m_dXiDotREdge[k];
 		}
 
-		m_dXiDotREdge[0] = 0.0;
-		m_dXiDotREdge[nRElements] = 0.0;
+		ws.m_dXiDotREdge[0] = 0.0;
+		ws.m_dXiDotREdge[nRElements] = 0.0;
 
-		m_dXiDotREdgeInitial[0] = 0.0;
-		m_dXiDotREdgeInitial[nRElements] = 0.0;
+		ws.m_dXiDotREdgeInitial[0] = 0.0;
+		ws.m_dXiDotREdgeInitial[nRElements] = 0.0;
 
 		// dRhoQ_k/dRhoQ_n
 		for (int k = 0; k < nRElements; k++) {
@@ -4469,10 +5347,10 @@ void VerticalDynamicsFEM::UpdateColumnTracers(
 
 					dTracersLUDF[TracerMatFIx(n, k)] +=
 						dDiffREdgeToNode[k][m]
-						* dJacobianREdge[m][m_iA][m_iB]
-						/ dJacobianNode[k][m_iA][m_iB]
+						* dJacobianREdge[m][ws.m_iA][ws.m_iB]
+						/ dJacobianNode[k][ws.m_iA][ws.m_iB]
 						* dInterpNodeToREdge[m][n]
-						* m_dXiDotREdge[m];
+						* ws.m_dXiDotREdge[m];
 				}
 			}
 		}
@@ -4487,12 +5365,12 @@ void VerticalDynamicsFEM::UpdateColumnTracers(
 				int kRightBegin = a * nNodesPerFiniteElement;
 				int kRightEnd = (a+1) * nNodesPerFiniteElement;
 
-				double dWeight = fabs(m_dXiDotREdge[kLeftEnd]);
+				double dWeight = fabs(ws.m_dXiDotREdge[kLeftEnd]);
 
 				double dSignWeight;
-				if (m_dXiDotREdge[kLeftEnd] > 0.0) {
+				if (ws.m_dXiDotREdge[kLeftEnd] > 0.0) {
 					dSignWeight = 1.0;
-				} else if (m_dXiDotREdge[kLeftEnd] < 0.0) {
+				} else if (ws.m_dXiDotREdge[kLeftEnd] < 0.0) {
 					dSignWeight = -1.0;
 				} else {
 					dSignWeight = 0.0;
@@ -4528,14 +5406,14 @@ void VerticalDynamicsFEM::UpdateColumnTracers(
 	// LU Decomposition
 	int iInfo =
 		LAPACK::DGETRF(
-			m_matTracersLUDF,
-			m_vecTracersIPiv);
+			ws.m_matTracersLUDF,
+			ws.m_vecTracersIPiv);
 #elif defined(USE_JACOBIAN_DIAGONAL)
 	// Banded diagonal LU decomposition
 	int iInfo =
 		LAPACK::DGBTRF(
-			m_matTracersLUDF,
-			m_vecTracersIPiv,
+			ws.m_matTracersLUDF,
+			ws.m_vecTracersIPiv,
 			2 * m_nVerticalOrder - 1,
 			2 * m_nVerticalOrder - 1);
 #else
@@ -4550,113 +5428,113 @@ void VerticalDynamicsFEM::UpdateColumnTracers(
 	if (m_fFullyExplicit) {
 		if (pGrid->GetVarLocation(WIx) == DataLocation_REdge) {
 			for (int k = 0; k <= nRElements; k++) {
-				m_dStateREdge[WIx][k] =
-					dataInitialREdge[WIx][k][m_iA][m_iB];
+				ws.m_dStateREdge[WIx][k] =
+					dataInitialREdge[WIx][k][ws.m_iA][ws.m_iB];
 			}
 
 		} else {
 			for (int k = 0; k < nRElements; k++) {
-				m_dStateNode[WIx][k] =
-					dataInitialNode[WIx][k][m_iA][m_iB];
+				ws.m_dStateNode[WIx][k] =
+					dataInitialNode[WIx][k][ws.m_iA][ws.m_iB];
 			}
 		}
 
 	} else {
 		if (pGrid->GetVarLocation(WIx) == DataLocation_REdge) {
 			for (int k = 0; k <= nRElements; k++) {
-				m_dStateREdge[WIx][k] =
-					dataUpdateREdge[WIx][k][m_iA][m_iB];
+				ws.m_dStateREdge[WIx][k] =
+					dataUpdateREdge[WIx][k][ws.m_iA][ws.m_iB];
 			}
 
 		} else {
 			for (int k = 0; k < nRElements; k++) {
-				m_dStateNode[WIx][k] =
-					dataUpdateNode[WIx][k][m_iA][m_iB];
+				ws.m_dStateNode[WIx][k] =
+					dataUpdateNode[WIx][k][ws.m_iA][ws.m_iB];
 			}
 		}
 	}
 
 	if (pGrid->GetVarLocation(WIx) == DataLocation_Node) {
 		pGrid->InterpolateNodeToREdge(
-			m_dStateNode[WIx],
-			m_dStateREdge[WIx]);
+			ws.m_dStateNode[WIx],
+			ws.m_dStateREdge[WIx]);
 	}
 
 #pragma message "Change to column arrays"
 	for (int k = 1; k < nRElements; k++) {
 		double dCovUx =
-			m_dStateREdge[WIx][k] * dDerivRREdge[k][m_iA][m_iB][2];
-
-		m_dXiDotREdge[k] =
-			  dContraMetricXiREdge[k][m_iA][m_iB][0]
-				* m_dStateREdge[UIx][k]
-			+ dContraMetricXiREdge[k][m_iA][m_iB][1]
-				* m_dStateREdge[VIx][k]
-			+ dContraMetricXiREdge[k][m_iA][m_iB][2]
+			ws.m_dStateREdge[WIx][k] * dDerivRREdge[k][ws.m_iA][ws.m_iB][2];
+
+		ws.m_dXiDotREdge[k] =
+			  dContraMetricXiREdge[k][ws.m_iA][ws.m_iB][0]
+				* ws.m_dStateREdge[UIx][k]
+			+ dContraMetricXiREdge[k][ws.m_iA][ws.m_iB][1]
+				* ws.m_dStateREdge[VIx][k]
+			+ dContraMetricXiREdge[k][ws.m_iA][ws.m_iB][2]
 				* dCovUx;
 	}
 
-	m_dXiDotREdge[0] = 0.0;
-	m_dXiDotREdge[nRElements] = 0.0;
+	ws.m_dXiDotREdge[0] = 0.0;
+	ws.m_dXiDotREdge[nRElements] = 0.0;
 
 	// Loop through all tracer species and apply update
 	for (int c = 0; c < nComponents; c++) {
 
 		// Interpolate tracer density to interfaces
 		for (int k = 0; k < nRElements; k++) {
-			m_dTracerDensityNode[k] = dataInitialTracer[c][k][m_iA][m_iB];
+			ws.m_dTracerDensityNode[k] = dataInitialTracer[c][k][ws.m_iA][ws.m_iB];
 		}
 
 		pGrid->InterpolateNodeToREdge(
-			m_dTracerDensityNode,
-			m_dTracerDensityREdge);
+			ws.m_dTracerDensityNode,
+			ws.m_dTracerDensityREdge);
 
 		// Calculate mass flux
 		for (int k = 0; k <= nRElements; k++) {
-			m_dMassFluxREdge[k] =
-				dJacobianREdge[k][m_iA][m_iB]
-				* m_dTracerDensityREdge[k]
-				* m_dXiDotREdge[k];
+			ws.m_dMassFluxREdge[k] =
+				dJacobianREdge[k][ws.m_iA][ws.m_iB]
+				* ws.m_dTracerDensityREdge[k]
+				* ws.m_dXiDotREdge[k];
 		}
 
 		////////////////////////////////////////////////////////////
 		// Apply uniform diffusion
 		if (m_fUniformDiffusionVar[TracerIx]) {
 			for (int k = 0; k < nRElements; k++) {
-				m_dStateAux[k] =
-					m_dTracerDensityNode[k]
-					/ m_dStateNode[RIx][k];
+				ws.m_dStateAux[k] =
+					ws.m_dTracerDensityNode[k]
+					/ ws.m_dStateNode[RIx][k];
 
-				m_dStateAux[k] -=
-					dataRefTracer[c][k][m_iA][m_iB]
-					/ m_dStateRefNode[RIx][k];
+				ws.m_dStateAux[k] -=
+					dataRefTracer[c][k][ws.m_iA][ws.m_iB]
+					/ ws.m_dStateRefNode[RIx][k];
 			}
 
 			pGrid->DifferentiateNodeToREdge(
-				m_dStateAux,
-				m_dStateAuxDiff);
+				ws.m_dStateAux,
+				ws.m_dStateAuxDiff);
 
 			for (int k = 1; k < nRElements; k++) {
-				m_dMassFluxREdge[k] -=
+				ws.m_dMassFluxREdge[k] -=
 					pGrid->GetScalarUniformDiffusionCoeff()
-					* m_dStateREdge[RIx][k]
-					* m_dStateAuxDiff[k];
+					* ws.m_dStateREdge[RIx][k]
+					* ws.m_dStateAuxDiff[k];
 			}
 		}
 
 		// Set boundary conditions and differentiate mass flux
-		m_dMassFluxREdge[0] = 0.0;
-		m_dMassFluxREdge[nRElements] = 0.0;
+		ws.m_dMassFluxREdge[0] = 0.0;
+		ws.m_dMassFluxREdge[nRElements] = 0.0;
 
 		pGrid->DifferentiateREdgeToNode(
-			m_dMassFluxREdge,
-			m_dDiffMassFluxNode);
+			ws.m_dMassFluxREdge,
+			ws.m_dDiffMassFluxNode);
 
 		// Update tracers
 		for (int k = 0; k < nRElements; k++) {
-			m_vecTracersF[k] =
-				m_dDiffMassFluxNode[k]
-				/ dJacobianNode[k][m_iA][m_iB];
+			ws.m_vecTracersF[k] =
+				ws.m_dDiffMassFluxNode[k]
+				/ dJacobianNode[k][ws.m_iA][ws.m_iB];
 		}
 
 		////////////////////////////////////////////////////////////
@@ -4671,27 +5549,27 @@ void VerticalDynamicsFEM::UpdateColumnTracers(
 			if (m_fFullyExplicit) {
 				for (int a = 0; a < nFiniteElements - 1; a++) {
 					int k = (a+1) * nNodesPerFiniteElement;
-					m_dUpwindWeights[a] = fabs(m_dXiDotREdge[k]);
+					ws.m_dUpwindWeights[a] = fabs(ws.m_dXiDotREdge[k]);
 				}
 
 			} else {
 				for (int a = 0; a < nFiniteElements - 1; a++) {
 					int k = (a+1) * nNodesPerFiniteElement;
-					m_dUpwindWeights[a] = fabs(m_dXiDotREdgeInitial[k]);
+					ws.m_dUpwindWeights[a] = fabs(ws.m_dXiDotREdgeInitial[k]);
 				}
 			}
 
 			// Apply upwinding
-			m_dStateAux.Zero();
+			ws.m_dStateAux.Zero();
 			opPenalty.Apply(
-				&(m_dUpwindWeights[0]),
-				&(m_dTracerDensityNode[0]),
-				&(m_dStateAux[0]),
+				&(ws.m_dUpwindWeights[0]),
+				&(ws.m_dTracerDensityNode[0]),
+				&(ws.m_dStateAux[0]),
 				1,
 				1);
 
 			for (int k = 0; k < nRElements; k++) {
-				m_vecTracersF[k] -= m_dStateAux[k];
+				ws.m_vecTracersF[k] -= ws.m_dStateAux[k];
 			}
 
 			// Apply implicit velocity correction
@@ -4705,12 +5583,12 @@ void VerticalDynamicsFEM::UpdateColumnTracers(
 					int kRightEnd = (a+1) * nNodesPerFiniteElement;
 
 					double dWeight =
-						fabs(m_dXiDotREdgeInitial[kLeftEnd]);
+						fabs(ws.m_dXiDotREdgeInitial[kLeftEnd]);
 
 					double dSignWeight;
-					if (m_dXiDotREdgeInitial[kLeftEnd] > 0.0) {
+					if (ws.m_dXiDotREdgeInitial[kLeftEnd] > 0.0) {
 						dSignWeight = 1.0;
-					} else if (m_dXiDotREdgeInitial[kLeftEnd] < 0.0) {
+					} else if (ws.m_dXiDotREdgeInitial[kLeftEnd] < 0.0) {
 						dSignWeight = -1.0;
 					} else {
 						dSignWeight = 0.0;
@@ -4719,16 +5597,16 @@ void VerticalDynamicsFEM::UpdateColumnTracers(
 					// dRhoQ_k/dW_a (left operator)
 					double dLeftJumpConUx =
 						dSignWeight
-						* (dataUpdateREdge[WIx][kLeftEnd][m_iA][m_iB]
-							- m_dColumnState[VecFIx(FWIx, kLeftEnd)])
-						/ m_dColumnDerivRREdge[kLeftEnd][2];
+						* (dataUpdateREdge[WIx][kLeftEnd][ws.m_iA][ws.m_iB]
+							- ws.m_dColumnState[VecFIx(FWIx, kLeftEnd)])
+						/ ws.m_dColumnDerivRREdge[kLeftEnd][2];
 
 					for (int k = kLeftBegin; k < kLeftEnd; k++) {
 						int n = iPenaltyLeftBegin[k];
 						for (; n < iPenaltyLeftEnd[k]; n++) {
-							m_vecTracersF[k] -=
+							ws.m_vecTracersF[k] -=
 								dPenaltyLeft[k][n]
-								* m_dTracerDensityNode[n]
+								* ws.m_dTracerDensityNode[n]
 								* dLeftJumpConUx;
 						}
 					}
@@ -4736,16 +5614,16 @@ void VerticalDynamicsFEM::UpdateColumnTracers(
 					// dRhoQ_k/dW_a (right operator)
 					double dRightJumpConUx =
 						dSignWeight
-						* (dataUpdateREdge[WIx][kRightBegin][m_iA][m_iB]
-							- m_dColumnState[VecFIx(FWIx, kRightBegin)])
-						/ m_dColumnDerivRREdge[kRightBegin][2];
+						* (dataUpdateREdge[WIx][kRightBegin][ws.m_iA][ws.m_iB]
+							- ws.m_dColumnState[VecFIx(FWIx, kRightBegin)])
+						/ ws.m_dColumnDerivRREdge[kRightBegin][2];
 
 					for (int k = kRightBegin; k < kRightEnd; k++) {
 						int n = iPenaltyRightBegin[k];
 						for (; n < iPenaltyRightEnd[k]; n++) {
-							m_vecTracersF[k] -=
+							ws.m_vecTracersF[k] -=
 								dPenaltyRight[k][n]
-								* m_dTracerDensityNode[n]
+								* ws.m_dTracerDensityNode[n]
 								* dRightJumpConUx;
 						}
 					}
@@ -4758,18 +5636,18 @@ void VerticalDynamicsFEM::UpdateColumnTracers(
 		int iInfo =
 			LAPACK::DGETRS(
 				'N',
-				m_matTracersLUDF,
-				m_vecTracersF,
-				m_vecTracersIPiv);
+				ws.m_matTracersLUDF,
+				ws.m_vecTracersF,
+				ws.m_vecTracersIPiv);
 
 #elif defined(USE_JACOBIAN_DIAGONAL)
 		// Solve the matrix system using banded LU decomposed matrix
 		int iInfo =
 			LAPACK::DGBTRS(
 				'N',
-				m_matTracersLUDF,
-				m_vecTracersF,
-				m_vecTracersIPiv,
+				ws.m_matTracersLUDF,
+				ws.m_vecTracersF,
+				ws.m_vecTracersIPiv,
 				2 * m_nVerticalOrder - 1,
 				2 * m_nVerticalOrder - 1);
 #else
@@ -4782,8 +5660,8 @@ void VerticalDynamicsFEM::UpdateColumnTracers(
 
 		// Update the state
 		for (int k = 0; k < nRElements; k++) {
-			dataUpdateTracer[c][k][m_iA][m_iB] -=
-				m_vecTracersF[k];
+			dataUpdateTracer[c][k][ws.m_iA][ws.m_iB] -=
+				ws.m_vecTracersF[k];
 		}
 	}
 }
@@ -4810,7 +5688,7 @@ void VerticalDynamicsFEM::FilterNegativeTracers(
 		const DataArray3D<double> & dElementArea =
 			pPatch->GetElementArea();
 
-		DataArray4D<double> & dataUpdateTracer =
+		TracerArray4D & dataUpdateTracer =
 			pPatch->GetDataTracers(iDataUpdate);
 
 		// Number of tracers
@@ -26,6 +26,9 @@
 #include "DataArray2D.h"
 #include "DataArray3D.h"
 #include "DataArray4D.h"
+#include "BatchedBandedLU.h"
+
+#include <vector>
 
 #ifdef USE_JFNK_PETSC
 #include <petscsnes.h>
@@ -59,7 +62,8 @@ public:
 		int nHypervisOrder,
 		bool fFullyExplicit,
 		bool fUseReferenceState,
-		bool fForceMassFluxOnLevels
+		bool fForceMassFluxOnLevels,
+		int nJacobianReuse = 0
 	);
 
 	///	<summary>
@@ -73,6 +77,11 @@ public:
 	///	</summary>
 	virtual void Initialize();
 
+	///	<summary>
+	///		Report statistics on reuse of column Jacobians.
+	///	</summary>
+	virtual void ReportStatistics();
+
 protected:
 	///	<summary>
 	///		Component indices into the F vector.
@@ -136,6 +145,429 @@ protected:
 #endif
 	}
 
+protected:
+	///	<summary>
+	///		Scratch space used when solving a single vertical column.  One
+	///		instance is allocated per thread (or per lane of a batch) so
+	///		that columns can be solved concurrently.
+	///	</summary>
+	struct ColumnWorkspace {
+
+		///	<summary>
+		///		Allocate all buffers.
+		///	</summary>
+		void Allocate(
+			int nRElements,
+			int nComponents,
+			int nColumnStateSize,
+			int nJacobianFWidth,
+			int nUpwindWeights
+		);
+
+		///	<summary>
+		///		State variable column.
+		///	</summary>
+		DataArray1D<double> m_dColumnState;
+
+		///	<summary>
+		///		Reference state column on nodes.
+		///	</summary>
+		DataArray2D<double> m_dStateRefNode;
+
+		///	<summary>
+		///		Reference state column on interfaces.
+		///	</summary>
+		DataArray2D<double> m_dStateRefREdge;
+
+		///	<summary>
+		///		State vector on model levels, used by StepImplicit.
+		///	</summary>
+		DataArray2D<double> m_dStateNode;
+
+		///	<summary>
+		///		State vector on model interfaces, used by StepImplicit.
+		///	</summary>
+		DataArray2D<double> m_dStateREdge;
+
+		///	<summary>
+		///		Auxiliary state data.
+		///	</summary>
+		DataArray1D<double> m_dStateAux;
+
+		///	<summary>
+		///		Derivative of auxiliary state data.
+		///	</summary>
+		DataArray1D<double> m_dStateAuxDiff;
+
+		///	<summary>
+		///		Velocity across xi surfaces (xi_dot) at nodes.
+		///	</summary>
+		DataArray1D<double> m_dXiDotNode;
+
+		///	<summary>
+		///		Velocity across xi surfaces (xi_dot) at interfaces.
+		///	</summary>
+		DataArray1D<double> m_dXiDotREdge;
+
+		///	<summary>
+		///		Velocity across xi surfaces (xi_dot) at interfaces.
+		///	</summary>
+		DataArray1D<double> m_dXiDotREdgeInitial;
+
+		///	<summary>
+		///		Auxiliary storage for derivative of alpha velocity.
+		///	</summary>
+		DataArray1D<double> m_dDiffUa;
+
+		///	<summary>
+		///		Auxiliary storage for derivative of beta velocity.
+		///	</summary>
+		DataArray1D<double> m_dDiffUb;
+
+		///	<summary>
+		///		Auxiliary storage for derivative of pressure on nodes.
+		///	</summary>
+		DataArray1D<double> m_dDiffPNode;
+
+		///	<summary>
+		///		Auxiliary storage for derivative of pressure on interfaces.
+		///	</summary>
+		DataArray1D<double> m_dDiffPREdge;
+
+		///	<summary>
+		///		Auxiliary storage for derivative of theta on nodes.
+		///	</summary>
+		DataArray1D<double> m_dDiffThetaNode;
+
+		///	<summary>
+		///		Auxiliary storage for derivative of theta on interfaces.
+		///	</summary>
+		DataArray1D<double> m_dDiffThetaREdge;
+
+		///	<summary>
+		///		Auxiliary storage for derivative of vertical velocity on nodes.
+		///	</summary>
+		DataArray1D<double> m_dDiffWNode;
+
+		///	<summary>
+		///		Auxiliary storage for derivative of vertical velocity on interfaces.
+		///	</summary>
+		DataArray1D<double> m_dDiffWREdge;
+
+		///	<summary>
+		///		Horizontal Kinetic energy on model levels.
+		///	</summary>
+		DataArray1D<double> m_dHorizKineticEnergyNode;
+
+		///	<summary>
+		///		Kinetic energy on model levels.
+		///	</summary>
+		DataArray1D<double> m_dKineticEnergyNode;
+
+		///	<summary>
+		///		Derivatives of kinetic energy on model levels.
+		///	</summary>
+		DataArray1D<double> m_dDiffKineticEnergyNode;
+
+		///	<summary>
+		///		Derivatives of kinetic energy on model levels.
+		///	</summary>
+		DataArray1D<double> m_dDiffKineticEnergyREdge;
+
+		///	<summary>
+		///		Mass flux on model levels.
+		///	</summary>
+		DataArray1D<double> m_dMassFluxNode;
+
+		///	<summary>
+		///		Mass flux on model interfaces.
+		///	</summary>
+		DataArray1D<double> m_dMassFluxREdge;
+
+		///	<summary>
+		///		Derivatives of mass flux on model levels.
+		///	</summary>
+		DataArray1D<double> m_dDiffMassFluxNode;
+
+		///	<summary>
+		///		Derivatives of mass flux on model interfaces.
+		///	</summary>
+		DataArray1D<double> m_dDiffMassFluxREdge;
+
+		///	<summary>
+		///		Pressure flux on model levels.
+		///	</summary>
+		DataArray1D<double> m_dPressureFluxNode;
+
+		///	<summary>
+		///		Pressure flux on model interfaces.
+		///	</summary>
+		DataArray1D<double> m_dPressureFluxREdge;
+
+		///	<summary>
+		///		Derivatives of pressure flux on model levels.
+		///	</summary>
+		DataArray1D<double> m_dDiffPressureFluxNode;
+
+		///	<summary>
+		///		Derivatives of pressure flux on model interfaces.
+		///	</summary>
+		DataArray1D<double> m_dDiffPressureFluxREdge;
+
+		///	<summary>
+		///		Exner pressure perturbation at model levels.
+		///	</summary>
+		DataArray1D<double> m_dExnerNode;
+
+		///	<summary>
+		///		Reference Exner pressure at model levels.
+		///	</summary>
+		DataArray1D<double> m_dExnerRefNode;
+
+		///	<summary>
+		///		Exner pressure perturbation at model interfaces.
+		///	</summary>
+		DataArray1D<double> m_dExnerREdge;
+
+		///	<summary>
+		///		Reference Exner pressure at model interfaces.
+		///	</summary>
+		DataArray1D<double> m_dExnerRefREdge;
+
+		///	<summary>
+		///		Derivative of Exner pressure perturbation at model levels.
+		///	</summary>
+		DataArray1D<double> m_dDiffExnerPertNode;
+
+		///	<summary>
+		///		Derivative of reference Exner pressure at model levels.
+		///	</summary>
+		DataArray1D<double> m_dDiffExnerRefNode;
+
+		///	<summary>
+		///		Derivative of Exner pressure perturbation at model interfaces.
+		///	</summary>
+		DataArray1D<double> m_dDiffExnerPertREdge;
+
+		///	<summary>
+		///		Derivative of reference Exner pressure at model interfaces.
+		///	</summary>
+		DataArray1D<double> m_dDiffExnerRefREdge;
+
+		///	<summary>
+		///		Tracer density on model levels.
+		///	</summary>
+		DataArray1D<double> m_dTracerDensityNode;
+
+		///	<summary>
+		///		Tracer density on model interfaces.
+		///	</summary>
+		DataArray1D<double> m_dTracerDensityREdge;
+
+		///	<summary>
+		///		Initial density on model levels.
+		///	</summary>
+		DataArray1D<double> m_dInitialDensityNode;
+
+		///	<summary>
+		///		Initial density on model interfaces.
+		///	</summary>
+		DataArray1D<double> m_dInitialDensityREdge;
+
+		///	<summary>
+		///		Updated density on model levels.
+		///	</summary>
+		DataArray1D<double> m_dUpdateDensityNode;
+
+		///	<summary>
+		///		Updated density on model interfaces.
+		///	</summary>
+		DataArray1D<double> m_dUpdateDensityREdge;
+
+		///	<summary>
+		///		Solution vector from the implicit solve.
+		///	</summary>
+		DataArray1D<double> m_dSoln;
+
+		///	<summary>
+		///		Jacobian in the column on Nodes.
+		///	</summary>
+		DataArray1D<double> m_dColumnJacobianNode;
+
+		///	<summary>
+		///		Jacobian in the column on REdges.
+		///	</summary>
+		DataArray1D<double> m_dColumnJacobianREdge;
+
+		///	<summary>
+		///		Element area on Nodes.
+		///	</summary>
+		DataArray1D<double> m_dColumnElementArea;
+
+		///	<summary>
+		///		Inverse Jacobian in the column on Nodes.
+		///	</summary>
+		DataArray1D<double> m_dColumnInvJacobianNode;
+
+		///	<summary>
+		///		Inverse Jacobian in the column on REdges.
+		///	</summary>
+		DataArray1D<double> m_dColumnInvJacobianREdge;
+
+		///	<summary>
+		///		Vertical derivative transform in the column on Nodes.
+		///	</summary>
+		DataArray2D<double> m_dColumnDerivRNode;
+
+		///	<summary>
+		///		Vertical derivative transform in the column on REdges.
+		///	</summary>
+		DataArray2D<double> m_dColumnDerivRREdge;
+
+		///	<summary>
+		///		Contravariant metric (alpha component) in the column on Nodes.
+		///	</summary>
+		DataArray2D<double> m_dColumnContraMetricA;
+
+		///	<summary>
+		///		Contravariant metric (beta component) in the column on Nodes.
+		///	</summary>
+		DataArray2D<double> m_dColumnContraMetricB;
+
+		///	<summary>
+		///		Contravariant metric (xi component) in the column on Nodes.
+		///	</summary>
+		DataArray2D<double> m_dColumnContraMetricXi;
+
+		///	<summary>
+		///		Contravariant metric (alpha component) in the column on REdges.
+		///	</summary>
+		DataArray2D<double> m_dColumnContraMetricAREdge;
+
+		///	<summary>
+		///		Contravariant metric (beta component) in the column on REdges.
+		///	</summary>
+		DataArray2D<double> m_dColumnContraMetricBREdge;
+
+		///	<summary>
+		///		Contravariant metric (xi component) in the column on REdges.
+		///	</summary>
+		DataArray2D<double> m_dColumnContraMetricXiREdge;
+
+		///	<summary>
+		///		Flux vector for tracer advection.
+		///	</summary>
+		DataArray1D<double> m_vecTracersF;
+
+		///	<summary>
+		///		LU decomposition of Jacobian matrix used for tracer advection.
+		///	</summary>
+		DataArray2D<double> m_matTracersLUDF;
+
+		///	<summary>
+		///		Pivot matrix used for updating tracers.
+		///	</summary>
+		DataArray1D<int> m_vecTracersIPiv;
+
+		///	<summary>
+		///		Jacobian matrix used in direct solve.
+		///	</summary>
+		DataArray2D<double> m_matJacobianF;
+
+		///	<summary>
+		///		Pivot matrix used in direct solve.
+		///	</summary>
+		DataArray1D<int> m_vecIPiv;
+
+		///	<summary>
+		///		Residual of the Newton system, and corrections to the Newton
+		///		step, when refining the step with a retained Jacobian.
+		///	</summary>
+		DataArray1D<double> m_dColumnResidual;
+
+		///	<summary>
+		///		Newton step refined with a retained Jacobian.
+		///	</summary>
+		DataArray1D<double> m_dColumnStep;
+
+		///	<summary>
+		///		Auxiliary storage for second derivatives of the state
+		///	</summary>
+		DataArray2D<double> m_dDiffDiffStateUpwind;
+
+		///	<summary>
+		///		Auxiliary storage for second derivatives of the state
+		///	</summary>
+		DataArray2D<double> m_dDiffDiffStateHypervis;
+
+		///	<summary>
+		///		Auxiliary storage for second derivatives of the state
+		///	</summary>
+		DataArray2D<double> m_dDiffDiffStateUniform;
+
+		///	<summary>
+		///		Finite element upwinding weights.
+		///	</summary>
+		DataArray1D<double> m_dUpwindWeights;
+
+		///	<summary>
+		///		Pointer to active patch.
+		///	</summary>
+		GridPatch * m_pPatch;
+
+		///	<summary>
+		///		Active alpha index on m_pPatch.
+		///	</summary>
+		int m_iA;
+
+		///	<summary>
+		///		Active beta index on m_pPatch.
+		///	</summary>
+		int m_iB;
+	};
+
+#ifdef USE_JFNK_GMRES
+	///	<summary>
+	///		Jacobian-Free Newton-Krylov solver bound to a single column
+	///		workspace, so that each thread carries its own Krylov state.
+	///	</summary>
+	class ColumnJFNK : public JacobianFreeNewtonKrylov {
+
+	public:
+		///	<summary>
+		///		Constructor.
+		///	</summary>
+		ColumnJFNK(
+			VerticalDynamicsFEM & dyn,
+			ColumnWorkspace & ws
+		) :
+			m_dyn(dyn),
+			m_ws(ws)
+		{ }
+
+		///	<summary>
+		///		Evaluate the column residual in the bound workspace.
+		///	</summary>
+		virtual void Evaluate(
+			const double * dX,
+			double * dF
+		) {
+			m_dyn.Evaluate(m_ws, dX, dF);
+		}
+
+	private:
+		///	<summary>
+		///		Vertical dynamics operator.
+		///	</summary>
+		VerticalDynamicsFEM & m_dyn;
+
+		///	<summary>
+		///		Column workspace used for residual evaluation.
+		///	</summary>
+		ColumnWorkspace & m_ws;
+	};
+#endif
+
 public:
 	///	<summary>
 	///		Advance explicit terms of the vertical column one substep.
@@ -160,7 +592,9 @@ public:
 	///	<summary>
 	///		Build the Jacobian matrix.
 	///	</summary>
-	void BootstrapJacobian();
+	void BootstrapJacobian(
+		ColumnWorkspace & ws
+	);
 
 	///	<summary>
 	///		Advance implicit terms of the vertical column one substep.
@@ -182,12 +616,94 @@ public:
                 double dDeltaT
 	);
 
+protected:
+	///	<summary>
+	///		Advance implicit terms of a single vertical column one substep.
+	///	</summary>
+	void StepImplicitColumn(
+		ColumnWorkspace & ws,
+		GridPatch * pPatch,
+		int iA,
+		int iB,
+		int iDataInitial,
+		int iDataUpdate,
+		double dDeltaT
+	);
+
+	///	<summary>
+	///		Build the F vector (in m_dSoln) and the Jacobian of the implicit
+	///		problem on a single vertical column.
+	///	</summary>
+	void BuildImplicitColumn(
+		ColumnWorkspace & ws,
+		GridPatch * pPatch,
+		int iA,
+		int iB,
+		int iDataInitial,
+		double dDeltaT
+	);
+
+	///	<summary>
+	///		Copy the updated column state in m_dSoln to the patch and
+	///		update tracers in the column.
+	///	</summary>
+	void ApplyImplicitColumn(
+		ColumnWorkspace & ws,
+		GridPatch * pPatch,
+		int iA,
+		int iB,
+		int iDataInitial,
+		int iDataUpdate,
+		double dDeltaT
+	);
+
+	///	<summary>
+	///		Solve the linearly implicit problem on a single vertical column.
+	///	</summary>
+	void SolveImplicitColumn(
+		ColumnWorkspace & ws,
+		GridPatch * pPatch,
+		int iA,
+		int iB,
+		int iDataInitial,
+		int iDataRHS,
+		double dDeltaT
+	);
+
+	///	<summary>
+	///		Build the scaled Jacobian and the RHS (in m_dSoln) of the
+	///		linearly implicit problem on a single vertical column.
+	///	</summary>
+	void BuildSolveImplicitColumn(
+		ColumnWorkspace & ws,
+		GridPatch * pPatch,
+		int iA,
+		int iB,
+		int iDataInitial,
+		int iDataRHS
+	);
+
+	///	<summary>
+	///		Copy the solution of the linearly implicit problem in m_dSoln
+	///		to the patch and update tracers in the column.
+	///	</summary>
+	void ApplySolveImplicitColumn(
+		ColumnWorkspace & ws,
+		GridPatch * pPatch,
+		int iA,
+		int iB,
+		int iDataInitial,
+		int iDataRHS,
+		double dDeltaT
+	);
+
 public:
 	///	<summary>
 	///		Set up the reference column.  This function is called once for
 	///		each column prior to the solve.
 	///	</summary>
 	void SetupReferenceColumn(
+		ColumnWorkspace & ws,
 		GridPatch * pPatch,
 		int iA,
 		int iB,
@@ -203,6 +719,7 @@ public:
 	///		BuildJacobianF.
 	///	</summary>
 	void PrepareColumn(
+		ColumnWorkspace & ws,
 		const double * dX
 	);
 
@@ -210,6 +727,7 @@ public:
 	///		Evaluate the zero equations for the implicit solve.
 	///	</summary>
 	void BuildF(
+		ColumnWorkspace & ws,
 		const double * dX,
 		double * dF
 	);
@@ -219,6 +737,7 @@ public:
 	///		in the zero equations.
 	///	</summary>
 	void BuildJacobianF_Diffusion(
+		ColumnWorkspace & ws,
 		const double * dX,
 		double * dDG
 	);
@@ -228,6 +747,7 @@ public:
 	///		for LOR vertical staggering and RhoTheta_Pi formulation.
 	///	</summary>
 	void BuildJacobianF_LOR_RhoTheta_Pi(
+		ColumnWorkspace & ws,
 		const double * dX,
 		double * dDG
 	);
@@ -236,13 +756,23 @@ public:
 	///		Build the Jacobian matrix associated with the zero equations.
 	///	</summary>
 	void BuildJacobianF(
+		ColumnWorkspace & ws,
 		const double * dX,
 		double * dDG
 	);
 
 	///	<summary>
-	///		Prepare the column then evaluate the zero equations
-	///		(used by JacobianFreeNewtonKrylov)
+	///		Prepare the column then evaluate the zero equations.
+	///	</summary>
+	void Evaluate(
+		ColumnWorkspace & ws,
+		const double * dX,
+		double * dF
+	);
+
+	///	<summary>
+	///		Prepare the column then evaluate the zero equations in the
+	///		first column workspace (used by JacobianFreeNewtonKrylov).
 	///	</summary>
 	void Evaluate(
 		const double * dX,
@@ -254,14 +784,15 @@ protected:
 	///		Update tracers in the vertical.
 	///	</summary>
 	void UpdateColumnTracers(
+		ColumnWorkspace & ws,
 		double dDeltaT,
 		const DataArray4D<double> & dataInitialNode,
 		const DataArray4D<double> & dataUpdateNode,
 		const DataArray4D<double> & dataInitialREdge,
 		const DataArray4D<double> & dataUpdateREdge,
-		const DataArray4D<double> & dataRefTracer,
-		const DataArray4D<double> & dataInitialTracer,
-		DataArray4D<double> & dataUpdateTracer
+		const TracerArray4D & dataRefTracer,
+		const TracerArray4D & dataInitialTracer,
+		TracerArray4D & dataUpdateTracer
 	);
 
 public:
@@ -334,52 +865,17 @@ protected:
 	///	</summary>
 	DataArray1D<bool> m_fUniformDiffusionVar;
 
-	///	<summary>
-	///		Finite element upwinding weights.
-	///	</summary>
-	DataArray1D<double> m_dUpwindWeights;
-
 	///	<summary>
 	///		Order of hyperdiffusion to apply (must be even).
 	///	</summary>
 	int m_nHypervisOrder;
 
-	///	<summary>
-	///		Auxiliary storage for second derivatives of the state
-	///	</summary>
-	DataArray2D<double> m_dDiffDiffStateUpwind;
-
-	///	<summary>
-	///		Auxiliary storage for second derivatives of the state
-	///	</summary>
-	DataArray2D<double> m_dDiffDiffStateHypervis;
-
-	///	<summary>
-	///		Auxiliary storage for second derivatives of the state
-	///	</summary>
-	DataArray2D<double> m_dDiffDiffStateUniform;
-
 protected:
 	///	<summary>
 	///		Timestep size.
 	///	</summary>
 	double m_dDeltaT;
 
-	///	<summary>
-	///		Pointer to active patch.
-	///	</summary>
-	GridPatch * m_pPatch;
-
-	///	<summary>
-	///		Active alpha index on m_pPatch.
-	///	</summary>
-	int m_iA;
-
-	///	<summary>
-	///		Active beta index on m_pPatch.
-	///	</summary>
-	int m_iB;
-
 	///	<summary>
 	///		Number of radial elements in the vertical column.
 	///	</summary>
@@ -390,314 +886,6 @@ protected:
 	///	</summary>
 	int m_nColumnStateSize;
 
-protected:
-	///	<summary>
-	///		State variable column.
-	///	</summary>
-	DataArray1D<double> m_dColumnState;
-
-	///	<summary>
-	///		Reference state column on nodes.
-	///	</summary>
-	DataArray2D<double> m_dStateRefNode;
-
-	///	<summary>
-	///		Reference state column on interfaces.
-	///	</summary>
-	DataArray2D<double> m_dStateRefREdge;
-
-	///	<summary>
-	///		State vector on model levels, used by StepImplicit.
-	///	</summary>
-	DataArray2D<double> m_dStateNode;
-
-	///	<summary>
-	///		State vector on model interfaces, used by StepImplicit.
-	///	</summary>
-	DataArray2D<double> m_dStateREdge;
-
-	///	<summary>
-	///		Auxiliary state data.
-	///	</summary>
-	DataArray1D<double> m_dStateAux;
-
-	///	<summary>
-	///		Derivative of auxiliary state data.
-	///	</summary>
-	DataArray1D<double> m_dStateAuxDiff;
-
-	///	<summary>
-	///		Velocity across xi surfaces (xi_dot) at nodes.
-	///	</summary>
-	DataArray1D<double> m_dXiDotNode;
-
-	///	<summary>
-	///		Velocity across xi surfaces (xi_dot) at interfaces.
-	///	</summary>
-	DataArray1D<double> m_dXiDotREdge;
-
-	///	<summary>
-	///		Velocity across xi surfaces (xi_dot) at interfaces.
-	///	</summary>
-	DataArray1D<double> m_dXiDotREdgeInitial;
-
-	///	<summary>
-	///		Auxiliary storage for derivative of alpha velocity.
-	///	</summary>
-	DataArray1D<double> m_dDiffUa;
-
-	///	<summary>
-	///		Auxiliary storage for derivative of beta velocity.
-	///	</summary>
-	DataArray1D<double> m_dDiffUb;
-
-	///	<summary>
-	///		Auxiliary storage for derivative of pressure on nodes.
-	///	</summary>
-	DataArray1D<double> m_dDiffPNode;
-
-	///	<summary>
-	///		Auxiliary storage for derivative of pressure on interfaces.
-	///	</summary>
-	DataArray1D<double> m_dDiffPREdge;
-
-	///	<summary>
-	///		Auxiliary storage for derivative of theta on nodes.
-	///	</summary>
-	DataArray1D<double> m_dDiffThetaNode;
-
-	///	<summary>
-	///		Auxiliary storage for derivative of theta on interfaces.
-	///	</summary>
-	DataArray1D<double> m_dDiffThetaREdge;
-
-	///	<summary>
-	///		Auxiliary storage for derivative of vertical velocity on nodes.
-	///	</summary>
-	DataArray1D<double> m_dDiffWNode;
-
-	///	<summary>
-	///		Auxiliary storage for derivative of vertical velocity on interfaces.
-	///	</summary>
-	DataArray1D<double> m_dDiffWREdge;
-
-	///	<summary>
-	///		Horizontal Kinetic energy on model levels.
-	///	</summary>
-	DataArray1D<double> m_dHorizKineticEnergyNode;
-
-	///	<summary>
-	///		Kinetic energy on model levels.
-	///	</summary>
-	DataArray1D<double> m_dKineticEnergyNode;
-
-	///	<summary>
-	///		Derivatives of kinetic energy on model levels.
-	///	</summary>
-	DataArray1D<double> m_dDiffKineticEnergyNode;
-
-	///	<summary>
-	///		Derivatives of kinetic energy on model levels.
-	///	</summary>
-	DataArray1D<double> m_dDiffKineticEnergyREdge;
-
-	///	<summary>
-	///		Mass flux on model levels.
-	///	</summary>
-	DataArray1D<double> m_dMassFluxNode;
-
-	///	<summary>
-	///		Mass flux on model interfaces.
-	///	</summary>
-	DataArray1D<double> m_dMassFluxREdge;
-
-	///	<summary>
-	///		Derivatives of mass flux on model levels.
-	///	</summary>
-	DataArray1D<double> m_dDiffMassFluxNode;
-
-	///	<summary>
-	///		Derivatives of mass flux on model interfaces.
-	///	</summary>
-	DataArray1D<double> m_dDiffMassFluxREdge;
-
-	///	<summary>
-	///		Pressure flux on model levels.
-	///	</summary>
-	DataArray1D<double> m_dPressureFluxNode;
-
-	///	<summary>
-	///		Pressure flux on model interfaces.
-	///	</summary>
-	DataArray1D<double> m_dPressureFluxREdge;
-
-	///	<summary>
-	///		Derivatives of pressure flux on model levels.
-	///	</summary>
-	DataArray1D<double> m_dDiffPressureFluxNode;
-
-	///	<summary>
-	///		Derivatives of pressure flux on model interfaces.
-	///	</summary>
-	DataArray1D<double> m_dDiffPressureFluxREdge;
-
-	///	<summary>
-	///		Exner pressure perturbation at model levels.
-	///	</summary>
-	DataArray1D<double> m_dExnerNode;
-
-	///	<summary>
-	///		Reference Exner pressure at model levels.
-	///	</summary>
-	DataArray1D<double> m_dExnerRefNode;
-
-	///	<summary>
-	///		Exner pressure perturbation at model interfaces.
-	///	</summary>
-	DataArray1D<double> m_dExnerREdge;
-
-	///	<summary>
-	///		Reference Exner pressure at model interfaces.
-	///	</summary>
-	DataArray1D<double> m_dExnerRefREdge;
-
-	///	<summary>
-	///		Derivative of Exner pressure perturbation at model levels.
-	///	</summary>
-	DataArray1D<double> m_dDiffExnerPertNode;
-
-	///	<summary>
-	///		Derivative of reference Exner pressure at model levels.
-	///	</summary>
-	DataArray1D<double> m_dDiffExnerRefNode;
-
-	///	<summary>
-	///		Derivative of Exner pressure perturbation at model interfaces.
-	///	</summary>
-	DataArray1D<double> m_dDiffExnerPertREdge;
-
-	///	<summary>
-	///		Derivative of reference Exner pressure at model interfaces.
-	///	</summary>
-	DataArray1D<double> m_dDiffExnerRefREdge;
-
-	///	<summary>
-	///		Tracer density on model levels.
-	///	</summary>
-	DataArray1D<double> m_dTracerDensityNode;
-
-	///	<summary>
-	///		Tracer density on model interfaces.
-	///	</summary>
-	DataArray1D<double> m_dTracerDensityREdge;
-
-	///	<summary>
-	///		Initial density on model levels.
-	///	</summary>
-	DataArray1D<double> m_dInitialDensityNode;
-
-	///	<summary>
-	///		Initial density on model interfaces.
-	///	</summary>
-	DataArray1D<double> m_dInitialDensityREdge;
-
-	///	<summary>
-	///		Updated density on model levels.
-	///	</summary>
-	DataArray1D<double> m_dUpdateDensityNode;
-
-	///	<summary>
-	///		Updated density on model interfaces.
-	///	</summary>
-	DataArray1D<double> m_dUpdateDensityREdge;
-
-	///	<summary>
-	///		Solution vector from the implicit solve.
-	///	</summary>
-	DataArray1D<double> m_dSoln;
-
-private:
-	///	<summary>
-	///		Jacobian in the column on Nodes.
-	///	</summary>
-	DataArray1D<double> m_dColumnJacobianNode;
-
-	///	<summary>
-	///		Jacobian in the column on REdges.
-	///	</summary>
-	DataArray1D<double> m_dColumnJacobianREdge;
-
-	///	<summary>
-	///		Element area on Nodes.
-	///	</summary>
-	DataArray1D<double> m_dColumnElementArea;
-
-	///	<summary>
-	///		Inverse Jacobian in the column on Nodes.
-	///	</summary>
-	DataArray1D<double> m_dColumnInvJacobianNode;
-
-	///	<summary>
-	///		Inverse Jacobian in the column on REdges.
-	///	</summary>
-	DataArray1D<double> m_dColumnInvJacobianREdge;
-
-	///	<summary>
-	///		Vertical derivative transform in the column on Nodes.
-	///	</summary>
-	DataArray2D<double> m_dColumnDerivRNode;
-
-	///	<summary>
-	///		Vertical derivative transform in the column on REdges.
-	///	</summary>
-	DataArray2D<double> m_dColumnDerivRREdge;
-
-	///	<summary>
-	///		Contravariant metric (alpha component) in the column on Nodes.
-	///	</summary>
-	DataArray2D<double> m_dColumnContraMetricA;
-
-	///	<summary>
-	///		Contravariant metric (beta component) in the column on Nodes.
-	///	</summary>
-	DataArray2D<double> m_dColumnContraMetricB;
-
-	///	<summary>
-	///		Contravariant metric (xi component) in the column on Nodes.
-	///	</summary>
-	DataArray2D<double> m_dColumnContraMetricXi;
-
-	///	<summary>
-	///		Contravariant metric (alpha component) in the column on REdges.
-	///	</summary>
-	DataArray2D<double> m_dColumnContraMetricAREdge;
-
-	///	<summary>
-	///		Contravariant metric (beta component) in the column on REdges.
-	///	</summary>
-	DataArray2D<double> m_dColumnContraMetricBREdge;
-
-	///	<summary>
-	///		Contravariant metric (xi component) in the column on REdges.
-	///	</summary>
-	DataArray2D<double> m_dColumnContraMetricXiREdge;
-
-private:
-	///	<summary>
-	///		Flux vector for tracer advection.
-	///	</summary>
-	DataArray1D<double> m_vecTracersF;
-
-	///	<summary>
-	///		LU decomposition of Jacobian matrix used for tracer advection.
-	///	</summary>
-	DataArray2D<double> m_matTracersLUDF;
-
-	///	<summary>
-	///		Pivot matrix used for updating tracers.
-	///	</summary>
-	DataArray1D<int> m_vecTracersIPiv;
-
 #ifdef USE_JFNK_PETSC
 private:
 	///	<summary>
@@ -723,14 +911,94 @@ private:
 
 private:
 	///	<summary>
-	///		Jacobian matrix used in direct solve.
+	///		Column workspaces.  There is one workspace per thread, or one
+	///		per lane of each thread's batch when USE_JACOBIAN_BATCHED is
+	///		defined, followed by one per thread for residual evaluation
+	///		when column Jacobians are reused.
+	///	</summary>
+	std::vector<ColumnWorkspace> m_vecColumnWorkspace;
+
+#ifdef USE_JFNK_GMRES
+	///	<summary>
+	///		Column JFNK solvers, one per column workspace.
 	///	</summary>
-	DataArray2D<double> m_matJacobianF;
+	std::vector<ColumnJFNK *> m_vecColumnJFNK;
+#endif
+
+#if defined(USE_JACOBIAN_BATCHED)
+	///	<summary>
+	///		Batched banded LU solver for each thread.
+	///	</summary>
+	std::vector<BatchedBandedLU> m_vecColumnBatchLU;
+
+	///	<summary>
+	///		A factored batch of column Jacobians retained for reuse.
+	///	</summary>
+	struct ColumnBatchJacobian {
+
+		///	<summary>
+		///		Constructor.
+		///	</summary>
+		ColumnBatchJacobian() :
+			fValid(false),
+			dDeltaT(0.0),
+			nUses(0),
+			nFactorizations(0),
+			nReuses(0),
+			nIterations(0),
+			nRefreshDeltaT(0),
+			nRefreshAge(0),
+			nRefreshSlow(0)
+		{ }
+
+		///	<summary>
+		///		Factorization of the batch.
+		///	</summary>
+		BatchedBandedLU lu;
+
+		///	<summary>
+		///		Flag indicating the factorization is available.
+		///	</summary>
+		bool fValid;
+
+		///	<summary>
+		///		Timestep size when the Jacobian was built.
+		///	</summary>
+		double dDeltaT;
+
+		///	<summary>
+		///		Number of solves with the current factorization.
+		///	</summary>
+		int nUses;
+
+		///	<summary>
+		///		Statistics: total factorizations, solves that reused an
+		///		existing factorization, back-solves performed with an
+		///		existing factorization, and refreshes due to a change in
+		///		timestep size, the reuse limit or slow convergence of
+		///		iterative refinement.
+		///	</summary>
+		long nFactorizations;
+		long nReuses;
+		long nIterations;
+		long nRefreshDeltaT;
+		long nRefreshAge;
+		long nRefreshSlow;
+	};
+
+	///	<summary>
+	///		Retained column Jacobians for each active patch and batch,
+	///		used when m_nJacobianReuse is positive.
+	///	</summary>
+	std::vector< std::vector<ColumnBatchJacobian> > m_vecColumnBatchJacobian;
+#endif
 
 	///	<summary>
-	///		Pivot matrix used in direct solve.
+	///		Maximum number of implicit solves that use a factored column
+	///		Jacobian to refine the Newton step, or 0 to refactor on every
+	///		solve.
 	///	</summary>
-	DataArray1D<int> m_vecIPiv;
+	int m_nJacobianReuse;
 
 #ifdef USE_JACOBIAN_DIAGONAL
 private:
@@ -506,40 +506,40 @@ void VerticalDynamicsFLL::StepExplicit(
 		DataArray4D<double> & dataUpdateREdge =
 			pPatch->GetDataState(iDataUpdate, DataLocation_REdge);
 
-		DataArray4D<double> & dataReferenceTracer =
+		TracerArray4D & dataReferenceTracer =
 			pPatch->GetReferenceTracers();
 
-		DataArray4D<double> & dataInitialTracer =
+		TracerArray4D & dataInitialTracer =
 			pPatch->GetDataTracers(iDataInitial);
 
-		DataArray4D<double> & dataUpdateTracer =
+		TracerArray4D & dataUpdateTracer =
 			pPatch->GetDataTracers(iDataUpdate);
 
 		// Metric quantities
-		const DataArray4D<double> & dDerivRNode =
+		const MetricArray4D & dDerivRNode =
 			pPatch->GetDerivRNode();
 
-		const DataArray4D<double> & dContraMetricXi =
+		const MetricArray4D & dContraMetricXi =
 			pPatch->GetContraMetricXi();
 
-		const DataArray4D<double> & dDerivRREdge =
+		const MetricArray4D & dDerivRREdge =
 			pPatch->GetDerivRREdge();
 
-		const DataArray4D<double> & dContraMetricXiREdge =
+		const MetricArray4D & dContraMetricXiREdge =
 			pPatch->GetContraMetricXiREdge();
 
 #if defined(EXPLICIT_VERTICAL_VELOCITY_ADVECTION) && \
     defined(VERTICAL_VELOCITY_ADVECTION_CLARK)
-		const DataArray4D<double> & dContraMetricA =
+		const MetricArray4D & dContraMetricA =
 			pPatch->GetContraMetricA();
 
-		const DataArray4D<double> & dContraMetricB =
+		const MetricArray4D & dContraMetricB =
 			pPatch->GetContraMetricB();
 
-		const DataArray4D<double> & dContraMetricAREdge =
+		const MetricArray4D & dContraMetricAREdge =
 			pPatch->GetContraMetricAREdge();
 
-		const DataArray4D<double> & dContraMetricBREdge =
+		const MetricArray4D & dContraMetricBREdge =
 			pPatch->GetContraMetricBREdge();
 #endif
 
@@ -707,9 +707,9 @@ void VerticalDynamicsFLL::StepImplicit(
 		const PatchBox & box = pPatch->GetPatchBox();
 
 		// Contravariant metric components
-		const DataArray4D<double> & dContraMetricA =
+		const MetricArray4D & dContraMetricA =
 			pPatch->GetContraMetricA();
-		const DataArray4D<double> & dContraMetricB =
+		const MetricArray4D & dContraMetricB =
 			pPatch->GetContraMetricB();
 
 		// State Data
@@ -732,13 +732,13 @@ void VerticalDynamicsFLL::StepImplicit(
 			pPatch->GetDataState(iDataUpdate, DataLocation_REdge);
 
 		// Tracer Data
-		DataArray4D<double> & dataReferenceTracer =
+		TracerArray4D & dataReferenceTracer =
 			pPatch->GetReferenceTracers();
 
-		DataArray4D<double> & dataInitialTracer =
+		TracerArray4D & dataInitialTracer =
 			pPatch->GetDataTracers(iDataInitial);
 
-		DataArray4D<double> & dataUpdateTracer =
+		TracerArray4D & dataUpdateTracer =
 			pPatch->GetDataTracers(iDataUpdate);
 
 		// Number of tracers
@@ -1134,27 +1134,27 @@ void VerticalDynamicsFLL::SetupReferenceColumn(
 */
 /*
 	// Metric terms
-	const DataArray3D<double> & dJacobian =
+	const MetricArray3D & dJacobian =
 		m_pPatch->GetJacobian();
 	const DataArray3D<double> & dElementArea =
 		m_pPatch->GetElementArea();
-	const DataArray3D<double> & dJacobianREdge =
+	const MetricArray3D & dJacobianREdge =
 		m_pPatch->GetJacobianREdge();
-	const DataArray4D<double> & dDerivRNode =
+	const MetricArray4D & dDerivRNode =
 		m_pPatch->GetDerivRNode();
-	const DataArray4D<double> & dDerivRREdge =
+	const MetricArray4D & dDerivRREdge =
 		m_pPatch->GetDerivRREdge();
-	const DataArray4D<double> & dContraMetricA =
+	const MetricArray4D & dContraMetricA =
 		m_pPatch->GetContraMetricA();
-	const DataArray4D<double> & dContraMetricB =
+	const MetricArray4D & dContraMetricB =
 		m_pPatch->GetContraMetricB();
-	const DataArray4D<double> & dContraMetricXi =
+	const MetricArray4D & dContraMetricXi =
 		m_pPatch->GetContraMetricXi();
-	const DataArray4D<double> & dContraMetricAREdge =
+	const MetricArray4D & dContraMetricAREdge =
 		m_pPatch->GetContraMetricAREdge();
-	const DataArray4D<double> & dContraMetricBREdge =
+	const MetricArray4D & dContraMetricBREdge =
 		m_pPatch->GetContraMetricBREdge();
-	const DataArray4D<double> & dContraMetricXiREdge =
+	const MetricArray4D & dContraMetricXiREdge =
 		m_pPatch->GetContraMetricXiREdge();
 
 	for (int k = 0; k < pGrid->GetRElements(); k++) {
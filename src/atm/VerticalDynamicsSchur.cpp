@@ -529,40 +529,40 @@ void VerticalDynamicsSchur::StepImplicitTermsExplicitly(
 		DataArray4D<double> & dataUpdateREdge =
 			pPatch->GetDataState(iDataUpdate, DataLocation_REdge);
 
-		DataArray4D<double> & dataReferenceTracer =
+		TracerArray4D & dataReferenceTracer =
 			pPatch->GetReferenceTracers();
 
-		DataArray4D<double> & dataInitialTracer =
+		TracerArray4D & dataInitialTracer =
 			pPatch->GetDataTracers(iDataInitial);
 
-		DataArray4D<double> & dataUpdateTracer =
+		TracerArray4D & dataUpdateTracer =
 			pPatch->GetDataTracers(iDataUpdate);
 
 		// Metric quantities
-		const DataArray4D<double> & dDerivRNode =
+		const MetricArray4D & dDerivRNode =
 			pPatch->GetDerivRNode();
 
-		const DataArray4D<double> & dContraMetricXi =
+		const MetricArray4D & dContraMetricXi =
 			pPatch->GetContraMetricXi();
 
-		const DataArray4D<double> & dDerivRREdge =
+		const MetricArray4D & dDerivRREdge =
 			pPatch->GetDerivRREdge();
 
-		const DataArray4D<double> & dContraMetricXiREdge =
+		const MetricArray4D & dContraMetricXiREdge =
 			pPatch->GetContraMetricXiREdge();
 
 #if defined(EXPLICIT_VERTICAL_VELOCITY_ADVECTION) && \
     defined(VERTICAL_VELOCITY_ADVECTION_CLARK)
-		const DataArray4D<double> & dContraMetricA =
+		const MetricArray4D & dContraMetricA =
 			pPatch->GetContraMetricA();
 
-		const DataArray4D<double> & dContraMetricB =
+		const MetricArray4D & dContraMetricB =
 			pPatch->GetContraMetricB();
 
-		const DataArray4D<double> & dContraMetricAREdge =
+		const MetricArray4D & dContraMetricAREdge =
 			pPatch->GetContraMetricAREdge();
 
-		const DataArray4D<double> & dContraMetricBREdge =
+		const MetricArray4D & dContraMetricBREdge =
 			pPatch->GetContraMetricBREdge();
 #endif
 #if defined(EXPLICIT_VERTICAL_VELOCITY_ADVECTION)
@@ -719,40 +719,40 @@ void VerticalDynamicsSchur::StepExplicit(
 		DataArray4D<double> & dataUpdateREdge =
 			pPatch->GetDataState(iDataUpdate, DataLocation_REdge);
 
-		DataArray4D<double> & dataReferenceTracer =
+		TracerArray4D & dataReferenceTracer =
 			pPatch->GetReferenceTracers();
 
-		DataArray4D<double> & dataInitialTracer =
+		TracerArray4D & dataInitialTracer =
 			pPatch->GetDataTracers(iDataInitial);
 
-		DataArray4D<double> & dataUpdateTracer =
+		TracerArray4D & dataUpdateTracer =
 			pPatch->GetDataTracers(iDataUpdate);
 
 		// Metric quantities
-		const DataArray4D<double> & dDerivRNode =
+		const MetricArray4D & dDerivRNode =
 			pPatch->GetDerivRNode();
 
-		const DataArray4D<double> & dContraMetricXi =
+		const MetricArray4D & dContraMetricXi =
 			pPatch->GetContraMetricXi();
 
-		const DataArray4D<double> & dDerivRREdge =
+		const MetricArray4D & dDerivRREdge =
 			pPatch->GetDerivRREdge();
 
-		const DataArray4D<double> & dContraMetricXiREdge =
+		const MetricArray4D & dContraMetricXiREdge =
 			pPatch->GetContraMetricXiREdge();
 
 #if defined(EXPLICIT_VERTICAL_VELOCITY_ADVECTION) && \
     defined(VERTICAL_VELOCITY_ADVECTION_CLARK)
-		const DataArray4D<double> & dContraMetricA =
+		const MetricArray4D & dContraMetricA =
 			pPatch->GetContraMetricA();
 
-		const DataArray4D<double> & dContraMetricB =
+		const MetricArray4D & dContraMetricB =
 			pPatch->GetContraMetricB();
 
-		const DataArray4D<double> & dContraMetricAREdge =
+		const MetricArray4D & dContraMetricAREdge =
 			pPatch->GetContraMetricAREdge();
 
-		const DataArray4D<double> & dContraMetricBREdge =
+		const MetricArray4D & dContraMetricBREdge =
 			pPatch->GetContraMetricBREdge();
 #endif
 /*
@@ -957,8 +957,7 @@ void VerticalDynamicsSchur::StepExplicit(
 
 				// Stride through state matrix
 				int nVerticalStateStride =
-					dataInitialNode.GetSize(2)
-					* dataInitialNode.GetSize(3);
+					dataInitialNode.GetStride(1);
 
 				// Update vertical velocity on levels
 				if (pGrid->GetVarLocation(WIx) == DataLocation_Node) {
@@ -1045,8 +1044,7 @@ void VerticalDynamicsSchur::StepExplicit(
 			{
 				// Stride through state matrix
 				int nVerticalStateStride =
-					dataInitialNode.GetSize(2)
-					* dataInitialNode.GetSize(3);
+					dataInitialNode.GetStride(1);
 
 				// Update vertical velocity on levels
 				if (pGrid->GetVarLocation(WIx) == DataLocation_Node) {
@@ -1083,8 +1081,7 @@ void VerticalDynamicsSchur::StepExplicit(
 					pGrid->GetOpDiffNodeToNode();
 
 				int nUpwindStride =
-					dataInitialNode.GetSize(2)
-					* dataInitialNode.GetSize(3);
+					dataInitialNode.GetStride(1);
 
 				opDiffNodeToNode.Apply(
 					&(dataInitialNode[PIx][0][i][j]),
@@ -1115,8 +1112,7 @@ void VerticalDynamicsSchur::StepExplicit(
 					pGrid->GetOpPenaltyNodeToNode();
 
 				int nUpwindStride =
-					dataInitialNode.GetSize(2)
-					* dataInitialNode.GetSize(3);
+					dataInitialNode.GetStride(1);
 
 				// Apply upwinding to U and V
 				if (m_fUpwindVar[UIx]) {
@@ -1443,9 +1439,9 @@ void VerticalDynamicsSchur::StepImplicit(
 		const PatchBox & box = pPatch->GetPatchBox();
 
 		// Contravariant metric components
-		const DataArray4D<double> & dContraMetricA =
+		const MetricArray4D & dContraMetricA =
 			pPatch->GetContraMetricA();
-		const DataArray4D<double> & dContraMetricB =
+		const MetricArray4D & dContraMetricB =
 			pPatch->GetContraMetricB();
 
 		// State Data
@@ -1468,13 +1464,13 @@ void VerticalDynamicsSchur::StepImplicit(
 			pPatch->GetDataState(iDataUpdate, DataLocation_REdge);
 
 		// Tracer Data
-		DataArray4D<double> & dataReferenceTracer =
+		TracerArray4D & dataReferenceTracer =
 			pPatch->GetReferenceTracers();
 
-		DataArray4D<double> & dataInitialTracer =
+		TracerArray4D & dataInitialTracer =
 			pPatch->GetDataTracers(iDataInitial);
 
-		DataArray4D<double> & dataUpdateTracer =
+		TracerArray4D & dataUpdateTracer =
 			pPatch->GetDataTracers(iDataUpdate);
 
 		// Number of tracers
@@ -2107,27 +2103,27 @@ void VerticalDynamicsSchur::SetupReferenceColumn(
 	}
 
 	// Metric terms
-	const DataArray3D<double> & dJacobian =
+	const MetricArray3D & dJacobian =
 		m_pPatch->GetJacobian();
 	const DataArray3D<double> & dElementArea =
 		m_pPatch->GetElementArea();
-	const DataArray3D<double> & dJacobianREdge =
+	const MetricArray3D & dJacobianREdge =
 		m_pPatch->GetJacobianREdge();
-	const DataArray4D<double> & dDerivRNode =
+	const MetricArray4D & dDerivRNode =
 		m_pPatch->GetDerivRNode();
-	const DataArray4D<double> & dDerivRREdge =
+	const MetricArray4D & dDerivRREdge =
 		m_pPatch->GetDerivRREdge();
-	const DataArray4D<double> & dContraMetricA =
+	const MetricArray4D & dContraMetricA =
 		m_pPatch->GetContraMetricA();
-	const DataArray4D<double> & dContraMetricB =
+	const MetricArray4D & dContraMetricB =
 		m_pPatch->GetContraMetricB();
-	const DataArray4D<double> & dContraMetricXi =
+	const MetricArray4D & dContraMetricXi =
 		m_pPatch->GetContraMetricXi();
-	const DataArray4D<double> & dContraMetricAREdge =
+	const MetricArray4D & dContraMetricAREdge =
 		m_pPatch->GetContraMetricAREdge();
-	const DataArray4D<double> & dContraMetricBREdge =
+	const MetricArray4D & dContraMetricBREdge =
 		m_pPatch->GetContraMetricBREdge();
-	const DataArray4D<double> & dContraMetricXiREdge =
+	const MetricArray4D & dContraMetricXiREdge =
 		m_pPatch->GetContraMetricXiREdge();
 
 	for (int k = 0; k < pGrid->GetRElements(); k++) {
@@ -3588,9 +3584,9 @@ void VerticalDynamicsSchur::UpdateColumnTracers(
 	const DataArray4D<double> & dataUpdateNode,
 	const DataArray4D<double> & dataInitialREdge,
 	const DataArray4D<double> & dataUpdateREdge,
-	const DataArray4D<double> & dataRefTracer,
-	const DataArray4D<double> & dataInitialTracer,
-	DataArray4D<double> & dataUpdateTracer
+	const TracerArray4D & dataRefTracer,
+	const TracerArray4D & dataInitialTracer,
+	TracerArray4D & dataUpdateTracer
 ) {
 	// Indices of EquationSet variables
 	const int UIx = 0;
@@ -3678,19 +3674,19 @@ void VerticalDynamicsSchur::UpdateColumnTracers(
 		opPenaltyRight.GetIxEnd();
 
 	// Metric quantities
-	const DataArray4D<double> & dContraMetricXi =
+	const MetricArray4D & dContraMetricXi =
 		m_pPatch->GetContraMetricXi();
-	const DataArray4D<double> & dContraMetricXiREdge =
+	const MetricArray4D & dContraMetricXiREdge =
 		m_pPatch->GetContraMetricXiREdge();
 	const DataArray3D<double> & dElementArea =
 		m_pPatch->GetElementArea();
-	const DataArray3D<double> & dJacobianNode =
+	const MetricArray3D & dJacobianNode =
 		m_pPatch->GetJacobian();
-	const DataArray3D<double> & dJacobianREdge =
+	const MetricArray3D & dJacobianREdge =
 		m_pPatch->GetJacobianREdge();
-	const DataArray4D<double> & dDerivRNode =
+	const MetricArray4D & dDerivRNode =
 		m_pPatch->GetDerivRNode();
-	const DataArray4D<double> & dDerivRREdge =
+	const MetricArray4D & dDerivRREdge =
 		m_pPatch->GetDerivRREdge();
 
 	// Under this configuration, set fluxes at boundaries to zero
@@ -4113,7 +4109,7 @@ void VerticalDynamicsSchur::FilterNegativeTracers(
 		const DataArray3D<double> & dElementArea =
 			pPatch->GetElementArea();
 
-		DataArray4D<double> & dataUpdateTracer =
+		TracerArray4D & dataUpdateTracer =
 			pPatch->GetDataTracers(iDataUpdate);
 
 		// Number of tracers
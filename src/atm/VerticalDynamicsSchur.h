@@ -286,9 +286,9 @@ protected:
 		const DataArray4D<double> & dataUpdateNode,
 		const DataArray4D<double> & dataInitialREdge,
 		const DataArray4D<double> & dataUpdateREdge,
-		const DataArray4D<double> & dataRefTracer,
-		const DataArray4D<double> & dataInitialTracer,
-		DataArray4D<double> & dataUpdateTracer
+		const TracerArray4D & dataRefTracer,
+		const TracerArray4D & dataInitialTracer,
+		TracerArray4D & dataUpdateTracer
 	);
 
 public:
@@ -69,6 +69,14 @@ public:
 		const Time & time
 	);
 
+public:
+	///	<summary>
+	///		Finalizer.  Called after the timestep loop.
+	///	</summary>
+	virtual void Finalize(
+		const Time & time
+	) { }
+
 protected:
 	///	<summary>
 	///		Reference to the model.
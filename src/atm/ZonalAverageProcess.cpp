@@ -0,0 +1,517 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    ZonalAverageProcess.cpp
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "ZonalAverageProcess.h"
+
+#include "Model.h"
+#include "Grid.h"
+#include "GridPatch.h"
+#include "Announce.h"
+
+#include <mpi.h>
+
+#include <cmath>
+
+#ifdef TEMPEST_NETCDF
+#include <netcdfcpp.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Value written to bins which contain no nodes
+static const double ZonalAverageFillValue = 9.969209968386869e+36;
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		MPI reduction operator which combines the weighted moments of two
+///		sets of samples.  Each element is a triple of the sum of weights,
+///		the weighted mean and the weighted sum of squared deviations.
+///	</summary>
+static void ZonalAverageCombineMoments(
+	void * pIn,
+	void * pInOut,
+	int * pLength,
+	MPI_Datatype * pDatatype
+) {
+	const double * dIn = reinterpret_cast<const double *>(pIn);
+	double * dInOut = reinterpret_cast<double *>(pInOut);
+
+	for (int b = 0; b < (*pLength); b++) {
+		const double * dA = &(dIn[3 * b]);
+		double * dB = &(dInOut[3 * b]);
+
+		double dWeight = dA[0] + dB[0];
+		if (dWeight == 0.0) {
+			continue;
+		}
+
+		double dDelta = dA[1] - dB[1];
+
+		dB[2] += dA[2] + dDelta * dDelta * dA[0] * dB[0] / dWeight;
+		dB[1] += dDelta * dA[0] / dWeight;
+		dB[0] = dWeight;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+ZonalAverageProcess::ZonalAverageProcess(
+	Model & model,
+	const Time & timeSampleFrequency,
+	const Time & timeOutputFrequency,
+	const std::string & strOutputDir,
+	const std::string & strOutputPrefix,
+	const std::string & strVariables,
+	int nLatitudes,
+	bool fVariance
+) :
+	WorkflowProcess(
+		model,
+		timeSampleFrequency),
+	m_timeOutputFrequency(timeOutputFrequency),
+	m_strOutputDir(strOutputDir),
+	m_strOutputPrefix(strOutputPrefix),
+	m_nLatitudes(nLatitudes),
+	m_fVariance(fVariance),
+	m_nBins(0),
+	m_nSamples(0)
+{
+#ifndef TEMPEST_NETCDF
+	_EXCEPTIONT("Zonal averages require NetCDF support (NETCDF=TRUE)");
+#endif
+
+	if (timeSampleFrequency.IsZero()) {
+		_EXCEPTIONT("Sampling frequency of zonal averages must be nonzero");
+	}
+	if (nLatitudes < 1) {
+		_EXCEPTIONT("Number of latitudes of zonal averages must be positive");
+	}
+
+	const Grid * pGrid = model.GetGrid();
+	if (pGrid == NULL) {
+		_EXCEPTIONT("A grid must be specified before zonal averages");
+	}
+
+	const EquationSet & eqn = model.GetEquationSet();
+
+	// Parse the comma-separated list of variables
+	int iVarBegin = 0;
+	for (int iVarCurrent = 0; iVarCurrent <= strVariables.length(); iVarCurrent++) {
+		if ((iVarCurrent < strVariables.length()) &&
+			(strVariables[iVarCurrent] != ',') &&
+			(strVariables[iVarCurrent] != ' ')
+		) {
+			continue;
+		}
+		if (iVarCurrent == iVarBegin) {
+			iVarBegin++;
+			continue;
+		}
+
+		Field field;
+		field.strName =
+			strVariables.substr(iVarBegin, iVarCurrent - iVarBegin);
+		field.ix = (-1);
+		field.loc = DataLocation_Node;
+		field.nLevels = pGrid->GetRElements();
+
+		iVarBegin = iVarCurrent + 1;
+
+		// Derived fields
+		if (field.strName == "T") {
+			field.eType = FieldType_Temperature;
+
+		} else if (field.strName == "PS") {
+			field.eType = FieldType_SurfacePressure;
+			field.loc = DataLocation_None;
+			field.nLevels = 1;
+
+		// Components and tracers of the EquationSet
+		} else {
+			for (int c = 0; c < eqn.GetComponents(); c++) {
+				if (eqn.GetComponentShortName(c) == field.strName) {
+					field.eType = FieldType_Component;
+					field.ix = c;
+					field.loc = pGrid->GetVarLocation(c);
+					if (field.loc == DataLocation_REdge) {
+						field.nLevels = pGrid->GetRElements() + 1;
+					}
+					break;
+				}
+			}
+			if (field.ix == (-1)) {
+				for (int c = 0; c < eqn.GetTracers(); c++) {
+					if (eqn.GetTracerShortName(c) == field.strName) {
+						field.eType = FieldType_Tracer;
+						field.ix = c;
+						break;
+					}
+				}
+			}
+			if (field.ix == (-1)) {
+				_EXCEPTION1("Unknown zonal average variable \"%s\"",
+					field.strName.c_str());
+			}
+		}
+
+		field.iOffset = m_nBins;
+		m_nBins += field.nLevels * m_nLatitudes;
+
+		m_vecFields.push_back(field);
+	}
+
+	if (m_vecFields.size() == 0) {
+		_EXCEPTIONT("No variables specified for zonal averages");
+	}
+
+	// Weighted moments of each bin
+	m_vecMoments.resize(3 * m_nBins, 0.0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ZonalAverageProcess::Initialize(
+	const Time & timeStart
+) {
+	WorkflowProcess::Initialize(timeStart);
+
+	m_timeWindowBegin = timeStart;
+	m_timeNextOutput = timeStart;
+	m_timeNextOutput += m_timeOutputFrequency;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ZonalAverageProcess::Perform(
+	const Time & time
+) {
+	Sample();
+
+	// Write the averages at the end of the averaging window; with no
+	// output frequency the average is taken over the whole simulation
+	if (!m_timeOutputFrequency.IsZero() && (time >= m_timeNextOutput)) {
+		WriteAverage(time);
+
+		m_timeNextOutput += m_timeOutputFrequency;
+	}
+
+	// Call up the stack to update performance time
+	WorkflowProcess::Perform(time);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ZonalAverageProcess::Finalize(
+	const Time & time
+) {
+	if (m_nSamples != 0) {
+		WriteAverage(time);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ZonalAverageProcess::Sample() {
+
+	Grid * pGrid = m_model.GetGrid();
+
+	const EquationSet & eqn = m_model.GetEquationSet();
+
+	// Derived quantities are computed on all processors since their
+	// computation may require communication
+	bool fTemperature = false;
+	bool fSurfacePressure = false;
+	for (int f = 0; f < m_vecFields.size(); f++) {
+		if (m_vecFields[f].eType == FieldType_Temperature) {
+			fTemperature = true;
+		}
+		if (m_vecFields[f].eType == FieldType_SurfacePressure) {
+			fSurfacePressure = true;
+		}
+	}
+	if (fTemperature) {
+		pGrid->ComputeTemperature(0);
+	}
+	if (fSurfacePressure) {
+		pGrid->ComputeSurfacePressure(0);
+	}
+
+	// Horizontal velocities are converted to primitive components
+	bool fConvertVelocity =
+		(eqn.GetComponents() >= 2)
+		&& (pGrid->GetVarLocation(0) == pGrid->GetVarLocation(1));
+
+	const double dBinWidth = M_PI / static_cast<double>(m_nLatitudes);
+
+	const double dZtop = pGrid->GetZtop();
+
+	for (int n = 0; n < pGrid->GetActivePatchCount(); n++) {
+		const GridPatch * pPatch = pGrid->GetActivePatch(n);
+
+		const PatchBox & box = pPatch->GetPatchBox();
+
+		const DataArray2D<double> & dataLatitude = pPatch->GetLatitude();
+		const DataArray2D<double> & dataTopography = pPatch->GetTopography();
+
+		const DataArray3D<double> & dataArea = pPatch->GetElementArea();
+		const DataArray3D<double> & dataAreaREdge =
+			pPatch->GetElementAreaREdge();
+
+		for (int i = box.GetAInteriorBegin(); i < box.GetAInteriorEnd(); i++) {
+		for (int j = box.GetBInteriorBegin(); j < box.GetBInteriorEnd(); j++) {
+
+			// Latitude bin
+			int l = static_cast<int>(
+				floor((dataLatitude[i][j] + 0.5 * M_PI) / dBinWidth));
+
+			if (l < 0) {
+				l = 0;
+			}
+			if (l >= m_nLatitudes) {
+				l = m_nLatitudes - 1;
+			}
+
+			for (int f = 0; f < m_vecFields.size(); f++) {
+				const Field & field = m_vecFields[f];
+
+				const DataArray3D<double> & dataFieldArea =
+					(field.loc == DataLocation_REdge)?
+						(dataAreaREdge):(dataArea);
+
+				for (int k = 0; k < field.nLevels; k++) {
+
+					double dWeight;
+					double dValue;
+
+					if (field.eType == FieldType_Component) {
+						const DataArray4D<double> & dataState =
+							pPatch->GetDataState(0, field.loc);
+
+						dWeight = dataFieldArea[k][i][j];
+
+						if (fConvertVelocity && (field.ix < 2)) {
+							double dUa = dataState[0][k][i][j];
+							double dUb = dataState[1][k][i][j];
+
+							pPatch->ConvertToPrimitiveVelocity(i, j, dUa, dUb);
+
+							dValue = (field.ix == 0)?(dUa):(dUb);
+
+						} else {
+							dValue = dataState[field.ix][k][i][j];
+						}
+
+					} else if (field.eType == FieldType_Tracer) {
+						dWeight = dataFieldArea[k][i][j];
+						dValue = static_cast<double>(
+							pPatch->GetDataTracers(0)[field.ix][k][i][j]);
+
+					} else if (field.eType == FieldType_Temperature) {
+						dWeight = dataFieldArea[k][i][j];
+						dValue = pPatch->GetDataTemperature()[k][i][j];
+
+					} else {
+						// Horizontal area is the column volume divided
+						// by the column depth
+						dWeight = 0.0;
+						for (int m = 0; m < pGrid->GetRElements(); m++) {
+							dWeight += dataArea[m][i][j];
+						}
+						dWeight /= (dZtop - dataTopography[i][j]);
+
+						dValue = pPatch->GetDataSurfacePressure()[i][j];
+					}
+
+					// Update weighted moments (West, 1979)
+					double * dMoments =
+						&(m_vecMoments[3 * (
+							field.iOffset + k * m_nLatitudes + l)]);
+
+					dMoments[0] += dWeight;
+
+					double dDelta = dValue - dMoments[1];
+					double dUpdate = dWeight / dMoments[0] * dDelta;
+
+					dMoments[1] += dUpdate;
+					dMoments[2] += (dMoments[0] - dWeight) * dDelta * dUpdate;
+				}
+			}
+		}
+		}
+	}
+
+	m_nSamples++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ZonalAverageProcess::WriteAverage(
+	const Time & time
+) {
+	int nRank;
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+
+	// Reduce running moments on the root processor
+	std::vector<double> vecGlobalMoments(m_vecMoments.size());
+
+	MPI_Datatype typeMoments;
+	MPI_Type_contiguous(3, MPI_DOUBLE, &typeMoments);
+	MPI_Type_commit(&typeMoments);
+
+	MPI_Op opCombineMoments;
+	MPI_Op_create(&ZonalAverageCombineMoments, 1, &opCombineMoments);
+
+	MPI_Reduce(
+		&(m_vecMoments[0]),
+		&(vecGlobalMoments[0]),
+		m_nBins,
+		typeMoments,
+		opCombineMoments,
+		0,
+		MPI_COMM_WORLD);
+
+	MPI_Op_free(&opCombineMoments);
+	MPI_Type_free(&typeMoments);
+
+	Announce("Zonal average (%i samples): %s",
+		m_nSamples, time.ToString().c_str());
+
+#ifdef TEMPEST_NETCDF
+	if (nRank == 0) {
+		// Asynchronous output may be inside NetCDF on a background thread
+		m_model.FlushOutput();
+
+		const Grid * pGrid = m_model.GetGrid();
+
+		const int nRElements = pGrid->GetRElements();
+
+		std::string strNcFileName =
+			m_strOutputDir + "/" + m_strOutputPrefix
+			+ ".zonal." + time.ToShortString() + ".nc";
+
+		NcFile ncout(strNcFileName.c_str(), NcFile::Replace);
+		if (!ncout.is_valid()) {
+			_EXCEPTION1("Error opening NetCDF file \"%s\"",
+				strNcFileName.c_str());
+		}
+
+		// Averaging window
+		ncout.add_att("averaging_begin", m_timeWindowBegin.ToString().c_str());
+		ncout.add_att("averaging_end", time.ToString().c_str());
+		ncout.add_att("samples", m_nSamples);
+
+		// Latitude bin centers
+		NcDim * dimLat = ncout.add_dim("lat", m_nLatitudes);
+		NcVar * varLat = ncout.add_var("lat", ncDouble, dimLat);
+
+		std::vector<double> vecLat(m_nLatitudes);
+		for (int l = 0; l < m_nLatitudes; l++) {
+			vecLat[l] = -90.0
+				+ 180.0 * (static_cast<double>(l) + 0.5)
+				/ static_cast<double>(m_nLatitudes);
+		}
+		varLat->put(&(vecLat[0]), m_nLatitudes);
+		varLat->add_att("units", "degrees_north");
+
+		// Model levels and interfaces
+		NcDim * dimLev = ncout.add_dim("lev", nRElements);
+		NcVar * varLev = ncout.add_var("lev", ncDouble, dimLev);
+
+		NcDim * dimILev = ncout.add_dim("ilev", nRElements + 1);
+		NcVar * varILev = ncout.add_var("ilev", ncDouble, dimILev);
+
+		varLev->put(&(pGrid->GetREtaLevels()[0]), nRElements);
+		varILev->put(&(pGrid->GetREtaInterfaces()[0]), nRElements + 1);
+
+		// Means and variances of each field
+		for (int f = 0; f < m_vecFields.size(); f++) {
+			const Field & field = m_vecFields[f];
+
+			const int nFieldBins = field.nLevels * m_nLatitudes;
+
+			std::vector<double> vecMean(nFieldBins);
+			std::vector<double> vecVariance;
+			if (m_fVariance) {
+				vecVariance.resize(nFieldBins);
+			}
+
+			for (int b = 0; b < nFieldBins; b++) {
+				const double * dMoments =
+					&(vecGlobalMoments[3 * (field.iOffset + b)]);
+
+				if (dMoments[0] == 0.0) {
+					vecMean[b] = ZonalAverageFillValue;
+					if (m_fVariance) {
+						vecVariance[b] = ZonalAverageFillValue;
+					}
+					continue;
+				}
+
+				vecMean[b] = dMoments[1];
+				if (m_fVariance) {
+					vecVariance[b] = dMoments[2] / dMoments[0];
+				}
+			}
+
+			NcDim * dimFieldLev =
+				(field.loc == DataLocation_REdge)?(dimILev):(dimLev);
+
+			NcVar * varMean;
+			if (field.eType == FieldType_SurfacePressure) {
+				varMean = ncout.add_var(
+					field.strName.c_str(), ncDouble, dimLat);
+				varMean->put(&(vecMean[0]), m_nLatitudes);
+
+			} else {
+				varMean = ncout.add_var(
+					field.strName.c_str(), ncDouble, dimFieldLev, dimLat);
+				varMean->put(&(vecMean[0]), field.nLevels, m_nLatitudes);
+			}
+			varMean->add_att("_FillValue", ZonalAverageFillValue);
+
+			if (m_fVariance) {
+				std::string strVarName = field.strName + "_var";
+
+				NcVar * varVariance;
+				if (field.eType == FieldType_SurfacePressure) {
+					varVariance = ncout.add_var(
+						strVarName.c_str(), ncDouble, dimLat);
+					varVariance->put(&(vecVariance[0]), m_nLatitudes);
+
+				} else {
+					varVariance = ncout.add_var(
+						strVarName.c_str(), ncDouble, dimFieldLev, dimLat);
+					varVariance->put(
+						&(vecVariance[0]), field.nLevels, m_nLatitudes);
+				}
+				varVariance->add_att("_FillValue", ZonalAverageFillValue);
+			}
+		}
+	}
+#endif
+
+	// Begin a new averaging window
+	for (int b = 0; b < m_vecMoments.size(); b++) {
+		m_vecMoments[b] = 0.0;
+	}
+
+	m_nSamples = 0;
+	m_timeWindowBegin = time;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
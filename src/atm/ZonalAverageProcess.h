@@ -0,0 +1,177 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    ZonalAverageProcess.h
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _ZONALAVERAGEPROCESS_H_
+#define _ZONALAVERAGEPROCESS_H_
+
+#include "WorkflowProcess.h"
+#include "DataLocation.h"
+
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		In-situ zonal and temporal average of model fields.  Each time the
+///		process is performed the selected fields are binned in latitude on
+///		the model levels of the active patches, weighted by the nodal
+///		element area.  Running moments are only reduced across processors
+///		at the end of each averaging window, when the zonal-temporal mean
+///		(and optionally the variance) is written to a latitude-level NetCDF
+///		file.
+///	</summary>
+class ZonalAverageProcess : public WorkflowProcess {
+
+public:
+	///	<summary>
+	///		Type of field which is averaged.
+	///	</summary>
+	enum FieldType {
+		FieldType_Component,
+		FieldType_Tracer,
+		FieldType_Temperature,
+		FieldType_SurfacePressure
+	};
+
+	///	<summary>
+	///		Description of a field which is averaged.
+	///	</summary>
+	struct Field {
+		std::string strName;
+		FieldType eType;
+		int ix;
+		DataLocation loc;
+		int nLevels;
+		int iOffset;
+	};
+
+public:
+	///	<summary>
+	///		Constructor.  strVariables is a comma-separated list of component
+	///		or tracer short names, or the derived fields "T" and "PS".
+	///	</summary>
+	ZonalAverageProcess(
+		Model & model,
+		const Time & timeSampleFrequency,
+		const Time & timeOutputFrequency,
+		const std::string & strOutputDir,
+		const std::string & strOutputPrefix,
+		const std::string & strVariables,
+		int nLatitudes,
+		bool fVariance
+	);
+
+public:
+	///	<summary>
+	///		Initializer.  Called prior to timestep loop.
+	///	</summary>
+	virtual void Initialize(
+		const Time & timeStart
+	);
+
+	///	<summary>
+	///		Add the current state to the running moments and write the
+	///		averages at the end of each averaging window.
+	///	</summary>
+	virtual void Perform(
+		const Time & time
+	);
+
+	///	<summary>
+	///		Write the averages of an incomplete averaging window.
+	///	</summary>
+	virtual void Finalize(
+		const Time & time
+	);
+
+protected:
+	///	<summary>
+	///		Add the current state to the running moments.
+	///	</summary>
+	void Sample();
+
+	///	<summary>
+	///		Reduce the running moments, write the averages and begin a new
+	///		averaging window.
+	///	</summary>
+	void WriteAverage(
+		const Time & time
+	);
+
+protected:
+	///	<summary>
+	///		Frequency of output of the averages.
+	///	</summary>
+	Time m_timeOutputFrequency;
+
+	///	<summary>
+	///		Time when the next output is required.
+	///	</summary>
+	Time m_timeNextOutput;
+
+	///	<summary>
+	///		Beginning of the current averaging window.
+	///	</summary>
+	Time m_timeWindowBegin;
+
+	///	<summary>
+	///		Output directory.
+	///	</summary>
+	std::string m_strOutputDir;
+
+	///	<summary>
+	///		Output file prefix.
+	///	</summary>
+	std::string m_strOutputPrefix;
+
+	///	<summary>
+	///		Number of latitude bins.
+	///	</summary>
+	int m_nLatitudes;
+
+	///	<summary>
+	///		Flag indicating the variance should be computed.
+	///	</summary>
+	bool m_fVariance;
+
+	///	<summary>
+	///		Fields which are averaged.
+	///	</summary>
+	std::vector<Field> m_vecFields;
+
+	///	<summary>
+	///		Number of (level, latitude) bins over all fields.
+	///	</summary>
+	int m_nBins;
+
+	///	<summary>
+	///		Number of samples in the current averaging window.
+	///	</summary>
+	int m_nSamples;
+
+	///	<summary>
+	///		Weighted moments of each bin, stored as consecutive triples
+	///		of the sum of weights, the weighted mean and the weighted sum
+	///		of squared deviations from the mean.
+	///	</summary>
+	std::vector<double> m_vecMoments;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
@@ -0,0 +1,146 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    AsyncTaskQueue.cpp
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "AsyncTaskQueue.h"
+#include "Exception.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+AsyncTaskQueue::AsyncTaskQueue(
+	int nMaxPending
+) :
+	m_nMaxPending(nMaxPending),
+	m_nPending(0),
+	m_nStalls(0),
+	m_fShutdown(false)
+{
+	if (nMaxPending < 1) {
+		_EXCEPTION1("Invalid queue depth (%i)", nMaxPending);
+	}
+
+	m_thread = std::thread(&AsyncTaskQueue::Run, this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+AsyncTaskQueue::~AsyncTaskQueue() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_fShutdown = true;
+	}
+	m_cvTaskAdded.notify_one();
+
+	m_thread.join();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AsyncTaskQueue::RethrowLocked(
+	std::unique_lock<std::mutex> & lock
+) {
+	if (m_pException) {
+		std::exception_ptr pException = m_pException;
+		m_pException = std::exception_ptr();
+		lock.unlock();
+		std::rethrow_exception(pException);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AsyncTaskQueue::Push(
+	const Task & task
+) {
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	RethrowLocked(lock);
+
+	// Wait for space in the queue
+	if (m_nPending >= m_nMaxPending) {
+		m_nStalls++;
+		m_cvTaskDone.wait(lock, [this] {
+			return (m_nPending < m_nMaxPending);
+		});
+		RethrowLocked(lock);
+	}
+
+	m_deqTasks.push_back(task);
+	m_nPending++;
+
+	lock.unlock();
+	m_cvTaskAdded.notify_one();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AsyncTaskQueue::Flush() {
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	m_cvTaskDone.wait(lock, [this] {
+		return (m_nPending == 0);
+	});
+
+	RethrowLocked(lock);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int AsyncTaskQueue::GetStallCount() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_nStalls;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AsyncTaskQueue::Run() {
+	for (;;) {
+		Task task;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_cvTaskAdded.wait(lock, [this] {
+				return (m_fShutdown || (m_deqTasks.size() != 0));
+			});
+
+			if (m_deqTasks.size() == 0) {
+				return;
+			}
+
+			task = m_deqTasks.front();
+			m_deqTasks.pop_front();
+		}
+
+		// Execute the task; later tasks still run after an exception so
+		// that files are closed
+		try {
+			task();
+
+		} catch(...) {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (!m_pException) {
+				m_pException = std::current_exception();
+			}
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_nPending--;
+		}
+		m_cvTaskDone.notify_all();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,147 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    AsyncTaskQueue.h
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _ASYNCTASKQUEUE_H_
+#define _ASYNCTASKQUEUE_H_
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A bounded first-in first-out queue of tasks executed in order by a
+///		single background thread.  Push() blocks while the queue is full so
+///		that a producer which outpaces the background thread is held back
+///		rather than accumulating unbounded work.  Tasks must not make MPI
+///		calls, since MPI is initialized with MPI_THREAD_FUNNELED.
+///	</summary>
+class AsyncTaskQueue {
+
+public:
+	///	<summary>
+	///		Type of the work performed by a task.
+	///	</summary>
+	typedef std::function<void()> Task;
+
+public:
+	///	<summary>
+	///		Constructor.  At most nMaxPending tasks may be queued or
+	///		executing at any time.
+	///	</summary>
+	AsyncTaskQueue(int nMaxPending);
+
+	///	<summary>
+	///		Destructor.  Completes all queued tasks.
+	///	</summary>
+	~AsyncTaskQueue();
+
+public:
+	///	<summary>
+	///		Add a task to the queue, waiting for space if the queue is full.
+	///		If a previous task threw an exception it is rethrown here.
+	///	</summary>
+	void Push(const Task & task);
+
+	///	<summary>
+	///		Wait for all queued tasks to complete.  If a task threw an
+	///		exception it is rethrown here.
+	///	</summary>
+	void Flush();
+
+	///	<summary>
+	///		Get the maximum number of pending tasks.
+	///	</summary>
+	int GetMaxPending() const {
+		return m_nMaxPending;
+	}
+
+	///	<summary>
+	///		Get the number of times Push() waited for space in the queue.
+	///	</summary>
+	int GetStallCount() const;
+
+private:
+	///	<summary>
+	///		Body of the background thread.
+	///	</summary>
+	void Run();
+
+	///	<summary>
+	///		Rethrow the stored exception, if any.  The mutex must be held.
+	///	</summary>
+	void RethrowLocked(std::unique_lock<std::mutex> & lock);
+
+private:
+	///	<summary>
+	///		Maximum number of pending tasks.
+	///	</summary>
+	int m_nMaxPending;
+
+	///	<summary>
+	///		Mutex guarding the queue.
+	///	</summary>
+	mutable std::mutex m_mutex;
+
+	///	<summary>
+	///		Signalled when a task is added or the queue is shut down.
+	///	</summary>
+	std::condition_variable m_cvTaskAdded;
+
+	///	<summary>
+	///		Signalled when a task completes.
+	///	</summary>
+	std::condition_variable m_cvTaskDone;
+
+	///	<summary>
+	///		Queued tasks.
+	///	</summary>
+	std::deque<Task> m_deqTasks;
+
+	///	<summary>
+	///		Number of tasks queued or executing.
+	///	</summary>
+	int m_nPending;
+
+	///	<summary>
+	///		Number of times Push() waited for space in the queue.
+	///	</summary>
+	int m_nStalls;
+
+	///	<summary>
+	///		Flag indicating the background thread should exit.
+	///	</summary>
+	bool m_fShutdown;
+
+	///	<summary>
+	///		First exception thrown by a task and not yet rethrown.
+	///	</summary>
+	std::exception_ptr m_pException;
+
+	///	<summary>
+	///		Background thread.
+	///	</summary>
+	std::thread m_thread;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
@@ -0,0 +1,301 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    BatchedBandedLU.cpp
+///	\author  Paul Ullrich
+///	\version October 15, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "BatchedBandedLU.h"
+#include "Exception.h"
+
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////////
+
+BatchedBandedLU::BatchedBandedLU() :
+	m_nN(0),
+	m_nKL(0),
+	m_nKU(0),
+	m_nLDAB(0)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////
+
+void BatchedBandedLU::Initialize(
+	int nN,
+	int nKL,
+	int nKU
+) {
+	if ((nN < 1) || (nKL < 0) || (nKU < 0)) {
+		_EXCEPTION3("Invalid banded system (N = %i, KL = %i, KU = %i)",
+			nN, nKL, nKU);
+	}
+
+	m_nN = nN;
+	m_nKL = nKL;
+	m_nKU = nKU;
+	m_nLDAB = 2 * nKL + nKU + 1;
+
+	m_dAB.Allocate(m_nN * m_nLDAB * Lanes);
+	m_dB.Allocate(m_nN * Lanes);
+	m_iPiv.Allocate(m_nN * Lanes);
+	m_iInfo.Allocate(Lanes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void BatchedBandedLU::SetMatrix(
+	int iLane,
+	const double * dAB
+) {
+	double * dBatchAB = m_dAB;
+
+	for (int j = 0; j < m_nN; j++) {
+		const double * dCol = dAB + j * m_nLDAB;
+		double * dBatchCol = dBatchAB + j * m_nLDAB * Lanes + iLane;
+
+		// Rows reserved for fill-in
+		for (int r = 0; r < m_nKL; r++) {
+			dBatchCol[r * Lanes] = 0.0;
+		}
+		for (int r = m_nKL; r < m_nLDAB; r++) {
+			dBatchCol[r * Lanes] = dCol[r];
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void BatchedBandedLU::SetIdentity(
+	int iLane
+) {
+	double * dBatchAB = m_dAB;
+
+	const int kv = m_nKL + m_nKU;
+
+	for (int j = 0; j < m_nN; j++) {
+		double * dBatchCol = dBatchAB + j * m_nLDAB * Lanes + iLane;
+		for (int r = 0; r < m_nLDAB; r++) {
+			dBatchCol[r * Lanes] = 0.0;
+		}
+		dBatchCol[kv * Lanes] = 1.0;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void BatchedBandedLU::SetRHS(
+	int iLane,
+	const double * dB
+) {
+	double * dBatchB = m_dB;
+	for (int i = 0; i < m_nN; i++) {
+		dBatchB[i * Lanes + iLane] = dB[i];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void BatchedBandedLU::GetSolution(
+	int iLane,
+	double * dX
+) const {
+	const double * dBatchB = m_dB;
+	for (int i = 0; i < m_nN; i++) {
+		dX[i] = dBatchB[i * Lanes + iLane];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int BatchedBandedLU::Factor() {
+
+	// Follows the unblocked LAPACK algorithm (dgbtf2), with the elimination
+	// in each column applied to all lanes together
+	double * dAB = m_dAB;
+	int * iPiv = m_iPiv;
+
+	const int kv = m_nKU + m_nKL;
+	const int nColStride = m_nLDAB * Lanes;
+
+	// Index of the last column affected by pivoting in each lane
+	int iJU[Lanes];
+
+	double dRecip[Lanes];
+
+	for (int w = 0; w < Lanes; w++) {
+		m_iInfo[w] = 0;
+		iJU[w] = 0;
+	}
+
+	for (int j = 0; j < m_nN; j++) {
+
+		// Number of subdiagonal elements in this column
+		const int km = (m_nKL < m_nN - 1 - j)?(m_nKL):(m_nN - 1 - j);
+
+		double * dColJ = dAB + j * nColStride;
+
+		int iJUMax = j;
+
+		for (int w = 0; w < Lanes; w++) {
+
+			// Find the pivot (first entry of largest magnitude)
+			int jp = 0;
+			double dMax = fabs(dColJ[kv * Lanes + w]);
+			for (int r = 1; r <= km; r++) {
+				double dAbs = fabs(dColJ[(kv + r) * Lanes + w]);
+				if (dAbs > dMax) {
+					dMax = dAbs;
+					jp = r;
+				}
+			}
+
+			iPiv[j * Lanes + w] = j + jp;
+
+			// Singular lane; skip the elimination in this column
+			if (dColJ[(kv + jp) * Lanes + w] == 0.0) {
+				if (m_iInfo[w] == 0) {
+					m_iInfo[w] = j + 1;
+				}
+				dRecip[w] = 0.0;
+				continue;
+			}
+
+			int iJUNew = j + m_nKU + jp;
+			if (iJUNew > m_nN - 1) {
+				iJUNew = m_nN - 1;
+			}
+			if (iJUNew > iJU[w]) {
+				iJU[w] = iJUNew;
+			}
+
+			// Swap rows j and j + jp in columns j through JU
+			if (jp != 0) {
+				for (int c = j; c <= iJU[w]; c++) {
+					double * dColC = dAB + c * nColStride;
+					const int d = c - j;
+					double dTemp = dColC[(kv + jp - d) * Lanes + w];
+					dColC[(kv + jp - d) * Lanes + w] =
+						dColC[(kv - d) * Lanes + w];
+					dColC[(kv - d) * Lanes + w] = dTemp;
+				}
+			}
+
+			dRecip[w] = 1.0 / dColJ[kv * Lanes + w];
+		}
+
+		for (int w = 0; w < Lanes; w++) {
+			if (iJU[w] > iJUMax) {
+				iJUMax = iJU[w];
+			}
+		}
+
+		if (km == 0) {
+			continue;
+		}
+
+		// Compute multipliers
+		for (int r = 1; r <= km; r++) {
+			double * dL = dColJ + (kv + r) * Lanes;
+			for (int w = 0; w < Lanes; w++) {
+				dL[w] *= dRecip[w];
+			}
+		}
+
+		// Rank-one update of the trailing band; entries of the pivot row
+		// beyond the JU of an individual lane are zero
+		for (int c = j + 1; c <= iJUMax; c++) {
+			double * dColC = dAB + c * nColStride;
+			const int d = c - j;
+
+			double dU[Lanes];
+			for (int w = 0; w < Lanes; w++) {
+				dU[w] = dColC[(kv - d) * Lanes + w];
+			}
+
+			const double * dL = dColJ + (kv + 1) * Lanes;
+			double * dA = dColC + (kv + 1 - d) * Lanes;
+			for (int r = 0; r < km; r++) {
+				for (int w = 0; w < Lanes; w++) {
+					dA[r * Lanes + w] -= dL[r * Lanes + w] * dU[w];
+				}
+			}
+		}
+	}
+
+	for (int w = 0; w < Lanes; w++) {
+		if (m_iInfo[w] != 0) {
+			return m_iInfo[w];
+		}
+	}
+	return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void BatchedBandedLU::Solve() {
+
+	// Follows LAPACK dgbtrs (no transpose)
+	const double * dAB = m_dAB;
+	const int * iPiv = m_iPiv;
+	double * dB = m_dB;
+
+	const int kv = m_nKU + m_nKL;
+	const int nColStride = m_nLDAB * Lanes;
+
+	// Apply row interchanges and solve L * X = B
+	for (int j = 0; j < m_nN - 1; j++) {
+		const int lm = (m_nKL < m_nN - 1 - j)?(m_nKL):(m_nN - 1 - j);
+
+		for (int w = 0; w < Lanes; w++) {
+			const int l = iPiv[j * Lanes + w];
+			if (l != j) {
+				double dTemp = dB[l * Lanes + w];
+				dB[l * Lanes + w] = dB[j * Lanes + w];
+				dB[j * Lanes + w] = dTemp;
+			}
+		}
+
+		const double * dColJ = dAB + j * nColStride;
+		const double * dBJ = dB + j * Lanes;
+		for (int r = 1; r <= lm; r++) {
+			const double * dL = dColJ + (kv + r) * Lanes;
+			double * dBR = dB + (j + r) * Lanes;
+			for (int w = 0; w < Lanes; w++) {
+				dBR[w] -= dL[w] * dBJ[w];
+			}
+		}
+	}
+
+	// Solve U * X = B, where U has KL + KU superdiagonals
+	for (int j = m_nN - 1; j >= 0; j--) {
+		const double * dColJ = dAB + j * nColStride;
+		double * dBJ = dB + j * Lanes;
+
+		const double * dDiag = dColJ + kv * Lanes;
+		for (int w = 0; w < Lanes; w++) {
+			dBJ[w] /= dDiag[w];
+		}
+
+		const int iBegin = (j - kv > 0)?(j - kv):(0);
+		for (int i = j - 1; i >= iBegin; i--) {
+			const double * dU = dColJ + (kv + i - j) * Lanes;
+			double * dBI = dB + i * Lanes;
+			for (int w = 0; w < Lanes; w++) {
+				dBI[w] -= dBJ[w] * dU[w];
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    BatchedBandedLU.h
+///	\author  Paul Ullrich
+///	\version October 15, 2026
+///
+///	<summary>
+///		This file provides a banded LU factorization and solve that operates
+///		on a batch of independent systems of identical size and bandwidth.
+///		Systems are interleaved in memory so that each step of the
+///		elimination is performed across all systems in the batch at once.
+///	</summary>
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _BATCHEDBANDEDLU_H_
+#define _BATCHEDBANDEDLU_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include "DataArray1D.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Number of systems in each batch.  This should be a multiple of the
+///		number of doubles in a SIMD register on the target architecture.
+///	</summary>
+#ifndef TEMPEST_BATCHED_LU_LANES
+#define TEMPEST_BATCHED_LU_LANES 4
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A batch of general banded linear systems, factored and solved
+///		together.  Matrices are provided in LAPACK band storage (as used by
+///		LAPACK::DGBSV and LAPACK::DGBTRF) and the factorization uses the
+///		same partial pivoting strategy as DGBTRF, so that each lane produces
+///		the same LU decomposition as an individual LAPACK call.
+///	</summary>
+class BatchedBandedLU {
+
+public:
+	///	<summary>
+	///		Number of systems in each batch.
+	///	</summary>
+	static const int Lanes = TEMPEST_BATCHED_LU_LANES;
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	BatchedBandedLU();
+
+	///	<summary>
+	///		Allocate storage for systems of size nN with nKL subdiagonals
+	///		and nKU superdiagonals.
+	///	</summary>
+	void Initialize(
+		int nN,
+		int nKL,
+		int nKU
+	);
+
+	///	<summary>
+	///		Get the order of each system.
+	///	</summary>
+	int GetSize() const {
+		return m_nN;
+	}
+
+	///	<summary>
+	///		Get the leading dimension of matrices in LAPACK band storage
+	///		(2 * KL + KU + 1).
+	///	</summary>
+	int GetLeadingDimension() const {
+		return m_nLDAB;
+	}
+
+public:
+	///	<summary>
+	///		Set the matrix in the given lane.  The matrix dAB is stored in
+	///		LAPACK band storage with leading dimension GetLeadingDimension();
+	///		the first KL entries of each column are used for fill-in and
+	///		need not be set.
+	///	</summary>
+	void SetMatrix(
+		int iLane,
+		const double * dAB
+	);
+
+	///	<summary>
+	///		Set the matrix in the given lane to the identity.  Used to
+	///		pad a partially filled batch.
+	///	</summary>
+	void SetIdentity(
+		int iLane
+	);
+
+	///	<summary>
+	///		Set the right-hand side in the given lane.
+	///	</summary>
+	void SetRHS(
+		int iLane,
+		const double * dB
+	);
+
+	///	<summary>
+	///		Get the solution in the given lane.
+	///	</summary>
+	void GetSolution(
+		int iLane,
+		double * dX
+	) const;
+
+public:
+	///	<summary>
+	///		Compute the LU decomposition of all matrices in the batch.
+	///		Returns 0 on success, or the LAPACK info code of the first
+	///		lane with an exactly singular factor.
+	///	</summary>
+	int Factor();
+
+	///	<summary>
+	///		Solve all systems in the batch using the LU decomposition from
+	///		Factor(), overwriting the right-hand side with the solution.
+	///	</summary>
+	void Solve();
+
+	///	<summary>
+	///		Get the LAPACK info code of the factorization in the given lane.
+	///	</summary>
+	int GetInfo(int iLane) const {
+		return m_iInfo[iLane];
+	}
+
+private:
+	///	<summary>
+	///		Order of each system.
+	///	</summary>
+	int m_nN;
+
+	///	<summary>
+	///		Number of subdiagonals.
+	///	</summary>
+	int m_nKL;
+
+	///	<summary>
+	///		Number of superdiagonals.
+	///	</summary>
+	int m_nKU;
+
+	///	<summary>
+	///		Leading dimension of the band storage.
+	///	</summary>
+	int m_nLDAB;
+
+	///	<summary>
+	///		Interleaved band storage, indexed as
+	///		[(column * LDAB + band row) * Lanes + lane].
+	///	</summary>
+	DataArray1D<double> m_dAB;
+
+	///	<summary>
+	///		Interleaved right-hand side / solution, indexed as
+	///		[row * Lanes + lane].
+	///	</summary>
+	DataArray1D<double> m_dB;
+
+	///	<summary>
+	///		Interleaved pivot indices, indexed as [row * Lanes + lane].
+	///	</summary>
+	DataArray1D<int> m_iPiv;
+
+	///	<summary>
+	///		LAPACK info code for each lane.
+	///	</summary>
+	DataArray1D<int> m_iInfo;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
@@ -0,0 +1,233 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    DataAllocator.cpp
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "DataAllocator.h"
+#include "Announce.h"
+#include "Exception.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include <sys/mman.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+void DataAllocator::ReportStatistics() const {
+	DataAllocatorStatistics stats = GetStatistics();
+
+	const double dMiB = 1024.0 * 1024.0;
+
+	Announce("Data allocator: %lu allocations, %lu reuses, %lu frees",
+		static_cast<unsigned long>(stats.nAllocations),
+		static_cast<unsigned long>(stats.nReuses),
+		static_cast<unsigned long>(stats.nFrees));
+	Announce("Data allocator: %1.2f MiB in use, %1.2f MiB peak,"
+		" %1.2f MiB cached",
+		static_cast<double>(stats.sBytesInUse) / dMiB,
+		static_cast<double>(stats.sPeakBytesInUse) / dMiB,
+		static_cast<double>(stats.sBytesCached) / dMiB);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// DataArenaAllocator
+///////////////////////////////////////////////////////////////////////////////
+
+DataArenaAllocator::DataArenaAllocator() :
+	m_fHugePages(false)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////
+
+DataArenaAllocator::~DataArenaAllocator() {
+	ReleaseCache();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void DataArenaAllocator::ReleaseCache() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	std::multimap<size_t, unsigned char *>::iterator iter =
+		m_mapCache.begin();
+	for (; iter != m_mapCache.end(); iter++) {
+		free(iter->second);
+	}
+
+	m_mapCache.clear();
+	m_stats.sBytesCached = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+unsigned char * DataArenaAllocator::Allocate(size_t sByteSize) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	unsigned char * pData = NULL;
+
+	// Reuse a cached block of the same size
+	std::multimap<size_t, unsigned char *>::iterator iter =
+		m_mapCache.find(sByteSize);
+
+	if (iter != m_mapCache.end()) {
+		pData = iter->second;
+		m_mapCache.erase(iter);
+
+		m_stats.nReuses++;
+		m_stats.sBytesCached -= sByteSize;
+
+	// Obtain a new block from the system
+	} else {
+		bool fHugePages = (m_fHugePages && (sByteSize >= HugePageSize));
+
+		size_t sAlignment = (fHugePages)?(HugePageSize):(ChunkAlignment);
+
+		void * pMemory = NULL;
+		if (posix_memalign(&pMemory, sAlignment, sByteSize) != 0) {
+			_EXCEPTION1("Out of memory (requested %lu bytes)",
+				static_cast<unsigned long>(sByteSize));
+		}
+		pData = reinterpret_cast<unsigned char *>(pMemory);
+
+#ifdef MADV_HUGEPAGE
+		if (fHugePages) {
+			madvise(pMemory, sByteSize, MADV_HUGEPAGE);
+		}
+#endif
+
+		m_stats.nAllocations++;
+	}
+
+	m_stats.sBytesInUse += sByteSize;
+	if (m_stats.sBytesInUse > m_stats.sPeakBytesInUse) {
+		m_stats.sPeakBytesInUse = m_stats.sBytesInUse;
+	}
+
+	return pData;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void DataArenaAllocator::Free(
+	unsigned char * pData,
+	size_t sByteSize
+) {
+	if (pData == NULL) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_stats.nFrees++;
+	m_stats.sBytesInUse -= sByteSize;
+
+	// Large blocks are returned to the system so that they are placed
+	// again on first touch, and the cache is bounded in size
+	if ((sByteSize > MaximumCachedBlockSize) ||
+	    (m_stats.sBytesCached + sByteSize > MaximumCachedByteSize)
+	) {
+		free(pData);
+		return;
+	}
+
+	m_mapCache.insert(
+		std::pair<size_t, unsigned char *>(sByteSize, pData));
+
+	m_stats.sBytesCached += sByteSize;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+DataAllocatorStatistics DataArenaAllocator::GetStatistics() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_stats;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// Global allocator
+///////////////////////////////////////////////////////////////////////////////
+
+static DataAllocator * s_pDataAllocator = NULL;
+
+///////////////////////////////////////////////////////////////////////////////
+
+DataArenaAllocator & GetDefaultDataAllocator() {
+	static DataArenaAllocator s_allocDefault;
+	return s_allocDefault;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+DataAllocator & GetDataAllocator() {
+	if (s_pDataAllocator == NULL) {
+		return GetDefaultDataAllocator();
+	}
+	return (*s_pDataAllocator);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void SetDataAllocator(DataAllocator * pAllocator) {
+	s_pDataAllocator = pAllocator;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// First-touch initialization
+///////////////////////////////////////////////////////////////////////////////
+
+void FirstTouchZero(
+	unsigned char * pData,
+	size_t sByteSize
+) {
+#ifdef _OPENMP
+	// Blocks smaller than this are not worth a parallel region
+	static const size_t MinimumParallelByteSize = 1024 * 1024;
+
+	// Pieces are split on page boundaries
+	static const size_t PageSize = 4096;
+
+	int nThreads = omp_get_max_threads();
+
+	if ((nThreads > 1) &&
+	    (sByteSize >= MinimumParallelByteSize) &&
+	    (!omp_in_parallel())
+	) {
+		size_t sPages = (sByteSize + PageSize - 1) / PageSize;
+
+		// One contiguous piece per thread
+#pragma omp parallel for schedule(static)
+		for (int t = 0; t < nThreads; t++) {
+			size_t sBegin = PageSize * ((sPages * t) / nThreads);
+			size_t sEnd = PageSize * ((sPages * (t+1)) / nThreads);
+			if (sEnd > sByteSize) {
+				sEnd = sByteSize;
+			}
+			if (sBegin < sEnd) {
+				memset(pData + sBegin, 0, sEnd - sBegin);
+			}
+		}
+		return;
+	}
+#endif
+
+	memset(pData, 0, sByteSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,250 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    DataAllocator.h
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _DATAALLOCATOR_H_
+#define _DATAALLOCATOR_H_
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Statistics gathered by a DataAllocator.
+///	</summary>
+struct DataAllocatorStatistics {
+
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	DataAllocatorStatistics() :
+		nAllocations(0),
+		nReuses(0),
+		nFrees(0),
+		sBytesInUse(0),
+		sPeakBytesInUse(0),
+		sBytesCached(0)
+	{ }
+
+	///	<summary>
+	///		Number of blocks obtained from the system.
+	///	</summary>
+	size_t nAllocations;
+
+	///	<summary>
+	///		Number of blocks handed out from the cache.
+	///	</summary>
+	size_t nReuses;
+
+	///	<summary>
+	///		Number of blocks returned to the allocator.
+	///	</summary>
+	size_t nFrees;
+
+	///	<summary>
+	///		Bytes currently handed out.
+	///	</summary>
+	size_t sBytesInUse;
+
+	///	<summary>
+	///		Maximum of sBytesInUse over the lifetime of the allocator.
+	///	</summary>
+	size_t sPeakBytesInUse;
+
+	///	<summary>
+	///		Bytes held in the cache awaiting reuse.
+	///	</summary>
+	size_t sBytesCached;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Interface for the allocator used by DataContainer.
+///	</summary>
+class DataAllocator {
+
+public:
+	///	<summary>
+	///		Alignment (in bytes) of each block and of each DataChunk within
+	///		a DataContainer.
+	///	</summary>
+	static const size_t ChunkAlignment = 64;
+
+	///	<summary>
+	///		Round a byte size up to a multiple of ChunkAlignment.
+	///	</summary>
+	static size_t PadToAlignment(size_t sByteSize) {
+		return ((sByteSize + ChunkAlignment - 1) / ChunkAlignment)
+			* ChunkAlignment;
+	}
+
+public:
+	///	<summary>
+	///		Virtual destructor.
+	///	</summary>
+	virtual ~DataAllocator() { }
+
+	///	<summary>
+	///		Allocate a block of at least sByteSize bytes, aligned to
+	///		ChunkAlignment.  The contents of the block are undefined.
+	///	</summary>
+	virtual unsigned char * Allocate(size_t sByteSize) = 0;
+
+	///	<summary>
+	///		Return a block obtained from Allocate(sByteSize).
+	///	</summary>
+	virtual void Free(unsigned char * pData, size_t sByteSize) = 0;
+
+	///	<summary>
+	///		Get allocation statistics.
+	///	</summary>
+	virtual DataAllocatorStatistics GetStatistics() const = 0;
+
+	///	<summary>
+	///		Announce allocation statistics.
+	///	</summary>
+	void ReportStatistics() const;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Default DataAllocator.  Blocks are aligned to ChunkAlignment and
+///		optionally backed by transparent huge pages.  Freed blocks smaller
+///		than MaximumCachedBlockSize are kept in a cache keyed by size so
+///		that small containers which are repeatedly deallocated and
+///		reallocated reuse memory that has already been faulted in.  Larger
+///		blocks are returned to the system so that their pages are placed
+///		again by FirstTouchZero when they are next allocated.
+///	</summary>
+class DataArenaAllocator : public DataAllocator {
+
+public:
+	///	<summary>
+	///		Size (in bytes) of a transparent huge page.
+	///	</summary>
+	static const size_t HugePageSize = 2 * 1024 * 1024;
+
+	///	<summary>
+	///		Largest block (in bytes) which is kept in the cache when freed.
+	///	</summary>
+	static const size_t MaximumCachedBlockSize = 1024 * 1024;
+
+	///	<summary>
+	///		Largest total size (in bytes) of all cached blocks.
+	///	</summary>
+	static const size_t MaximumCachedByteSize = 64 * 1024 * 1024;
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	DataArenaAllocator();
+
+	///	<summary>
+	///		Destructor.
+	///	</summary>
+	virtual ~DataArenaAllocator();
+
+public:
+	///	<summary>
+	///		Request transparent huge pages for blocks of at least
+	///		HugePageSize bytes.  Has no effect where madvise(MADV_HUGEPAGE)
+	///		is unavailable.
+	///	</summary>
+	void SetHugePages(bool fHugePages) {
+		m_fHugePages = fHugePages;
+	}
+
+	///	<summary>
+	///		Release all cached blocks back to the system.
+	///	</summary>
+	void ReleaseCache();
+
+public:
+	///	<summary>
+	///		Allocate a block.
+	///	</summary>
+	virtual unsigned char * Allocate(size_t sByteSize);
+
+	///	<summary>
+	///		Return a block to the cache, or to the system if it is too
+	///		large to be cached.
+	///	</summary>
+	virtual void Free(unsigned char * pData, size_t sByteSize);
+
+	///	<summary>
+	///		Get allocation statistics.
+	///	</summary>
+	virtual DataAllocatorStatistics GetStatistics() const;
+
+private:
+	///	<summary>
+	///		Mutex guarding the cache and statistics.
+	///	</summary>
+	mutable std::mutex m_mutex;
+
+	///	<summary>
+	///		Flag indicating that huge pages should be requested.
+	///	</summary>
+	bool m_fHugePages;
+
+	///	<summary>
+	///		Freed blocks, keyed by their size.
+	///	</summary>
+	std::multimap<size_t, unsigned char *> m_mapCache;
+
+	///	<summary>
+	///		Allocation statistics.
+	///	</summary>
+	DataAllocatorStatistics m_stats;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Get the allocator used by all DataContainers.
+///	</summary>
+DataAllocator & GetDataAllocator();
+
+///	<summary>
+///		Replace the allocator used by all DataContainers.  Ownership of
+///		pAllocator is not taken; NULL restores the default allocator.  Must
+///		not be called while any DataContainer holds memory.
+///	</summary>
+void SetDataAllocator(DataAllocator * pAllocator);
+
+///	<summary>
+///		Get the default allocator.
+///	</summary>
+DataArenaAllocator & GetDefaultDataAllocator();
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Zero a block of memory, partitioning it in contiguous page-aligned
+///		pieces over the available threads so that its pages are spread
+///		evenly over the memory of the threads rather than all being placed
+///		with the master thread.
+///	</summary>
+void FirstTouchZero(unsigned char * pData, size_t sByteSize);
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
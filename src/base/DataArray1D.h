@@ -21,6 +21,7 @@
 
 #include "Exception.h"
 #include "DataChunk.h"
+#include "MemoryTools.h"
 #include "DataType.h"
 #include "DataLocation.h"
 
@@ -123,6 +124,7 @@ public:
 			m_sSize = sSize;
 
 			m_data = reinterpret_cast<T *>(malloc(GetByteSize()));
+			m_memacct.Add(GetByteSize());
 		}
 
 		Zero();
@@ -169,6 +171,7 @@ public:
 	virtual void Detach() {
 		if ((m_fOwnsData) && (m_data != NULL)) {
 			delete[] m_data;
+			m_memacct.Remove();
 		}
 		m_fOwnsData = true;
 		m_data = NULL;
@@ -377,6 +380,11 @@ private:
 	///	</summary>
 	bool m_fOwnsData;
 
+	///	<summary>
+	///		Record of the owned data in the MemoryAccounting table.
+	///	</summary>
+	MemoryAccountingEntry m_memacct;
+
 	///	<summary>
 	///		The number of rows in this DataArray1D.
 	///	</summary>
@@ -21,6 +21,7 @@
 
 #include "Exception.h"
 #include "DataChunk.h"
+#include "MemoryTools.h"
 #include "DataType.h"
 #include "DataLocation.h"
 #include "Subscript.h"
@@ -79,7 +80,8 @@ public:
 	DataArray2D(const DataArray2D<T> & da) :
 		m_fOwnsData(true),
 		m_eDataType(DataType_Default),
-		m_eDataLocation(DataLocation_Default)
+		m_eDataLocation(DataLocation_Default),
+		m_data1D(NULL)
 	{
 		if (da.IsAttached()) {
 			m_sSize[0] = 0;
@@ -149,6 +151,7 @@ public:
 			m_sSize[1] = sSize1;
 
 			m_data1D = reinterpret_cast<T *>(malloc(GetByteSize()));
+			m_memacct.Add(GetByteSize());
 
 		}
 
@@ -198,6 +201,7 @@ public:
 	virtual void Detach() {
 		if ((m_fOwnsData) && (m_data1D != NULL)) {
 			delete[] m_data1D;
+			m_memacct.Remove();
 		}
 		m_fOwnsData = true;
 		m_data1D = NULL;
@@ -527,6 +531,11 @@ private:
 	///	</summary>
 	bool m_fOwnsData;
 
+	///	<summary>
+	///		Record of the owned data in the MemoryAccounting table.
+	///	</summary>
+	MemoryAccountingEntry m_memacct;
+
 	///	<summary>
 	///		The size of each dimension of this DataArray3D.
 	///	</summary>
@@ -21,13 +21,23 @@
 
 #include "Exception.h"
 #include "DataChunk.h"
+#include "MemoryTools.h"
 #include "DataType.h"
 #include "DataLocation.h"
 #include "Subscript.h"
+#include "DataArraySlice.h"
 
 #include <cstdlib>
 #include <cstring>
 
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A three-dimensional array.  Data is stored in row-major order, unless
+///		the column layout is selected, in which case dimension 0 is stored
+///		innermost (so that entries (:,j,k) are contiguous).  The column
+///		layout is only available when built with TEMPEST_COLUMN_LAYOUT.
+///	</summary>
 template <typename T>
 class DataArray3D : public DataChunk {
 
@@ -42,6 +52,7 @@ public:
 		DataLocation eDataLocation = DataLocation_Default
 	) :
 		m_fOwnsData(true),
+		m_fColumnLayout(false),
 		m_eDataType(eDataType),
 		m_eDataLocation(eDataLocation),
 		m_data1D(NULL)
@@ -49,6 +60,8 @@ public:
 		m_sSize[0] = 0;
 		m_sSize[1] = 0;
 		m_sSize[2] = 0;
+
+		UpdateStrides();
 	}
 
 	///	<summary>
@@ -63,6 +76,7 @@ public:
 		bool fAllocate = true
 	) :
 		m_fOwnsData(true),
+		m_fColumnLayout(false),
 		m_eDataType(eDataType),
 		m_eDataLocation(eDataLocation),
 		m_data1D(NULL)
@@ -71,6 +85,8 @@ public:
 		m_sSize[1] = sSize1;
 		m_sSize[2] = sSize2;
 
+		UpdateStrides();
+
 		if (fAllocate) {
 			Allocate();
 		}
@@ -81,8 +97,10 @@ public:
 	///	</summary>
 	DataArray3D(const DataArray3D<T> & da) :
 		m_fOwnsData(true),
+		m_fColumnLayout(da.m_fColumnLayout),
 		m_eDataType(DataType_Default),
-		m_eDataLocation(DataLocation_Default)
+		m_eDataLocation(DataLocation_Default),
+		m_data1D(NULL)
 	{
 		if (da.IsAttached()) {
 			m_sSize[0] = 0;
@@ -96,6 +114,8 @@ public:
 			m_sSize[1] = da.m_sSize[1];
 			m_sSize[2] = da.m_sSize[2];
 
+			UpdateStrides();
+
 			m_fOwnsData = true;
 			m_eDataType = da.m_eDataType;
 			m_eDataLocation = da.m_eDataLocation;
@@ -159,7 +179,10 @@ public:
 			m_sSize[1] = sSize1;
 			m_sSize[2] = sSize2;
 
+			UpdateStrides();
+
 			m_data1D = reinterpret_cast<T *>(malloc(GetByteSize()));
+			m_memacct.Add(GetByteSize());
 		}
 
 		Zero();
@@ -182,6 +205,52 @@ public:
 		m_sSize[0] = sSize0;
 		m_sSize[1] = sSize1;
 		m_sSize[2] = sSize2;
+
+		UpdateStrides();
+	}
+
+	///	<summary>
+	///		Select the column layout, in which dimension 0 is stored
+	///		innermost.  The layout may only be changed while no data is
+	///		attached.
+	///	</summary>
+	void SetColumnLayout(bool fColumnLayout) {
+		if (IsAttached()) {
+			_EXCEPTIONT("Attempting SetColumnLayout() on attached DataArray3D");
+		}
+#if !defined(TEMPEST_COLUMN_LAYOUT)
+		if (fColumnLayout) {
+			_EXCEPTIONT("Column layout requires TEMPEST_COLUMN_LAYOUT");
+		}
+#endif
+		m_fColumnLayout = fColumnLayout;
+
+		UpdateStrides();
+	}
+
+	///	<summary>
+	///		Determine if this DataArray3D uses the column layout.
+	///	</summary>
+	inline bool IsColumnLayout() const {
+		return m_fColumnLayout;
+	}
+
+protected:
+	///	<summary>
+	///		Recompute the distance between consecutive entries along each
+	///		dimension from the dimension sizes and layout.
+	///	</summary>
+	void UpdateStrides() {
+		if (m_fColumnLayout) {
+			m_sStride[0] = 1;
+			m_sStride[2] = m_sSize[0];
+			m_sStride[1] = m_sSize[0] * m_sSize[2];
+
+		} else {
+			m_sStride[2] = 1;
+			m_sStride[1] = m_sSize[2];
+			m_sStride[0] = m_sSize[1] * m_sSize[2];
+		}
 	}
 
 public:
@@ -210,6 +279,7 @@ public:
 	virtual void Detach() {
 		if ((m_fOwnsData) && (m_data1D != NULL)) {
 			delete[] m_data1D;
+			m_memacct.Remove();
 		}
 		m_fOwnsData = true;
 		m_data1D = NULL;
@@ -241,6 +311,14 @@ public:
 		return m_sSize[dim];
 	}
 
+	///	<summary>
+	///		Get the distance between consecutive entries along the specified
+	///		dimension.
+	///	</summary>
+	inline size_t GetStride(int dim) const {
+		return m_sStride[dim];
+	}
+
 	///	<summary>
 	///		Get the number of rows in this DataArray3D.
 	///	</summary>
@@ -304,6 +382,9 @@ public:
 				m_sSize[1] = da.m_sSize[1];
 				m_sSize[2] = da.m_sSize[2];
 
+				m_fColumnLayout = da.m_fColumnLayout;
+				UpdateStrides();
+
 				m_eDataType = da.m_eDataType;
 				m_eDataLocation = da.m_eDataLocation;
 				return;
@@ -315,6 +396,7 @@ public:
 
 		// Allocate if necessary
 		if (!IsAttached()) {
+			m_fColumnLayout = da.m_fColumnLayout;
 			Allocate(da.m_sSize[0], da.m_sSize[1], da.m_sSize[2]);
 			m_eDataType = da.m_eDataType;
 			m_eDataLocation = da.m_eDataLocation;
@@ -351,6 +433,9 @@ public:
 		if (da.m_eDataLocation != m_eDataLocation) {
 			_EXCEPTIONT("DataLocation mismatch in assignment of DataArray3D");
 		}
+		if (da.m_fColumnLayout != m_fColumnLayout) {
+			_EXCEPTIONT("Layout mismatch in assignment of DataArray3D");
+		}
 
 		// Copy data
 		memcpy(m_data1D, da.m_data1D, GetByteSize());
@@ -420,6 +505,9 @@ public:
 		if (da.GetSubColumns() != GetSubColumns()) {
 			_EXCEPTIONT("SubColumns mismatch in DataArray3D");
 		}
+		if (da.m_fColumnLayout != m_fColumnLayout) {
+			_EXCEPTIONT("Layout mismatch in DataArray3D");
+		}
 
 		// Scale data values
 		size_t sTotalSize = GetTotalSize();
@@ -491,15 +579,64 @@ public:
 	///		Parenthetical array accessor.
 	///	</summary>
 	inline const T & operator()(size_t i, size_t j, size_t k) const {
+#if defined(TEMPEST_COLUMN_LAYOUT)
+		return (*(m_data1D + i * m_sStride[0] + j * m_sStride[1]
+				+ k * m_sStride[2]));
+#else
 		return (*(m_data1D + i * m_sSize[1] * m_sSize[2] + j * m_sSize[2] + k));
+#endif
 	}
 	///	<summary>
 	///		Parenthetical array accessor.
 	///	</summary>
 	inline T & operator()(size_t i, size_t j, size_t k) {
+#if defined(TEMPEST_COLUMN_LAYOUT)
+		return (*(m_data1D + i * m_sStride[0] + j * m_sStride[1]
+				+ k * m_sStride[2]));
+#else
 		return (*(m_data1D + i * m_sSize[1] * m_sSize[2] + j * m_sSize[2] + k));
+#endif
+	}
+
+#if defined(TEMPEST_COLUMN_LAYOUT)
+	///	<summary>
+	///		Parenthetical array accessor (strided slicer).
+	///	</summary>
+	inline DataArraySlice<T const>
+	operator()(std::array<std::ptrdiff_t, 2> indices) const noexcept
+	{
+		return (*this)(indices[0], indices[1]);
 	}
 
+	///	<summary>
+	///		Parenthetical array accessor (strided slicer).
+	///	</summary>
+	inline DataArraySlice<T>
+	operator()(std::array<std::ptrdiff_t, 2> indices) noexcept
+	{
+		return (*this)(indices[0], indices[1]);
+	}
+
+	///	<summary>
+	///		Parenthetical array accessor (strided slicer).
+	///	</summary>
+	inline DataArraySlice<T const>
+	operator()(size_t i, size_t j) const noexcept {
+		return DataArraySlice<T const>(
+			m_data1D + i * m_sStride[0] + j * m_sStride[1],
+			m_sStride[2]);
+	}
+
+	///	<summary>
+	///		Parenthetical array accessor (strided slicer).
+	///	</summary>
+	inline DataArraySlice<T>
+	operator()(size_t i, size_t j) noexcept {
+		return DataArraySlice<T>(
+			m_data1D + i * m_sStride[0] + j * m_sStride[1],
+			m_sStride[2]);
+	}
+#else
 	///	<summary>
 	///		Parenthetical array accessor (unit-stride slicer).
 	///	</summary>
@@ -548,6 +685,7 @@ public:
 #endif
 		return m_data1D + i * m_sSize[1] * m_sSize[2] + j * m_sSize[2];
 	}
+#endif
 
 private:
 	///	<summary>
@@ -555,11 +693,26 @@ private:
 	///	</summary>
 	bool m_fOwnsData;
 
+	///	<summary>
+	///		Record of the owned data in the MemoryAccounting table.
+	///	</summary>
+	MemoryAccountingEntry m_memacct;
+
+	///	<summary>
+	///		A flag indicating dimension 0 is stored innermost.
+	///	</summary>
+	bool m_fColumnLayout;
+
 	///	<summary>
 	///		The size of each dimension of this DataArray3D.
 	///	</summary>
 	size_t m_sSize[3];
 
+	///	<summary>
+	///		The distance between consecutive entries along each dimension.
+	///	</summary>
+	size_t m_sStride[3];
+
 	///	<summary>
 	///		The type of data stored in this DataArray3D.
 	///	</summary>
@@ -21,14 +21,24 @@
 
 #include "Exception.h"
 #include "DataChunk.h"
+#include "MemoryTools.h"
 #include "DataType.h"
 #include "DataLocation.h"
 #include "Subscript.h"
+#include "DataArraySlice.h"
 
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
 
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A four-dimensional array.  Data is stored in row-major order, unless
+///		the column layout is selected, in which case dimension 1 is stored
+///		innermost (so that entries (i,:,k,l) are contiguous).  The column
+///		layout is only available when built with TEMPEST_COLUMN_LAYOUT.
+///	</summary>
 template <typename T>
 class DataArray4D : public DataChunk {
 
@@ -43,6 +53,7 @@ public:
 		DataLocation eDataLocation = DataLocation_Default
 	) :
 		m_fOwnsData(true),
+		m_fColumnLayout(false),
 		m_eDataType(eDataType),
 		m_eDataLocation(eDataLocation),
 		m_data1D(NULL)
@@ -51,6 +62,8 @@ public:
 		m_sSize[1] = 0;
 		m_sSize[2] = 0;
 		m_sSize[3] = 0;
+
+		UpdateStrides();
 	}
 
 	///	<summary>
@@ -66,6 +79,7 @@ public:
 		bool fAllocate = true
 	) :
 		m_fOwnsData(true),
+		m_fColumnLayout(false),
 		m_eDataType(eDataType),
 		m_eDataLocation(eDataLocation),
 		m_data1D(NULL)
@@ -75,6 +89,8 @@ public:
 		m_sSize[2] = sSize2;
 		m_sSize[3] = sSize3;
 
+		UpdateStrides();
+
 		if (fAllocate) {
 			Allocate();
 		}
@@ -85,8 +101,10 @@ public:
 	///	</summary>
 	DataArray4D(const DataArray4D<T> & da) :
 		m_fOwnsData(true),
+		m_fColumnLayout(da.m_fColumnLayout),
 		m_eDataType(DataType_Default),
-		m_eDataLocation(DataLocation_Default)
+		m_eDataLocation(DataLocation_Default),
+		m_data1D(NULL)
 	{
 		if (da.IsAttached()) {
 			m_sSize[0] = 0;
@@ -102,6 +120,8 @@ public:
 			m_sSize[2] = da.m_sSize[2];
 			m_sSize[3] = da.m_sSize[3];
 
+			UpdateStrides();
+
 			m_fOwnsData = true;
 			m_eDataType = da.m_eDataType;
 			m_eDataLocation = da.m_eDataLocation;
@@ -176,7 +196,10 @@ public:
 			m_sSize[2] = sSize2;
 			m_sSize[3] = sSize3;
 
+			UpdateStrides();
+
 			m_data1D = reinterpret_cast<T *>(malloc(GetByteSize()));
+			m_memacct.Add(GetByteSize());
 		}
 
 		Zero();
@@ -201,6 +224,54 @@ public:
 		m_sSize[1] = sSize1;
 		m_sSize[2] = sSize2;
 		m_sSize[3] = sSize3;
+
+		UpdateStrides();
+	}
+
+	///	<summary>
+	///		Select the column layout, in which dimension 1 is stored
+	///		innermost.  The layout may only be changed while no data is
+	///		attached.
+	///	</summary>
+	void SetColumnLayout(bool fColumnLayout) {
+		if (IsAttached()) {
+			_EXCEPTIONT("Attempting SetColumnLayout() on attached DataArray4D");
+		}
+#if !defined(TEMPEST_COLUMN_LAYOUT)
+		if (fColumnLayout) {
+			_EXCEPTIONT("Column layout requires TEMPEST_COLUMN_LAYOUT");
+		}
+#endif
+		m_fColumnLayout = fColumnLayout;
+
+		UpdateStrides();
+	}
+
+	///	<summary>
+	///		Determine if this DataArray4D uses the column layout.
+	///	</summary>
+	inline bool IsColumnLayout() const {
+		return m_fColumnLayout;
+	}
+
+protected:
+	///	<summary>
+	///		Recompute the distance between consecutive entries along each
+	///		dimension from the dimension sizes and layout.
+	///	</summary>
+	void UpdateStrides() {
+		if (m_fColumnLayout) {
+			m_sStride[1] = 1;
+			m_sStride[3] = m_sSize[1];
+			m_sStride[2] = m_sSize[1] * m_sSize[3];
+			m_sStride[0] = m_sSize[1] * m_sSize[2] * m_sSize[3];
+
+		} else {
+			m_sStride[3] = 1;
+			m_sStride[2] = m_sSize[3];
+			m_sStride[1] = m_sSize[2] * m_sSize[3];
+			m_sStride[0] = m_sSize[1] * m_sSize[2] * m_sSize[3];
+		}
 	}
 
 public:
@@ -229,6 +300,7 @@ public:
 	virtual void Detach() {
 		if ((m_fOwnsData) && (m_data1D != NULL)) {
 			delete[] m_data1D;
+			m_memacct.Remove();
 		}
 		m_fOwnsData = true;
 		m_data1D = NULL;
@@ -261,6 +333,15 @@ public:
 		return m_sSize[dim];
 	}
 
+	///	<summary>
+	///		Get the distance between consecutive entries along the specified
+	///		dimension.  Column operators should use GetStride(1) rather than
+	///		assuming a particular layout.
+	///	</summary>
+	inline size_t GetStride(int dim) const {
+		return m_sStride[dim];
+	}
+
 public:
 	///	<summary>
 	///		Set the DataLocation.
@@ -304,6 +385,9 @@ public:
 				m_sSize[2] = da.m_sSize[2];
 				m_sSize[3] = da.m_sSize[3];
 
+				m_fColumnLayout = da.m_fColumnLayout;
+				UpdateStrides();
+
 				m_eDataType = da.m_eDataType;
 				m_eDataLocation = da.m_eDataLocation;
 				return;
@@ -315,6 +399,7 @@ public:
 
 		// Allocate if necessary
 		if (!IsAttached()) {
+			m_fColumnLayout = da.m_fColumnLayout;
 			Allocate(
 				da.m_sSize[0],
 				da.m_sSize[1],
@@ -361,6 +446,9 @@ public:
 		if (da.m_eDataLocation != m_eDataLocation) {
 			_EXCEPTIONT("DataLocation mismatch in assignment of DataArray4D");
 		}
+		if (da.m_fColumnLayout != m_fColumnLayout) {
+			_EXCEPTIONT("Layout mismatch in assignment of DataArray4D");
+		}
 
 		// Copy data
 		memcpy(m_data1D, da.m_data1D, GetByteSize());
@@ -468,6 +556,9 @@ public:
 		if (da.GetSize(3) != GetSize(3)) {
 			_EXCEPTIONT("Dimension 3 mismatch in DataArray4D");
 		}
+		if (da.m_fColumnLayout != m_fColumnLayout) {
+			_EXCEPTIONT("Layout mismatch in DataArray4D");
+		}
 
 		// Scale data values
 		size_t sTotalSize = GetTotalSize();
@@ -521,6 +612,9 @@ public:
 		if (da.GetSize(3) != GetSize(3)) {
 			_EXCEPTIONT("Dimension 3 mismatch in DataArray4D");
 		}
+		if (da.m_fColumnLayout != m_fColumnLayout) {
+			_EXCEPTIONT("Layout mismatch in DataArray4D");
+		}
 
 		// Scale data values
 		size_t sTotalSize = GetTotalSize();
@@ -561,6 +655,11 @@ public:
 		if ((x.GetSize(3) != GetSize(3)) || (y.GetSize(3) != GetSize(3))) {
 			_EXCEPTIONT("Dimension 3 mismatch in DataArray4D");
 		}
+		if ((x.m_fColumnLayout != m_fColumnLayout) ||
+		    (y.m_fColumnLayout != m_fColumnLayout)
+		) {
+			_EXCEPTIONT("Layout mismatch in DataArray4D");
+		}
 
 		// Scale data values
 		size_t sTotalSize = GetTotalSize();
@@ -599,6 +698,11 @@ public:
 		if ((x.GetSize(3) != GetSize(3)) || (y.GetSize(3) != GetSize(3))) {
 			_EXCEPTIONT("Dimension 3 mismatch in DataArray4D");
 		}
+		if ((x.m_fColumnLayout != m_fColumnLayout) ||
+		    (y.m_fColumnLayout != m_fColumnLayout)
+		) {
+			_EXCEPTIONT("Layout mismatch in DataArray4D");
+		}
 
 		// Scale data values
 		size_t sTotalSize = GetTotalSize();
@@ -638,6 +742,11 @@ public:
 		if ((x.GetSize(3) != GetSize(3)) || (y.GetSize(3) != GetSize(3))) {
 			_EXCEPTIONT("Dimension 3 mismatch in DataArray4D");
 		}
+		if ((x.m_fColumnLayout != m_fColumnLayout) ||
+		    (y.m_fColumnLayout != m_fColumnLayout)
+		) {
+			_EXCEPTIONT("Layout mismatch in DataArray4D");
+		}
 
 		// Scale data values
 		size_t sTotalSize = GetTotalSize();
@@ -673,6 +782,9 @@ public:
 		if (x.GetSize(3) != GetSize(3)) {
 			_EXCEPTIONT("Dimension 3 mismatch in DataArray4D");
 		}
+		if (x.m_fColumnLayout != m_fColumnLayout) {
+			_EXCEPTIONT("Layout mismatch in DataArray4D");
+		}
 
 		// Scale data values
 		size_t sTotalSize = GetTotalSize();
@@ -745,17 +857,66 @@ public:
 	///		Parenthetical array accessor.
 	///	</summary>
 	inline const T & operator()(size_t i, size_t j, size_t k, size_t l) const {
+#if defined(TEMPEST_COLUMN_LAYOUT)
+		return (*(m_data1D + i * m_sStride[0] + j * m_sStride[1]
+				+ k * m_sStride[2] + l * m_sStride[3]));
+#else
 		return (*(m_data1D + i * m_sSize[1] * m_sSize[2] * m_sSize[3]
 				+ j * m_sSize[2] * m_sSize[3] + k * m_sSize[3] + l));
+#endif
 	}
 	///	<summary>
 	///		Parenthetical array accessor.
 	///	</summary>
 	inline T & operator()(size_t i, size_t j, size_t k, size_t l) {
+#if defined(TEMPEST_COLUMN_LAYOUT)
+		return (*(m_data1D + i * m_sStride[0] + j * m_sStride[1]
+				+ k * m_sStride[2] + l * m_sStride[3]));
+#else
 		return (*(m_data1D + i * m_sSize[1] * m_sSize[2] * m_sSize[3]
 				+ j * m_sSize[2] * m_sSize[3] + k * m_sSize[3] + l));
+#endif
+	}
+
+#if defined(TEMPEST_COLUMN_LAYOUT)
+	///	<summary>
+	///		Parenthetical array accessor (strided slicer).
+	///	</summary>
+	inline DataArraySlice<T const>
+	operator()(std::array<std::ptrdiff_t, 3> indices) const noexcept
+	{
+		return (*this)(indices[0], indices[1], indices[2]);
 	}
 
+	///	<summary>
+	///		Parenthetical array accessor (strided slicer).
+	///	</summary>
+	inline DataArraySlice<T>
+	operator()(std::array<std::ptrdiff_t, 3> indices) noexcept
+	{
+		return (*this)(indices[0], indices[1], indices[2]);
+	}
+
+	///	<summary>
+	///		Parenthetical array accessor (strided slicer).
+	///	</summary>
+	inline DataArraySlice<T const>
+	operator()(size_t i, size_t j, size_t k) const noexcept {
+		return DataArraySlice<T const>(
+			m_data1D + i * m_sStride[0] + j * m_sStride[1] + k * m_sStride[2],
+			m_sStride[3]);
+	}
+
+	///	<summary>
+	///		Parenthetical array accessor (strided slicer).
+	///	</summary>
+	inline DataArraySlice<T>
+	operator()(size_t i, size_t j, size_t k) noexcept {
+		return DataArraySlice<T>(
+			m_data1D + i * m_sStride[0] + j * m_sStride[1] + k * m_sStride[2],
+			m_sStride[3]);
+	}
+#else
 	///	<summary>
 	///		Parenthetical array accessor (unit-stride slicer).
 	///	</summary>
@@ -805,6 +966,7 @@ public:
 		return m_data1D + i * m_sSize[1] * m_sSize[2] * m_sSize[3]
 				+ j * m_sSize[2] * m_sSize[3] + k * m_sSize[3];
 	}
+#endif
 
 private:
 	///	<summary>
@@ -812,11 +974,26 @@ private:
 	///	</summary>
 	bool m_fOwnsData;
 
+	///	<summary>
+	///		Record of the owned data in the MemoryAccounting table.
+	///	</summary>
+	MemoryAccountingEntry m_memacct;
+
+	///	<summary>
+	///		A flag indicating dimension 1 is stored innermost.
+	///	</summary>
+	bool m_fColumnLayout;
+
 	///	<summary>
 	///		The size of each dimension of this DataArray4D.
 	///	</summary>
 	size_t m_sSize[4];
 
+	///	<summary>
+	///		The distance between consecutive entries along each dimension.
+	///	</summary>
+	size_t m_sStride[4];
+
 	///	<summary>
 	///		The type of data stored in this DataArray4D.
 	///	</summary>
@@ -0,0 +1,69 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    DataArraySlice.h
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _DATAARRAYSLICE_H_
+#define _DATAARRAYSLICE_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A one-dimensional slice through the last dimension of a data array,
+///		whose entries need not be contiguous in memory.  Returned by the
+///		subscript operators of DataArray3D and DataArray4D in builds with
+///		TEMPEST_COLUMN_LAYOUT.
+///	</summary>
+template <typename T>
+class DataArraySlice {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	DataArraySlice(
+		T * data,
+		size_t sStride
+	) :
+		m_data(data),
+		m_sStride(static_cast<std::ptrdiff_t>(sStride))
+	{ }
+
+	///	<summary>
+	///		Array accessor.
+	///	</summary>
+	inline T & operator[](std::ptrdiff_t idx) const {
+		return m_data[idx * m_sStride];
+	}
+
+private:
+	///	<summary>
+	///		Pointer to the first entry of the slice.
+	///	</summary>
+	T * m_data;
+
+	///	<summary>
+	///		Distance between consecutive entries of the slice.
+	///	</summary>
+	std::ptrdiff_t m_sStride;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
@@ -15,6 +15,7 @@
 ///	</remarks>
 
 #include "DataContainer.h"
+#include "DataAllocator.h"
 
 #include "Exception.h"
 
@@ -35,14 +36,17 @@ static const size_t bool_aligned_size = sizeof(size_t);
 
 DataContainer::DataContainer() :
 	m_fOwnsData(true),
-	m_pAllocatedMemory(NULL)
+	m_pAllocatedMemory(NULL),
+	m_sAllocatedByteSize(0),
+	m_ixMemoryCategory(-1)
 { }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 DataContainer::~DataContainer() {
 	if ((m_fOwnsData) && (m_pAllocatedMemory != NULL)) {
-		free(m_pAllocatedMemory);
+		GetDataAllocator().Free(m_pAllocatedMemory, m_sAllocatedByteSize);
+		m_memacct.Remove();
 	}
 }
 
@@ -57,12 +61,9 @@ size_t DataContainer::GetTotalByteSize() const {
 		DataChunk * pDataChunk =
 			reinterpret_cast<DataChunk*>(m_vecDataChunks[i]);
 
-		// Verify byte alignment
-		size_t sByteSize = pDataChunk->GetByteSize();
-		if (sByteSize % sizeof(size_t) != 0) {
-			_EXCEPTIONT("Misaligned array detected in DataContainer");
-		}
-		sAccumulated += sByteSize;
+		// Pad each DataChunk so that the next one remains aligned
+		sAccumulated +=
+			DataAllocator::PadToAlignment(pDataChunk->GetByteSize());
 	}
 
 	return sAccumulated;
@@ -80,15 +81,22 @@ void DataContainer::Allocate() {
 	// Allocate memory as one contiguous chunk
 	size_t sTotalByteSize = GetTotalByteSize();
 
-	m_pAllocatedMemory =
-		reinterpret_cast<unsigned char*>(malloc(sTotalByteSize));
+	// Avoid a zero-sized block so that IsAttached() reflects Allocate()
+	if (sTotalByteSize == 0) {
+		sTotalByteSize = DataAllocator::ChunkAlignment;
+	}
+
+	m_pAllocatedMemory = GetDataAllocator().Allocate(sTotalByteSize);
+	m_sAllocatedByteSize = sTotalByteSize;
 
-	if (m_pAllocatedMemory == NULL) {
-		_EXCEPTIONT("Out of memory");
+	if (m_ixMemoryCategory == (-1)) {
+		m_memacct.Add(sTotalByteSize);
+	} else {
+		m_memacct.Add(sTotalByteSize, m_ixMemoryCategory);
 	}
 
 	// Initialize allocated memory to zero
-	memset(m_pAllocatedMemory, 0, sTotalByteSize);
+	FirstTouchZero(m_pAllocatedMemory, sTotalByteSize);
 
 	// Assign memory to DataChunks
 	unsigned char * pAccumulated = m_pAllocatedMemory;
@@ -100,8 +108,8 @@ void DataContainer::Allocate() {
 		pDataChunk->AttachToData(
 			reinterpret_cast<void *>(pAccumulated));
 
-#pragma message "Alignment may be an issue here on 32-bit systems"
-		pAccumulated += pDataChunk->GetByteSize();
+		pAccumulated +=
+			DataAllocator::PadToAlignment(pDataChunk->GetByteSize());
 	}
 }
 
@@ -133,7 +141,8 @@ void DataContainer::AttachTo(
 		pDataChunk->AttachToData(
 			reinterpret_cast<void *>(pAccumulated));
 
-		pAccumulated += pDataChunk->GetByteSize();
+		pAccumulated +=
+			DataAllocator::PadToAlignment(pDataChunk->GetByteSize());
 	}
 }
 
@@ -149,11 +158,13 @@ void DataContainer::Detach() {
 	}
 
 	if ((m_fOwnsData) && (m_pAllocatedMemory != NULL)) {
-		free(m_pAllocatedMemory);
+		GetDataAllocator().Free(m_pAllocatedMemory, m_sAllocatedByteSize);
+		m_memacct.Remove();
 	}
 
 	m_fOwnsData = true;
 	m_pAllocatedMemory = NULL;
+	m_sAllocatedByteSize = 0;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
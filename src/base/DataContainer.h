@@ -18,6 +18,7 @@
 #define _DATACONTAINER_H_
 
 #include "DataChunk.h"
+#include "MemoryTools.h"
 
 #include <vector>
 
@@ -39,6 +40,15 @@ public:
 	///	</summary>
 	~DataContainer();
 
+	///	<summary>
+	///		Set the category to which memory allocated by this DataContainer
+	///		is charged in the MemoryAccounting table.
+	///	</summary>
+	void SetMemoryCategory(const char * szCategory) {
+		m_ixMemoryCategory =
+			GetMemoryAccounting().GetCategoryIndex(szCategory);
+	}
+
 	///	<summary>
 	///		Add a new data object to the DataContainer of specified size.
 	///	</summary>
@@ -49,7 +59,9 @@ public:
 	}
 
 	///	<summary>
-	///		Get the total size of the DataContainer (in bytes).
+	///		Get the total size of the DataContainer (in bytes), including
+	///		the padding that aligns each DataChunk to
+	///		DataAllocator::ChunkAlignment.
 	///	</summary>
 	size_t GetTotalByteSize() const;
 
@@ -68,7 +80,8 @@ public:
 	}
 
 	///	<summary>
-	///		Allocate an array for all DataChunks.
+	///		Allocate an array for all DataChunks from the DataAllocator and
+	///		initialize it to zero.
 	///	</summary>
 	void Allocate();
 
@@ -78,7 +91,8 @@ public:
 	void Deallocate();
 
 	///	<summary>
-	///		Attach to the specified pointer.
+	///		Attach to the specified pointer, which should be aligned to
+	///		DataAllocator::ChunkAlignment.
 	///	</summary>
 	void AttachTo(unsigned char * pAllocatedMemory);
 
@@ -105,6 +119,22 @@ private:
 	///	</summary>
 	unsigned char * m_pAllocatedMemory;
 
+	///	<summary>
+	///		Size of the memory chunk obtained from the DataAllocator.
+	///	</summary>
+	size_t m_sAllocatedByteSize;
+
+	///	<summary>
+	///		Category in the MemoryAccounting table, or -1 to use the
+	///		category in effect when Allocate() is called.
+	///	</summary>
+	int m_ixMemoryCategory;
+
+	///	<summary>
+	///		Record of the allocated memory in the MemoryAccounting table.
+	///	</summary>
+	MemoryAccountingEntry m_memacct;
+
 	///	<summary>
 	///		Vector of DataChunks stored in this DataContainer.
 	///	</summary>
@@ -5,8 +5,8 @@
 ///	\version April 23, 2014
 ///
 ///	<summary>
-///		This header file provides access to various mathematical functions
-///		that are not normally exposed in the standard C++ libraries.
+///		This header file provides tools for measuring and accounting for
+///		the memory used by the model.
 ///	</summary>
 ///	<remarks>
 ///		Copyright 2000-2010 Paul Ullrich
@@ -20,6 +20,15 @@
 
 #include "MemoryTools.h"
 #include "Announce.h"
+#include "Exception.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#ifdef TEMPEST_MPIOMP
+#include <mpi.h>
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -32,8 +41,319 @@ void PrintMemoryLine(const char * szString) {
 		Announce("MEMORY RES %lu", ruse.ru_maxrss);
 	} else {
 		Announce("%s : RES %lu : DATA %lu : STACK %lu",
-			szString, ruse.ru_maxrss);
+			szString, ruse.ru_maxrss, ruse.ru_idrss, ruse.ru_isrss);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// MemoryAccounting
+///////////////////////////////////////////////////////////////////////////////
+
+MemoryAccounting::MemoryAccounting() :
+	m_nCategories(1)
+{
+	for (int ix = 0; ix < MaxCategories; ix++) {
+		m_sBytes[ix].store(0);
+		m_sPeakBytes[ix].store(0);
+		m_sAllocations[ix].store(0);
+	}
+	m_strName[0] = "Other";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int MemoryAccounting::GetCategoryIndex(const char * szCategory) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	int nCategories = m_nCategories.load();
+	for (int ix = 0; ix < nCategories; ix++) {
+		if (m_strName[ix] == szCategory) {
+			return ix;
+		}
+	}
+
+	if (nCategories == MaxCategories) {
+		_EXCEPTION1("Too many memory categories (maximum %i)",
+			MaxCategories);
+	}
+
+	m_strName[nCategories] = szCategory;
+	m_nCategories.store(nCategories + 1);
+
+	return nCategories;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int MemoryAccounting::GetCategoryCount() const {
+	return m_nCategories.load();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+std::string MemoryAccounting::GetCategoryName(int ix) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_strName[ix];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void MemoryAccounting::Add(int ix, size_t sByteSize) {
+	size_t sBytes = (m_sBytes[ix] += sByteSize);
+	m_sAllocations[ix]++;
+
+	size_t sPeakBytes = m_sPeakBytes[ix].load();
+	while (sBytes > sPeakBytes) {
+		if (m_sPeakBytes[ix].compare_exchange_weak(sPeakBytes, sBytes)) {
+			break;
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void MemoryAccounting::Remove(int ix, size_t sByteSize) {
+	m_sBytes[ix] -= sByteSize;
+	m_sAllocations[ix]--;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+MemoryAccounting & GetMemoryAccounting() {
+
+	// Never destroyed, so that arrays with static storage duration may
+	// still be released at exit
+	static MemoryAccounting * s_pMemoryAccounting = new MemoryAccounting;
+
+	return (*s_pMemoryAccounting);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// MemoryCategoryScope
+///////////////////////////////////////////////////////////////////////////////
+
+static thread_local int s_ixCurrentMemoryCategory = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+
+int GetCurrentMemoryCategory() {
+	return s_ixCurrentMemoryCategory;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+MemoryCategoryScope::MemoryCategoryScope(
+	const char * szCategory
+) :
+	m_ixPrevious(s_ixCurrentMemoryCategory)
+{
+	s_ixCurrentMemoryCategory =
+		GetMemoryAccounting().GetCategoryIndex(szCategory);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+MemoryCategoryScope::~MemoryCategoryScope() {
+	s_ixCurrentMemoryCategory = m_ixPrevious;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// ReportMemoryUsage
+///////////////////////////////////////////////////////////////////////////////
+
+void ReportMemoryUsage(const std::string & strJSONFile) {
+
+	MemoryAccounting & memacct = GetMemoryAccounting();
+
+	int nRank = 0;
+	int nRanks = 1;
+
+#ifdef TEMPEST_MPIOMP
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &nRanks);
+#endif
+
+	// Names of the categories on this rank
+	std::vector<std::string> vecLocalNames;
+	for (int ix = 0; ix < memacct.GetCategoryCount(); ix++) {
+		vecLocalNames.push_back(memacct.GetCategoryName(ix));
+	}
+
+	// Categories on all ranks, in order of first appearance by rank.  This
+	// ordering is identical on every rank.
+	std::vector<std::string> vecNames;
+
+#ifdef TEMPEST_MPIOMP
+	{
+		std::string strLocalNames;
+		for (int c = 0; c < vecLocalNames.size(); c++) {
+			strLocalNames += vecLocalNames[c];
+			strLocalNames += '\n';
+		}
+
+		int nLocalLength = static_cast<int>(strLocalNames.length());
+
+		std::vector<int> vecLength(nRanks);
+		MPI_Allgather(
+			&nLocalLength, 1, MPI_INT,
+			&(vecLength[0]), 1, MPI_INT,
+			MPI_COMM_WORLD);
+
+		std::vector<int> vecDispl(nRanks, 0);
+		for (int r = 1; r < nRanks; r++) {
+			vecDispl[r] = vecDispl[r-1] + vecLength[r-1];
+		}
+
+		std::vector<char> vecAllNames(
+			vecDispl[nRanks-1] + vecLength[nRanks-1] + 1, '\0');
+
+		MPI_Allgatherv(
+			const_cast<char *>(strLocalNames.c_str()), nLocalLength, MPI_CHAR,
+			&(vecAllNames[0]), &(vecLength[0]), &(vecDispl[0]), MPI_CHAR,
+			MPI_COMM_WORLD);
+
+		std::string strName;
+		for (int i = 0; i < vecAllNames.size() - 1; i++) {
+			if (vecAllNames[i] != '\n') {
+				strName += vecAllNames[i];
+				continue;
+			}
+
+			int c = 0;
+			for (; c < vecNames.size(); c++) {
+				if (vecNames[c] == strName) {
+					break;
+				}
+			}
+			if (c == vecNames.size()) {
+				vecNames.push_back(strName);
+			}
+			strName.clear();
+		}
 	}
+#else
+	vecNames = vecLocalNames;
+#endif
+
+	// Local values: bytes, peak bytes and allocations for each category,
+	// followed by the maximum resident set size
+	const int nCategories = static_cast<int>(vecNames.size());
+	const int nValues = 3 * nCategories + 1;
+
+	std::vector<unsigned long long> vecLocal(nValues, 0);
+
+	for (int c = 0; c < nCategories; c++) {
+		for (int ix = 0; ix < vecLocalNames.size(); ix++) {
+			if (vecLocalNames[ix] == vecNames[c]) {
+				vecLocal[3*c  ] = memacct.GetBytes(ix);
+				vecLocal[3*c+1] = memacct.GetPeakBytes(ix);
+				vecLocal[3*c+2] = memacct.GetAllocations(ix);
+				break;
+			}
+		}
+	}
+
+	rusage ruse;
+	getrusage(RUSAGE_SELF, &ruse);
+	vecLocal[3*nCategories] =
+		1024 * static_cast<unsigned long long>(ruse.ru_maxrss);
+
+	// Reduce over ranks
+	std::vector<unsigned long long> vecMin(vecLocal);
+	std::vector<unsigned long long> vecMax(vecLocal);
+	std::vector<unsigned long long> vecSum(vecLocal);
+
+#ifdef TEMPEST_MPIOMP
+	MPI_Reduce(&(vecLocal[0]), &(vecMin[0]),
+		nValues, MPI_UNSIGNED_LONG_LONG, MPI_MIN, 0, MPI_COMM_WORLD);
+	MPI_Reduce(&(vecLocal[0]), &(vecMax[0]),
+		nValues, MPI_UNSIGNED_LONG_LONG, MPI_MAX, 0, MPI_COMM_WORLD);
+	MPI_Reduce(&(vecLocal[0]), &(vecSum[0]),
+		nValues, MPI_UNSIGNED_LONG_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
+#endif
+
+	if (nRank != 0) {
+		return;
+	}
+
+	// Announce the report
+	const double dMiB = 1024.0 * 1024.0;
+
+	unsigned long long sTotal[3] = {0, 0, 0};
+
+	char szTitle[64];
+	snprintf(szTitle, 64, "Memory usage (MiB) over %i ranks", nRanks);
+
+	AnnounceStartBlock(szTitle);
+	Announce("%-20s %10s %10s %10s %10s %10s",
+		"Category", "Min", "Max", "Total", "Peak", "Arrays");
+
+	for (int c = 0; c < nCategories; c++) {
+		if (vecMax[3*c+1] == 0) {
+			continue;
+		}
+		Announce("%-20s %10.2f %10.2f %10.2f %10.2f %10llu",
+			vecNames[c].c_str(),
+			static_cast<double>(vecMin[3*c]) / dMiB,
+			static_cast<double>(vecMax[3*c]) / dMiB,
+			static_cast<double>(vecSum[3*c]) / dMiB,
+			static_cast<double>(vecMax[3*c+1]) / dMiB,
+			vecSum[3*c+2]);
+
+		sTotal[0] += vecMin[3*c];
+		sTotal[1] += vecMax[3*c];
+		sTotal[2] += vecSum[3*c];
+	}
+
+	Announce("%-20s %10.2f %10.2f %10.2f",
+		"(accounted)",
+		static_cast<double>(sTotal[0]) / dMiB,
+		static_cast<double>(sTotal[1]) / dMiB,
+		static_cast<double>(sTotal[2]) / dMiB);
+	Announce("%-20s %10.2f %10.2f %10.2f",
+		"(max resident)",
+		static_cast<double>(vecMin[3*nCategories]) / dMiB,
+		static_cast<double>(vecMax[3*nCategories]) / dMiB,
+		static_cast<double>(vecSum[3*nCategories]) / dMiB);
+	AnnounceEndBlock("Done");
+
+	// Write the report as JSON
+	if (strJSONFile == "") {
+		return;
+	}
+
+	FILE * fp = fopen(strJSONFile.c_str(), "w");
+	if (fp == NULL) {
+		_EXCEPTION1("Unable to open memory report \"%s\"",
+			strJSONFile.c_str());
+	}
+
+	fprintf(fp, "{\n");
+	fprintf(fp, "  \"ranks\": %i,\n", nRanks);
+	fprintf(fp, "  \"categories\": {\n");
+	for (int c = 0; c < nCategories; c++) {
+		fprintf(fp, "    \"%s\": {\n", vecNames[c].c_str());
+		fprintf(fp, "      \"bytes\": "
+			"{\"min\": %llu, \"max\": %llu, \"sum\": %llu},\n",
+			vecMin[3*c], vecMax[3*c], vecSum[3*c]);
+		fprintf(fp, "      \"peak_bytes\": "
+			"{\"min\": %llu, \"max\": %llu, \"sum\": %llu},\n",
+			vecMin[3*c+1], vecMax[3*c+1], vecSum[3*c+1]);
+		fprintf(fp, "      \"arrays\": "
+			"{\"min\": %llu, \"max\": %llu, \"sum\": %llu}\n",
+			vecMin[3*c+2], vecMax[3*c+2], vecSum[3*c+2]);
+		fprintf(fp, "    }%s\n", (c == nCategories-1)?(""):(","));
+	}
+	fprintf(fp, "  },\n");
+	fprintf(fp, "  \"accounted_bytes\": "
+		"{\"min\": %llu, \"max\": %llu, \"sum\": %llu},\n",
+		sTotal[0], sTotal[1], sTotal[2]);
+	fprintf(fp, "  \"max_resident_bytes\": "
+		"{\"min\": %llu, \"max\": %llu, \"sum\": %llu}\n",
+		vecMin[3*nCategories], vecMax[3*nCategories], vecSum[3*nCategories]);
+	fprintf(fp, "}\n");
+
+	fclose(fp);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5,8 +5,8 @@
 ///	\version April 23, 2014
 ///
 ///	<summary>
-///		This header file provides access to various mathematical functions
-///		that are not normally exposed in the standard C++ libraries.
+///		This header file provides tools for measuring and accounting for
+///		the memory used by the model.
 ///	</summary>
 ///	<remarks>
 ///		Copyright 2000-2010 Paul Ullrich
@@ -24,11 +24,220 @@
 #include "sys/resource.h"
 #include <cstdlib>
 
+#include <atomic>
+#include <mutex>
+#include <string>
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void PrintMemoryLine(const char * szString = NULL);
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		A table of the number of bytes held by each category of data on
+///		this rank.  Category 0 ("Other") collects all memory allocated
+///		outside of a MemoryCategoryScope.
+///	</summary>
+class MemoryAccounting {
+
+public:
+	///	<summary>
+	///		Maximum number of categories.
+	///	</summary>
+	static const int MaxCategories = 64;
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	MemoryAccounting();
+
+public:
+	///	<summary>
+	///		Get the index of the category with the given name, adding it to
+	///		the table if necessary.
+	///	</summary>
+	int GetCategoryIndex(const char * szCategory);
+
+	///	<summary>
+	///		Get the number of categories.
+	///	</summary>
+	int GetCategoryCount() const;
+
+	///	<summary>
+	///		Get the name of a category.
+	///	</summary>
+	std::string GetCategoryName(int ix) const;
+
+	///	<summary>
+	///		Record an allocation of sByteSize bytes in category ix.
+	///	</summary>
+	void Add(int ix, size_t sByteSize);
+
+	///	<summary>
+	///		Record the release of sByteSize bytes in category ix.
+	///	</summary>
+	void Remove(int ix, size_t sByteSize);
+
+	///	<summary>
+	///		Get the number of bytes currently held by category ix.
+	///	</summary>
+	size_t GetBytes(int ix) const {
+		return m_sBytes[ix].load();
+	}
+
+	///	<summary>
+	///		Get the largest number of bytes held by category ix.
+	///	</summary>
+	size_t GetPeakBytes(int ix) const {
+		return m_sPeakBytes[ix].load();
+	}
+
+	///	<summary>
+	///		Get the number of allocations currently held by category ix.
+	///	</summary>
+	size_t GetAllocations(int ix) const {
+		return m_sAllocations[ix].load();
+	}
+
+private:
+	///	<summary>
+	///		Mutex guarding the addition of categories.
+	///	</summary>
+	mutable std::mutex m_mutex;
+
+	///	<summary>
+	///		Number of categories.
+	///	</summary>
+	std::atomic<int> m_nCategories;
+
+	///	<summary>
+	///		Category names.
+	///	</summary>
+	std::string m_strName[MaxCategories];
+
+	///	<summary>
+	///		Bytes currently held by each category.
+	///	</summary>
+	std::atomic<size_t> m_sBytes[MaxCategories];
+
+	///	<summary>
+	///		Largest number of bytes held by each category.
+	///	</summary>
+	std::atomic<size_t> m_sPeakBytes[MaxCategories];
+
+	///	<summary>
+	///		Number of allocations currently held by each category.
+	///	</summary>
+	std::atomic<size_t> m_sAllocations[MaxCategories];
+};
+
+///	<summary>
+///		Get the MemoryAccounting table for this rank.
+///	</summary>
+MemoryAccounting & GetMemoryAccounting();
+
+///	<summary>
+///		Get the category to which allocations on this thread are charged.
+///	</summary>
+int GetCurrentMemoryCategory();
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Charge all DataArray allocations made on this thread to the given
+///		category for the lifetime of this object.
+///	</summary>
+class MemoryCategoryScope {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	MemoryCategoryScope(const char * szCategory);
+
+	///	<summary>
+	///		Destructor.  Restores the previous category.
+	///	</summary>
+	~MemoryCategoryScope();
+
+private:
+	///	<summary>
+	///		Category in effect before this scope.
+	///	</summary>
+	int m_ixPrevious;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A record of one block of memory in the MemoryAccounting table.
+///	</summary>
+class MemoryAccountingEntry {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	MemoryAccountingEntry() :
+		m_ixCategory(0),
+		m_sByteSize(0)
+	{ }
+
+	///	<summary>
+	///		Record a block of sByteSize bytes in the given category.
+	///	</summary>
+	void Add(size_t sByteSize, int ixCategory) {
+		Remove();
+		if (sByteSize == 0) {
+			return;
+		}
+		m_ixCategory = ixCategory;
+		m_sByteSize = sByteSize;
+		GetMemoryAccounting().Add(m_ixCategory, m_sByteSize);
+	}
+
+	///	<summary>
+	///		Record a block of sByteSize bytes in the current category.
+	///	</summary>
+	void Add(size_t sByteSize) {
+		Add(sByteSize, GetCurrentMemoryCategory());
+	}
+
+	///	<summary>
+	///		Remove the block from the table.
+	///	</summary>
+	void Remove() {
+		if (m_sByteSize != 0) {
+			GetMemoryAccounting().Remove(m_ixCategory, m_sByteSize);
+			m_sByteSize = 0;
+		}
+	}
+
+private:
+	///	<summary>
+	///		Category of the block.
+	///	</summary>
+	int m_ixCategory;
+
+	///	<summary>
+	///		Size of the block.
+	///	</summary>
+	size_t m_sByteSize;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Reduce the MemoryAccounting table over all ranks and announce the
+///		minimum, maximum and total of each category.  If strJSONFile is
+///		not empty the report is also written to that file as JSON.  Must be
+///		called on all ranks.
+///	</summary>
+void ReportMemoryUsage(const std::string & strJSONFile = "");
+
+///////////////////////////////////////////////////////////////////////////////
+
 #endif
 
@@ -129,7 +129,19 @@ struct Subscript<T, 1, NumDims>
 	>::type() const 
 	{
 		return object_(indices_);
-	} 
+	}
+
+#if defined(TEMPEST_COLUMN_LAYOUT)
+	///	<summary>
+	///		Final subscript, which is forwarded to the slice returned by the
+	///		object so that the last dimension need not be contiguous.
+	///	</summary>
+	auto operator[](size_type idx) const
+		-> decltype(object_(indices_)[idx])
+	{
+		return object_(indices_)[idx];
+	}
+#endif
 };
 
 #endif // _SUBSCRIPT_H_
@@ -0,0 +1,484 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    TaskRuntime.cpp
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "TaskRuntime.h"
+#include "Exception.h"
+
+#include <condition_variable>
+#include <memory>
+#include <thread>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Index of the calling thread within the task runtime.
+///	</summary>
+static thread_local int s_iThreadIndex = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A pool of worker threads, each with its own queue of ready tasks.
+///		Workers take tasks from the back of their own queue and steal from
+///		the front of the queues of other workers.
+///	</summary>
+class TaskRuntime {
+
+public:
+	///	<summary>
+	///		Get the task runtime.
+	///	</summary>
+	static TaskRuntime & Get() {
+		static TaskRuntime s_runtime;
+		return s_runtime;
+	}
+
+	///	<summary>
+	///		Destructor.
+	///	</summary>
+	~TaskRuntime() {
+		StopWorkers();
+	}
+
+public:
+	///	<summary>
+	///		Set the number of threads, including the calling thread.
+	///	</summary>
+	void SetThreadCount(int nThreads);
+
+	///	<summary>
+	///		Get the number of threads.
+	///	</summary>
+	int GetThreadCount() const {
+		return static_cast<int>(m_vecQueues.size());
+	}
+
+	///	<summary>
+	///		Submit a ready task to the queue of the calling thread.
+	///	</summary>
+	void Submit(
+		TaskGraph * pGraph,
+		TaskGraph::TaskId ix
+	);
+
+	///	<summary>
+	///		Execute one ready task on the given thread, stealing from other
+	///		threads if necessary.  Returns false if no task was available.
+	///	</summary>
+	bool RunOne(int iThread);
+
+private:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	TaskRuntime() :
+		m_nQueued(0),
+		m_fShutdown(false)
+	{
+		m_vecQueues.push_back(
+			std::unique_ptr<WorkerQueue>(new WorkerQueue));
+	}
+
+	///	<summary>
+	///		Stop and join all worker threads.
+	///	</summary>
+	void StopWorkers();
+
+	///	<summary>
+	///		Main loop of each worker thread.
+	///	</summary>
+	void WorkerLoop(int iThread);
+
+private:
+	///	<summary>
+	///		A reference to a task in a TaskGraph.
+	///	</summary>
+	typedef std::pair<TaskGraph *, TaskGraph::TaskId> TaskRef;
+
+	///	<summary>
+	///		Queue of ready tasks owned by one thread.
+	///	</summary>
+	struct WorkerQueue {
+		std::mutex mutex;
+		std::deque<TaskRef> deque;
+	};
+
+	///	<summary>
+	///		Task queues, one per thread.
+	///	</summary>
+	std::vector< std::unique_ptr<WorkerQueue> > m_vecQueues;
+
+	///	<summary>
+	///		Worker threads (thread 0 is the calling thread).
+	///	</summary>
+	std::vector<std::thread> m_vecThreads;
+
+	///	<summary>
+	///		Number of tasks in all queues.
+	///	</summary>
+	std::atomic<int> m_nQueued;
+
+	///	<summary>
+	///		Mutex and condition variable used by idle workers.
+	///	</summary>
+	std::mutex m_mutexSleep;
+	std::condition_variable m_cvSleep;
+
+	///	<summary>
+	///		Flag indicating that worker threads should exit.
+	///	</summary>
+	bool m_fShutdown;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TaskRuntime::SetThreadCount(
+	int nThreads
+) {
+	if (nThreads < 1) {
+		_EXCEPTION1("Invalid thread count (%i)", nThreads);
+	}
+	if (nThreads == GetThreadCount()) {
+		return;
+	}
+
+	StopWorkers();
+
+	m_vecQueues.clear();
+	for (int t = 0; t < nThreads; t++) {
+		m_vecQueues.push_back(
+			std::unique_ptr<WorkerQueue>(new WorkerQueue));
+	}
+
+	m_fShutdown = false;
+	for (int t = 1; t < nThreads; t++) {
+		m_vecThreads.push_back(
+			std::thread(&TaskRuntime::WorkerLoop, this, t));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TaskRuntime::StopWorkers() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutexSleep);
+		m_fShutdown = true;
+	}
+	m_cvSleep.notify_all();
+
+	for (int t = 0; t < m_vecThreads.size(); t++) {
+		m_vecThreads[t].join();
+	}
+	m_vecThreads.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TaskRuntime::WorkerLoop(
+	int iThread
+) {
+	s_iThreadIndex = iThread;
+
+	for (;;) {
+		if (RunOne(iThread)) {
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_mutexSleep);
+		m_cvSleep.wait(lock, [this]() {
+			return (m_fShutdown || (m_nQueued.load() > 0));
+		});
+		if (m_fShutdown) {
+			return;
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TaskRuntime::Submit(
+	TaskGraph * pGraph,
+	TaskGraph::TaskId ix
+) {
+	int iThread = s_iThreadIndex;
+	if (iThread >= GetThreadCount()) {
+		iThread = 0;
+	}
+
+	{
+		WorkerQueue & queue = *(m_vecQueues[iThread]);
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.deque.push_back(TaskRef(pGraph, ix));
+	}
+	m_nQueued++;
+
+	// Wake an idle worker
+	if (m_vecThreads.size() != 0) {
+		{
+			std::lock_guard<std::mutex> lock(m_mutexSleep);
+		}
+		m_cvSleep.notify_one();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool TaskRuntime::RunOne(
+	int iThread
+) {
+	const int nThreads = GetThreadCount();
+	if (iThread >= nThreads) {
+		iThread = 0;
+	}
+
+	TaskRef ref(NULL, 0);
+
+	// Take the most recently submitted task from this thread's queue
+	{
+		WorkerQueue & queue = *(m_vecQueues[iThread]);
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.deque.size() != 0) {
+			ref = queue.deque.back();
+			queue.deque.pop_back();
+		}
+	}
+
+	// Steal the oldest task from another thread
+	for (int k = 1; (ref.first == NULL) && (k < nThreads); k++) {
+		WorkerQueue & queue = *(m_vecQueues[(iThread + k) % nThreads]);
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.deque.size() != 0) {
+			ref = queue.deque.front();
+			queue.deque.pop_front();
+		}
+	}
+
+	if (ref.first == NULL) {
+		return false;
+	}
+
+	m_nQueued--;
+
+	ref.first->Execute(ref.second);
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// TaskGraph
+///////////////////////////////////////////////////////////////////////////////
+
+TaskGraph::TaskGraph() :
+	m_fLaunched(false),
+	m_nIncomplete(0)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////
+
+TaskGraph::~TaskGraph() {
+	if (m_fLaunched) {
+		try {
+			Wait();
+		} catch(...) {
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+TaskGraph::TaskId TaskGraph::AddTask(
+	const TaskFunction & fn
+) {
+	if (m_fLaunched) {
+		_EXCEPTIONT("Tasks cannot be added to a launched TaskGraph");
+	}
+	m_vecTasks.emplace_back(fn);
+	return static_cast<TaskId>(m_vecTasks.size() - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TaskGraph::AddDependency(
+	TaskId ixBefore,
+	TaskId ixAfter
+) {
+	if (m_fLaunched) {
+		_EXCEPTIONT("Dependencies cannot be added to a launched TaskGraph");
+	}
+	if ((ixBefore < 0) || (ixBefore >= m_vecTasks.size()) ||
+	    (ixAfter < 0) || (ixAfter >= m_vecTasks.size())
+	) {
+		_EXCEPTIONT("TaskId out of range");
+	}
+	m_vecTasks[ixBefore].vecSuccessors.push_back(ixAfter);
+	m_vecTasks[ixAfter].nPending++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TaskGraph::AddExternalDependency(
+	TaskId ix
+) {
+	if (m_fLaunched) {
+		_EXCEPTIONT("Dependencies cannot be added to a launched TaskGraph");
+	}
+	if ((ix < 0) || (ix >= m_vecTasks.size())) {
+		_EXCEPTIONT("TaskId out of range");
+	}
+	m_vecTasks[ix].nPending++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TaskGraph::Launch() {
+	if (m_fLaunched) {
+		_EXCEPTIONT("TaskGraph has already been launched");
+	}
+	m_fLaunched = true;
+	m_nIncomplete = static_cast<int>(m_vecTasks.size());
+
+	// Find ready tasks before submitting any, since a submitted task may
+	// complete and release its successors while the graph is scanned
+	std::vector<TaskId> vecReady;
+	for (int ix = 0; ix < m_vecTasks.size(); ix++) {
+		if (m_vecTasks[ix].nPending.load() == 0) {
+			vecReady.push_back(ix);
+		}
+	}
+
+	TaskRuntime & runtime = TaskRuntime::Get();
+	for (int i = 0; i < vecReady.size(); i++) {
+		runtime.Submit(this, vecReady[i]);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TaskGraph::Release(
+	TaskId ix
+) {
+	if (!m_fLaunched) {
+		_EXCEPTIONT("TaskGraph must be launched before Release");
+	}
+	if ((ix < 0) || (ix >= m_vecTasks.size())) {
+		_EXCEPTIONT("TaskId out of range");
+	}
+	Satisfy(ix);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TaskGraph::Wait() {
+	if (!m_fLaunched) {
+		_EXCEPTIONT("TaskGraph must be launched before Wait");
+	}
+
+	TaskRuntime & runtime = TaskRuntime::Get();
+	while (m_nIncomplete.load() > 0) {
+		if (!runtime.RunOne(s_iThreadIndex)) {
+			std::this_thread::yield();
+		}
+	}
+	m_fLaunched = false;
+
+	if (m_pException) {
+		std::exception_ptr pException = m_pException;
+		m_pException = std::exception_ptr();
+		std::rethrow_exception(pException);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TaskGraph::Execute(
+	TaskId ix
+) {
+	Task & task = m_vecTasks[ix];
+
+	try {
+		if (task.fn) {
+			task.fn();
+		}
+
+	} catch(...) {
+		std::lock_guard<std::mutex> lock(m_mutexException);
+		if (!m_pException) {
+			m_pException = std::current_exception();
+		}
+	}
+
+	// Successors are released even if the task failed so that the graph
+	// always runs to completion
+	for (int i = 0; i < task.vecSuccessors.size(); i++) {
+		Satisfy(task.vecSuccessors[i]);
+	}
+
+	// The graph may be destroyed as soon as this reaches zero
+	m_nIncomplete--;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TaskGraph::Satisfy(
+	TaskId ix
+) {
+	if (--(m_vecTasks[ix].nPending) == 0) {
+		TaskRuntime::Get().Submit(this, ix);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TaskRuntimeSetThreadCount(int nThreads) {
+	TaskRuntime::Get().SetThreadCount(nThreads);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int TaskRuntimeGetThreadCount() {
+	return TaskRuntime::Get().GetThreadCount();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int TaskRuntimeGetThreadIndex() {
+	return s_iThreadIndex;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TaskParallelFor(
+	int nCount,
+	const std::function<void(int)> & fn
+) {
+	if ((nCount == 1) || (TaskRuntimeGetThreadCount() == 1)) {
+		for (int i = 0; i < nCount; i++) {
+			fn(i);
+		}
+		return;
+	}
+
+	TaskGraph graph;
+	for (int i = 0; i < nCount; i++) {
+		graph.AddTask([&fn, i]() { fn(i); });
+	}
+	graph.Launch();
+	graph.Wait();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,210 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    TaskRuntime.h
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<summary>
+///		This header file provides a shared-memory task runtime built on
+///		std::thread.  Work is expressed as a graph of tasks with
+///		dependencies, executed by a pool of worker threads that each own a
+///		task queue and steal from other workers when their own queue is
+///		empty.
+///	</summary>
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _TASKRUNTIME_H_
+#define _TASKRUNTIME_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A graph of tasks.  A task becomes ready once all of the tasks it
+///		depends on have completed and all of its external dependencies
+///		have been released.  The thread that calls Wait() executes tasks
+///		alongside the worker threads until the graph is complete.
+///	</summary>
+class TaskGraph {
+
+friend class TaskRuntime;
+
+public:
+	///	<summary>
+	///		Type used to identify a task within the graph.
+	///	</summary>
+	typedef int TaskId;
+
+	///	<summary>
+	///		Type of the work performed by a task.
+	///	</summary>
+	typedef std::function<void()> TaskFunction;
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	TaskGraph();
+
+	///	<summary>
+	///		Destructor.  Waits for any launched tasks to complete.
+	///	</summary>
+	~TaskGraph();
+
+public:
+	///	<summary>
+	///		Add a task to the graph.  Tasks may only be added before
+	///		Launch() is called.
+	///	</summary>
+	TaskId AddTask(
+		const TaskFunction & fn
+	);
+
+	///	<summary>
+	///		Require that task ixBefore completes before task ixAfter begins.
+	///	</summary>
+	void AddDependency(
+		TaskId ixBefore,
+		TaskId ixAfter
+	);
+
+	///	<summary>
+	///		Add a dependency of the given task on an external event, which
+	///		is satisfied by a later call to Release().
+	///	</summary>
+	void AddExternalDependency(
+		TaskId ix
+	);
+
+	///	<summary>
+	///		Submit all ready tasks to the runtime.
+	///	</summary>
+	void Launch();
+
+	///	<summary>
+	///		Satisfy one external dependency of the given task.  May only be
+	///		called after Launch().
+	///	</summary>
+	void Release(
+		TaskId ix
+	);
+
+	///	<summary>
+	///		Execute tasks until all tasks in the graph have completed.  If
+	///		any task threw an exception the first such exception is
+	///		rethrown.
+	///	</summary>
+	void Wait();
+
+	///	<summary>
+	///		Get the number of tasks in the graph.
+	///	</summary>
+	int GetTaskCount() const {
+		return static_cast<int>(m_vecTasks.size());
+	}
+
+protected:
+	///	<summary>
+	///		Execute the given task and release its successors.
+	///	</summary>
+	void Execute(
+		TaskId ix
+	);
+
+	///	<summary>
+	///		Decrement the dependency count of a task and submit it to the
+	///		runtime once it becomes ready.
+	///	</summary>
+	void Satisfy(
+		TaskId ix
+	);
+
+private:
+	///	<summary>
+	///		A task and its outgoing dependencies.
+	///	</summary>
+	struct Task {
+		TaskFunction fn;
+		std::atomic<int> nPending;
+		std::vector<TaskId> vecSuccessors;
+
+		Task(const TaskFunction & fnTask) :
+			fn(fnTask),
+			nPending(0)
+		{ }
+	};
+
+	///	<summary>
+	///		Tasks in the graph (a deque so that tasks are never moved).
+	///	</summary>
+	std::deque<Task> m_vecTasks;
+
+	///	<summary>
+	///		Flag indicating the graph has been launched.
+	///	</summary>
+	bool m_fLaunched;
+
+	///	<summary>
+	///		Number of tasks that have not yet completed.
+	///	</summary>
+	std::atomic<int> m_nIncomplete;
+
+	///	<summary>
+	///		Mutex protecting m_pException.
+	///	</summary>
+	std::mutex m_mutexException;
+
+	///	<summary>
+	///		First exception thrown by a task.
+	///	</summary>
+	std::exception_ptr m_pException;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Set the number of threads used by the task runtime, including the
+///		calling thread.  Worker threads are started as needed.
+///	</summary>
+void TaskRuntimeSetThreadCount(int nThreads);
+
+///	<summary>
+///		Get the number of threads used by the task runtime.
+///	</summary>
+int TaskRuntimeGetThreadCount();
+
+///	<summary>
+///		Get the index of the calling thread within the task runtime.  The
+///		thread that set the thread count has index 0.
+///	</summary>
+int TaskRuntimeGetThreadIndex();
+
+///	<summary>
+///		Execute fn(i) for 0 <= i < nCount as independent tasks and wait for
+///		all of them to complete.
+///	</summary>
+void TaskParallelFor(
+	int nCount,
+	const std::function<void(int)> & fn
+);
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    ThreadTools.cpp
+///	\author  Paul Ullrich
+///	\version October 15, 2026
+///
+///	<summary>
+///		This header file provides access to the shared-memory threading
+///		runtime (the built-in task runtime when Tempest is built with
+///		PARALLEL=MPITASK, otherwise OpenMP), falling back to a single
+///		thread when neither is available.
+///	</summary>
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "ThreadTools.h"
+#include "Exception.h"
+
+#ifdef TEMPEST_TASKS
+#include "TaskRuntime.h"
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool HasThreadSupport() {
+#if defined(TEMPEST_TASKS) || defined(_OPENMP)
+	return true;
+#else
+	return false;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void SetThreadCount(int nThreads) {
+	if (nThreads < 1) {
+		_EXCEPTION1("Invalid thread count (%i)", nThreads);
+	}
+
+#ifdef TEMPEST_TASKS
+	TaskRuntimeSetThreadCount(nThreads);
+#elif defined(_OPENMP)
+	omp_set_num_threads(nThreads);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int GetMaxThreadCount() {
+#ifdef TEMPEST_TASKS
+	return TaskRuntimeGetThreadCount();
+#elif defined(_OPENMP)
+	return omp_get_max_threads();
+#else
+	return 1;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int GetThreadIndex() {
+#ifdef TEMPEST_TASKS
+	return TaskRuntimeGetThreadIndex();
+#elif defined(_OPENMP)
+	return omp_get_thread_num();
+#else
+	return 0;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ParallelExceptionGuard::Capture() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!m_pException) {
+		m_pException = std::current_exception();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ParallelExceptionGuard::Rethrow() {
+	if (m_pException) {
+		std::exception_ptr pException = m_pException;
+		m_pException = std::exception_ptr();
+		std::rethrow_exception(pException);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    ThreadTools.h
+///	\author  Paul Ullrich
+///	\version October 15, 2026
+///
+///	<summary>
+///		This header file provides access to the shared-memory threading
+///		runtime (the built-in task runtime when Tempest is built with
+///		PARALLEL=MPITASK, otherwise OpenMP), falling back to a single
+///		thread when neither is available.
+///	</summary>
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _THREADTOOLS_H_
+#define _THREADTOOLS_H_
+
+#include <exception>
+#include <mutex>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Returns true if Tempest was built with the task runtime or with
+///		OpenMP support.
+///	</summary>
+bool HasThreadSupport();
+
+///	<summary>
+///		Set the number of threads used in each parallel region.
+///	</summary>
+void SetThreadCount(int nThreads);
+
+///	<summary>
+///		Get the maximum number of threads that may be used in a parallel
+///		region.  Per-thread workspaces should be sized by this value.
+///	</summary>
+int GetMaxThreadCount();
+
+///	<summary>
+///		Get the index of the calling thread within the current parallel
+///		region or task runtime (0 outside of a parallel region).
+///	</summary>
+int GetThreadIndex();
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Holds the first exception thrown by the iterations of a parallel
+///		loop so that it can be rethrown once the loop is complete, as
+///		exceptions may not leave an OpenMP parallel region.
+///	</summary>
+class ParallelExceptionGuard {
+
+public:
+	///	<summary>
+	///		Store the exception being handled, unless one is already stored.
+	///		Must be called from within a catch block.
+	///	</summary>
+	void Capture();
+
+	///	<summary>
+	///		Rethrow the stored exception, if any.
+	///	</summary>
+	void Rethrow();
+
+private:
+	///	<summary>
+	///		Mutex guarding the stored exception.
+	///	</summary>
+	std::mutex m_mutex;
+
+	///	<summary>
+	///		First exception thrown.
+	///	</summary>
+	std::exception_ptr m_pException;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
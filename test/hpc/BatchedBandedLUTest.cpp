@@ -0,0 +1,281 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    BatchedBandedLUTest.cpp
+///	\author  Paul Ullrich
+///	\version October 15, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "CommandLine.h"
+#include "Exception.h"
+#include "LinearAlgebra.h"
+#include "BatchedBandedLU.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <ctime>
+#include <algorithm>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Fill a banded matrix in LAPACK band storage with random entries,
+///		adding dDiagonal to each diagonal entry.
+///	</summary>
+void GenerateBandedMatrix(
+	int nN,
+	int nKL,
+	int nKU,
+	double dDiagonal,
+	double * dAB
+) {
+	const int nLDAB = 2 * nKL + nKU + 1;
+	const int kv = nKL + nKU;
+
+	for (int j = 0; j < nN; j++) {
+		for (int r = 0; r < nLDAB; r++) {
+			dAB[j * nLDAB + r] = 0.0;
+		}
+		for (int i = j - nKU; i <= j + nKL; i++) {
+			if ((i < 0) || (i >= nN)) {
+				continue;
+			}
+			dAB[j * nLDAB + kv + i - j] =
+				2.0 * static_cast<double>(rand()) / RAND_MAX - 1.0;
+		}
+		dAB[j * nLDAB + kv] += dDiagonal;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Wall-clock time in seconds.
+///	</summary>
+double GetTime() {
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<double>(ts.tv_sec) + 1.0e-9 * ts.tv_nsec;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Solve a set of random banded systems with LAPACK::DGBSV on each
+///		column and with BatchedBandedLU, and compare the solutions.  If
+///		fZeroDiagonal is set the diagonal of each matrix is zeroed, so that
+///		the first step of every elimination requires a row interchange.
+///		Throws if the solutions differ by more than a relative tolerance.
+///	</summary>
+void CompareWithLAPACK(
+	const char * szName,
+	int nN,
+	int nKL,
+	int nKU,
+	int nColumns,
+	int nRepeat,
+	double dDiagonal,
+	bool fZeroDiagonal
+) {
+	const int nLDAB = 2 * nKL + nKU + 1;
+	const int nLanes = BatchedBandedLU::Lanes;
+
+	// Generate matrices and right-hand sides
+	srand(1);
+
+	DataArray2D<double> dMatrices(nColumns, nN * nLDAB);
+	DataArray2D<double> dRHS(nColumns, nN);
+
+	for (int n = 0; n < nColumns; n++) {
+		GenerateBandedMatrix(nN, nKL, nKU, dDiagonal, dMatrices[n]);
+		if (fZeroDiagonal) {
+			for (int j = 0; j < nN; j++) {
+				dMatrices[n][j * nLDAB + nKL + nKU] = 0.0;
+			}
+		}
+		for (int i = 0; i < nN; i++) {
+			dRHS[n][i] = 2.0 * static_cast<double>(rand()) / RAND_MAX - 1.0;
+		}
+	}
+
+	// Reference solution using LAPACK on each column
+	DataArray2D<double> dSolnLAPACK(nColumns, nN);
+
+	DataArray2D<double> matA(nN, nLDAB);
+	DataArray1D<double> vecB(nN);
+	DataArray1D<int> vecIPiv(nN);
+
+	long lInterchanges = 0;
+
+	double dTimeLAPACK = 0.0;
+	for (int r = 0; r < nRepeat; r++) {
+		for (int n = 0; n < nColumns; n++) {
+			memcpy(&(matA[0][0]), dMatrices[n], nN * nLDAB * sizeof(double));
+			memcpy(&(vecB[0]), dRHS[n], nN * sizeof(double));
+
+			double dStart = GetTime();
+			int iInfo = LAPACK::DGBSV(matA, vecB, vecIPiv, nKL, nKU);
+			dTimeLAPACK += GetTime() - dStart;
+
+			if (iInfo != 0) {
+				_EXCEPTION1("LAPACK solve failed: %i", iInfo);
+			}
+
+			if (r == 0) {
+				for (int i = 0; i < nN; i++) {
+					if (vecIPiv[i] != i + 1) {
+						lInterchanges++;
+					}
+				}
+			}
+
+			memcpy(dSolnLAPACK[n], &(vecB[0]), nN * sizeof(double));
+		}
+	}
+
+	// Batched solution
+	DataArray2D<double> dSolnBatched(nColumns, nN);
+
+	BatchedBandedLU lu;
+	lu.Initialize(nN, nKL, nKU);
+
+	double dTimeBatched = 0.0;
+	for (int r = 0; r < nRepeat; r++) {
+		for (int n = 0; n < nColumns; n += nLanes) {
+			double dStart = GetTime();
+			for (int w = 0; w < nLanes; w++) {
+				lu.SetMatrix(w, dMatrices[n+w]);
+				lu.SetRHS(w, dRHS[n+w]);
+			}
+
+			int iInfo = lu.Factor();
+			if (iInfo != 0) {
+				_EXCEPTION1("Batched factorization failed: %i", iInfo);
+			}
+
+			lu.Solve();
+
+			for (int w = 0; w < nLanes; w++) {
+				lu.GetSolution(w, dSolnBatched[n+w]);
+			}
+			dTimeBatched += GetTime() - dStart;
+		}
+	}
+
+	// Compare solutions
+	double dMaxRelDiff = 0.0;
+	for (int n = 0; n < nColumns; n++) {
+		double dNorm = 0.0;
+		double dDiff = 0.0;
+		for (int i = 0; i < nN; i++) {
+			dNorm = std::max(dNorm, fabs(dSolnLAPACK[n][i]));
+			dDiff = std::max(dDiff,
+				fabs(dSolnLAPACK[n][i] - dSolnBatched[n][i]));
+		}
+		dMaxRelDiff = std::max(dMaxRelDiff, dDiff / dNorm);
+	}
+
+	const double dSolves = static_cast<double>(nColumns * nRepeat);
+
+	printf("%s\n", szName);
+	printf("  Row interchanges: %li (%1.2f per column)\n",
+		lInterchanges,
+		static_cast<double>(lInterchanges) / static_cast<double>(nColumns));
+	printf("  LAPACK DGBSV:      %1.5e s per column\n",
+		dTimeLAPACK / dSolves);
+	printf("  BatchedBandedLU:   %1.5e s per column (incl. gather/scatter)\n",
+		dTimeBatched / dSolves);
+	printf("  Speedup:           %1.3f\n",
+		dTimeLAPACK / dTimeBatched);
+	printf("  Max relative diff: %1.5e\n", dMaxRelDiff);
+
+	if (dMaxRelDiff > 1.0e-10) {
+		_EXCEPTION1("%s: Batched solution does not match LAPACK", szName);
+	}
+	if (fZeroDiagonal && (lInterchanges < nColumns)) {
+		_EXCEPTION1("%s: Expected a row interchange in every column",
+			szName);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv) {
+
+try {
+	// Number of model levels
+	int nLevels;
+
+	// Number of off-diagonals
+	int nOffDiagonals;
+
+	// Number of columns
+	int nColumns;
+
+	// Number of repetitions
+	int nRepeat;
+
+	// Shift added to the diagonal (implicit column Jacobians are close
+	// to the identity, so little pivoting is required)
+	double dDiagonal;
+
+	// Parse the command line
+	BeginCommandLine()
+		CommandLineInt(nLevels, "levels", 30);
+		CommandLineInt(nOffDiagonals, "offd", 9);
+		CommandLineInt(nColumns, "columns", 4096);
+		CommandLineInt(nRepeat, "repeat", 5);
+		CommandLineDouble(dDiagonal, "diagonal", 10.0);
+
+		ParseCommandLine(argc, argv);
+	EndCommandLine(argv)
+
+	// Three implicit variables on each interface, as in VerticalDynamicsFEM
+	const int nN = 3 * (nLevels + 1);
+	const int nLanes = BatchedBandedLU::Lanes;
+
+	if (nColumns % nLanes != 0) {
+		_EXCEPTION1("--columns must be a multiple of %i", nLanes);
+	}
+
+	printf("Systems: %i x %i, KL = KU = %i, %i columns, %i lanes\n",
+		nN, nN, nOffDiagonals, nColumns, nLanes);
+
+	// Diagonally shifted systems, as for implicit column Jacobians
+	CompareWithLAPACK(
+		"Shifted diagonal",
+		nN, nOffDiagonals, nOffDiagonals,
+		nColumns, nRepeat, dDiagonal, false);
+
+	// Unshifted random systems, which require partial pivoting
+	CompareWithLAPACK(
+		"Unshifted diagonal",
+		nN, nOffDiagonals, nOffDiagonals,
+		nColumns, 1, 0.0, false);
+
+	// Systems with a zero diagonal, which force row interchanges
+	CompareWithLAPACK(
+		"Zero diagonal",
+		nN, nOffDiagonals, nOffDiagonals,
+		nColumns, 1, 0.0, true);
+
+} catch(Exception & e) {
+	std::cout << e.ToString() << std::endl;
+	return (-1);
+}
+
+	return (0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
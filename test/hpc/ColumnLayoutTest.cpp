@@ -0,0 +1,288 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    ColumnLayoutTest.cpp
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "CommandLine.h"
+#include "Exception.h"
+#include "DataArray1D.h"
+#include "DataArray2D.h"
+#include "DataArray4D.h"
+#include "GaussQuadrature.h"
+#include "GaussLobattoQuadrature.h"
+#include "PolynomialInterp.h"
+#include "LinearColumnOperatorFEM.h"
+
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <ctime>
+#include <algorithm>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Wall-clock time in seconds.
+///	</summary>
+double GetTime() {
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<double>(ts.tv_sec) + 1.0e-9 * ts.tv_nsec;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Apply a column operator to every column of every component.
+///	</summary>
+void ApplyVertical(
+	const LinearColumnDiffFEM & op,
+	const DataArray4D<double> & dataIn,
+	DataArray4D<double> & dataOut
+) {
+	for (int c = 0; c < dataIn.GetSize(0); c++) {
+	for (int i = 0; i < dataIn.GetSize(2); i++) {
+	for (int j = 0; j < dataIn.GetSize(3); j++) {
+		op.Apply(
+			&(dataIn[c][0][i][j]),
+			&(dataOut[c][0][i][j]),
+			dataIn.GetStride(1),
+			dataOut.GetStride(1));
+	}
+	}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Apply the GLL derivative in alpha and beta on every element and
+///		level, in the loop order used by HorizontalDynamicsFEM.
+///	</summary>
+void ApplyHorizontal(
+	const DataArray2D<double> & dDxBasis1D,
+	int nHorizontalOrder,
+	const DataArray4D<double> & dataIn,
+	DataArray4D<double> & dataOut
+) {
+	for (int c = 0; c < dataIn.GetSize(0); c++) {
+	for (int k = 0; k < dataIn.GetSize(1); k++) {
+	for (int a = 0; a < dataIn.GetSize(2); a += nHorizontalOrder) {
+	for (int b = 0; b < dataIn.GetSize(3); b += nHorizontalOrder) {
+		for (int i = 0; i < nHorizontalOrder; i++) {
+		for (int j = 0; j < nHorizontalOrder; j++) {
+			double dDaF = 0.0;
+			double dDbF = 0.0;
+			for (int s = 0; s < nHorizontalOrder; s++) {
+				dDaF += dDxBasis1D[s][i] * dataIn[c][k][a+s][b+j];
+				dDbF += dDxBasis1D[s][j] * dataIn[c][k][a+i][b+s];
+			}
+			dataOut[c][k][a+i][b+j] = dDaF + dDbF;
+		}
+		}
+	}
+	}
+	}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv) {
+
+try {
+	// Number of model levels
+	int nLevels;
+
+	// Vertical order
+	int nVerticalOrder;
+
+	// Horizontal order
+	int nHorizontalOrder;
+
+	// Number of elements along each side of the patch
+	int nElements;
+
+	// Number of state components
+	int nComponents;
+
+	// Number of repetitions
+	int nRepeat;
+
+	// Parse the command line
+	BeginCommandLine()
+		CommandLineInt(nLevels, "levels", 30);
+		CommandLineInt(nVerticalOrder, "vertorder", 1);
+		CommandLineInt(nHorizontalOrder, "order", 4);
+		CommandLineInt(nElements, "elements", 16);
+		CommandLineInt(nComponents, "components", 5);
+		CommandLineInt(nRepeat, "repeat", 20);
+
+		ParseCommandLine(argc, argv);
+	EndCommandLine(argv)
+
+	if (nLevels % nVerticalOrder != 0) {
+		_EXCEPTIONT("--levels must be a multiple of --vertorder");
+	}
+
+	const int nA = nElements * nHorizontalOrder;
+
+	// Vertical coordinate, as in GridGLL with uniform stretching
+	DataArray1D<double> dG;
+	DataArray1D<double> dW;
+	GaussQuadrature::GetPoints(nVerticalOrder, 0.0, 1.0, dG, dW);
+
+	DataArray1D<double> dGL;
+	DataArray1D<double> dWL;
+	GaussLobattoQuadrature::GetPoints(nVerticalOrder+1, 0.0, 1.0, dGL, dWL);
+
+	const int nFiniteElements = nLevels / nVerticalOrder;
+	const double dDeltaElement = 1.0 / static_cast<double>(nFiniteElements);
+
+	DataArray1D<double> dREtaLevels(nLevels);
+	DataArray1D<double> dREtaInterfaces(nLevels+1);
+
+	for (int k = 0; k < nLevels; k++) {
+		double dA = static_cast<double>(k / nVerticalOrder);
+		dREtaLevels[k] = (dG[k % nVerticalOrder] + dA) * dDeltaElement;
+	}
+	for (int k = 0; k <= nLevels; k++) {
+		double dA = static_cast<double>(k / nVerticalOrder);
+		dREtaInterfaces[k] = (dGL[k % nVerticalOrder] + dA) * dDeltaElement;
+	}
+
+	LinearColumnDiffFEM opDiffNodeToNode;
+	opDiffNodeToNode.InitializeInterfaceMethod(
+		LinearColumnDiffFEM::InterpSource_Levels,
+		nVerticalOrder,
+		dREtaLevels,
+		dREtaInterfaces,
+		dREtaLevels,
+		false);
+
+	// Horizontal derivative coefficients
+	DataArray1D<double> dGH;
+	DataArray1D<double> dWH;
+	GaussLobattoQuadrature::GetPoints(nHorizontalOrder, 0.0, 1.0, dGH, dWH);
+
+	DataArray2D<double> dDxBasis1D(nHorizontalOrder, nHorizontalOrder);
+	DataArray1D<double> dCoeffs(nHorizontalOrder);
+	for (int i = 0; i < nHorizontalOrder; i++) {
+		PolynomialInterp::DiffLagrangianPolynomialCoeffs(
+			nHorizontalOrder, dGH, dCoeffs, dGH[i]);
+		for (int m = 0; m < nHorizontalOrder; m++) {
+			dDxBasis1D[m][i] = dCoeffs[m];
+		}
+	}
+
+	printf("State: %i components x %i levels x %i x %i nodes\n",
+		nComponents, nLevels, nA, nA);
+
+	// Layouts available in this build
+#if defined(TEMPEST_COLUMN_LAYOUT)
+	const int nLayouts = 2;
+#else
+	const int nLayouts = 1;
+	printf("Built without LAYOUT=COLUMN; timing level layout only\n");
+#endif
+	const char * szLayoutName[2] = {"level", "column"};
+
+	double dTimeVertical[2] = {0.0, 0.0};
+	double dTimeHorizontal[2] = {0.0, 0.0};
+
+	DataArray4D<double> dataVertical[2];
+	DataArray4D<double> dataHorizontal[2];
+
+	for (int l = 0; l < nLayouts; l++) {
+		DataArray4D<double> dataIn;
+		dataIn.SetColumnLayout(l == 1);
+		dataIn.Allocate(nComponents, nLevels, nA, nA);
+
+		dataVertical[l].SetColumnLayout(l == 1);
+		dataVertical[l].Allocate(nComponents, nLevels, nA, nA);
+
+		dataHorizontal[l].SetColumnLayout(l == 1);
+		dataHorizontal[l].Allocate(nComponents, nLevels, nA, nA);
+
+		// Identical logical values in each layout
+		srand(1);
+		for (int c = 0; c < nComponents; c++) {
+		for (int k = 0; k < nLevels; k++) {
+		for (int i = 0; i < nA; i++) {
+		for (int j = 0; j < nA; j++) {
+			dataIn[c][k][i][j] =
+				2.0 * static_cast<double>(rand()) / RAND_MAX - 1.0;
+		}
+		}
+		}
+		}
+
+		for (int r = 0; r < nRepeat; r++) {
+			double dStart = GetTime();
+			ApplyVertical(opDiffNodeToNode, dataIn, dataVertical[l]);
+			dTimeVertical[l] += GetTime() - dStart;
+
+			dStart = GetTime();
+			ApplyHorizontal(
+				dDxBasis1D, nHorizontalOrder, dataIn, dataHorizontal[l]);
+			dTimeHorizontal[l] += GetTime() - dStart;
+		}
+	}
+
+	for (int l = 0; l < nLayouts; l++) {
+		printf("%-7s vertical:   %1.5e s   horizontal: %1.5e s\n",
+			szLayoutName[l],
+			dTimeVertical[l] / nRepeat,
+			dTimeHorizontal[l] / nRepeat);
+	}
+
+	if (nLayouts == 2) {
+		printf("Speedup (column / level): vertical %1.3f, horizontal %1.3f\n",
+			dTimeVertical[0] / dTimeVertical[1],
+			dTimeHorizontal[0] / dTimeHorizontal[1]);
+
+		// Both layouts must produce identical results
+		double dMaxDiff = 0.0;
+		for (int c = 0; c < nComponents; c++) {
+		for (int k = 0; k < nLevels; k++) {
+		for (int i = 0; i < nA; i++) {
+		for (int j = 0; j < nA; j++) {
+			dMaxDiff = std::max(dMaxDiff, fabs(
+				dataVertical[0][c][k][i][j] - dataVertical[1][c][k][i][j]));
+			dMaxDiff = std::max(dMaxDiff, fabs(
+				dataHorizontal[0][c][k][i][j]
+				- dataHorizontal[1][c][k][i][j]));
+		}
+		}
+		}
+		}
+
+		printf("Max difference:   %1.5e\n", dMaxDiff);
+
+		if (dMaxDiff != 0.0) {
+			_EXCEPTIONT("Column layout results differ from level layout");
+		}
+	}
+
+} catch(Exception & e) {
+	std::cout << e.ToString() << std::endl;
+	return (-1);
+}
+
+	return (0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
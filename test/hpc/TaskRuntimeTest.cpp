@@ -0,0 +1,424 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    TaskRuntimeTest.cpp
+///	\author  Paul Ullrich
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2000-2010 Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "CommandLine.h"
+#include "Exception.h"
+#include "TaskRuntime.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Sleep for the given number of microseconds, so that tasks last long
+///		enough for other threads to be scheduled on an oversubscribed node.
+///	</summary>
+void SleepMicroseconds(int nMicroseconds) {
+	std::this_thread::sleep_for(std::chrono::microseconds(nMicroseconds));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Build a random directed acyclic graph of nTasks tasks, in which
+///		each task depends on up to nMaxDependencies earlier tasks, and
+///		verify that every task runs exactly once and after all of the
+///		tasks it depends on.
+///	</summary>
+void TestDependencyOrdering(
+	int nTasks,
+	int nMaxDependencies
+) {
+	std::vector< std::pair<int, int> > vecEdges;
+
+	std::vector< std::atomic<int> > vecRunCount(nTasks);
+	std::vector<int> vecOrder(nTasks, -1);
+	std::atomic<int> nCompleted(0);
+
+	for (int i = 0; i < nTasks; i++) {
+		vecRunCount[i] = 0;
+	}
+
+	TaskGraph graph;
+	for (int i = 0; i < nTasks; i++) {
+		graph.AddTask([&, i]() {
+			vecRunCount[i]++;
+			SleepMicroseconds(rand() % 50);
+			vecOrder[i] = nCompleted++;
+		});
+	}
+	for (int i = 1; i < nTasks; i++) {
+		int nDependencies = rand() % (nMaxDependencies + 1);
+		for (int d = 0; d < nDependencies; d++) {
+			int ixBefore = rand() % i;
+			graph.AddDependency(ixBefore, i);
+			vecEdges.push_back(std::pair<int, int>(ixBefore, i));
+		}
+	}
+
+	graph.Launch();
+	graph.Wait();
+
+	for (int i = 0; i < nTasks; i++) {
+		if (vecRunCount[i] != 1) {
+			_EXCEPTION2("Task %i executed %i times", i, vecRunCount[i].load());
+		}
+	}
+	for (int e = 0; e < vecEdges.size(); e++) {
+		const int ixBefore = vecEdges[e].first;
+		const int ixAfter = vecEdges[e].second;
+		if (vecOrder[ixBefore] >= vecOrder[ixAfter]) {
+			_EXCEPTION2("Task %i completed before its dependency %i",
+				ixAfter, ixBefore);
+		}
+	}
+
+	printf("Dependency ordering: %i tasks, %i dependencies .. PASS\n",
+		nTasks, static_cast<int>(vecEdges.size()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Verify that a task with external dependencies does not run until
+///		each of them has been released, while other tasks in the graph
+///		proceed, and that its successors wait for it.
+///	</summary>
+void TestExternalDependency() {
+
+	std::atomic<bool> fIndependentRun(false);
+	std::atomic<bool> fExternalRun(false);
+	std::atomic<bool> fSuccessorRun(false);
+	std::atomic<bool> fSuccessorAfterExternal(false);
+
+	TaskGraph graph;
+
+	graph.AddTask([&]() {
+		fIndependentRun = true;
+	});
+
+	TaskGraph::TaskId ixExternal =
+		graph.AddTask([&]() {
+			fExternalRun = true;
+		});
+
+	TaskGraph::TaskId ixSuccessor =
+		graph.AddTask([&]() {
+			fSuccessorAfterExternal = fExternalRun.load();
+			fSuccessorRun = true;
+		});
+
+	graph.AddExternalDependency(ixExternal);
+	graph.AddExternalDependency(ixExternal);
+	graph.AddDependency(ixExternal, ixSuccessor);
+
+	graph.Launch();
+
+	// With worker threads, independent tasks run without any release;
+	// otherwise tasks only run within Wait()
+	bool fIndependentBeforeRelease = true;
+	if (TaskRuntimeGetThreadCount() > 1) {
+		for (int n = 0; (n < 10000) && (!fIndependentRun); n++) {
+			SleepMicroseconds(100);
+		}
+		fIndependentBeforeRelease = fIndependentRun;
+	}
+
+	SleepMicroseconds(10000);
+	bool fRunBeforeRelease = (fExternalRun || fSuccessorRun);
+
+	// One of two external dependencies released
+	graph.Release(ixExternal);
+
+	SleepMicroseconds(10000);
+	bool fRunBeforeLastRelease = (fExternalRun || fSuccessorRun);
+
+	// Release the last external dependency from another thread, as the
+	// thread receiving messages does
+	std::thread threadRelease([&]() {
+		graph.Release(ixExternal);
+	});
+	threadRelease.join();
+
+	graph.Wait();
+
+	// Checks are made once the graph is complete, so that a failure does
+	// not leave the graph waiting on a release
+	if (!fIndependentBeforeRelease) {
+		_EXCEPTIONT("Independent task did not run before Release");
+	}
+	if (fRunBeforeRelease) {
+		_EXCEPTIONT("Task ran before its external dependencies were "
+			"released");
+	}
+	if (fRunBeforeLastRelease) {
+		_EXCEPTIONT("Task ran with an external dependency outstanding");
+	}
+	if (!fIndependentRun || !fExternalRun || !fSuccessorRun) {
+		_EXCEPTIONT("Task did not run after its external dependencies "
+			"were released");
+	}
+	if (!fSuccessorAfterExternal) {
+		_EXCEPTIONT("Successor ran before task with external dependencies");
+	}
+
+	printf("External dependency / Release .. PASS\n");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Verify that tasks submitted to the queue of a single thread are
+///		stolen and executed by the other threads in the runtime.
+///	</summary>
+void TestWorkStealing(
+	int nTasks
+) {
+	const int nThreads = TaskRuntimeGetThreadCount();
+
+	if (nThreads == 1) {
+		printf("Work stealing: single thread .. SKIP\n");
+		return;
+	}
+
+	std::vector<int> vecThreadIndex(nTasks, -1);
+
+	// All ready tasks are submitted to the queue of the launching thread,
+	// so any task executed elsewhere was stolen
+	TaskGraph graph;
+	for (int i = 0; i < nTasks; i++) {
+		graph.AddTask([&, i]() {
+			vecThreadIndex[i] = TaskRuntimeGetThreadIndex();
+			SleepMicroseconds(1000);
+		});
+	}
+
+	graph.Launch();
+	graph.Wait();
+
+	// Successors released by a worker are submitted to that worker's
+	// queue and may be stolen by the launching thread as well
+	std::vector<int> vecSuccessorThreadIndex(nTasks, -1);
+
+	TaskGraph graphFanOut;
+	TaskGraph::TaskId ixRoot =
+		graphFanOut.AddTask([]() { });
+	for (int i = 0; i < nTasks; i++) {
+		TaskGraph::TaskId ix =
+			graphFanOut.AddTask([&, i]() {
+				vecSuccessorThreadIndex[i] = TaskRuntimeGetThreadIndex();
+				SleepMicroseconds(1000);
+			});
+		graphFanOut.AddDependency(ixRoot, ix);
+	}
+
+	graphFanOut.Launch();
+	graphFanOut.Wait();
+
+	std::set<int> setThreads;
+	std::set<int> setSuccessorThreads;
+	for (int i = 0; i < nTasks; i++) {
+		if ((vecThreadIndex[i] < 0) || (vecThreadIndex[i] >= nThreads)) {
+			_EXCEPTION1("Task %i did not record a valid thread index", i);
+		}
+		setThreads.insert(vecThreadIndex[i]);
+		setSuccessorThreads.insert(vecSuccessorThreadIndex[i]);
+	}
+
+	if (setThreads.size() < 2) {
+		_EXCEPTIONT("Tasks submitted to one thread were not stolen");
+	}
+	if (setSuccessorThreads.size() < 2) {
+		_EXCEPTIONT("Tasks released by one thread were not stolen");
+	}
+
+	printf("Work stealing: %i tasks on %i / %i threads, "
+		"successors on %i / %i threads .. PASS\n",
+		nTasks,
+		static_cast<int>(setThreads.size()), nThreads,
+		static_cast<int>(setSuccessorThreads.size()), nThreads);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Verify that an exception thrown by a task is rethrown by Wait()
+///		once all other tasks, including the successors of the failed task,
+///		have completed, and that the runtime remains usable afterwards.
+///	</summary>
+void TestExceptionPropagation(
+	int nTasks
+) {
+	std::atomic<int> nRun(0);
+
+	TaskGraph graph;
+
+	TaskGraph::TaskId ixThrow =
+		graph.AddTask([&]() {
+			nRun++;
+			_EXCEPTIONT("TaskRuntimeTest exception");
+		});
+
+	for (int i = 0; i < nTasks; i++) {
+		TaskGraph::TaskId ix =
+			graph.AddTask([&]() {
+				SleepMicroseconds(100);
+				nRun++;
+			});
+		if (i % 2 == 0) {
+			graph.AddDependency(ixThrow, ix);
+		}
+	}
+
+	graph.Launch();
+
+	bool fCaught = false;
+	try {
+		graph.Wait();
+
+	} catch(Exception & e) {
+		if (e.ToString().find("TaskRuntimeTest exception")
+			== std::string::npos
+		) {
+			_EXCEPTION1("Unexpected exception: %s", e.ToString().c_str());
+		}
+		fCaught = true;
+	}
+
+	if (!fCaught) {
+		_EXCEPTIONT("Exception thrown by task was not rethrown by Wait");
+	}
+	if (nRun != nTasks + 1) {
+		_EXCEPTION2("Only %i of %i tasks ran before Wait returned",
+			nRun.load(), nTasks + 1);
+	}
+
+	// The exception is only reported once, and the runtime still works
+	std::atomic<int> nRunAfter(0);
+	TaskParallelFor(nTasks, [&](int i) {
+		nRunAfter++;
+	});
+	if (nRunAfter != nTasks) {
+		_EXCEPTIONT("Runtime unusable after a task threw an exception");
+	}
+
+	printf("Exception propagation in Wait .. PASS\n");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Verify that TaskParallelFor may be called from within a task of an
+///		enclosing TaskParallelFor, and that every inner iteration runs
+///		exactly once.
+///	</summary>
+void TestNestedParallelFor(
+	int nOuter,
+	int nInner
+) {
+	std::vector< std::atomic<int> > vecRunCount(nOuter * nInner);
+	for (int i = 0; i < vecRunCount.size(); i++) {
+		vecRunCount[i] = 0;
+	}
+
+	std::atomic<int> nOuterComplete(0);
+
+	TaskParallelFor(nOuter, [&](int i) {
+		TaskParallelFor(nInner, [&, i](int j) {
+			SleepMicroseconds(rand() % 50);
+			vecRunCount[i * nInner + j]++;
+		});
+
+		// All inner iterations have completed when the inner loop returns
+		for (int j = 0; j < nInner; j++) {
+			if (vecRunCount[i * nInner + j] != 1) {
+				_EXCEPTION2("Inner iteration (%i, %i) incomplete "
+					"after nested TaskParallelFor", i, j);
+			}
+		}
+		nOuterComplete++;
+	});
+
+	if (nOuterComplete != nOuter) {
+		_EXCEPTIONT("Outer iterations incomplete after TaskParallelFor");
+	}
+	for (int i = 0; i < vecRunCount.size(); i++) {
+		if (vecRunCount[i] != 1) {
+			_EXCEPTION2("Iteration %i executed %i times",
+				i, vecRunCount[i].load());
+		}
+	}
+
+	printf("Nested TaskParallelFor: %i x %i .. PASS\n", nOuter, nInner);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv) {
+
+try {
+	// Number of threads
+	int nThreads;
+
+	// Number of tasks
+	int nTasks;
+
+	// Number of repetitions
+	int nRepeat;
+
+	// Parse the command line
+	BeginCommandLine()
+		CommandLineInt(nThreads, "threads", 4);
+		CommandLineInt(nTasks, "tasks", 200);
+		CommandLineInt(nRepeat, "repeat", 3);
+
+		ParseCommandLine(argc, argv);
+	EndCommandLine(argv)
+
+	srand(1);
+
+	TaskRuntimeSetThreadCount(nThreads);
+
+	printf("Threads: %i, tasks: %i\n", TaskRuntimeGetThreadCount(), nTasks);
+
+	for (int r = 0; r < nRepeat; r++) {
+		TestDependencyOrdering(nTasks, 4);
+		TestExternalDependency();
+		TestWorkStealing(nTasks / 4);
+		TestExceptionPropagation(nTasks);
+		TestNestedParallelFor(16, nTasks / 16);
+	}
+
+	TaskRuntimeSetThreadCount(1);
+
+} catch(Exception & e) {
+	std::cout << e.ToString() << std::endl;
+	return (-1);
+}
+
+	return (0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,101 @@
+#!/bin/bash
+# Compare BaroclinicWaveUMJSTest with column Jacobians refactored on every
+# implicit solve against a run that reuses factored column Jacobians
+# (--jacobianreuse).
+#
+# Usage: ./run_jacobianreuse.sh [path to BaroclinicWaveUMJSTest]
+#
+# The test case must already be built (default: the executable in
+# test/nonhydro_sphere of this tree).  The test fails if any of the final
+# U, Theta, W or Rho checksums differ by more than TOLERANCE (relative).
+# With a retained Jacobian the Newton step is refined to a relative
+# correction of 1e-10, and the W checksum, the most sensitive of the four,
+# then matches the refactored run to about 2e-12 after one hour.  Refining
+# only to 1e-8 moves it by about 2e-9, so 1e-10 catches a loosened
+# refinement while leaving room for roundoff.  The V checksum sums to
+# nearly zero and is not compared.
+#
+# Environment:
+#   MPIRUN     MPI launcher (default: mpirun)
+#   NP         Number of ranks (default: 6)
+#   REUSE      Maximum number of solves per factorization (default: 5)
+#   TOLERANCE  Relative tolerance (default: 1e-10)
+
+MPIRUN=${MPIRUN:-mpirun}
+NP=${NP:-6}
+REUSE=${REUSE:-5}
+TOLERANCE=${TOLERANCE:-1e-10}
+
+TESTDIR=$(cd "$(dirname "$0")" && pwd)
+BASEDIR=$(cd "$TESTDIR/../.." && pwd)
+EXEC=${1:-$BASEDIR/test/nonhydro_sphere/BaroclinicWaveUMJSTest}
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' EXIT
+
+if [ ! -x "$EXEC" ]; then
+	echo "FAIL: $EXEC not found; build test/nonhydro_sphere first"
+	exit 1
+fi
+
+# Run the short validation case with the given Jacobian reuse count and
+# write the output to $2
+run() {
+	( cd "$WORKDIR" &&
+	  $MPIRUN -np $NP "$EXEC" --output_none --timescheme strang \
+		--resolution 6 --levels 8 --dt 300s --endtime 3600s \
+		--jacobianreuse $1 ) > "$2" 2>&1
+}
+
+# Print the final checksum of variable $2 from output $1
+checksum() {
+	awk -v var="($2):" '
+		/\(Final\)/ { final = 1 }
+		final && ($1 == "..Checksum") && ($2 == var) { print $NF }
+	' "$1"
+}
+
+echo "Running with --jacobianreuse 0"
+if ! run 0 "$WORKDIR/refactor.log"; then
+	cat "$WORKDIR/refactor.log"
+	echo "FAIL: run with --jacobianreuse 0"
+	exit 1
+fi
+
+echo "Running with --jacobianreuse $REUSE"
+if ! run $REUSE "$WORKDIR/reuse.log"; then
+	cat "$WORKDIR/reuse.log"
+	echo "FAIL: run with --jacobianreuse $REUSE"
+	exit 1
+fi
+
+grep "Column Jacobian" "$WORKDIR/reuse.log"
+
+STATUS=0
+for var in U Theta W Rho; do
+	REFACTOR=$(checksum "$WORKDIR/refactor.log" $var)
+	REUSED=$(checksum "$WORKDIR/reuse.log" $var)
+
+	if [ -z "$REFACTOR" ] || [ -z "$REUSED" ]; then
+		echo "FAIL: $var checksum not found in output"
+		exit 1
+	fi
+
+	if ! awk -v var="$var" -v a="$REUSED" -v b="$REFACTOR" \
+		-v tol="$TOLERANCE" 'BEGIN {
+		diff = a - b; if (diff < 0) diff = -diff;
+		scale = (b < 0)?(-b):(b);
+		rel = (scale > 0)?(diff / scale):(diff);
+		printf("%-6s refactor %s reuse %s relative difference %1.3e\n",
+			var, b, a, rel);
+		if (rel > tol) { exit 1 }
+	}'
+	then
+		STATUS=1
+	fi
+done
+
+if [ $STATUS -ne 0 ]; then
+	echo "FAIL (tolerance $TOLERANCE)"
+	exit 1
+fi
+echo "PASS (tolerance $TOLERANCE)"
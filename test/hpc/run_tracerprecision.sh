@@ -0,0 +1,80 @@
+#!/bin/bash
+# Compare the passive tracer of BaroclinicWaveUMJSTest between a build with
+# double precision tracer storage and a build with TRACERS=SINGLE.
+#
+# Usage: ./run_tracerprecision.sh [make options, e.g. NETCDF=FALSE]
+#
+# Each precision is built in its own scratch copy of the tracked files of
+# the working tree, so the developer's build tree is left untouched.  The
+# test fails if the final RhoQ checksums differ by more than TOLERANCE
+# (relative).  Float storage rounds the tracer to about 6e-8 relative at
+# every write; 1e-6 leaves room for that rounding to accumulate over the
+# run while still catching tracers that are mishandled in the single
+# precision build.
+#
+# Environment:
+#   MPIRUN     MPI launcher (default: mpirun)
+#   NP         Number of ranks (default: 6)
+#   TOLERANCE  Relative tolerance (default: 1e-6)
+
+MPIRUN=${MPIRUN:-mpirun}
+NP=${NP:-6}
+TOLERANCE=${TOLERANCE:-1e-6}
+
+TESTDIR=$(cd "$(dirname "$0")" && pwd)
+BASEDIR=$(cd "$TESTDIR/../.." && pwd)
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' EXIT
+
+# Build BaroclinicWaveUMJSTest with the given tracer storage precision in
+# a scratch copy of the working tree at $1
+build() {
+	local SRCDIR=$1
+	shift
+	mkdir -p "$SRCDIR" &&
+	( cd "$BASEDIR" && git ls-files -z | xargs -0 cp --parents -t "$SRCDIR" ) &&
+	( cd "$SRCDIR/src/base" && make "$@" ) &&
+	( cd "$SRCDIR/src/atm" && make "$@" ) &&
+	( cd "$SRCDIR/test/nonhydro_sphere" &&
+	  make "$@" BaroclinicWaveUMJSTest )
+}
+
+# Run the short validation case and print the final RhoQ checksum
+checksum() {
+	$MPIRUN -np $NP "$1" --output_none --tracers \
+		--resolution 6 --levels 8 --dt 300s --endtime 3600s \
+		| grep "Checksum (RhoQ)" | tail -n 1 | awk '{print $NF}'
+}
+
+for precision in SINGLE DOUBLE; do
+	echo "Building with TRACERS=$precision"
+	if ! build "$WORKDIR/src_$precision" "$@" TRACERS=$precision \
+		> "$WORKDIR/build_$precision.log" 2>&1
+	then
+		cat "$WORKDIR/build_$precision.log"
+		echo "FAIL: build with TRACERS=$precision"
+		exit 1
+	fi
+	cp "$WORKDIR/src_$precision/test/nonhydro_sphere/BaroclinicWaveUMJSTest" \
+		"$WORKDIR/BaroclinicWaveUMJSTest_$precision"
+done
+
+SINGLE=$(checksum "$WORKDIR/BaroclinicWaveUMJSTest_SINGLE")
+DOUBLE=$(checksum "$WORKDIR/BaroclinicWaveUMJSTest_DOUBLE")
+
+if [ -z "$SINGLE" ] || [ -z "$DOUBLE" ]; then
+	echo "FAIL: RhoQ checksum not found in output"
+	exit 1
+fi
+
+echo "RhoQ checksum (double): $DOUBLE"
+echo "RhoQ checksum (single): $SINGLE"
+
+awk -v s="$SINGLE" -v d="$DOUBLE" -v tol="$TOLERANCE" 'BEGIN {
+	diff = s - d; if (diff < 0) diff = -diff;
+	scale = (d < 0)?(-d):(d);
+	rel = (scale > 0)?(diff / scale):(diff);
+	printf("Relative difference: %1.3e (tolerance %s)\n", rel, tol);
+	if (rel > tol) { print "FAIL"; exit 1 }
+	print "PASS"
+}'
@@ -156,7 +156,8 @@ public:
 		bool fDeepAtmosphere,
 		double dZtop,
 		PerturbationType ePerturbationType = PerturbationType_None,
-		bool fRayleighFriction = false
+		bool fRayleighFriction = false,
+		bool fTracerOn = false
 	) :
 		ParamEarthRadiusScaling(1.0),
 		ParamHeightLimit(30000.0),
@@ -175,7 +176,7 @@ public:
 
 		m_dAlpha(dAlpha),
 		m_fDeepAtmosphere(fDeepAtmosphere),
-		m_fTracerOn(false),
+		m_fTracerOn(fTracerOn),
 		m_dZtop(dZtop),
 		m_ePerturbationType(ePerturbationType),
 		m_fRayleighFriction(fRayleighFriction)
@@ -580,6 +581,11 @@ public:
 		dState[3] = 0.0;
 		dState[4] = dRho;
 
+		// Tracer density with mixing ratio decaying with latitude and height
+		if (m_fTracerOn) {
+			dTracer[0] = dRho * cos(dLat) * cos(dLat) * exp(- dZ / m_dZtop);
+		}
+
 #ifdef PERTURB_STATE
                 // machine epsilon
                 double dEps = std::numeric_limits<double>::epsilon();
@@ -643,6 +649,7 @@ try {
 		CommandLineDouble(dAlpha, "alpha", 0.0);
 		CommandLineBool(fDeepAtmosphere, "deep_atmosphere");
 		CommandLineBool(fRayleighFriction, "rayleigh");
+		CommandLineBool(fTracersOn, "tracers");
 		CommandLineStringD(strPerturbationType, "pert",
 			"None", "(None | Exp | Sfn)");
 
@@ -652,7 +659,13 @@ try {
 	// Setup the Model
 	AnnounceBanner("MODEL SETUP");
 
-	Model model(EquationSet::PrimitiveNonhydrostaticEquations);
+	EquationSet eqn(EquationSet::PrimitiveNonhydrostaticEquations);
+
+	if (fTracersOn) {
+		eqn.InsertTracer("RhoQ", "RhoQ");
+	}
+
+	Model model(eqn);
 
 	TempestSetupCubedSphereModel(model);
 
@@ -678,7 +691,8 @@ try {
 			fDeepAtmosphere,
 			dZtop,
 			ePerturbationType,
-			fRayleighFriction));
+			fRayleighFriction,
+			fTracersOn));
 
 	AnnounceEndBlock("Done");
 